@@ -0,0 +1,101 @@
+#ifndef VQRO_BASE_BITSTREAM_H
+#define VQRO_BASE_BITSTREAM_H
+
+#include <cstdint>
+#include <vector>
+
+#include "vqro/base/base.h"
+
+
+namespace vqro {
+
+
+// Bits are packed most significant first into 64-bit words.
+class BitWriter {
+ public:
+  BitWriter() = default;
+
+  void Write(uint64_t value, int nbits) {
+    if (nbits <= 0)
+      return;
+    if (nbits < 64)
+      value &= (UINT64_C(1) << nbits) - 1;
+
+    int used = bit_count % 64;
+    if (used == 0)
+      words.push_back(0);
+
+    int free_bits = 64 - used;
+    if (nbits <= free_bits) {
+      words.back() |= value << (free_bits - nbits);
+    } else {
+      int spill = nbits - free_bits;
+      words.back() |= value >> spill;
+      words.push_back(value << (64 - spill));
+    }
+    bit_count += nbits;
+  }
+
+  void WriteBit(bool bit) { Write(bit ? 1 : 0, 1); }
+
+  void Clear() {
+    words.clear();
+    bit_count = 0;
+  }
+
+  void ShrinkToFit() { words.shrink_to_fit(); }
+
+  const vector<uint64_t>& Words() const { return words; }
+  size_t BitCount() const { return bit_count; }
+  size_t CapacityBytes() const { return words.capacity() * sizeof(uint64_t); }
+
+ private:
+  vector<uint64_t> words;
+  size_t bit_count = 0;
+};
+
+
+class BitReader {
+ public:
+  BitReader(const uint64_t* w, size_t nbits) : words(w), bit_count(nbits) {}
+
+  // Reading past the end returns zeros, check Exhausted() to detect that.
+  uint64_t Read(int nbits) {
+    if (nbits <= 0)
+      return 0;
+    if (pos + nbits > bit_count) {
+      pos = bit_count + 1;
+      return 0;
+    }
+
+    size_t index = pos / 64;
+    int used = pos % 64;
+    int avail = 64 - used;
+    uint64_t result;
+
+    if (nbits <= avail) {
+      result = (words[index] << used) >> (64 - nbits);
+    } else {
+      int spill = nbits - avail;
+      uint64_t high = (words[index] << used) >> used;
+      result = (high << spill) | (words[index + 1] >> (64 - spill));
+    }
+    pos += nbits;
+    return result;
+  }
+
+  bool ReadBit() { return Read(1) != 0; }
+
+  bool Exhausted() const { return pos > bit_count; }
+  size_t Position() const { return pos; }
+
+ private:
+  const uint64_t* const words;
+  const size_t bit_count;
+  size_t pos = 0;
+};
+
+
+} // namespace vqro
+
+#endif // VQRO_BASE_BITSTREAM_H
@@ -0,0 +1,53 @@
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+
+
+TEST(BitstreamTest, RoundTripsMixedWidths) {
+  BitWriter writer;
+  writer.WriteBit(true);
+  writer.Write(0x5, 3);
+  writer.Write(UINT64_MAX, 64);  // straddles a word boundary
+  writer.Write(0, 7);
+  writer.Write(0x1234, 13);
+  writer.WriteBit(false);
+  EXPECT_EQ(writer.BitCount(), 1 + 3 + 64 + 7 + 13 + 1);
+  EXPECT_EQ(writer.Words().size(), 2);
+
+  BitReader reader(writer.Words().data(), writer.BitCount());
+  EXPECT_TRUE(reader.ReadBit());
+  EXPECT_EQ(reader.Read(3), 0x5);
+  EXPECT_EQ(reader.Read(64), UINT64_MAX);
+  EXPECT_EQ(reader.Read(7), 0);
+  EXPECT_EQ(reader.Read(13), 0x1234 & 0x1fff);
+  EXPECT_FALSE(reader.ReadBit());
+  EXPECT_FALSE(reader.Exhausted());
+}
+
+
+TEST(BitstreamTest, WriteMasksExtraBits) {
+  BitWriter writer;
+  writer.Write(0xff, 4);
+  writer.Write(0, 4);
+  BitReader reader(writer.Words().data(), writer.BitCount());
+  EXPECT_EQ(reader.Read(8), 0xf0);
+}
+
+
+TEST(BitstreamTest, ReadingPastTheEndIsDetected) {
+  BitWriter writer;
+  writer.Write(3, 2);
+  BitReader reader(writer.Words().data(), writer.BitCount());
+  EXPECT_EQ(reader.Read(2), 3);
+  EXPECT_FALSE(reader.Exhausted());
+  EXPECT_EQ(reader.Read(1), 0);
+  EXPECT_TRUE(reader.Exhausted());
+}
+
+
+}  // namespace
@@ -0,0 +1,145 @@
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+
+
+namespace vqro {
+
+
+FileCache::FileCache(size_t cap) : capacity(std::max<size_t>(cap, 1)) {}
+
+
+std::shared_ptr<FileHandle> FileCache::Open(const string& path,
+                                            off_t& size,
+                                            bool create/*=false*/,
+                                            mode_t mode/*=0644*/) {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    auto found = entries.find(path);
+    if (found != entries.end()) {
+      lru.splice(lru.begin(), lru, found->second);
+      hits++;
+      size = found->second->size;
+      return found->second->file;
+    }
+  }
+  misses++;
+
+  // We open and stat without holding the lock.
+  int flags = O_RDWR | O_CLOEXEC | (create ? O_CREAT : 0);
+  auto file = std::make_shared<FileHandle>(path, flags, mode);
+  if (file->fd == -1)
+    throw IOErrorFromErrno("FileCache open() failed path=" + path);
+
+  struct stat stats;
+  if (fstat(file->fd, &stats) == -1)
+    throw IOErrorFromErrno("FileCache fstat() failed path=" + path);
+  size = stats.st_size;
+
+  std::lock_guard<std::mutex> guard(mutex);
+  auto found = entries.find(path);
+  if (found != entries.end()) {
+    // Someone else opened it meanwhile, theirs knows about any writes since.
+    lru.splice(lru.begin(), lru, found->second);
+    size = found->second->size;
+    return found->second->file;
+  }
+
+  lru.push_front(Entry {path, file, size, nullptr});
+  entries[path] = lru.begin();
+  while (lru.size() > capacity) {
+    entries.erase(lru.back().path);
+    lru.pop_back();
+    evictions++;
+  }
+  return file;
+}
+
+
+std::shared_ptr<MappedFile> FileCache::Map(const string& path,
+                                           off_t& size,
+                                           int advice/*=MADV_NORMAL*/) {
+  // The size we know of may count writes still queued in an IoBatch, and
+  // the mapping mustn't reach past the end of the file.
+  IoBatch::DrainCurrent();
+  std::shared_ptr<FileHandle> file = Open(path, size);
+  auto map = [&] {
+    mappings++;
+    auto mapping = std::make_shared<MappedFile>(*file, size);
+    if (advice != MADV_NORMAL)
+      mapping->Advise(0, mapping->length, advice);
+    return mapping;
+  };
+
+  std::lock_guard<std::mutex> guard(mutex);
+  auto found = entries.find(path);
+  if (found == entries.end())
+    return map();  // Evicted already, so our mapping won't be cached either
+
+  Entry& entry = *found->second;
+  size = entry.size;
+  if (!entry.mapping || entry.mapping->length != static_cast<size_t>(size))
+    entry.mapping = map();
+  return entry.mapping;
+}
+
+
+void FileCache::SetSize(const string& path, off_t size) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto found = entries.find(path);
+  if (found != entries.end())
+    found->second->size = size;
+}
+
+
+void FileCache::Renamed(const string& old_path, const string& new_path) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto replaced = entries.find(new_path);
+  if (replaced != entries.end()) {
+    lru.erase(replaced->second);
+    entries.erase(replaced);
+    invalidations++;
+  }
+
+  auto found = entries.find(old_path);
+  if (found == entries.end())
+    return;
+
+  // The descriptor follows the file to its new name.
+  EntryList::iterator entry = found->second;
+  entries.erase(found);
+  entry->path = new_path;
+  entry->file->path = new_path;
+  entries[new_path] = entry;
+}
+
+
+void FileCache::Invalidate(const string& path) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto found = entries.find(path);
+  if (found == entries.end())
+    return;
+
+  lru.erase(found->second);
+  entries.erase(found);
+  invalidations++;
+}
+
+
+size_t FileCache::Size() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return lru.size();
+}
+
+
+FileCache::Stats FileCache::GetStats() const {
+  return Stats {hits, misses, evictions, invalidations, mappings};
+}
+
+
+} // namespace vqro
@@ -0,0 +1,100 @@
+#ifndef VQRO_BASE_FILE_CACHE_H
+#define VQRO_BASE_FILE_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+
+
+namespace vqro {
+
+
+// A FileCache keeps up to capacity files open, along with their sizes, so
+// repeated reads and writes of the same files don't pay for open(), close()
+// and stat() every time. When full the least recently used file is closed.
+//
+// Files are opened read/write and shared, so callers must use the offset
+// taking ReadValues(), WriteValues() and WriteVector(). Files can also be
+// read through cached mappings. A handle or mapping stays valid after its
+// file is evicted or invalidated, and is closed once the last reference to it
+// goes away.
+//
+// The cache only knows what it is told. Whoever renames or unlinks a cached
+// file must call Renamed() or Invalidate(), and whoever writes to one must
+// call SetSize().
+//
+// Thread-safe, though the intent is one cache per worker thread so the lock
+// is uncontended.
+class FileCache {
+ public:
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t invalidations;
+    uint64_t mappings;  // Times a file was mapped or remapped
+  };
+
+  explicit FileCache(size_t capacity);
+
+  FileCache(const FileCache& other) = delete;
+  FileCache& operator=(const FileCache& other) = delete;
+
+  // Returns a read/write handle for path and sets size to the file's size.
+  // If create is true a missing file is created with mode. Throws IOError if
+  // the file can't be opened.
+  std::shared_ptr<FileHandle> Open(const string& path,
+                                   off_t& size,
+                                   bool create=false,
+                                   mode_t mode=0644);
+
+  // Returns a mapping of the file at path, as big as the file was when size
+  // was last set, and sets size to that. Mappings are kept with the open file
+  // and replaced once the file grows. New mappings are madvise()d with advice.
+  // Throws IOError.
+  std::shared_ptr<MappedFile> Map(const string& path,
+                                  off_t& size,
+                                  int advice=MADV_NORMAL);
+
+  // Records that the file at path is now size bytes long.
+  void SetSize(const string& path, off_t size);
+
+  // Must be called after the file at old_path is renamed to new_path.
+  void Renamed(const string& old_path, const string& new_path);
+
+  // Must be called when the file at path is unlinked or replaced.
+  void Invalidate(const string& path);
+
+  size_t Size();
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    string path;
+    std::shared_ptr<FileHandle> file;
+    off_t size;
+    std::shared_ptr<MappedFile> mapping;
+  };
+  using EntryList = std::list<Entry>;
+
+  const size_t capacity;
+  std::mutex mutex;
+  EntryList lru;  // Most recently used first
+  std::unordered_map<string,EntryList::iterator> entries;
+
+  std::atomic<uint64_t> hits {0};
+  std::atomic<uint64_t> misses {0};
+  std::atomic<uint64_t> evictions {0};
+  std::atomic<uint64_t> invalidations {0};
+  std::atomic<uint64_t> mappings {0};
+};
+
+
+} // namespace vqro
+
+#endif // VQRO_BASE_FILE_CACHE_H
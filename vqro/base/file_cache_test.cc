@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+
+
+TEST(FileCacheTest, OpenCachesDescriptorsAndSizes) {
+  string path = GetEnvVar("TEST_TMPDIR") + "/cachefile";
+  unlink(path.c_str());
+  FileCache cache(4);
+  off_t size = -1;
+
+  EXPECT_THROW(cache.Open(path, size), IOError);
+  std::shared_ptr<FileHandle> file = cache.Open(path, size, true);
+  ASSERT_NE(file->fd, -1);
+  EXPECT_EQ(size, 0);
+
+  const char* buf = "testing123";
+  WriteValues<char>(*file, const_cast<char*>(buf), 10, size);
+  cache.SetSize(path, 10);
+
+  // The same descriptor comes back, along with the size we were told.
+  EXPECT_EQ(cache.Open(path, size)->fd, file->fd);
+  EXPECT_EQ(size, 10);
+
+  FileCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+  ASSERT_EQ(unlink(path.c_str()), 0);
+}
+
+
+TEST(FileCacheTest, EvictsLeastRecentlyUsed) {
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  FileCache cache(2);
+  off_t size;
+
+  std::shared_ptr<FileHandle> a = cache.Open(tmpdir + "/a", size, true);
+  cache.Open(tmpdir + "/b", size, true);
+  cache.Open(tmpdir + "/a", size);  // b is now least recently used
+  cache.Open(tmpdir + "/c", size, true);
+  EXPECT_EQ(cache.Size(), 2);
+  EXPECT_EQ(cache.GetStats().evictions, 1);
+
+  cache.Open(tmpdir + "/a", size);
+  EXPECT_EQ(cache.GetStats().hits, 2);
+  cache.Open(tmpdir + "/b", size);
+  EXPECT_EQ(cache.GetStats().misses, 4);
+
+  // a was evicted by b but our handle keeps its descriptor open.
+  struct stat s;
+  EXPECT_EQ(fstat(a->fd, &s), 0);
+
+  for (auto name : {"/a", "/b", "/c"})
+    ASSERT_EQ(unlink((tmpdir + name).c_str()), 0);
+}
+
+
+TEST(FileCacheTest, MapReusesMappingUntilFileGrows) {
+  string path = GetEnvVar("TEST_TMPDIR") + "/mapfile";
+  FileCache cache(4);
+  off_t size;
+
+  std::shared_ptr<FileHandle> file = cache.Open(path, size, true);
+  WriteValues<char>(*file, const_cast<char*>("abc"), 3, 0);
+  cache.SetSize(path, 3);
+
+  std::shared_ptr<MappedFile> mapping = cache.Map(path, size);
+  EXPECT_EQ(size, 3);
+  ASSERT_EQ(mapping->length, 3);
+  EXPECT_EQ(memcmp(mapping->data, "abc", 3), 0);
+  EXPECT_EQ(cache.Map(path, size), mapping);
+  EXPECT_EQ(cache.GetStats().mappings, 1);
+
+  WriteValues<char>(*file, const_cast<char*>("def"), 3, 3);
+  cache.SetSize(path, 6);
+  std::shared_ptr<MappedFile> remapped = cache.Map(path, size);
+  EXPECT_NE(remapped, mapping);
+  ASSERT_EQ(remapped->length, 6);
+  EXPECT_EQ(memcmp(remapped->data, "abcdef", 6), 0);
+  EXPECT_EQ(cache.GetStats().mappings, 2);
+
+  // The old mapping is still usable.
+  EXPECT_EQ(memcmp(mapping->data, "abc", 3), 0);
+  ASSERT_EQ(unlink(path.c_str()), 0);
+}
+
+
+TEST(FileCacheTest, RenamedAndInvalidate) {
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  string old_path = tmpdir + "/old";
+  string new_path = tmpdir + "/new";
+  FileCache cache(4);
+  off_t size;
+
+  int fd = cache.Open(old_path, size, true)->fd;
+  cache.SetSize(old_path, 42);
+  ASSERT_EQ(rename(old_path.c_str(), new_path.c_str()), 0);
+  cache.Renamed(old_path, new_path);
+
+  // The descriptor and size follow the file to its new name.
+  std::shared_ptr<FileHandle> file = cache.Open(new_path, size);
+  EXPECT_EQ(file->fd, fd);
+  EXPECT_EQ(file->path, new_path);
+  EXPECT_EQ(size, 42);
+  EXPECT_EQ(cache.GetStats().hits, 1);
+
+  cache.Invalidate(new_path);
+  EXPECT_EQ(cache.Size(), 0);
+  EXPECT_EQ(cache.GetStats().invalidations, 1);
+  EXPECT_NE(cache.Open(new_path, size)->fd, -1);
+  EXPECT_EQ(size, 0);  // The real size, since it was reopened
+  EXPECT_EQ(cache.GetStats().misses, 2);
+
+  ASSERT_EQ(unlink(new_path.c_str()), 0);
+}
+
+
+}  // namespace
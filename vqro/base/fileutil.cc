@@ -3,6 +3,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "vqro/base/base.h"
 #include "vqro/base/fileutil.h"
 
@@ -58,10 +60,62 @@ void CreateDirectory(string dir_path) {
 }
 
 
-void WriteVector(FileHandle file, Iovec* iov, size_t iov_count) {
+void SyncFile(const FileHandle& file) {
+  while (fdatasync(file.fd) == -1) {
+    if (errno != EINTR)
+      throw IOErrorFromErrno("SyncFile fdatasync() failed path=" + file.path);
+  }
+}
+
+
+void SyncDirectory(string dir_path) {
+  FileHandle dir(dir_path, O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  if (dir.fd == -1 || fsync(dir.fd) == -1)
+    throw IOErrorFromErrno("SyncDirectory fsync() failed path=" + dir_path);
+}
+
+
+void SyncFilesystem(string path) {
+  FileHandle handle(path, O_RDONLY|O_CLOEXEC);
+  if (handle.fd == -1 || syncfs(handle.fd) == -1)
+    throw IOErrorFromErrno("SyncFilesystem syncfs() failed path=" + path);
+}
+
+
+MappedFile::MappedFile(const FileHandle& file, size_t len) : length(len) {
+  if (!length)
+    return;  // mmap() refuses empty mappings
+
+  void* addr = mmap(NULL, length, PROT_READ, MAP_SHARED, file.fd, 0);
+  if (addr == MAP_FAILED)
+    throw IOErrorFromErrno("MappedFile mmap() failed path=" + file.path);
+  data = static_cast<const char*>(addr);
+}
+
+
+void MappedFile::Advise(size_t offset, size_t len, int advice) const {
+  if (offset >= length)
+    return;
+
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  size_t start = offset - offset % page_size;
+  size_t end = std::min(offset + len, length);
+  madvise(const_cast<char*>(data) + start, end - start, advice);
+}
+
+
+void WriteVector(const FileHandle& file,
+                 Iovec* iov,
+                 size_t iov_count,
+                 off_t offset/*=-1*/) {
   ssize_t written;
   while (iov_count) {
-    written = writev(file.fd, iov, iov_count);
+    if (offset < 0) {
+      written = writev(file.fd, iov, iov_count);
+    } else {
+      written = ThreadIoBackend()->Pwritev(file.fd, iov, iov_count, offset);
+      if (written > 0) offset += written;
+    }
     VLOG(2) << "writev() wrote " << written << " bytes";
 
     if (written < 0) {
@@ -84,4 +138,16 @@ void WriteVector(FileHandle file, Iovec* iov, size_t iov_count) {
 }
 
 
+void QueueWrite(const std::shared_ptr<FileHandle>& file,
+                Iovec* iov,
+                size_t iov_count,
+                off_t offset) {
+  IoBatch* batch = IoBatch::Current();
+  if (batch)
+    batch->Write(file, file->fd, iov, iov_count, offset);
+  else
+    WriteVector(*file, iov, iov_count, offset);
+}
+
+
 } // namespace vqro
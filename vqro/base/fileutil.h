@@ -3,6 +3,7 @@
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <sys/stat.h>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "vqro/base/base.h"
+#include "vqro/base/io_backend.h"
 
 
 namespace vqro {
@@ -26,7 +28,8 @@ off_t GetFileSize(string path, bool error_returns_zero=false);
 void CreateDirectory(string dir_path);
 
 
-// RAII wrapper for file descriptors
+// RAII wrapper for file descriptors. Not copyable, since copies would close
+// the descriptor out from under each other.
 class FileHandle {
  public:
   string path = "";
@@ -40,6 +43,9 @@ class FileHandle {
     fd = open(path.c_str(), flags, mode);
   }
 
+  FileHandle(const FileHandle& other) = delete;
+  FileHandle& operator=(const FileHandle& other) = delete;
+
   ~FileHandle() {
     if (fd != -1)
       close(fd);
@@ -47,6 +53,31 @@ class FileHandle {
 };
 
 
+// RAII wrapper for a read-only shared mapping of the first length bytes of
+// a file. The mapping outlives the FileHandle it was made from. Pages past
+// the end of the file must not be touched, so files must never be truncated
+// while mapped.
+class MappedFile {
+ public:
+  const char* data = nullptr;
+  size_t length = 0;
+
+  MappedFile(const FileHandle& file, size_t len);
+
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+
+  ~MappedFile() {
+    if (data != nullptr)
+      munmap(const_cast<char*>(data), length);
+  }
+
+  // madvise() the pages holding [offset, offset + len). Advice is only a
+  // hint, so failures are ignored.
+  void Advise(size_t offset, size_t len, int advice) const;
+};
+
+
 // RAII wrapper for directory streams
 class DirectoryHandle {
  public:
@@ -64,11 +95,32 @@ class DirectoryHandle {
 };
 
 
-// File I/O
-void WriteVector(FileHandle file, Iovec* iov, size_t iov_len);
+// Durability. Each throws IOError if the data can't be made durable.
+void SyncFile(const FileHandle& file);  // fdatasync() an open file
+void SyncDirectory(string dir_path);    // fsync() a directory's entries
+void SyncFilesystem(string path);       // syncfs() everything on path's filesystem
+
+
+// File I/O. Given an offset these read and write at that offset through the
+// calling thread's IoBackend, leaving the file position alone so descriptors
+// can be shared. Otherwise they use and advance the file position.
+void WriteVector(const FileHandle& file,
+                 Iovec* iov,
+                 size_t iov_len,
+                 off_t offset=-1);
+
+// Like WriteVector() at an offset, except that while the calling thread has
+// an IoBatch open the write is only queued there, along with a reference
+// keeping file open. Its errors are then reported by the batch.
+void QueueWrite(const std::shared_ptr<FileHandle>& file,
+                Iovec* iov,
+                size_t iov_len,
+                off_t offset);
 
 template <class T>
-std::unique_ptr<vector<T>> ReadValues(FileHandle file, int len) {
+std::unique_ptr<vector<T>> ReadValues(const FileHandle& file,
+                                      int len,
+                                      off_t offset=-1) {
   std::unique_ptr<vector<T>> buffer(new vector<T>(len));
   char* start = reinterpret_cast<char*>(buffer->data());
   char* end = start + len * sizeof(T);
@@ -76,7 +128,13 @@ std::unique_ptr<vector<T>> ReadValues(FileHandle file, int len) {
   int bytes_read;
 
   while (start < end) {
-    bytes_read = read(file.fd, start, end - start);
+    if (offset < 0) {
+      bytes_read = read(file.fd, start, end - start);
+    } else {
+      Iovec iov {start, static_cast<size_t>(end - start)};
+      bytes_read = ThreadIoBackend()->Preadv(file.fd, &iov, 1, offset);
+      if (bytes_read > 0) offset += bytes_read;
+    }
 
     if (bytes_read == -1) {
       if (errno == EINTR) continue;
@@ -95,13 +153,19 @@ std::unique_ptr<vector<T>> ReadValues(FileHandle file, int len) {
 
 
 template <class T>
-void WriteValues(FileHandle file, T* buffer, size_t len) {
+void WriteValues(const FileHandle& file, T* buffer, size_t len, off_t offset=-1) {
   char* ptr = reinterpret_cast<char*>(buffer);
   size_t to_write = len * sizeof(T);
   int written;
 
   while (to_write) {
-    written = write(file.fd, ptr, to_write);
+    if (offset < 0) {
+      written = write(file.fd, ptr, to_write);
+    } else {
+      Iovec iov {ptr, to_write};
+      written = ThreadIoBackend()->Pwritev(file.fd, &iov, 1, offset);
+      if (written > 0) offset += written;
+    }
 
     if (written == -1) {
       if (errno == EINTR) continue;
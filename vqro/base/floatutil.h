@@ -20,7 +20,7 @@ namespace vqro {
 static constexpr int MAX_ULPS_DIFF = 4;
 
 
-bool AlmostEquals(const double a, const double b) {
+inline bool AlmostEquals(const double a, const double b) {
   // NANs never compare equal to anything, even themselves.
   if (std::isnan(a) || std::isnan(b))
     return false;
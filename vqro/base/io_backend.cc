@@ -0,0 +1,521 @@
+#include "vqro/base/io_backend.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+
+DEFINE_string(io_backend, "sync",
+    "How worker threads do positional file I/O. 'sync' makes a syscall per "
+    "request, 'io_uring' submits batches through an io_uring per thread and "
+    "falls back to 'sync' where io_uring is unavailable.");
+DEFINE_int32(io_uring_entries, 64,
+    "Submission queue size of each thread's io_uring. Larger batches are "
+    "submitted this many requests at a time.");
+DEFINE_int32(io_batch_buffer_size, 1 << 20,
+    "Bytes of writes a thread queues in an IoBatch before submitting them. "
+    "Each thread's buffer is registered with its io_uring.");
+
+
+namespace vqro {
+
+
+// Pointing the registered files at a drain's fds costs a syscall, which only
+// pays off for drains of many writes.
+static constexpr size_t min_writes_to_register_files = 32;
+
+// Slots in each io_uring's registered file table. Drains touching more files
+// than this use plain fds.
+static constexpr size_t max_registered_files = 256;
+
+
+ssize_t IoBackend::Preadv(int fd,
+                          const struct iovec* iov,
+                          int iov_count,
+                          off_t offset) {
+  IoBatch::DrainCurrent();
+  IoRequest request(IoRequest::READ, fd, iov, iov_count, offset);
+  Submit(&request, 1);
+  if (request.result < 0) {
+    errno = -request.result;
+    return -1;
+  }
+  return request.result;
+}
+
+
+ssize_t IoBackend::Pwritev(int fd,
+                           const struct iovec* iov,
+                           int iov_count,
+                           off_t offset) {
+  IoRequest request(IoRequest::WRITE, fd, iov, iov_count, offset);
+  Submit(&request, 1);
+  if (request.result < 0) {
+    errno = -request.result;
+    return -1;
+  }
+  return request.result;
+}
+
+
+char* IoBackend::BatchBuffer(int& buffer_index) {
+  if (!batch_buffer) {
+    size_t size = std::max(FLAGS_io_batch_buffer_size, 1);
+    batch_buffer.reset(new char[size]);
+    struct iovec iov {batch_buffer.get(), size};
+    batch_buffer_index = RegisterBuffers(&iov, 1) ? 0 : -1;
+  }
+  buffer_index = batch_buffer_index;
+  return batch_buffer.get();
+}
+
+
+void SyncIoBackend::Submit(IoRequest* requests, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    IoRequest& request = requests[i];
+    do {
+      if (request.op == IoRequest::READ)
+        request.result = preadv(request.fd, request.iov, request.iov_count,
+                                request.offset);
+      else
+        request.result = pwritev(request.fd, request.iov, request.iov_count,
+                                 request.offset);
+    } while (request.result == -1 && errno == EINTR);
+
+    if (request.result == -1)
+      request.result = -errno;
+  }
+}
+
+
+UringIoBackend::UringIoBackend(unsigned entries) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  ring_fd = syscall(__NR_io_uring_setup, std::max(entries, 1u), &params);
+  if (ring_fd < 0)
+    throw IOErrorFromErrno("io_uring_setup() failed", false);
+  sq_entries = params.sq_entries;
+
+  // Older kernels map the submission and completion rings separately.
+  sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size = params.cq_off.cqes +
+                 params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap)
+    sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+
+  void* addr = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+  if (addr == MAP_FAILED) {
+    IOError error = IOErrorFromErrno(
+        "io_uring mmap() of submission ring failed");
+    Unmap();
+    throw error;
+  }
+  sq_ring = addr;
+
+  if (single_mmap) {
+    cq_ring = sq_ring;
+  } else {
+    addr = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+    if (addr == MAP_FAILED) {
+      IOError error = IOErrorFromErrno(
+          "io_uring mmap() of completion ring failed");
+      Unmap();
+      throw error;
+    }
+    cq_ring = addr;
+  }
+
+  sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  addr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+              MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+  if (addr == MAP_FAILED) {
+    IOError error = IOErrorFromErrno(
+        "io_uring mmap() of submission entries failed");
+    Unmap();
+    throw error;
+  }
+  sqes = static_cast<struct io_uring_sqe*>(addr);
+
+  char* sq = static_cast<char*>(sq_ring);
+  sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+  char* cq = static_cast<char*>(cq_ring);
+  cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+
+UringIoBackend::~UringIoBackend() {
+  Unmap();
+}
+
+
+void UringIoBackend::Unmap() {
+  if (sqes != nullptr)
+    munmap(sqes, sqes_size);
+  if (cq_ring != nullptr && cq_ring != sq_ring)
+    munmap(cq_ring, cq_ring_size);
+  if (sq_ring != nullptr)
+    munmap(sq_ring, sq_ring_size);
+  if (ring_fd != -1)
+    close(ring_fd);
+  sqes = nullptr;
+  sq_ring = cq_ring = nullptr;
+  ring_fd = -1;
+}
+
+
+// Submitted requests point the kernel at their callers' iovecs, so we never
+// return while any is in flight. Once a submit fails we stop submitting and
+// only wait out the requests the kernel already took, then fail the rest.
+void UringIoBackend::Submit(IoRequest* requests, size_t count) {
+  // We never have more requests in flight than submission entries, so the
+  // completion ring (twice as big) can't overflow.
+  size_t done = 0;
+  while (done < count) {
+    const size_t batch = std::min<size_t>(count - done, sq_entries);
+
+    // Only we move the submission tail, the kernel only reads it.
+    unsigned tail = *sq_tail;
+    for (size_t i = 0; i < batch; i++, tail++) {
+      unsigned slot = tail & *sq_mask;
+      Prepare(requests[done + i], slot);
+      sqes[slot].user_data = done + i;
+      sq_array[slot] = slot;
+    }
+    __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+    size_t unsubmitted = batch;
+    size_t completed = 0;
+    int error = 0;
+    while (completed < batch - unsubmitted || (!error && unsubmitted)) {
+      const size_t to_submit = error ? 0 : unsubmitted;
+      int submitted = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1,
+                              IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (submitted < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+          continue;
+        // Without a way to wait for them we can't tell when the kernel is
+        // done with the iovecs of requests in flight.
+        if (completed < batch - unsubmitted && to_submit == 0)
+          PLOG(FATAL) << "io_uring_enter() failed waiting on "
+                      << (batch - unsubmitted - completed) << " requests";
+        error = errno;
+        PLOG(ERROR) << "io_uring_enter() failed submitting " << unsubmitted
+                    << " requests";
+        continue;
+      }
+      unsubmitted -= std::min<size_t>(submitted, unsubmitted);
+      completed += Reap(requests);
+    }
+
+    if (error) {
+      // The kernel takes entries in order and without SQPOLL only while we
+      // are in io_uring_enter(), so we can take back the ones it didn't.
+      __atomic_store_n(sq_tail, tail - unsubmitted, __ATOMIC_RELEASE);
+      for (size_t i = done + batch - unsubmitted; i < count; i++)
+        requests[i].result = -error;
+      return;
+    }
+    done += batch;
+  }
+}
+
+
+void UringIoBackend::Prepare(IoRequest& request, size_t slot) {
+  struct io_uring_sqe& sqe = sqes[slot];
+  memset(&sqe, 0, sizeof(sqe));
+
+  if (buffers_registered && request.buffer_index >= 0 &&
+      request.iov_count == 1) {
+    sqe.opcode = (request.op == IoRequest::READ) ?
+        IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+    sqe.addr = reinterpret_cast<uint64_t>(request.iov[0].iov_base);
+    sqe.len = request.iov[0].iov_len;
+    sqe.buf_index = request.buffer_index;
+  } else {
+    sqe.opcode = (request.op == IoRequest::READ) ?
+        IORING_OP_READV : IORING_OP_WRITEV;
+    sqe.addr = reinterpret_cast<uint64_t>(request.iov);
+    sqe.len = request.iov_count;
+  }
+
+  if (files_registered && request.file_index >= 0) {
+    sqe.fd = request.file_index;
+    sqe.flags |= IOSQE_FIXED_FILE;
+  } else {
+    sqe.fd = request.fd;
+  }
+  sqe.off = request.offset;
+}
+
+
+// Records the results of whatever requests have completed, returning how
+// many did.
+size_t UringIoBackend::Reap(IoRequest* requests) {
+  unsigned head = *cq_head;
+  unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+  size_t reaped = 0;
+  for (; head != tail; head++, reaped++) {
+    const struct io_uring_cqe& cqe = cqes[head & *cq_mask];
+    requests[cqe.user_data].result = cqe.res;
+  }
+  __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+  return reaped;
+}
+
+
+// The table is registered empty once and then updated in place, which takes
+// one syscall instead of unregistering and registering it anew. Slots are
+// updated even when they already hold the same fd number, since it may have
+// been closed and reused for another file since.
+bool UringIoBackend::RegisterFiles(const int* fds, size_t count) {
+  if (count > max_registered_files)
+    return false;
+
+  if (!files_table) {
+    if (files_unsupported)
+      return false;
+    vector<int> empty(max_registered_files, -1);
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_FILES,
+                empty.data(), empty.size()) != 0) {
+      files_unsupported = true;
+      return false;
+    }
+    files_table = true;
+  }
+
+  // Slots past count are emptied so the ring doesn't hold on to files we are
+  // done with.
+  vector<int> update(fds, fds + count);
+  if (update.size() < files_in_use)
+    update.resize(files_in_use, -1);
+  files_registered = false;
+  if (!update.empty()) {
+    struct io_uring_files_update files_update;
+    memset(&files_update, 0, sizeof(files_update));
+    files_update.fds = reinterpret_cast<uint64_t>(update.data());
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_FILES_UPDATE,
+                &files_update, update.size()) !=
+        static_cast<long>(update.size())) {
+      // We no longer know what the slots hold.
+      syscall(__NR_io_uring_register, ring_fd, IORING_UNREGISTER_FILES,
+              nullptr, 0);
+      files_table = false;
+      files_in_use = 0;
+      return false;
+    }
+  }
+  files_in_use = count;
+  files_registered = count > 0;
+  return true;
+}
+
+
+bool UringIoBackend::RegisterBuffers(const struct iovec* iov, size_t count) {
+  if (buffers_registered) {
+    syscall(__NR_io_uring_register, ring_fd, IORING_UNREGISTER_BUFFERS,
+            nullptr, 0);
+    buffers_registered = false;
+  }
+  if (!count)
+    return true;
+
+  buffers_registered = syscall(__NR_io_uring_register, ring_fd,
+                               IORING_REGISTER_BUFFERS, iov, count) == 0;
+  return buffers_registered;
+}
+
+
+static thread_local IoBatch* current_batch = nullptr;
+
+
+IoBatch::IoBatch() : backend(ThreadIoBackend()) {
+  if (current_batch)
+    throw std::logic_error("IoBatch already open on this thread");
+  buffer = backend->BatchBuffer(buffer_index);
+  current_batch = this;
+}
+
+
+IoBatch::~IoBatch() {
+  Drain();
+  current_batch = nullptr;
+}
+
+
+IoBatch* IoBatch::Current() {
+  return current_batch;
+}
+
+
+void IoBatch::DrainCurrent() {
+  if (current_batch)
+    current_batch->Drain();
+}
+
+
+void IoBatch::Write(std::shared_ptr<void> keep_alive,
+                    int fd,
+                    const struct iovec* iov,
+                    size_t iov_count,
+                    off_t offset) {
+  if (errors.count(current_owner))
+    return;  // The owner stopped at its first failure
+
+  size_t len = 0;
+  for (size_t i = 0; i < iov_count; i++)
+    len += iov[i].iov_len;
+
+  const size_t buffer_size = std::max(FLAGS_io_batch_buffer_size, 1);
+  if (len <= buffer_size && buffer_used + len > buffer_size)
+    Drain();
+
+  queued.emplace_back();
+  QueuedWrite& write = queued.back();
+  write.owner = current_owner;
+  write.fd = fd;
+  write.offset = offset;
+  write.len = len;
+  write.keep_alive = std::move(keep_alive);
+
+  char* data;
+  if (len <= buffer_size) {
+    data = buffer + buffer_used;
+    buffer_used += len;
+    write.buffer_index = buffer_index;
+  } else {
+    write.heap.reset(new char[len]);
+    data = write.heap.get();
+    write.buffer_index = -1;
+  }
+  write.data = data;
+  for (size_t i = 0; i < iov_count; i++) {
+    memcpy(data, iov[i].iov_base, iov[i].iov_len);
+    data += iov[i].iov_len;
+  }
+}
+
+
+void IoBatch::Drain() {
+  if (queued.empty())
+    return;
+
+  // Each round submits the next write of every owner still going, so an
+  // owner's writes land in order and none follow a failed one.
+  std::map<size_t,vector<QueuedWrite*>> by_owner;
+  for (QueuedWrite& write : queued)
+    by_owner[write.owner].push_back(&write);
+
+  std::map<int,int> file_indexes;
+  if (queued.size() >= min_writes_to_register_files) {
+    vector<int> fds;
+    for (QueuedWrite& write : queued) {
+      if (file_indexes.emplace(write.fd, fds.size()).second)
+        fds.push_back(write.fd);
+    }
+    if (!backend->RegisterFiles(fds.data(), fds.size()))
+      file_indexes.clear();
+  }
+
+  // Registered slots are left pointing at our files until the next drain
+  // that registers any, saving a syscall per drain.
+
+  vector<struct iovec> iovs;
+  vector<IoRequest> requests;
+  vector<QueuedWrite*> round;
+  for (size_t next = 0; ; next++) {
+    round.clear();
+    for (auto& it : by_owner) {
+      if (next < it.second.size() && !errors.count(it.first))
+        round.push_back(it.second[next]);
+    }
+    if (round.empty())
+      break;
+
+    iovs.clear();
+    requests.clear();
+    for (QueuedWrite* write : round)
+      iovs.push_back(iovec {const_cast<char*>(write->data), write->len});
+    for (size_t i = 0; i < round.size(); i++) {
+      requests.emplace_back(IoRequest::WRITE, round[i]->fd, &iovs[i], 1,
+                            round[i]->offset);
+      requests.back().buffer_index = round[i]->buffer_index;
+      auto file_index = file_indexes.find(round[i]->fd);
+      if (file_index != file_indexes.end())
+        requests.back().file_index = file_index->second;
+    }
+
+    backend->Submit(requests.data(), requests.size());
+    for (size_t i = 0; i < round.size(); i++)
+      Finish(*round[i], requests[i].result);
+  }
+
+  queued.clear();
+  buffer_used = 0;
+}
+
+
+// Records how write went given the result of submitting it, finishing a
+// short write synchronously.
+void IoBatch::Finish(QueuedWrite& write, ssize_t result) {
+  size_t done = 0;
+  while (result > 0 && (done += result) < write.len) {
+    struct iovec iov {const_cast<char*>(write.data) + done, write.len - done};
+    do {
+      result = backend->Pwritev(write.fd, &iov, 1, write.offset + done);
+    } while (result == -1 && errno == EINTR);
+    if (result == -1)
+      result = -errno;
+  }
+  if (done < write.len)
+    errors.emplace(write.owner, (result < 0) ? -result : EIO);
+}
+
+
+int IoBatch::Error(size_t owner) const {
+  auto found = errors.find(owner);
+  return (found == errors.end()) ? 0 : found->second;
+}
+
+
+std::unique_ptr<IoBackend> NewIoBackend(const string& kind) {
+  if (kind == "sync")
+    return std::unique_ptr<IoBackend>(new SyncIoBackend());
+  if (kind != "io_uring")
+    throw std::invalid_argument("Invalid io backend: " + kind);
+
+  try {
+    return std::unique_ptr<IoBackend>(
+        new UringIoBackend(FLAGS_io_uring_entries));
+  } catch (IOError& e) {
+    static std::once_flag warned;
+    std::call_once(warned, [&] {
+      LOG(WARNING) << "io_uring unavailable, using sync I/O: " << e.what();
+    });
+    return std::unique_ptr<IoBackend>(new SyncIoBackend());
+  }
+}
+
+
+IoBackend* ThreadIoBackend() {
+  thread_local std::unique_ptr<IoBackend> backend;
+  if (!backend)
+    backend = NewIoBackend(FLAGS_io_backend);
+  return backend.get();
+}
+
+
+} // namespace vqro
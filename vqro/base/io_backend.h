@@ -0,0 +1,232 @@
+#ifndef VQRO_BASE_IO_BACKEND_H
+#define VQRO_BASE_IO_BACKEND_H
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+
+
+DECLARE_string(io_backend);
+
+
+namespace vqro {
+
+
+// One positional read or write of a batch submitted to an IoBackend.
+struct IoRequest {
+  enum Op { READ, WRITE };
+
+  Op op;
+  int fd;
+  const struct iovec* iov;
+  int iov_count;
+  off_t offset;
+
+  // Backends that support it use the registered file at file_index instead
+  // of fd, and with a single iovec lying within registered buffer
+  // buffer_index skip mapping its pages for every request.
+  int file_index = -1;
+  int buffer_index = -1;
+
+  // Once submitted, the bytes transferred or -errno. Transfers may come up
+  // short just like preadv() and pwritev().
+  ssize_t result = 0;
+
+  IoRequest(Op o, int f, const struct iovec* i, int count, off_t off) :
+    op(o), fd(f), iov(i), iov_count(count), offset(off) {}
+};
+
+
+// Performs positional file I/O. A backend may only be used by one thread at
+// a time, ThreadIoBackend() gives every thread its own.
+//
+// Batches come from SegmentStore's startup scan and from IoBatch, which the
+// flush scheduler opens around the flushes of many series at once. Reads of
+// datapoint files mostly go through FileCache's mappings, and the rest go
+// through fileutil one request at a time.
+class IoBackend {
+ public:
+  virtual ~IoBackend() {}
+
+  virtual const char* Name() const = 0;
+
+  // Performs every request, in any order, and returns once all are done.
+  // Doesn't throw, requests that couldn't be performed get -errno results.
+  virtual void Submit(IoRequest* requests, size_t count) = 0;
+
+  // Registers descriptors and buffers that requests may then refer to by
+  // index, replacing any registered before. Returns false if the backend
+  // doesn't support it, in which case requests must use fds alone. Files are
+  // held until registered over, so call RegisterFiles() again before each
+  // batch, even for the same fds.
+  virtual bool RegisterFiles(const int*, size_t) { return false; }
+  virtual bool RegisterBuffers(const struct iovec*, size_t) { return false; }
+
+  // Like preadv() and pwritev(), returning -1 and setting errno on failure.
+  // Preadv() first drains the calling thread's IoBatch, if it has one.
+  ssize_t Preadv(int fd, const struct iovec* iov, int iov_count, off_t offset);
+  ssize_t Pwritev(int fd, const struct iovec* iov, int iov_count, off_t offset);
+
+  // A buffer of --io_batch_buffer_size bytes for IoBatch to copy writes into,
+  // allocated on first use. Sets buffer_index to its registered index, or -1
+  // if it couldn't be registered.
+  char* BatchBuffer(int& buffer_index);
+
+ private:
+  std::unique_ptr<char[]> batch_buffer;
+  int batch_buffer_index = -1;
+};
+
+
+// Makes a syscall per request.
+class SyncIoBackend : public IoBackend {
+ public:
+  const char* Name() const override { return "sync"; }
+  void Submit(IoRequest* requests, size_t count) override;
+};
+
+
+// Queues a whole batch on an io_uring and waits on it with one syscall.
+class UringIoBackend : public IoBackend {
+ public:
+  // Throws IOError if the kernel doesn't give us a ring.
+  explicit UringIoBackend(unsigned entries);
+  ~UringIoBackend();
+
+  UringIoBackend(const UringIoBackend& other) = delete;
+  UringIoBackend& operator=(const UringIoBackend& other) = delete;
+
+  const char* Name() const override { return "io_uring"; }
+  void Submit(IoRequest* requests, size_t count) override;
+  bool RegisterFiles(const int* fds, size_t count) override;
+  bool RegisterBuffers(const struct iovec* iov, size_t count) override;
+
+ private:
+  int ring_fd = -1;
+  unsigned sq_entries = 0;
+  bool files_table = false;        // Sparse table registered
+  bool files_unsupported = false;  // The kernel refused the table
+  size_t files_in_use = 0;         // Leading slots holding files
+  bool files_registered = false;
+  bool buffers_registered = false;
+
+  void* sq_ring = nullptr;
+  size_t sq_ring_size = 0;
+  void* cq_ring = nullptr;
+  size_t cq_ring_size = 0;
+  struct io_uring_sqe* sqes = nullptr;
+  size_t sqes_size = 0;
+
+  unsigned* sq_tail;
+  unsigned* sq_mask;
+  unsigned* sq_array;
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_mask;
+  struct io_uring_cqe* cqes;
+
+  void Unmap();
+  void Prepare(IoRequest& request, size_t index);
+  size_t Reap(IoRequest* requests);
+};
+
+
+// Queues the positional writes a thread makes through QueueWrite() while it is
+// open, and submits them together. Each write is copied into the thread
+// backend's registered batch buffer, so its iovecs may be reused right away.
+//
+// Writes are tagged with an owner, say one per series being flushed. Each
+// owner's writes land in the order they were queued, and once one fails the
+// rest of that owner's are dropped, as if each had been made synchronously
+// and the first error had stopped its owner. Writes of different owners are
+// submitted together, a round at a time.
+//
+// Queued writes are drained whenever the buffer fills up, when the thread
+// reads through Preadv() or maps a file through a FileCache, and when the
+// batch is destroyed. Failures never throw, Error() reports them per owner.
+// Until it has checked Error() the caller must assume nothing it queued was
+// written.
+//
+// One per thread at a time.
+class IoBatch {
+ public:
+  // Throws std::logic_error if the calling thread already has a batch open.
+  IoBatch();
+  ~IoBatch();
+
+  IoBatch(const IoBatch& other) = delete;
+  IoBatch& operator=(const IoBatch& other) = delete;
+
+  // The calling thread's open batch, or nullptr.
+  static IoBatch* Current();
+
+  // Drains the calling thread's open batch, if any.
+  static void DrainCurrent();
+
+  // Writes queued from now on belong to owner. The first owner is zero.
+  void SetOwner(size_t owner) { current_owner = owner; }
+
+  // Queues a write of fd. keep_alive is held until the write is done, it
+  // should keep fd open.
+  void Write(std::shared_ptr<void> keep_alive,
+             int fd,
+             const struct iovec* iov,
+             size_t iov_count,
+             off_t offset);
+
+  // Performs every queued write.
+  void Drain();
+
+  // Drops owner's queued writes and ignores any it queues later, as after a
+  // failed write. Error(owner) returns ECANCELED unless one had failed.
+  void Abandon(size_t owner) { errors.emplace(owner, ECANCELED); }
+
+  // The errno of owner's first failed write, or zero if none has failed.
+  int Error(size_t owner) const;
+
+ private:
+  struct QueuedWrite {
+    size_t owner;
+    int fd;
+    off_t offset;
+    const char* data;
+    size_t len;
+    int buffer_index;                 // Of data, -1 if not in our buffer
+    std::shared_ptr<void> keep_alive;
+    std::unique_ptr<char[]> heap;     // Holds data too big for our buffer
+  };
+
+  IoBackend* const backend;
+  char* buffer;
+  int buffer_index;
+  size_t buffer_used = 0;
+  size_t current_owner = 0;
+  vector<QueuedWrite> queued;
+  std::map<size_t,int> errors;
+
+  void Finish(QueuedWrite& write, ssize_t result);
+};
+
+
+// Returns a backend of the named kind, "sync" or "io_uring". An io_uring
+// backend falls back to a sync one if io_uring is unavailable. Throws
+// std::invalid_argument for unknown kinds.
+std::unique_ptr<IoBackend> NewIoBackend(const string& kind);
+
+// The calling thread's backend of the --io_backend kind, created on first
+// use.
+IoBackend* ThreadIoBackend();
+
+
+} // namespace vqro
+
+#endif // VQRO_BASE_IO_BACKEND_H
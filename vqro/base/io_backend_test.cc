@@ -0,0 +1,229 @@
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/base/io_backend.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+
+
+// Writes a batch of blocks to a file, reads them back in another batch and
+// checks we got out what we put in.
+void ExpectBatchesWork(IoBackend* backend, const string& name) {
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  FileHandle file(tmpdir + "/" + name, O_RDWR|O_CREAT|O_TRUNC, 0644);
+  ASSERT_NE(file.fd, -1);
+
+  const size_t blocks = 100;  // More than one submission queue's worth
+  vector<uint64_t> written(blocks * 8);
+  for (size_t i = 0; i < written.size(); i++)
+    written[i] = i * 7919;
+
+  vector<Iovec> iovs;
+  vector<IoRequest> requests;
+  for (size_t i = 0; i < blocks; i++)
+    iovs.push_back(Iovec {&written[i * 8], 8 * sizeof(uint64_t)});
+  for (size_t i = 0; i < blocks; i++)
+    requests.emplace_back(IoRequest::WRITE, file.fd, &iovs[i], 1,
+                          i * 8 * sizeof(uint64_t));
+  backend->Submit(requests.data(), requests.size());
+  for (const IoRequest& request : requests)
+    EXPECT_EQ(request.result, 8 * sizeof(uint64_t));
+  EXPECT_EQ(GetFileSize(file.path), written.size() * sizeof(uint64_t));
+
+  vector<uint64_t> read(written.size());
+  iovs.clear();
+  requests.clear();
+  for (size_t i = 0; i < blocks; i++)
+    iovs.push_back(Iovec {&read[i * 8], 8 * sizeof(uint64_t)});
+  for (size_t i = 0; i < blocks; i++)
+    requests.emplace_back(IoRequest::READ, file.fd, &iovs[i], 1,
+                          i * 8 * sizeof(uint64_t));
+  backend->Submit(requests.data(), requests.size());
+  for (const IoRequest& request : requests)
+    EXPECT_EQ(request.result, 8 * sizeof(uint64_t));
+  EXPECT_EQ(read, written);
+}
+
+
+TEST(IoBackendTest, SyncBatchesWork) {
+  SyncIoBackend backend;
+  ExpectBatchesWork(&backend, "sync");
+}
+
+
+TEST(IoBackendTest, IoUringBatchesWork) {
+  std::unique_ptr<IoBackend> backend = NewIoBackend("io_uring");
+  ExpectBatchesWork(backend.get(), "io_uring");
+}
+
+
+TEST(IoBackendTest, ErrorsAreReportedPerRequest) {
+  std::unique_ptr<IoBackend> backends[] = {
+    NewIoBackend("sync"),
+    NewIoBackend("io_uring")
+  };
+  for (auto& backend : backends) {
+    FileHandle file("/dev/null", O_RDONLY);
+    ASSERT_NE(file.fd, -1);
+    char buf[16];
+    Iovec iov {buf, sizeof(buf)};
+    IoRequest requests[] = {
+      IoRequest(IoRequest::READ, file.fd, &iov, 1, 0),
+      IoRequest(IoRequest::WRITE, file.fd, &iov, 1, 0)  // Opened read-only
+    };
+    backend->Submit(requests, 2);
+    EXPECT_EQ(requests[0].result, 0) << backend->Name();
+    EXPECT_EQ(requests[1].result, -EBADF) << backend->Name();
+
+    errno = 0;
+    EXPECT_EQ(backend->Pwritev(file.fd, &iov, 1, 0), -1);
+    EXPECT_EQ(errno, EBADF);
+  }
+}
+
+
+TEST(IoBackendTest, RegisteredFilesAndBuffersWork) {
+  std::unique_ptr<IoBackend> backend = NewIoBackend("io_uring");
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  FileHandle file(tmpdir + "/registered", O_RDWR|O_CREAT|O_TRUNC, 0644);
+  ASSERT_NE(file.fd, -1);
+
+  char buf[4096];
+  memset(buf, 'v', sizeof(buf));
+  Iovec iov {buf, sizeof(buf)};
+  // Sync backends, and kernels without registration, just use the fds.
+  bool registered = backend->RegisterFiles(&file.fd, 1) &&
+                    backend->RegisterBuffers(&iov, 1);
+  if (string(backend->Name()) == "sync") {
+    EXPECT_FALSE(registered);
+  }
+
+  IoRequest write(IoRequest::WRITE, file.fd, &iov, 1, 0);
+  write.file_index = 0;
+  write.buffer_index = 0;
+  backend->Submit(&write, 1);
+  EXPECT_EQ(write.result, sizeof(buf));
+
+  memset(buf, 0, sizeof(buf));
+  IoRequest read(IoRequest::READ, file.fd, &iov, 1, 0);
+  read.file_index = 0;
+  read.buffer_index = 0;
+  backend->Submit(&read, 1);
+  EXPECT_EQ(read.result, sizeof(buf));
+  EXPECT_EQ(buf[0], 'v');
+  EXPECT_EQ(buf[sizeof(buf) - 1], 'v');
+}
+
+
+TEST(IoBackendTest, RegisteredFilesCanBeRepointed) {
+  std::unique_ptr<IoBackend> backend = NewIoBackend("io_uring");
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  FileHandle first(tmpdir + "/repoint_first", O_RDWR|O_CREAT|O_TRUNC, 0644);
+  FileHandle second(tmpdir + "/repoint_second", O_RDWR|O_CREAT|O_TRUNC, 0644);
+  ASSERT_NE(first.fd, -1);
+  ASSERT_NE(second.fd, -1);
+
+  char buf[] = "vqro";
+  Iovec iov {buf, 4};
+  size_t offset = 0;
+  for (const FileHandle* file : {&first, &second, &first}) {
+    IoRequest write(IoRequest::WRITE, file->fd, &iov, 1, offset);
+    if (backend->RegisterFiles(&file->fd, 1))
+      write.file_index = 0;
+    backend->Submit(&write, 1);
+    EXPECT_EQ(write.result, 4);
+    offset += 4;
+  }
+  EXPECT_EQ(GetFileSize(first.path), 12);
+  EXPECT_EQ(GetFileSize(second.path), 8);
+}
+
+
+TEST(IoBackendTest, IoBatchesOfManyWritesLandInTheirFiles) {
+  // Enough files that their writes use registered files where supported,
+  // over several drains with different files each. A new thread gets a
+  // backend of its own.
+  const string io_backend = FLAGS_io_backend;
+  FLAGS_io_backend = "io_uring";
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  std::thread thread([&] {
+    for (int drain = 0; drain < 3; drain++) {
+      vector<std::shared_ptr<FileHandle>> files;
+      for (int i = 0; i < 40; i++) {
+        files.push_back(std::make_shared<FileHandle>(
+            tmpdir + "/many_" + to_string(drain) + "_" + to_string(i),
+            O_RDWR|O_CREAT|O_TRUNC, 0644));
+        ASSERT_NE(files.back()->fd, -1);
+      }
+
+      IoBatch batch;
+      for (size_t i = 0; i < files.size(); i++) {
+        string data(i + 1, 'a' + drain);
+        Iovec iov {&data[0], data.size()};
+        batch.SetOwner(i);
+        batch.Write(files[i], files[i]->fd, &iov, 1, 0);
+      }
+      batch.Drain();
+      for (size_t i = 0; i < files.size(); i++) {
+        EXPECT_EQ(batch.Error(i), 0);
+        EXPECT_EQ(GetFileSize(files[i]->path), i + 1);
+      }
+    }
+  });
+  thread.join();
+  FLAGS_io_backend = io_backend;
+}
+
+
+TEST(IoBackendTest, IoBatchWritesInOrderAndReportsErrorsPerOwner) {
+  string tmpdir = GetEnvVar("TEST_TMPDIR");
+  auto file = std::make_shared<FileHandle>(tmpdir + "/batch",
+                                           O_RDWR|O_CREAT|O_TRUNC, 0644);
+  ASSERT_NE(file->fd, -1);
+  auto read_only = std::make_shared<FileHandle>(file->path, O_RDONLY);
+  ASSERT_NE(read_only->fd, -1);
+
+  {
+    IoBatch batch;
+    EXPECT_EQ(IoBatch::Current(), &batch);
+    EXPECT_THROW(IoBatch(), std::logic_error);
+
+    // Owner 0 overwrites its own first write, which only works in order.
+    char first[] = "aaaa";
+    char second[] = "bb";
+    Iovec iov {first, 4};
+    batch.SetOwner(0);
+    batch.Write(file, file->fd, &iov, 1, 0);
+    iov = Iovec {second, 2};  // Queued data is copied
+    batch.Write(file, file->fd, &iov, 1, 0);
+
+    // Owner 1 fails, so its later write to a good fd is dropped.
+    batch.SetOwner(1);
+    batch.Write(read_only, read_only->fd, &iov, 1, 8);
+    batch.Write(file, file->fd, &iov, 1, 16);
+
+    batch.Drain();
+    EXPECT_EQ(batch.Error(0), 0);
+    EXPECT_EQ(batch.Error(1), EBADF);
+  }
+  EXPECT_EQ(IoBatch::Current(), nullptr);
+
+  EXPECT_EQ(GetFileSize(file->path), 4);
+  char buf[4];
+  Iovec iov {buf, sizeof(buf)};
+  EXPECT_EQ(ThreadIoBackend()->Preadv(file->fd, &iov, 1, 0), 4);
+  EXPECT_EQ(string(buf, 4), "bbaa");
+}
+
+
+TEST(IoBackendTest, UnknownKindsThrow) {
+  EXPECT_THROW(NewIoBackend("carrier_pigeon"), std::invalid_argument);
+}
+
+
+}  // namespace
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+
+#include "vqro/base/base.h"
+#include "vqro/base/slab_allocator.h"
+
+
+namespace vqro {
+
+
+constexpr size_t slab_size = 1 << 16;
+
+
+SlabAllocator::SlabAllocator(vector<size_t> classes, size_t max_idle) :
+    max_idle_bytes(max_idle)
+{
+  std::sort(classes.begin(), classes.end());
+  if (classes.empty())
+    throw std::invalid_argument("SlabAllocator needs at least one size class");
+
+  for (size_t size : classes) {
+    // Keep carved blocks 8-byte aligned
+    size = (size + 7) & ~static_cast<size_t>(7);
+    if (size_classes.empty() || size_classes.back().size != size)
+      size_classes.push_back(SizeClassState {size, {}});
+  }
+}
+
+
+SlabAllocator::~SlabAllocator() {
+  for (auto& size_class : size_classes)
+    if (size_class.size >= static_cast<size_t>(pagesize))
+      for (void* ptr : size_class.free_list)
+        free(ptr);
+
+  for (void* slab : slabs)
+    free(slab);
+}
+
+
+SlabAllocator::SizeClassState& SlabAllocator::ClassFor(size_t bytes) {
+  for (auto& size_class : size_classes)
+    if (size_class.size >= bytes)
+      return size_class;
+  return size_classes.back();
+}
+
+
+size_t SlabAllocator::SizeClass(size_t bytes) const {
+  for (auto& size_class : size_classes)
+    if (size_class.size >= bytes)
+      return size_class.size;
+  return size_classes.back().size;
+}
+
+
+void* SlabAllocator::Carve(size_t bytes) {
+  if (slab_pos + bytes > slab_end) {
+    void* slab = malloc(slab_size);
+    if (slab == NULL)
+      throw std::bad_alloc();
+    slabs.push_back(slab);
+    // The tail of the previous slab is lost to us, stop counting it as idle.
+    idle_bytes -= slab_end - slab_pos;
+    idle_bytes += slab_size;
+    slab_pos = static_cast<char*>(slab);
+    slab_end = slab_pos + slab_size;
+  }
+  void* ptr = slab_pos;
+  slab_pos += bytes;
+  idle_bytes -= bytes;
+  return ptr;
+}
+
+
+void* SlabAllocator::Allocate(size_t bytes) {
+  std::lock_guard<std::mutex> guard(mutex);
+  SizeClassState& size_class = ClassFor(bytes);
+  void* ptr;
+
+  if (!size_class.free_list.empty()) {
+    ptr = size_class.free_list.back();
+    size_class.free_list.pop_back();
+    idle_bytes -= size_class.size;
+    if (size_class.size >= static_cast<size_t>(pagesize))
+      idle_page_bytes -= size_class.size;
+  } else if (size_class.size < static_cast<size_t>(pagesize)) {
+    ptr = Carve(size_class.size);
+  } else {
+    ptr = aligned_alloc(pagesize, size_class.size);
+    if (ptr == NULL)
+      throw std::bad_alloc();
+  }
+
+  live_bytes += size_class.size;
+  return ptr;
+}
+
+
+void SlabAllocator::Free(void* ptr, size_t bytes) {
+  if (ptr == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> guard(mutex);
+  SizeClassState& size_class = ClassFor(bytes);
+  live_bytes -= size_class.size;
+
+  if (size_class.size >= static_cast<size_t>(pagesize) &&
+      idle_page_bytes + size_class.size > max_idle_bytes) {
+    free(ptr);
+    return;
+  }
+
+  size_class.free_list.push_back(ptr);
+  idle_bytes += size_class.size;
+  if (size_class.size >= static_cast<size_t>(pagesize))
+    idle_page_bytes += size_class.size;
+}
+
+
+size_t SlabAllocator::LiveBytes() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return live_bytes;
+}
+
+
+size_t SlabAllocator::IdleBytes() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return idle_bytes;
+}
+
+
+} // namespace vqro
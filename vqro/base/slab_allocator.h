@@ -0,0 +1,70 @@
+#ifndef VQRO_BASE_SLAB_ALLOCATOR_H
+#define VQRO_BASE_SLAB_ALLOCATOR_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "vqro/base/base.h"
+
+
+namespace vqro {
+
+
+// A SlabAllocator hands out blocks from a fixed, ascending list of size
+// classes and keeps freed blocks on per-class free lists so they can be
+// reused rather than going back to malloc.
+//
+// Classes smaller than a page are carved out of larger slabs, which keeps
+// per-block overhead near zero and lets many tiny buffers share a page.
+// Carved blocks are recycled but never returned to the system. Classes of a
+// page or more are page aligned and allocated individually; once more than
+// max_idle_bytes of them sit on free lists the surplus is freed.
+//
+// Thread-safe, though the intent is one allocator per worker thread so the
+// lock is uncontended.
+class SlabAllocator {
+ public:
+  SlabAllocator(vector<size_t> classes, size_t max_idle);
+  ~SlabAllocator();
+
+  SlabAllocator(const SlabAllocator& other) = delete;
+  SlabAllocator& operator=(const SlabAllocator& other) = delete;
+
+  // Returns the smallest size class that can hold bytes, or the largest
+  // size class if none can.
+  size_t SizeClass(size_t bytes) const;
+
+  // Allocates a block of SizeClass(bytes) bytes.
+  void* Allocate(size_t bytes);
+
+  // bytes must be the same value passed to Allocate() (or its SizeClass).
+  void Free(void* ptr, size_t bytes);
+
+  size_t LiveBytes();  // Bytes in blocks currently handed out
+  size_t IdleBytes();  // Bytes held on free lists or in uncarved slab space
+
+ private:
+  struct SizeClassState {
+    size_t size;
+    vector<void*> free_list;
+  };
+
+  const size_t max_idle_bytes;
+  std::mutex mutex;
+  vector<SizeClassState> size_classes;
+  vector<void*> slabs;
+  char* slab_pos = nullptr;
+  char* slab_end = nullptr;
+  size_t live_bytes = 0;
+  size_t idle_bytes = 0;
+  size_t idle_page_bytes = 0;
+
+  SizeClassState& ClassFor(size_t bytes);
+  void* Carve(size_t bytes);
+};
+
+
+} // namespace vqro
+
+#endif // VQRO_BASE_SLAB_ALLOCATOR_H
@@ -0,0 +1,66 @@
+#include <cstring>
+
+#include "vqro/base/base.h"
+#include "vqro/base/slab_allocator.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+
+
+TEST(SlabAllocatorTest, RoundsUpToSizeClasses) {
+  SlabAllocator alloc({96, 384, static_cast<size_t>(pagesize)}, 0);
+  EXPECT_EQ(alloc.SizeClass(1), 96);
+  EXPECT_EQ(alloc.SizeClass(96), 96);
+  EXPECT_EQ(alloc.SizeClass(97), 384);
+  EXPECT_EQ(alloc.SizeClass(pagesize), pagesize);
+  EXPECT_EQ(alloc.SizeClass(pagesize * 2), pagesize);
+}
+
+
+TEST(SlabAllocatorTest, RecyclesFreedBlocks) {
+  SlabAllocator alloc({96, static_cast<size_t>(pagesize)}, 1 << 20);
+
+  void* small = alloc.Allocate(50);
+  void* page = alloc.Allocate(pagesize);
+  ASSERT_TRUE(small != nullptr);
+  ASSERT_TRUE(page != nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(page) % pagesize, 0);
+  EXPECT_EQ(alloc.LiveBytes(), 96 + pagesize);
+  memset(small, 'x', 96);
+  memset(page, 'y', pagesize);
+
+  alloc.Free(small, 50);
+  alloc.Free(page, pagesize);
+  EXPECT_EQ(alloc.LiveBytes(), 0);
+
+  // Freed blocks come back before anything new gets allocated
+  EXPECT_EQ(alloc.Allocate(96), small);
+  EXPECT_EQ(alloc.Allocate(pagesize), page);
+}
+
+
+TEST(SlabAllocatorTest, SmallBlocksShareSlabs) {
+  SlabAllocator alloc({24}, 0);
+  char* a = static_cast<char*>(alloc.Allocate(24));
+  char* b = static_cast<char*>(alloc.Allocate(24));
+  EXPECT_EQ(b - a, 24);
+  EXPECT_EQ(alloc.LiveBytes(), 48);
+  EXPECT_GT(alloc.IdleBytes(), 0);
+}
+
+
+TEST(SlabAllocatorTest, ReleasesIdlePagesBeyondLimit) {
+  SlabAllocator alloc({static_cast<size_t>(pagesize)}, pagesize);
+  void* a = alloc.Allocate(pagesize);
+  void* b = alloc.Allocate(pagesize);
+  alloc.Free(a, pagesize);
+  alloc.Free(b, pagesize);  // exceeds max idle, goes back to the system
+  EXPECT_EQ(alloc.LiveBytes(), 0);
+  EXPECT_EQ(alloc.IdleBytes(), pagesize);
+}
+
+
+}  // namespace
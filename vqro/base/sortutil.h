@@ -0,0 +1,115 @@
+#ifndef VQRO_BASE_SORTUTIL_H
+#define VQRO_BASE_SORTUTIL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "vqro/base/base.h"
+
+
+namespace vqro {
+
+
+// Stable k-way merge of the sorted runs in src into dst, which must not
+// overlap src. run_starts holds the offset of every run after the first one,
+// in increasing order. Ties are taken from the earlier run, so the result is
+// the same as std::stable_sort would give.
+template <typename T, typename Less>
+void MergeRuns(const T* src,
+               T* dst,
+               size_t n,
+               const vector<size_t>& run_starts,
+               Less less)
+{
+  if (run_starts.empty()) {
+    std::copy(src, src + n, dst);
+    return;
+  }
+
+  if (run_starts.size() == 1) {
+    const T* middle = src + run_starts[0];
+    std::merge(src, middle, middle, src + n, dst, less);
+    return;
+  }
+
+  struct Run { const T* next; const T* end; size_t index; };
+  vector<Run> runs;
+  runs.reserve(run_starts.size() + 1);
+  size_t start = 0;
+  for (size_t i = 0; i <= run_starts.size(); i++) {
+    size_t end = (i < run_starts.size()) ? run_starts[i] : n;
+    if (end > start)
+      runs.push_back(Run{src + start, src + end, i});
+    start = end;
+  }
+
+  // std heaps are max-heaps, so "greater" puts the smallest head on top.
+  auto greater = [&less](const Run& a, const Run& b) {
+    if (less(*b.next, *a.next)) return true;
+    if (less(*a.next, *b.next)) return false;
+    return a.index > b.index;
+  };
+  std::make_heap(runs.begin(), runs.end(), greater);
+
+  while (runs.size() > 1) {
+    std::pop_heap(runs.begin(), runs.end(), greater);
+    Run& run = runs.back();
+    *dst++ = *run.next++;
+    if (run.next == run.end)
+      runs.pop_back();
+    else
+      std::push_heap(runs.begin(), runs.end(), greater);
+  }
+  std::copy(runs[0].next, runs[0].end, dst);
+}
+
+
+// Stable LSD radix sort of data by a signed 64-bit key, one byte per pass.
+// Passes where every key has the same byte are skipped, which for timestamps
+// from a single flush interval is most of them. scratch must hold n elements.
+// T must be trivially copyable. The sorted result ends up in data.
+template <typename T, typename KeyFunc>
+void RadixSortByKey(T* data, T* scratch, size_t n, KeyFunc key) {
+  if (n < 2)
+    return;
+
+  // Flipping the sign bit makes signed keys order correctly as unsigned.
+  auto ukey = [&key](const T& item) {
+    return static_cast<uint64_t>(key(item)) ^ (UINT64_C(1) << 63);
+  };
+
+  size_t counts[8][256] = {};
+  for (size_t i = 0; i < n; i++) {
+    uint64_t k = ukey(data[i]);
+    for (int b = 0; b < 8; b++)
+      counts[b][(k >> (b * 8)) & 0xff]++;
+  }
+
+  T* from = data;
+  T* to = scratch;
+  for (int b = 0; b < 8; b++) {
+    size_t* count = counts[b];
+    if (count[(ukey(data[0]) >> (b * 8)) & 0xff] == n)
+      continue;  // Every key shares this byte
+
+    size_t offset = 0;
+    for (int v = 0; v < 256; v++) {
+      size_t c = count[v];
+      count[v] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < n; i++)
+      to[count[(ukey(from[i]) >> (b * 8)) & 0xff]++] = from[i];
+    std::swap(from, to);
+  }
+
+  if (from != data)
+    std::memcpy(data, from, n * sizeof(T));
+}
+
+
+}  // namespace vqro
+
+#endif  // VQRO_BASE_SORTUTIL_H
@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <random>
+
+#include "vqro/base/base.h"
+#include "vqro/base/sortutil.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+
+
+struct Item {
+  int64_t key;
+  int order;  // Original position, to check stability
+
+  bool operator<(const Item& other) const { return key < other.key; }
+  bool operator==(const Item& other) const {
+    return key == other.key && order == other.order;
+  }
+};
+
+
+vector<Item> RandomItems(size_t n, int64_t min_key, int64_t max_key) {
+  std::mt19937_64 rng(n);
+  std::uniform_int_distribution<int64_t> dist(min_key, max_key);
+  vector<Item> items(n);
+  for (size_t i = 0; i < n; i++)
+    items[i] = Item{dist(rng), static_cast<int>(i)};
+  return items;
+}
+
+
+TEST(SortutilTest, MergeRunsIsStable) {
+  vector<Item> items;
+  vector<size_t> run_starts;
+  int order = 0;
+  for (int run = 0; run < 5; run++) {
+    if (run) run_starts.push_back(items.size());
+    for (int64_t key = run; key < 40; key += 3)
+      items.push_back(Item{key, order++});
+  }
+  items.push_back(Item{7, order++});  // a run of one
+
+  run_starts.push_back(items.size() - 1);
+  vector<Item> merged(items.size());
+  MergeRuns(items.data(), merged.data(), items.size(), run_starts,
+            std::less<Item>());
+
+  vector<Item> expected = items;
+  std::stable_sort(expected.begin(), expected.end());
+  EXPECT_EQ(merged, expected);
+}
+
+
+TEST(SortutilTest, MergeRunsHandlesOneAndTwoRuns) {
+  vector<Item> items = {{1, 0}, {3, 1}, {5, 2}, {2, 3}, {3, 4}};
+  vector<Item> merged(items.size());
+
+  MergeRuns(items.data(), merged.data(), 3, {}, std::less<Item>());
+  EXPECT_EQ(vector<Item>(merged.begin(), merged.begin() + 3),
+            vector<Item>(items.begin(), items.begin() + 3));
+
+  MergeRuns(items.data(), merged.data(), items.size(), {3}, std::less<Item>());
+  vector<Item> expected = {{1, 0}, {2, 3}, {3, 1}, {3, 4}, {5, 2}};
+  EXPECT_EQ(merged, expected);
+}
+
+
+TEST(SortutilTest, RadixSortMatchesStableSort) {
+  auto key = [](const Item& item) { return item.key; };
+  for (auto range : {std::make_pair(INT64_MIN, INT64_MAX),
+                     std::make_pair(int64_t(-1000), int64_t(1000)),
+                     std::make_pair(int64_t(1500000000), int64_t(1500000255))}) {
+    vector<Item> items = RandomItems(5000, range.first, range.second);
+    vector<Item> expected = items;
+    std::stable_sort(expected.begin(), expected.end());
+
+    vector<Item> scratch(items.size());
+    RadixSortByKey(items.data(), scratch.data(), items.size(), key);
+    EXPECT_EQ(items, expected);
+  }
+}
+
+
+TEST(SortutilTest, RadixSortSkipsConstantKeys) {
+  auto key = [](const Item& item) { return item.key; };
+  vector<Item> items = {{42, 0}, {42, 1}, {42, 2}};
+  vector<Item> scratch(items.size());
+  RadixSortByKey(items.data(), scratch.data(), items.size(), key);
+  vector<Item> expected = {{42, 0}, {42, 1}, {42, 2}};
+  EXPECT_EQ(items, expected);
+}
+
+
+}  // namespace
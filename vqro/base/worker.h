@@ -1,9 +1,11 @@
 #ifndef VQRO_WORKER_H
 #define VQRO_WORKER_H
 
+#include <chrono>
 #include <deque>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <thread>
 #include <future>
 #include <mutex>
@@ -56,24 +58,43 @@ class WorkerThread {
   bool Alive() { return alive; }
 
   std::future<void> Do(VoidFunc func) {
-    std::future<void> done;
-
-    if (static_cast<int>(tasks.size()) >= FLAGS_worker_task_queue_limit)
-      throw WorkerThreadTooBusy("WorkerThreadTooBusy:" + GetThreadId());
+    auto task = std::make_shared<std::packaged_task<void()>>(func);
+    std::future<void> done = task->get_future();
+    Post([task] { (*task)(); });
+    return done;
+  }
 
+  // Like Do() but fire-and-forget. No future is created so callers that track
+  // completion themselves (ie. from inside func) avoid the shared state
+  // allocation. Exceptions thrown by func are logged and swallowed.
+  void Post(VoidFunc func) {
     {
       std::lock_guard<std::mutex> guard(tasks_mutex);
-      tasks.emplace_back(func);
-      done = std::move(tasks.back().get_future());
+      if (static_cast<int>(tasks.size()) >= FLAGS_worker_task_queue_limit)
+        throw WorkerThreadTooBusy("WorkerThreadTooBusy:" + GetThreadId());
+
+      tasks.emplace_back(std::move(func));
     }
     tasks_available.notify_one();
-    return done;
   }
 
   size_t TasksQueued() {
     return tasks.size();
   }
 
+  // Blocks until Post() would accept another task, or timeout_ms has passed.
+  // Returns whether it would. Other threads may take the room first.
+  bool WaitForRoom(int64_t timeout_ms) {
+    std::unique_lock<std::mutex> lock(tasks_mutex);
+    return room_available.wait_for(
+        lock,
+        std::chrono::milliseconds(timeout_ms),
+        [&] {
+          return static_cast<int>(tasks.size()) <
+                 FLAGS_worker_task_queue_limit;
+        });
+  }
+
  private:
   std::thread my_thread;
   bool alive = false;
@@ -81,28 +102,32 @@ class WorkerThread {
   std::promise<void> will_start;
   std::promise<void> will_die;
 
-  std::deque<std::packaged_task<void()>> tasks;
+  std::deque<VoidFunc> tasks;
   std::mutex tasks_mutex;
   std::condition_variable tasks_available;
-  std::mutex tasks_available_mutex;
+  std::condition_variable room_available;
 
   void DoTasks() {
-    std::unique_lock<std::mutex> wait_lock(tasks_available_mutex);
-    std::packaged_task<void()> task;
+    VoidFunc task;
     VLOG(2) << "WorkerThread start";
     will_start.set_value();
 
     alive = true;
     while (keep_processing) {
-      // Wait for work to show up
-      tasks_available.wait(wait_lock, [&] { return !tasks.empty(); });
-
-      // Safely claim work from the queue
+      // Wait for work to show up and safely claim it from the queue. The wait
+      // must use tasks_mutex, otherwise a Post() landing between our empty()
+      // check and the wait would be a lost wakeup.
+      bool was_full;
       {
-        std::lock_guard<std::mutex> guard(tasks_mutex);
+        std::unique_lock<std::mutex> lock(tasks_mutex);
+        tasks_available.wait(lock, [&] { return !tasks.empty(); });
+        was_full = static_cast<int>(tasks.size()) >=
+                   FLAGS_worker_task_queue_limit;
         task = std::move(tasks.front());
         tasks.pop_front();
       }
+      if (was_full)
+        room_available.notify_all();
 
       // Do the work
       try {
@@ -111,6 +136,9 @@ class WorkerThread {
         LOG(ERROR) << "Task exception: " << e.what();
       }
 
+      // Release whatever the task captured now rather than when the next
+      // task arrives, which may be never.
+      task = nullptr;
     }
     alive = false;
     will_die.set_value();
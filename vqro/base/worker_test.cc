@@ -26,6 +26,25 @@ TEST(WorkerTest, WorkerDoesWorkAndStops) {
 }
 
 
+TEST(WorkerTest, WorkerPostsWorkInOrder) {
+  WorkerThread worker {};
+  vector<int> order;
+  std::promise<void> all_done;
+
+  worker.Start().wait();
+  for (int i = 0; i < 10; i++) {
+    worker.Post([&order, i] { order.push_back(i); });
+  }
+  worker.Post([&all_done] { all_done.set_value(); });
+  all_done.get_future().wait();
+  worker.Stop().wait();
+
+  ASSERT_EQ(order.size(), 10);
+  for (int i = 0; i < 10; i++)
+    EXPECT_EQ(order[i], i);
+}
+
+
 TEST(WorkerTest, WorkerRefusesTooMuchWork) {
   WorkerThread worker {};
   std::promise<void> will_start;
@@ -62,4 +81,37 @@ TEST(WorkerTest, WorkerRefusesTooMuchWork) {
 }
 
 
+TEST(WorkerTest, WorkerWaitsForRoom) {
+  WorkerThread worker {};
+  std::promise<void> will_start;
+  std::future<void> work_started = will_start.get_future();
+  std::promise<void> may_finish;
+  std::shared_future<void> finish = may_finish.get_future().share();
+
+  FLAGS_worker_task_queue_limit = 1;
+  worker.Start().wait();
+
+  worker.Post([&] { will_start.set_value(); finish.wait(); });
+  work_started.wait();
+  worker.Post([] {});
+  ASSERT_EQ(worker.TasksQueued(), 1);
+
+  // Full until the blocking task finishes and the queued one is taken.
+  EXPECT_FALSE(worker.WaitForRoom(10));
+
+  std::thread finisher([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    may_finish.set_value();
+  });
+  EXPECT_TRUE(worker.WaitForRoom(10000));
+  worker.Post([] {});
+
+  finisher.join();
+  ASSERT_TRUE(worker.WaitForRoom(10000));
+  worker.Do([] {}).wait();
+  worker.Stop().wait();
+  FLAGS_worker_task_queue_limit = 16;
+}
+
+
 }  // namespace
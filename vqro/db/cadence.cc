@@ -0,0 +1,136 @@
+#include <unistd.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/base/floatutil.h"
+#include "vqro/db/cadence.h"
+#include "vqro/db/datapoint_file.h"
+#include "vqro/db/dense_file.h"
+#include "vqro/db/storage_optimizer.h"
+
+
+DEFINE_bool(cadence_profiles,
+            true,
+            "Learn how regular each series is and flush regular series "
+            "straight into dense or constant files.");
+
+
+namespace vqro {
+namespace db {
+
+
+// Identifies a CadenceRecord.
+static constexpr uint64_t cadence_magic = 0x7671726f63616463;  // "vqrocadc"
+
+
+bool CadenceProfile::Regular() {
+  Load();
+  return record.regular_run >= FLAGS_min_datapoints_for_dense;
+}
+
+
+bool CadenceProfile::Constant() {
+  return Regular() &&
+         record.constant_run >= FLAGS_min_datapoints_for_constant;
+}
+
+
+int64_t CadenceProfile::Duration() {
+  Load();
+  return record.duration;
+}
+
+
+void CadenceProfile::Remove() {
+  file_cache->Invalidate(path);
+  unlink(path.c_str());
+  record = CadenceRecord {0, 0, 0, 0, 0, 0};
+  loaded = true;
+}
+
+
+void CadenceProfile::Add(const Datapoint& point) {
+  const int64_t delta = point.timestamp - record.last_timestamp;
+  const bool same_duration = point.duration > 0 &&
+                             point.duration == record.duration;
+
+  // The datapoints flushed since a regular profile was saved kept to it, or
+  // it would have been saved again, so the first we see after loading it
+  // carries on its runs however far past the saved one it lands.
+  if (resumed) {
+    resumed = false;
+    if (Regular() && same_duration && delta > 0 &&
+        delta % point.duration == 0) {
+      record.regular_run++;
+      if (Constant() && AlmostEquals(point.value, record.last_value))
+        record.constant_run++;
+      else
+        record.constant_run = 1;
+      record.last_timestamp = point.timestamp;
+      record.last_value = point.value;
+      return;
+    }
+  }
+
+  // Rewriting the last datapoint neither breaks nor extends a run.
+  if (same_duration && record.regular_run && delta == 0) {
+    if (!AlmostEquals(point.value, record.last_value))
+      record.constant_run = 1;
+    record.last_value = point.value;
+    return;
+  }
+
+  if (same_duration && record.regular_run && delta > 0 &&
+      delta % point.duration == 0 &&
+      delta / point.duration <= FLAGS_max_dense_nan_gap + 1) {
+    record.regular_run++;
+  } else {
+    record.duration = point.duration;
+    record.regular_run = point.duration > 0 ? 1 : 0;
+  }
+
+  if (record.regular_run > 1 &&
+      delta == point.duration &&
+      AlmostEquals(point.value, record.last_value))
+    record.constant_run++;
+  else
+    record.constant_run = record.regular_run ? 1 : 0;
+
+  record.last_timestamp = point.timestamp;
+  record.last_value = point.value;
+}
+
+
+void CadenceProfile::Load() {
+  if (loaded)
+    return;
+  loaded = true;
+
+  FileHandle file(path, O_RDONLY);
+  if (file.fd == -1)
+    return;  // Nothing learned yet
+
+  auto records = ReadValues<CadenceRecord>(file, 1, 0);
+  if (!records->empty() && records->front().magic == cadence_magic) {
+    record = records->front();
+    resumed = true;
+  }
+}
+
+
+// The record is overwritten in place rather than replaced. A single write
+// this small lands within one sector, so a crash leaves the old record or the
+// new one. Under a flush's IoBatch it goes out with the datapoints.
+void CadenceProfile::Save() {
+  record.magic = cadence_magic;
+  off_t size;
+  std::shared_ptr<FileHandle> file = file_cache->Open(
+      path, size, true, FLAGS_datapoint_file_mode);
+  Iovec iov {&record, sizeof(record)};
+  QueueWrite(file, &iov, 1, 0);
+  file_cache->SetSize(path, sizeof(record));
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,106 @@
+#ifndef VQRO_DB_CADENCE_H
+#define VQRO_DB_CADENCE_H
+
+#include <cstdint>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/datapoint.h"
+
+
+DECLARE_bool(cadence_profiles);
+
+
+namespace vqro {
+namespace db {
+
+
+constexpr const char* CADENCE_FILENAME = "CADENCE";
+
+
+// The contents of a CADENCE file.
+struct CadenceRecord {
+  uint64_t magic;
+  int64_t duration;       // Of the datapoints in the current regular run
+  int64_t last_timestamp;
+  double last_value;
+  int64_t regular_run;    // Datapoints in a row that a DenseFile could hold
+  int64_t constant_run;   // Datapoints in a row that a ConstantFile could hold
+};
+static_assert(sizeof(CadenceRecord) == 48,
+              "CadenceRecord must have no padding");
+
+
+// Learns how regularly a directory's datapoints arrive and how often their
+// value changes, so its flushes can go straight into a DenseFile or
+// ConstantFile rather than a SparseFile the StorageOptimizer later rewrites.
+// The profile is kept in the directory's CADENCE file, overwritten through
+// the directory's FileCache whenever a write changes the duration or whether
+// the directory is regular or constant. The datapoints flushed since kept to
+// the saved state, so a reloaded profile that was regular carries on its runs
+// from the first datapoint it sees.
+//
+// Not thread safe, used from the series' worker thread like its directory.
+class CadenceProfile {
+ public:
+  CadenceProfile(const string& dir_path, FileCache* cache) :
+    path(dir_path + "/" + CADENCE_FILENAME),
+    file_cache(cache) {}
+
+  CadenceProfile(const CadenceProfile& other) = delete;
+  CadenceProfile& operator=(const CadenceProfile& other) = delete;
+
+  // Folds the sorted datapoints of a write into the profile. Throws IOError.
+  template <typename Buffer>
+  void Observe(const Buffer& buffer);
+
+  // True once --min_datapoints_for_dense datapoints in a row were spaced
+  // Duration() apart, gaps a DenseFile would pad included.
+  bool Regular();
+
+  // True if also the last --min_datapoints_for_constant of them were
+  // contiguous and had the same value.
+  bool Constant();
+
+  int64_t Duration();
+
+  // Forgets the profile along with its file, for when the directory goes.
+  void Remove();
+
+ private:
+  const string path;
+  FileCache* const file_cache;
+  bool loaded = false;
+  bool resumed = false;  // Loaded from disk and not yet added to
+  CadenceRecord record {0, 0, 0, 0, 0, 0};
+
+  void Load();
+  void Save();
+  void Add(const Datapoint& point);
+};
+
+
+template <typename Buffer>
+void CadenceProfile::Observe(const Buffer& buffer) {
+  if (!buffer.Size())
+    return;
+
+  Load();
+  const bool regular = Regular();
+  const bool constant = Constant();
+  const int64_t duration = record.duration;
+  for (size_t i = 0; i < buffer.Size(); i++)
+    Add(buffer.At(i));
+
+  if (Regular() != regular || Constant() != constant ||
+      record.duration != duration)
+    Save();
+}
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_CADENCE_H
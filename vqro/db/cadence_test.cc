@@ -0,0 +1,146 @@
+#include <unistd.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/cadence.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/storage_optimizer.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+void Observe(CadenceProfile& profile, vector<Datapoint> points) {
+  RawBuffer buffer(points.data(), points.size());
+  profile.Observe(buffer);
+}
+
+
+// The record on disk, or an empty one if there is none.
+CadenceRecord ReadRecord(const string& dir) {
+  FileHandle file(dir + "/" + CADENCE_FILENAME, O_RDONLY);
+  if (file.fd == -1)
+    return CadenceRecord {0, 0, 0, 0, 0, 0};
+  return ReadValues<CadenceRecord>(file, 1, 0)->front();
+}
+
+
+class CadenceProfileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_min_datapoints_for_dense = 4;
+    FLAGS_min_datapoints_for_constant = 3;
+    dir = MakeTestDirForTest();
+  }
+
+  void TearDown() override {
+    FLAGS_min_datapoints_for_dense = min_datapoints_for_dense;
+    FLAGS_min_datapoints_for_constant = min_datapoints_for_constant;
+  }
+
+  const int32_t min_datapoints_for_dense = FLAGS_min_datapoints_for_dense;
+  const int32_t min_datapoints_for_constant =
+      FLAGS_min_datapoints_for_constant;
+
+  string dir;
+  FileCache file_cache {16};
+};
+
+
+TEST_F(CadenceProfileTest, LearnsRegularAndConstantRuns) {
+  CadenceProfile profile(dir, &file_cache);
+  Observe(profile, {Datapoint(100, 1, 10), Datapoint(110, 1, 10),
+                    Datapoint(120, 1, 10)});
+  EXPECT_FALSE(profile.Regular());
+  EXPECT_FALSE(profile.Constant());
+
+  // Rewriting the last datapoint doesn't count towards the run.
+  Observe(profile, {Datapoint(120, 1, 10)});
+  EXPECT_FALSE(profile.Regular());
+
+  Observe(profile, {Datapoint(130, 1, 10)});
+  EXPECT_TRUE(profile.Regular());
+  EXPECT_TRUE(profile.Constant());
+  EXPECT_EQ(profile.Duration(), 10);
+
+  // A new value ends the constant run, a gap a DenseFile pads doesn't end
+  // the regular one.
+  Observe(profile, {Datapoint(140, 2, 10), Datapoint(160, 2, 10)});
+  EXPECT_TRUE(profile.Regular());
+  EXPECT_FALSE(profile.Constant());
+
+  // Another duration starts over.
+  Observe(profile, {Datapoint(165, 2, 5)});
+  EXPECT_FALSE(profile.Regular());
+  EXPECT_EQ(profile.Duration(), 5);
+}
+
+
+TEST_F(CadenceProfileTest, StateChangesAreSaved) {
+  // A new duration is saved.
+  {
+    CadenceProfile profile(dir, &file_cache);
+    Observe(profile, {Datapoint(100, 1, 10), Datapoint(110, 2, 10)});
+    EXPECT_FALSE(profile.Regular());
+  }
+  CadenceRecord record = ReadRecord(dir);
+  EXPECT_EQ(record.last_timestamp, 110);
+  EXPECT_EQ(record.regular_run, 2);
+
+  // A reloaded profile carries on the run it had, though it wasn't yet
+  // regular when it was last saved, and becoming regular is saved.
+  {
+    CadenceProfile profile(dir, &file_cache);
+    Observe(profile, {Datapoint(120, 3, 10), Datapoint(130, 4, 10)});
+    EXPECT_TRUE(profile.Regular());
+  }
+  record = ReadRecord(dir);
+  EXPECT_EQ(record.last_timestamp, 130);
+  EXPECT_EQ(record.regular_run, 4);
+
+  // Writes that keep to the saved state aren't saved.
+  {
+    CadenceProfile profile(dir, &file_cache);
+    EXPECT_TRUE(profile.Regular());
+    EXPECT_EQ(profile.Duration(), 10);
+    Observe(profile, {Datapoint(140, 5, 10), Datapoint(150, 6, 10)});
+  }
+  EXPECT_EQ(ReadRecord(dir).last_timestamp, 130);
+
+  // So a reloaded regular profile carries on from the first datapoint past
+  // the saved one, even beyond a gap a DenseFile would pad.
+  {
+    CadenceProfile profile(dir, &file_cache);
+    Observe(profile, {Datapoint(500, 7, 10)});
+    EXPECT_TRUE(profile.Regular());
+  }
+  EXPECT_EQ(ReadRecord(dir).last_timestamp, 130);
+
+  // Breaking the run is saved.
+  CadenceProfile profile(dir, &file_cache);
+  Observe(profile, {Datapoint(505, 8, 10)});
+  EXPECT_FALSE(profile.Regular());
+  EXPECT_EQ(ReadRecord(dir).last_timestamp, 505);
+}
+
+
+TEST_F(CadenceProfileTest, RemoveForgetsTheProfile) {
+  CadenceProfile profile(dir, &file_cache);
+  Observe(profile, {Datapoint(100, 1, 10), Datapoint(110, 1, 10),
+                    Datapoint(120, 1, 10), Datapoint(130, 1, 10)});
+  EXPECT_TRUE(profile.Regular());
+
+  profile.Remove();
+  EXPECT_FALSE(profile.Regular());
+  EXPECT_FALSE(FileExists(dir + "/" + CADENCE_FILENAME));
+  EXPECT_FALSE(CadenceProfile(dir, &file_cache).Regular());
+}
+
+
+} // namespace
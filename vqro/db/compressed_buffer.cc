@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cmath>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/compressed_buffer.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_codec.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/write_op.h"
+
+
+namespace vqro {
+namespace db {
+
+
+void CompressedBuffer::Append(vqro::rpc::WriteOperation& op) {
+  if (decoded_valid)
+    ReleaseScratchSpace();
+
+  for (int i = 0; i < op.datapoints_size(); i++) {
+    const vqro::rpc::Datapoint& op_datapoint = op.datapoints(i);
+    AppendDatapoint(Datapoint(op_datapoint.timestamp(),
+                              op_datapoint.value(),
+                              op_datapoint.duration()));
+  }
+}
+
+
+void CompressedBuffer::Append(const vqro::rpc::SeriesColumns& columns) {
+  if (decoded_valid)
+    ReleaseScratchSpace();
+
+  const bool one_duration = columns.durations_size() <= 1;
+  const int64_t duration = columns.durations_size() ? columns.durations(0) : 0;
+
+  for (int i = 0; i < columns.timestamps_size(); i++) {
+    AppendDatapoint(Datapoint(columns.timestamps(i),
+                              columns.values(i),
+                              one_duration ? duration : columns.durations(i)));
+  }
+}
+
+
+void CompressedBuffer::AppendDatapoint(const Datapoint& point) {
+  if (std::isnan(point.value))  // NANs not allowed
+    return;
+
+  encoder.Encode(point);
+  num_datapoints++;
+
+  if (point.timestamp < last_timestamp)
+    sorted = false;
+  last_timestamp = point.timestamp;
+}
+
+
+RawBuffer& CompressedBuffer::Decoded() {
+  if (!decoded_valid) {
+    decoded.resize(num_datapoints);
+    DatapointDecoder decoder(bits.Words().data(), bits.BitCount());
+    for (size_t i = 0; i < num_datapoints; i++) {
+      if (!decoder.Decode(&decoded[i])) {
+        LOG(ERROR) << "CompressedBuffer decoded only " << i << " of "
+                   << num_datapoints << " datapoints";
+        decoded.resize(i);
+        break;
+      }
+    }
+    decoded_view.reset(new RawBuffer(decoded.data(), decoded.size()));
+    decoded_valid = true;
+  }
+  return *decoded_view;
+}
+
+
+void CompressedBuffer::Sort() {
+  if (sorted)
+    return;
+
+  Decoded();
+  std::stable_sort(decoded.begin(), decoded.end());
+
+  // Re-encode so the compressed form is sorted too. Sorted timestamps usually
+  // compress better than what we had.
+  bits.Clear();
+  encoder.Reset();
+  for (auto& point : decoded)
+    encoder.Encode(point);
+  bits.ShrinkToFit();
+
+  last_timestamp = decoded.empty() ? INT64_MIN : decoded.back().timestamp;
+  sorted = true;
+}
+
+
+void CompressedBuffer::WriteTo(DatapointDirectory& dir) {
+  if (IsEmpty())
+    return;
+
+  Sort();
+  WriteOperation<RawBuffer> write_op(&Decoded());
+  dir.Write(write_op);
+}
+
+
+void CompressedBuffer::Clear() {
+  bits.Clear();
+  bits.ShrinkToFit();
+  encoder.Reset();
+  num_datapoints = 0;
+  last_timestamp = INT64_MIN;
+  sorted = true;
+  ReleaseScratchSpace();
+}
+
+
+size_t CompressedBuffer::AllocatedBytes() const {
+  return bits.CapacityBytes() + decoded.capacity() * datapoint_size;
+}
+
+
+void CompressedBuffer::ReleaseScratchSpace() {
+  decoded_view.reset();
+  vector<Datapoint>().swap(decoded);
+  decoded_valid = false;
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,68 @@
+#ifndef VQRO_DB_COMPRESSED_BUFFER_H
+#define VQRO_DB_COMPRESSED_BUFFER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_codec.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/series_buffer.h"
+
+
+namespace vqro {
+namespace db {
+
+
+// A SeriesBuffer that keeps its datapoints compressed with DatapointEncoder
+// as they are appended. A series with regular timestamps, a constant duration
+// and slowly changing values costs a few bits per datapoint instead of 24
+// bytes.
+//
+// Iterating the buffer (for reads and flushes) decodes it into scratch space
+// that is kept until the next Append() or ReleaseScratchSpace(). Sort() sorts
+// that scratch copy and re-encodes it, so the compressed form stays sorted.
+class CompressedBuffer: public SeriesBuffer {
+ public:
+  CompressedBuffer() : encoder(&bits) {}
+
+  // DatapointBuffer API
+  size_t Size() const override { return num_datapoints; }
+  Iterator begin() override { return Decoded().begin(); }
+  Iterator end() override { return Decoded().end(); }
+
+  // SeriesBuffer API
+  void Append(vqro::rpc::WriteOperation& op) override;
+  void Append(const vqro::rpc::SeriesColumns& columns) override;
+  bool IsEmpty() const override { return num_datapoints == 0; }
+  bool IsSorted() const override { return sorted; }
+  void Sort() override;
+  void Clear() override;
+  void WriteTo(DatapointDirectory& dir) override;
+  size_t AllocatedBytes() const override;
+  void ReleaseScratchSpace() override;
+
+ private:
+  BitWriter bits;
+  DatapointEncoder encoder;
+  size_t num_datapoints = 0;
+  int64_t last_timestamp = INT64_MIN;
+  bool sorted = true;
+
+  vector<Datapoint> decoded;
+  bool decoded_valid = false;
+  std::unique_ptr<RawBuffer> decoded_view;
+
+  void AppendDatapoint(const Datapoint& point);
+  RawBuffer& Decoded();
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_COMPRESSED_BUFFER_H
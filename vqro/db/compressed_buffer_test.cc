@@ -0,0 +1,200 @@
+#include <cmath>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/compressed_buffer.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_bool(cadence_profiles);
+DECLARE_int32(compaction_min_files);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+void Append(CompressedBuffer& buffer, const vector<Datapoint>& points) {
+  vqro::rpc::WriteOperation op;
+  for (const Datapoint& point : points) {
+    vqro::rpc::Datapoint* op_point = op.add_datapoints();
+    op_point->set_timestamp(point.timestamp);
+    op_point->set_value(point.value);
+    op_point->set_duration(point.duration);
+  }
+  buffer.Append(op);
+}
+
+
+vector<Datapoint> Contents(CompressedBuffer& buffer) {
+  return vector<Datapoint>(buffer.begin(), buffer.end());
+}
+
+
+// Irregular on purpose: timestamp gaps, durations and values that don't
+// compress well still have to come back exactly. No datapoint starts within
+// the one before it, which reads would skip.
+vector<Datapoint> Irregular() {
+  return {
+    Datapoint(1000, 1.5, 10),
+    Datapoint(1010, 1.5, 10),
+    Datapoint(1020, -2.25, 10),
+    Datapoint(5000, 1e300, 7),
+    Datapoint(5010, 0.0, 0),
+    Datapoint(1700000000000, -1e-300, 86400000),
+    Datapoint(1700086400000, 3.0, 1)
+  };
+}
+
+
+TEST(CompressedBufferTest, AppendRoundTrips) {
+  CompressedBuffer buffer;
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_EQ(Contents(buffer), vector<Datapoint>());
+
+  vector<Datapoint> points = Irregular();
+  Append(buffer, points);
+  EXPECT_EQ(buffer.Size(), points.size());
+  EXPECT_TRUE(buffer.IsSorted());
+  EXPECT_EQ(Contents(buffer), points);
+
+  // Appending after iterating drops the scratch copy, and the next
+  // iteration sees both appends.
+  Append(buffer, {Datapoint(1700086400001, 4.0, 1)});
+  points.push_back(Datapoint(1700086400001, 4.0, 1));
+  EXPECT_EQ(Contents(buffer), points);
+}
+
+
+TEST(CompressedBufferTest, AppendColumns) {
+  CompressedBuffer buffer;
+  vqro::rpc::SeriesColumns columns;
+  for (int64_t t = 100; t < 130; t += 10) {
+    columns.add_timestamps(t);
+    columns.add_values(t / 10.0);
+  }
+  columns.add_durations(10);  // Shared by every datapoint
+  buffer.Append(columns);
+
+  vqro::rpc::SeriesColumns varying;
+  varying.add_timestamps(200);
+  varying.add_values(1.0);
+  varying.add_durations(5);
+  varying.add_timestamps(210);
+  varying.add_values(2.0);
+  varying.add_durations(6);
+  buffer.Append(varying);
+
+  EXPECT_EQ(Contents(buffer), vector<Datapoint>({
+    Datapoint(100, 10.0, 10),
+    Datapoint(110, 11.0, 10),
+    Datapoint(120, 12.0, 10),
+    Datapoint(200, 1.0, 5),
+    Datapoint(210, 2.0, 6)
+  }));
+}
+
+
+TEST(CompressedBufferTest, NansAreDropped) {
+  CompressedBuffer buffer;
+  Append(buffer, {Datapoint(1, 1.0, 0), Datapoint(2, NAN, 0),
+                  Datapoint(3, 3.0, 0)});
+  EXPECT_EQ(buffer.Size(), 2);
+  EXPECT_EQ(Contents(buffer),
+            vector<Datapoint>({Datapoint(1, 1.0, 0), Datapoint(3, 3.0, 0)}));
+}
+
+
+TEST(CompressedBufferTest, RegularSeriesCompress) {
+  CompressedBuffer buffer;
+  vector<Datapoint> points;
+  for (int64_t i = 0; i < 1000; i++)
+    points.push_back(Datapoint(1000000 + i * 10, 42.0, 10));
+  Append(buffer, points);
+
+  EXPECT_LT(buffer.AllocatedBytes(), points.size() * datapoint_size / 8);
+  EXPECT_EQ(Contents(buffer), points);
+  buffer.ReleaseScratchSpace();
+  EXPECT_LT(buffer.AllocatedBytes(), points.size() * datapoint_size / 8);
+}
+
+
+TEST(CompressedBufferTest, SortIsStableAndReencodes) {
+  CompressedBuffer buffer;
+  Append(buffer, {
+    Datapoint(30, 3.0, 1),
+    Datapoint(10, 1.0, 1),
+    Datapoint(20, 2.0, 1),
+    Datapoint(10, 1.5, 1)  // Rewrites the earlier 10, must stay after it
+  });
+  EXPECT_FALSE(buffer.IsSorted());
+
+  buffer.Sort();
+  EXPECT_TRUE(buffer.IsSorted());
+  vector<Datapoint> sorted {
+    Datapoint(10, 1.0, 1),
+    Datapoint(10, 1.5, 1),
+    Datapoint(20, 2.0, 1),
+    Datapoint(30, 3.0, 1)
+  };
+  EXPECT_EQ(Contents(buffer), sorted);
+
+  // The compressed form is what was sorted, not just the scratch copy.
+  buffer.ReleaseScratchSpace();
+  EXPECT_EQ(Contents(buffer), sorted);
+
+  // Later appends are checked against the sorted tail.
+  Append(buffer, {Datapoint(40, 4.0, 1)});
+  EXPECT_TRUE(buffer.IsSorted());
+  Append(buffer, {Datapoint(35, 3.5, 1)});
+  EXPECT_FALSE(buffer.IsSorted());
+}
+
+
+TEST(CompressedBufferTest, ClearEmptiesTheBuffer) {
+  CompressedBuffer buffer;
+  Append(buffer, {Datapoint(20, 2.0, 1), Datapoint(10, 1.0, 1)});
+  Contents(buffer);
+  buffer.Clear();
+
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_TRUE(buffer.IsSorted());
+  EXPECT_EQ(Contents(buffer), vector<Datapoint>());
+
+  // The encoder starts over rather than carrying deltas from before.
+  Append(buffer, {Datapoint(5, 0.5, 1)});
+  EXPECT_EQ(Contents(buffer), vector<Datapoint>({Datapoint(5, 0.5, 1)}));
+}
+
+
+TEST(CompressedBufferTest, WriteToRoundTripsThroughADirectory) {
+  DirectoryFlagSaver flag_saver;
+  FLAGS_cadence_profiles = false;
+  FLAGS_compaction_min_files = 0;
+
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache, MakeTestDir("compressed_write"));
+
+  CompressedBuffer buffer;
+  buffer.WriteTo(dir);  // Nothing to write
+  EXPECT_TRUE(dir.Empty());
+
+  vector<Datapoint> points = Irregular();
+  vector<Datapoint> shuffled(points.rbegin(), points.rend());
+  Append(buffer, shuffled);
+  buffer.WriteTo(dir);
+  EXPECT_TRUE(buffer.IsSorted());
+
+  Datapoint read_buffer[100];
+  ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false, read_buffer, 100);
+  dir.Read(read_op);
+  EXPECT_EQ(vector<Datapoint>(read_buffer, read_op.cursor), points);
+}
+
+
+} // namespace
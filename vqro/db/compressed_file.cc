@@ -0,0 +1,200 @@
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/compressed_file.h"
+#include "vqro/db/datapoint_codec.h"
+#include "vqro/db/datapoint_directory.h"
+
+
+DEFINE_int32(compressed_block_datapoints,
+             1024,
+             "Datapoints per block of a compressed file. Reads decode whole "
+             "blocks, so smaller blocks make short range reads cheaper at the "
+             "cost of a 24 byte header per block.");
+
+
+namespace vqro {
+namespace db {
+
+
+string CompressedFile::Filename() const {
+  return (to_string(min_timestamp) + "-" + to_string(max_timestamp) +
+          COMPRESSED_SUFFIX);
+}
+
+
+ManifestEntry CompressedFile::Describe() const {
+  ManifestEntry entry = DescribeAs(FileFormat::COMPRESSED);
+  entry.count = datapoint_count;
+  return entry;
+}
+
+
+std::unique_ptr<DatapointFile> CompressedFile::FromFilename(
+    DatapointDirectory* dir,
+    char* filename) {
+  // compressed filename format is "<min_timestamp>-<max_timestamp>.gor"
+  const string name = filename;
+  char* endptr;
+  int64_t min;
+  int64_t max;
+
+  min = strtoll(filename, &endptr, 10);
+  if (endptr == filename || *endptr != '-')
+    return nullptr;
+
+  filename = endptr + 1;
+  max = strtoll(filename, &endptr, 10);
+  if (endptr == filename || strcmp(endptr, COMPRESSED_SUFFIX) != 0)
+    return nullptr;
+
+  CompressedFile* file = new CompressedFile(dir, min, max, true);
+  file->filename = name;
+  return std::unique_ptr<DatapointFile>(static_cast<DatapointFile*>(file));
+}
+
+
+void CompressedFile::Read(ReadOperation& read_op) const {
+  off_t file_size;
+  std::shared_ptr<MappedFile> mapping;
+  std::unique_ptr<vector<uint64_t>> contents;
+  const char* data;
+
+  if (FLAGS_mmap_reads) {
+    // We seek by block, and most reads want a few blocks.
+    mapping = dir->file_cache->Map(GetPath(), file_size, MADV_RANDOM);
+    data = mapping->data;
+  } else {
+    std::shared_ptr<FileHandle> file = dir->file_cache->Open(GetPath(), file_size);
+    contents = ReadValues<uint64_t>(*file, file_size / sizeof(uint64_t), 0);
+    data = reinterpret_cast<const char*>(contents->data());
+    file_size = contents->size() * sizeof(uint64_t);
+  }
+
+  const char* pos = data;
+  const char* const end = data + file_size;
+  Datapoint point;
+
+  while (end - pos >= static_cast<ssize_t>(sizeof(CompressedBlockHeader)) &&
+         read_op.SpaceLeft() &&
+         !read_op.Complete())
+  {
+    const CompressedBlockHeader* header =
+        reinterpret_cast<const CompressedBlockHeader*>(pos);
+    const uint64_t* words =
+        reinterpret_cast<const uint64_t*>(pos + sizeof(CompressedBlockHeader));
+    pos += sizeof(CompressedBlockHeader) +
+           (header->bit_count + 63) / 64 * sizeof(uint64_t);
+    if (pos > end) {
+      LOG(ERROR) << "CompressedFile::Read truncated block file=" << GetPath();
+      return;
+    }
+
+    if (header->max_timestamp < read_op.next_time)
+      continue;
+    if (header->min_timestamp >= read_op.end_time)
+      return;
+
+    DatapointDecoder decoder(words, header->bit_count);
+    for (uint32_t i = 0; i < header->count; i++) {
+      if (!decoder.Decode(&point)) {
+        LOG(ERROR) << "CompressedFile::Read corrupt block file=" << GetPath();
+        return;
+      }
+      if (point.timestamp < read_op.next_time)
+        continue;
+      if (point.timestamp >= read_op.end_time || !read_op.SpaceLeft())
+        return;
+      read_op.Append(point);
+    }
+  }
+}
+
+
+// Datapoints must be sorted with unique timestamps.
+template <typename Buffer>
+size_t CompressedFile::WriteDatapoints(const WriteOperation<Buffer>& write_op) {
+  if (written)
+    return 0;
+
+  size_t datapoints_to_write = write_op.WritableDatapoints();
+  if (!datapoints_to_write)
+    return 0;
+
+  const size_t block_size = std::max(FLAGS_compressed_block_datapoints, 1);
+  constexpr size_t header_words = sizeof(CompressedBlockHeader) / sizeof(uint64_t);
+  vector<uint64_t> contents;
+  BitWriter writer;
+  DatapointEncoder encoder(&writer);
+
+  for (size_t start = 0; start < datapoints_to_write; start += block_size) {
+    size_t count = std::min(block_size, datapoints_to_write - start);
+    writer.Clear();
+    encoder.Reset();
+    for (size_t i = start; i < start + count; i++)
+      encoder.Encode(write_op.At(i));
+
+    CompressedBlockHeader header {
+      write_op.At(start).timestamp,
+      write_op.At(start + count - 1).timestamp,
+      static_cast<uint32_t>(count),
+      static_cast<uint32_t>(writer.BitCount())
+    };
+    size_t header_pos = contents.size();
+    contents.resize(header_pos + header_words);
+    memcpy(&contents[header_pos], &header, sizeof(header));
+    contents.insert(contents.end(), writer.Words().begin(), writer.Words().end());
+  }
+
+  min_timestamp = write_op.At(0).timestamp;
+  max_timestamp = write_op.At(datapoints_to_write - 1).timestamp;
+
+  // Written and synced under a temporary name first so a crash can't leave a
+  // partial file for ReadFilenames() to find.
+  string tmp_path = GetPath() + ".tmp";
+  {
+    FileHandle file(tmp_path,
+                    O_WRONLY|O_CREAT|O_TRUNC,
+                    FLAGS_datapoint_file_mode);
+    if (file.fd == -1)
+      throw IOErrorFromErrno("CompressedFile::Write open() failed");
+    WriteValues<uint64_t>(file, contents.data(), contents.size());
+    SyncFile(file);
+  }
+  if (rename(tmp_path.c_str(), GetPath().c_str()) == -1)
+    throw IOErrorFromErrno("CompressedFile::Write rename() failed");
+  dir->file_cache->Invalidate(GetPath());
+
+  written = true;
+  datapoint_count = datapoints_to_write;
+  size = contents.size() * sizeof(uint64_t);
+  checksum = crc32(0, reinterpret_cast<const Bytef*>(contents.data()), size);
+  checksummed = true;
+  dir->FileChanged(*this);
+  return datapoints_to_write;
+}
+
+
+size_t CompressedFile::Write(const WriteOperation<WriteBuffer>& write_op) {
+  return WriteDatapoints(write_op);
+}
+
+
+size_t CompressedFile::Write(const WriteOperation<RawBuffer>& write_op) {
+  return WriteDatapoints(write_op);
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,81 @@
+#ifndef VQRO_DB_COMPRESSED_FILE_H
+#define VQRO_DB_COMPRESSED_FILE_H
+
+#include <cstdint>
+#include <memory>
+
+#include "vqro/base/base.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_file.h"
+#include "vqro/db/read_op.h"
+#include "vqro/db/write_op.h"
+
+
+DECLARE_int32(compressed_block_datapoints);
+
+
+namespace vqro {
+namespace db {
+
+
+class DatapointDirectory;
+
+// Filename suffix for compressed files.
+constexpr const char* COMPRESSED_SUFFIX = ".gor";
+constexpr int COMPRESSED_SUFFIX_LEN = 4;
+
+
+// Precedes each block's encoded datapoints. Blocks are a whole number of
+// 64-bit words, so headers stay aligned.
+struct CompressedBlockHeader {
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  uint32_t count;      // Datapoints in the block
+  uint32_t bit_count;  // Bits of encoded datapoints that follow
+};
+static_assert(sizeof(CompressedBlockHeader) == 24,
+              "CompressedBlockHeader must have no padding");
+
+
+// A CompressedFile holds sorted datapoints with unique timestamps encoded by
+// DatapointEncoder, in blocks of up to --compressed_block_datapoints. Each
+// block starts a fresh encoding, so reads seek by the block headers and only
+// decode the blocks they need.
+//
+// Compressed files are written once, by the StorageOptimizer from a sealed
+// sparse file, and never appended to.
+class CompressedFile: public DatapointFile {
+ public:
+  CompressedFile() = default;
+  CompressedFile(DatapointDirectory* _dir,
+                 int64_t _min,
+                 int64_t _max,
+                 bool _written=false) :
+    DatapointFile(_dir, _min, _max), written(_written) {
+      filename = Filename();
+    }
+
+  static std::unique_ptr<DatapointFile> FromFilename(
+      DatapointDirectory* dir,
+      char* filename);
+
+  string Filename() const;
+  ManifestEntry Describe() const;
+  void Read(ReadOperation& read_op) const;
+  size_t Write(const WriteOperation<WriteBuffer>& write_op);
+  size_t Write(const WriteOperation<RawBuffer>& write_op);
+  size_t RemainingWritableDatapoints() const { return 0; }
+
+ private:
+  template <typename Buffer>
+  size_t WriteDatapoints(const WriteOperation<Buffer>& write_op);
+
+  bool written = false;
+  int64_t datapoint_count = 0;  // Set by Write()
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_COMPRESSED_FILE_H
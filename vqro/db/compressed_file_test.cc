@@ -0,0 +1,136 @@
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/compressed_file.h"
+#include "vqro/db/datapoint_codec.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+// Bitwise, so NaN values compare equal to themselves.
+bool SameDatapoint(const Datapoint& a, const Datapoint& b) {
+  return memcmp(&a, &b, sizeof(Datapoint)) == 0;
+}
+
+
+// Regular timestamps with the odd jitter and gap, and values that exercise
+// each of the encoder's value codes.
+vector<Datapoint> MakeDatapoints(size_t count) {
+  vector<Datapoint> points;
+  int64_t timestamp = 1000;
+  for (size_t i = 0; i < count; i++) {
+    timestamp += 10;
+    if (i % 7 == 3)
+      timestamp += 1;  // Small delta of delta
+    if (i % 50 == 49)
+      timestamp += 100000;  // Large delta of delta
+    double value = (i % 5 == 0) ? 42.0 : i * 0.37;
+    if (i % 31 == 30)
+      value = NAN;
+    int64_t duration = (i % 20 < 10) ? 10 : 1;
+    points.emplace_back(timestamp, value, duration);
+  }
+  return points;
+}
+
+
+TEST(CompressedFileTest, CodecRoundTrips) {
+  vector<Datapoint> points = MakeDatapoints(500);
+  // Out of order timestamps and extreme values must survive too.
+  points.emplace_back(5, -0.0, 0);
+  points.emplace_back(INT64_MAX, INFINITY, INT64_MIN);
+  points.emplace_back(INT64_MIN, DBL_MIN, INT64_MAX);
+
+  BitWriter writer;
+  DatapointEncoder encoder(&writer);
+  for (const Datapoint& point : points)
+    encoder.Encode(point);
+
+  DatapointDecoder decoder(writer.Words().data(), writer.BitCount());
+  Datapoint decoded;
+  for (const Datapoint& point : points) {
+    ASSERT_TRUE(decoder.Decode(&decoded));
+    EXPECT_TRUE(SameDatapoint(decoded, point)) << point.timestamp;
+  }
+  EXPECT_FALSE(decoder.Decode(&decoded));
+}
+
+
+TEST(CompressedFileTest, ResetStartsAFreshStream) {
+  vector<Datapoint> points = MakeDatapoints(20);
+  BitWriter writer;
+  DatapointEncoder encoder(&writer);
+  for (const Datapoint& point : points)
+    encoder.Encode(point);
+
+  writer.Clear();
+  encoder.Reset();
+  encoder.Encode(points.back());
+  DatapointDecoder decoder(writer.Words().data(), writer.BitCount());
+  Datapoint decoded;
+  ASSERT_TRUE(decoder.Decode(&decoded));
+  EXPECT_TRUE(SameDatapoint(decoded, points.back()));
+}
+
+
+TEST(CompressedFileTest, ReadsSeekByBlock) {
+  FLAGS_compressed_block_datapoints = 16;
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache, MakeTestDir("gor_seek"));
+
+  vector<Datapoint> points = MakeDatapoints(200);
+  RawBuffer buffer(points.data(), points.size());
+  WriteOperation<RawBuffer> write_op(&buffer);
+  CompressedFile file(&dir, 0, 0);
+  ASSERT_EQ(file.Write(write_op), points.size());
+  EXPECT_EQ(file.min_timestamp, points.front().timestamp);
+  EXPECT_EQ(file.max_timestamp, points.back().timestamp);
+  EXPECT_EQ(file.Describe().count, points.size());
+
+  // Once written a compressed file takes no more datapoints.
+  WriteOperation<RawBuffer> rewrite_op(&buffer);
+  EXPECT_EQ(file.Write(rewrite_op), 0);
+
+  // Reopened by name, as after a restart. Start part way into the third
+  // block and resume with a buffer too small to hold a whole block.
+  char filename[256];
+  strncpy(filename, file.filename.c_str(), sizeof(filename));
+  std::unique_ptr<DatapointFile> reopened =
+      CompressedFile::FromFilename(&dir, filename);
+  ASSERT_NE(reopened, nullptr);
+
+  const size_t first = 16 * 2 + 5;
+  const size_t last = 150;  // Exclusive
+  Datapoint read_buffer[10];
+  ReadOperation read_op(points[first].timestamp,
+                        points[last].timestamp,
+                        -1,
+                        false,
+                        read_buffer,
+                        10);
+  vector<Datapoint> read;
+  do {
+    read_op.ClearBuffer();
+    reopened->Read(read_op);
+    read.insert(read.end(), read_buffer, read_op.cursor);
+  } while (!read_op.SpaceLeft() && !read_op.Complete());
+
+  ASSERT_EQ(read.size(), last - first);
+  for (size_t i = 0; i < read.size(); i++)
+    EXPECT_TRUE(SameDatapoint(read[i], points[first + i])) << i;
+}
+
+
+} // namespace
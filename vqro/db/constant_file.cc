@@ -4,11 +4,14 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <stdio.h>
+
 #include <algorithm>
 #include <cmath>
 #include <memory>
 
 #include "vqro/base/fileutil.h"
+#include "vqro/base/floatutil.h"
 #include "vqro/db/constant_file.h"
 #include "vqro/db/datapoint_directory.h"
 
@@ -17,10 +20,23 @@ namespace vqro {
 namespace db {
 
 
-string ConstantFile::GetPath() const {
-  return dir->path + "/" + to_string(min_timestamp) +
+string ConstantFile::Filename() const {
+  // Enough digits for strtod() to give back the same value.
+  char value_str[32];
+  snprintf(value_str, sizeof(value_str), "%.17g", value);
+  return to_string(min_timestamp) +
          "@" + to_string(duration) +
-         "x" + to_string(count);
+         "x" + to_string(count) +
+         "=" + value_str;
+}
+
+
+ManifestEntry ConstantFile::Describe() const {
+  ManifestEntry entry = DescribeAs(FileFormat::CONSTANT);
+  entry.duration = duration;
+  entry.count = count;
+  entry.value = value;
+  return entry;
 }
 
 
@@ -29,6 +45,7 @@ std::unique_ptr<DatapointFile> ConstantFile::FromFilename(
     char* filename)
 {
   // constant filename format is "<start_time>@<duration>x<count>=<value>"
+  const string name = filename;
   char* endptr;
   int64_t start_time;
   int64_t duration;
@@ -59,22 +76,27 @@ std::unique_ptr<DatapointFile> ConstantFile::FromFilename(
     return nullptr;
   }
 
-  return std::unique_ptr<DatapointFile>(
-    static_cast<DatapointFile*>(
-      new ConstantFile(dir, start_time, duration, count, value))
-  );
+  ConstantFile* file = new ConstantFile(dir, start_time, duration, count, value);
+  file->filename = name;
+  return std::unique_ptr<DatapointFile>(static_cast<DatapointFile*>(file));
 }
 
 
 void ConstantFile::Read(ReadOperation& read_op) const {
-  if (read_op.next_time % duration)
-    read_op.next_time = (read_op.next_time / duration + 1) * duration;
+  // Like a DenseFile's, our datapoints sit at min_timestamp plus a multiple
+  // of duration.
+  if (read_op.next_time < min_timestamp)
+    read_op.next_time = min_timestamp;
+  int64_t misalignment = (read_op.next_time - min_timestamp) % duration;
+  if (misalignment)
+    read_op.next_time += duration - misalignment;
 
   if (max_timestamp < read_op.next_time)
     return;
 
   int64_t read_end_time = std::min(max_timestamp, read_op.end_time);
-  int64_t datapoints_to_read = (read_end_time - read_op.next_time) / duration;
+  int64_t datapoints_to_read = std::min<int64_t>(
+      (read_end_time - read_op.next_time) / duration, read_op.SpaceLeft());
 
   while (datapoints_to_read--) {
     read_op.cursor->timestamp = read_op.next_time;
@@ -85,18 +107,50 @@ void ConstantFile::Read(ReadOperation& read_op) const {
 }
 
 
-size_t ConstantFile::Write(const WriteOperation& write_op) {
-  size_t datapoints_to_write = write_op.WritableDatapoints();
-  if (!datapoints_to_write)
+// Takes datapoints from write_op's cursor on for as long as each has our
+// value and duration and lands on one of our slots or the one after them.
+template <typename Buffer>
+size_t ConstantFile::WriteDatapoints(const WriteOperation<Buffer>& write_op) {
+  const size_t writable = write_op.WritableDatapoints();
+  int64_t slots = count;
+  size_t fitting = 0;
+
+  for (; fitting < writable; fitting++) {
+    const Datapoint& point = write_op.At(fitting);
+    const int64_t offset = point.timestamp - min_timestamp;
+    if (offset < 0 || offset % duration || point.duration != duration ||
+        offset / duration > slots || !AlmostEquals(point.value, value))
+      break;
+    if (offset / duration == slots)
+      slots++;
+  }
+  if (!fitting)
     return 0;
 
-  string old_path = GetPath();
-  count += datapoints_to_write;
-  max_timestamp = min_timestamp + count * duration;
-  if (rename(old_path.c_str(), GetPath().c_str()) == -1)
-    throw IOErrorFromErrno("ConstantFile::Write rename() failed");
+  // The file holds no data, but lets the directory be listed without its
+  // manifest.
+  if (!count) {
+    FileHandle file(GetPath(), O_WRONLY|O_CREAT, FLAGS_datapoint_file_mode);
+    if (file.fd == -1)
+      throw IOErrorFromErrno("ConstantFile::Write open() failed");
+  }
+
+  if (slots != count) {
+    count = slots;
+    max_timestamp = min_timestamp + count * duration;
+    dir->FileChanged(*this);
+  }
+  return fitting;
+}
+
+
+size_t ConstantFile::Write(const WriteOperation<WriteBuffer>& write_op) {
+  return WriteDatapoints(write_op);
+}
+
 
-  return datapoints_to_write;
+size_t ConstantFile::Write(const WriteOperation<RawBuffer>& write_op) {
+  return WriteDatapoints(write_op);
 }
 
 
@@ -31,16 +31,24 @@ class ConstantFile: public DatapointFile {
       DatapointFile(_dir, start_time, start_time + cnt * dur),
       duration(dur),
       count(cnt),
-      value(val) {}
+      value(val) {
+        filename = Filename();
+      }
 
   static std::unique_ptr<DatapointFile> FromFilename(
       DatapointDirectory* dir,
       char* filename);
 
-  string GetPath() const;
+  string Filename() const;
+  ManifestEntry Describe() const;
   void Read(ReadOperation& read_op) const;
-  size_t Write(const WriteOperation& write_op);
+  size_t Write(const WriteOperation<WriteBuffer>& write_op);
+  size_t Write(const WriteOperation<RawBuffer>& write_op);
   size_t RemainingWritableDatapoints() const { return -1; }
+
+ private:
+  template <typename Buffer>
+  size_t WriteDatapoints(const WriteOperation<Buffer>& write_op);
 };
 
 
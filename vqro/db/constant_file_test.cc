@@ -0,0 +1,133 @@
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/constant_file.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+class ConstantFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // No Series or DB behind our directory.
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 0;
+    path = MakeTestDirForTest();
+
+    // Ten datapoints of 1.5 from 100 on, in a directory read back anew.
+    DatapointDirectory dir(nullptr, &file_cache, path);
+    ConstantFile file(&dir, 100, 10, 0, 1.5);
+    for (int64_t timestamp = 100; timestamp < 200; timestamp += 10)
+      expected.emplace_back(timestamp, 1.5, 10);
+    Write(file, expected);
+    EXPECT_EQ(file.count, 10);
+  }
+
+  size_t Write(DatapointFile& file, vector<Datapoint> points) {
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    return file.Write(write_op);
+  }
+
+  // Writes points through a directory read back anew.
+  void Write(vector<Datapoint> points) {
+    DatapointDirectory dir(nullptr, &file_cache, path);
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    dir.Write(write_op);
+  }
+
+  vector<Datapoint> ReadAll() {
+    DatapointDirectory dir(nullptr, &file_cache, path);
+    vector<Datapoint> buffer(100);
+    ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false,
+                          buffer.data(), buffer.size());
+    dir.Read(read_op);
+    return vector<Datapoint>(buffer.data(), read_op.cursor);
+  }
+
+  vector<FileFormat> Formats() {
+    Manifest manifest(path, &file_cache);
+    EXPECT_TRUE(manifest.Load());
+    vector<FileFormat> formats;
+    for (const ManifestEntry& entry : manifest.Entries())
+      formats.push_back(entry.format);
+    return formats;
+  }
+
+  DirectoryFlagSaver flag_saver;
+
+  FileCache file_cache {16};
+  string path;
+  vector<Datapoint> expected;
+};
+
+
+TEST_F(ConstantFileTest, TakesItsValueInAndAfterItsSlots) {
+  Write({Datapoint(120, 1.5, 10), Datapoint(200, 1.5, 10)});
+  expected.emplace_back(200, 1.5, 10);
+  EXPECT_EQ(ReadAll(), expected);
+  EXPECT_EQ(Formats(), vector<FileFormat>({FileFormat::CONSTANT}));
+}
+
+
+TEST_F(ConstantFileTest, OtherValuesInRangeRewriteItDense) {
+  // The first datapoint still fits, the second doesn't, the third lands
+  // after the file and goes on the end of what replaced it.
+  Write({Datapoint(120, 1.5, 10), Datapoint(130, 7, 10),
+         Datapoint(200, 1.5, 10)});
+  expected[3].value = 7;
+  expected.emplace_back(200, 1.5, 10);
+  EXPECT_EQ(ReadAll(), expected);
+  EXPECT_EQ(Formats(), vector<FileFormat>({FileFormat::DENSE}));
+}
+
+
+TEST_F(ConstantFileTest, OtherDurationsRewriteItCompressed) {
+  // 135 fits no slot, so it is kept, though reads skip it for starting
+  // within the datapoint at 130.
+  Write({Datapoint(135, 4, 5), Datapoint(170, 2, 10)});
+  expected[7].value = 2;
+  EXPECT_EQ(ReadAll(), expected);
+  EXPECT_EQ(Formats(), vector<FileFormat>({FileFormat::COMPRESSED}));
+}
+
+
+TEST_F(ConstantFileTest, RewritesKeepTheOriginalDurations) {
+  // Like a SparseFile, a slot keeps its datapoint over a later one of
+  // another duration, but not over one of the same duration written after.
+  vector<Datapoint> rewrite {
+    Datapoint(130, 4, 5),
+    Datapoint(150, 5, 5),
+    Datapoint(150, 6, 10),
+    Datapoint(150, 8, 5),
+    Datapoint(170, 2, 10)
+  };
+  Write(rewrite);
+  expected[5].value = 6;
+  expected[7].value = 2;
+  EXPECT_EQ(ReadAll(), expected);
+  EXPECT_EQ(Formats(), vector<FileFormat>({FileFormat::DENSE}));
+
+  // The same writes read back the same from a SparseFile.
+  path = MakeTestDir("sparse");
+  vector<Datapoint> original;
+  for (int64_t timestamp = 100; timestamp < 200; timestamp += 10)
+    original.emplace_back(timestamp, 1.5, 10);
+  Write(original);
+  Write(rewrite);
+  EXPECT_EQ(Formats(), vector<FileFormat>({FileFormat::SPARSE}));
+  EXPECT_EQ(ReadAll(), expected);
+}
+
+
+} // namespace
@@ -1,6 +1,12 @@
 #ifndef VQRO_DB_DATAPOINT_BUFFER_H
 #define VQRO_DB_DATAPOINT_BUFFER_H
 
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include "vqro/db/datapoint.h"
+
 
 namespace vqro {
 namespace db {
@@ -14,12 +20,6 @@ class DatapointBuffer {
 
     virtual Datapoint& ValueAt(size_t i) const = 0;
     virtual IteratorImpl* Clone() const = 0;
-    virtual std::unique_ptr<Iovec[]> GetIOVector(
-        const size_t pos,
-        size_t& iov_count,
-        size_t& writable_datapoints,
-        size_t max_writable_datapoints,
-        const int64_t max_writable_timestamp) const = 0;
   };
 
  public:
@@ -48,10 +48,10 @@ class DatapointBuffer {
     }
 
     Iterator& operator+=(const long inc) { pos += inc; return *this; }
-    Iterator operator++() { Iterator i = *this; pos++; return i; }  //post
-    Iterator operator--() { Iterator i = *this; pos--; return i; }  //post
-    Iterator operator++(int) { pos++; return *this; }  //pre
-    Iterator operator--(int) { pos--; return *this; }  //pre
+    Iterator& operator++() { pos++; return *this; }  //pre
+    Iterator& operator--() { pos--; return *this; }  //pre
+    Iterator operator++(int) { Iterator i = *this; pos++; return i; }  //post
+    Iterator operator--(int) { Iterator i = *this; pos--; return i; }  //post
     Iterator operator+(const long inc) const { Iterator i(*this); i.pos += inc; return i; }
     Iterator operator-(const long inc) const { Iterator i(*this); i.pos -= inc; return i; }
     long operator-(const Iterator& rhs) const { return pos - rhs.pos; }
@@ -61,23 +61,10 @@ class DatapointBuffer {
     bool operator>(const Iterator& rhs) const { return pos > rhs.pos; }
     bool operator<=(const Iterator& rhs) const { return pos <= rhs.pos; }
     bool operator>=(const Iterator& rhs) const { return pos >= rhs.pos; }
-    Datapoint& operator[](long i) { return impl->ValueAt(i); }
+    Datapoint& operator[](long i) { return impl->ValueAt(pos + i); }
     Datapoint& operator*() { return impl->ValueAt(pos); }
     Datapoint* operator->() { return &operator*(); }
 
-    std::unique_ptr<Iovec[]> GetIOVector(
-        size_t& iov_count,
-        size_t& writable_datapoints,
-        size_t max_writable_datapoints,
-        const int64_t max_writable_timestamp) const {
-      return impl->GetIOVector(
-          pos,
-          iov_count,
-          writable_datapoints,
-          max_writable_datapoints,
-          max_writable_timestamp);
-    }
-
     size_t Pos() const { return pos; }
 
    private:
@@ -85,6 +72,7 @@ class DatapointBuffer {
     size_t pos;
   };
 
+  virtual ~DatapointBuffer() {}
   virtual size_t Size() const = 0;
   virtual Iterator begin() = 0;
   virtual Iterator end() = 0;
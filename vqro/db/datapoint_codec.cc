@@ -0,0 +1,157 @@
+#include <cstring>
+
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_codec.h"
+
+
+namespace vqro {
+namespace db {
+
+
+static inline uint64_t DoubleBits(double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+
+static inline double BitsDouble(uint64_t bits) {
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+
+// Sign-extend the low nbits of value.
+static inline int64_t SignExtend(uint64_t value, int nbits) {
+  uint64_t sign = UINT64_C(1) << (nbits - 1);
+  return static_cast<int64_t>((value ^ sign) - sign);
+}
+
+
+void DatapointEncoder::Reset() {
+  prev_timestamp = 0;
+  prev_delta = 0;
+  prev_duration = 0;
+  prev_value_bits = 0;
+  prev_leading = -1;
+  prev_trailing = 0;
+}
+
+
+void DatapointEncoder::Encode(const Datapoint& point) {
+  // Timestamp. Unsigned arithmetic so extreme values wrap rather than overflow.
+  int64_t delta = static_cast<int64_t>(
+      static_cast<uint64_t>(point.timestamp) -
+      static_cast<uint64_t>(prev_timestamp));
+  int64_t dod = static_cast<int64_t>(
+      static_cast<uint64_t>(delta) - static_cast<uint64_t>(prev_delta));
+
+  if (dod == 0) {
+    writer->Write(0x0, 1);
+  } else if (dod >= -64 && dod <= 63) {
+    writer->Write(0x2, 2);
+    writer->Write(dod, 7);
+  } else if (dod >= -256 && dod <= 255) {
+    writer->Write(0x6, 3);
+    writer->Write(dod, 9);
+  } else if (dod >= -2048 && dod <= 2047) {
+    writer->Write(0xe, 4);
+    writer->Write(dod, 12);
+  } else {
+    writer->Write(0xf, 4);
+    writer->Write(dod, 64);
+  }
+  prev_timestamp = point.timestamp;
+  prev_delta = delta;
+
+  // Duration
+  if (point.duration == prev_duration) {
+    writer->WriteBit(false);
+  } else {
+    writer->WriteBit(true);
+    writer->Write(point.duration, 64);
+    prev_duration = point.duration;
+  }
+
+  // Value
+  uint64_t value_bits = DoubleBits(point.value);
+  uint64_t xor_bits = value_bits ^ prev_value_bits;
+  prev_value_bits = value_bits;
+
+  if (xor_bits == 0) {
+    writer->WriteBit(false);
+    return;
+  }
+
+  int leading = __builtin_clzll(xor_bits);
+  int trailing = __builtin_ctzll(xor_bits);
+  if (leading > 63) leading = 63;
+
+  if (prev_leading != -1 && leading >= prev_leading && trailing >= prev_trailing) {
+    writer->Write(0x2, 2);
+    writer->Write(xor_bits >> prev_trailing, 64 - prev_leading - prev_trailing);
+  } else {
+    int meaningful = 64 - leading - trailing;
+    writer->Write(0x3, 2);
+    writer->Write(leading, 6);
+    writer->Write(meaningful - 1, 6);
+    writer->Write(xor_bits >> trailing, meaningful);
+    prev_leading = leading;
+    prev_trailing = trailing;
+  }
+}
+
+
+bool DatapointDecoder::Decode(Datapoint* point) {
+  // Timestamp
+  int64_t dod;
+  if (!reader.ReadBit()) {
+    dod = 0;
+  } else if (!reader.ReadBit()) {
+    dod = SignExtend(reader.Read(7), 7);
+  } else if (!reader.ReadBit()) {
+    dod = SignExtend(reader.Read(9), 9);
+  } else if (!reader.ReadBit()) {
+    dod = SignExtend(reader.Read(12), 12);
+  } else {
+    dod = static_cast<int64_t>(reader.Read(64));
+  }
+  prev_delta = static_cast<int64_t>(
+      static_cast<uint64_t>(prev_delta) + static_cast<uint64_t>(dod));
+  prev_timestamp = static_cast<int64_t>(
+      static_cast<uint64_t>(prev_timestamp) + static_cast<uint64_t>(prev_delta));
+
+  // Duration
+  if (reader.ReadBit())
+    prev_duration = static_cast<int64_t>(reader.Read(64));
+
+  // Value
+  if (reader.ReadBit()) {
+    if (!reader.ReadBit()) {
+      if (prev_leading == -1)  // corrupt, there is no window to reuse
+        return false;
+      int meaningful = 64 - prev_leading - prev_trailing;
+      prev_value_bits ^= reader.Read(meaningful) << prev_trailing;
+    } else {
+      prev_leading = reader.Read(6);
+      int meaningful = reader.Read(6) + 1;
+      prev_trailing = 64 - prev_leading - meaningful;
+      prev_value_bits ^= reader.Read(meaningful) << prev_trailing;
+    }
+  }
+
+  if (reader.Exhausted())
+    return false;
+
+  point->timestamp = prev_timestamp;
+  point->duration = prev_duration;
+  point->value = BitsDouble(prev_value_bits);
+  return true;
+}
+
+
+} // namespace db
+} // namespace vqro
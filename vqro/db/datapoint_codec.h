@@ -0,0 +1,77 @@
+#ifndef VQRO_DB_DATAPOINT_CODEC_H
+#define VQRO_DB_DATAPOINT_CODEC_H
+
+#include <cstdint>
+
+#include "vqro/base/base.h"
+#include "vqro/base/bitstream.h"
+#include "vqro/db/datapoint.h"
+
+
+namespace vqro {
+namespace db {
+
+
+// Compresses a stream of datapoints in the style of Facebook's Gorilla paper.
+// Each datapoint is encoded relative to the one before it:
+//
+//   timestamp: delta-of-delta, using a prefix code that favors small values
+//     '0'                        dod == 0
+//     '10'   + 7 bits            dod in [-64, 63]
+//     '110'  + 9 bits            dod in [-256, 255]
+//     '1110' + 12 bits           dod in [-2048, 2047]
+//     '1111' + 64 bits           anything else
+//
+//   duration: run-length style
+//     '0'                        same as previous
+//     '1'    + 64 bits           new duration
+//
+//   value: XOR with the previous value's bits
+//     '0'                        identical
+//     '10'   + meaningful bits   fits within the previous leading/trailing zeros
+//     '11'   + 6 bits leading zeros + 6 bits (length - 1) + meaningful bits
+//
+// The first datapoint is encoded against an all-zero "previous" datapoint, so
+// a stream needs no header. Datapoints need not be in timestamp order, though
+// out of order timestamps cost more bits.
+class DatapointEncoder {
+ public:
+  explicit DatapointEncoder(BitWriter* w) : writer(w) {}
+
+  void Encode(const Datapoint& point);
+  void Reset();
+
+ private:
+  BitWriter* const writer;
+  int64_t prev_timestamp = 0;
+  int64_t prev_delta = 0;
+  int64_t prev_duration = 0;
+  uint64_t prev_value_bits = 0;
+  int prev_leading = -1;  // -1 means no leading/trailing window yet
+  int prev_trailing = 0;
+};
+
+
+class DatapointDecoder {
+ public:
+  DatapointDecoder(const uint64_t* words, size_t bit_count) :
+      reader(words, bit_count) {}
+
+  // Returns false if the stream ended before a full datapoint was decoded.
+  bool Decode(Datapoint* point);
+
+ private:
+  BitReader reader;
+  int64_t prev_timestamp = 0;
+  int64_t prev_delta = 0;
+  int64_t prev_duration = 0;
+  uint64_t prev_value_bits = 0;
+  int prev_leading = -1;
+  int prev_trailing = 0;
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_DATAPOINT_CODEC_H
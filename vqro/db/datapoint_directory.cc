@@ -5,6 +5,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <dirent.h>
+#include <limits.h>
 #include <stdlib.h>
 
 #include <algorithm>
@@ -13,10 +14,19 @@
 
 #include "vqro/base/base.h"
 #include "vqro/base/fileutil.h"
+#include "vqro/base/floatutil.h"
+#include "vqro/db/cadence.h"
 #include "vqro/db/datapoint_directory.h"
 #include "vqro/db/datapoint_file.h"
+#include "vqro/db/compressed_file.h"
 #include "vqro/db/constant_file.h"
+#include "vqro/db/db.h"
 #include "vqro/db/dense_file.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/segment_file.h"
+#include "vqro/db/segment_store.h"
+#include "vqro/db/series.h"
 #include "vqro/db/sparse_file.h"
 #include "vqro/db/read_op.h"
 #include "vqro/db/write_op.h"
@@ -29,8 +39,9 @@ namespace db {
 //TODO: support datapoint_limit and prefer_latest
 void DatapointDirectory::Read(ReadOperation& read_op) {
   // It is possible that our actual directory does not yet exist because
-  // Write() hasn't been called yet.
-  if (!filenames_read) {
+  // Write() hasn't been called yet. Segment compaction moves our chunks.
+  if (!filenames_read ||
+      (segment_store && segment_generation != segment_store->Generation())) {
     try {
       ReadFilenames();
     } catch (IOError& e) {
@@ -42,6 +53,7 @@ void DatapointDirectory::Read(ReadOperation& read_op) {
   // file_it will point to the latest datapoint_files member such that its
   // min_timestamp < read_op.next_time
   auto file_it = FindFirstPotentialFile(read_op.next_time);
+  size_t files_read = 0;
 
   while (read_op.SpaceLeft() && !read_op.Complete())
   {
@@ -53,21 +65,239 @@ void DatapointDirectory::Read(ReadOperation& read_op) {
     // When we run out of files in the read_op's range we're done.
     if (file_it == datapoint_files.end() ||
         (*file_it)->min_timestamp >= read_op.end_time)
-      return;
+      break;
 
     // DatapointFile::Read() advances read_op.next_time for us
     (*file_it++)->Read(read_op);
+    files_read++;
+  }
+
+  // Reads walking many files are the ones compaction speeds up.
+  if (!segment_store &&
+      FLAGS_compaction_min_files > 0 &&
+      files_read >= static_cast<size_t>(FLAGS_compaction_min_files))
+    series->db->GetDirectoryCompactor()->Fragmented(series);
+}
+
+
+void DatapointDirectory::Prefetch() {
+  if (filenames_read)
+    return;
+
+  try {
+    ReadFilenames();
+  } catch (IOError& e) {
+    // Nothing has been written yet, Write() creates the directory.
+  }
+}
+
+
+void DatapointDirectory::Forget() {
+  for (auto& file : datapoint_files)
+    file_cache->Invalidate(file->GetPath());
+  datapoint_files.clear();
+  filenames_read = false;
+
+  if (manifest) {
+    file_cache->Invalidate(path + "/" + MANIFEST_FILENAME);
+    manifest.reset(new Manifest(path, file_cache));
+  }
+  if (cadence)
+    cadence.reset(new CadenceProfile(path, file_cache));
+}
+
+
+template <typename Buffer>
+void DatapointDirectory::WriteChunks(WriteOperation<Buffer>& write_op) {
+  if (!filenames_read || segment_generation != segment_store->Generation())
+    ReadChunks();
+
+  vector<Datapoint> points;
+  while (!write_op.Complete()) {
+    const int64_t timestamp = write_op.Current().timestamp;
+
+    // next_it is the first chunk that starts after the current datapoint.
+    auto next_it = FindFirstPotentialFile(timestamp);
+    if (next_it != datapoint_files.end() && (*next_it)->min_timestamp <= timestamp)
+      next_it++;
+
+    // Chunks in [first, next_it) get replaced by the one we write.
+    auto first = next_it;
+    write_op.max_writable_timestamp = (next_it == datapoint_files.end()) ?
+        INT64_MAX : (*next_it)->min_timestamp - 1;
+    write_op.max_writable_datapoints = std::max(FLAGS_segment_chunk_datapoints, 1);
+
+    // Late datapoints landing inside a chunk are merged into a new version of
+    // it, up to its max_timestamp.
+    bool inside = first != datapoint_files.begin() &&
+                  (*(first - 1))->max_timestamp >= timestamp;
+    if (inside) {
+      first--;
+      write_op.max_writable_timestamp = (*first)->max_timestamp;
+    }
+
+    size_t count = write_op.WritableDatapoints();
+
+    // Otherwise the chunks just before our datapoints are merged with them
+    // while they're no bigger than what we have so far, so a series flushed a
+    // little at a time ends up in a logarithmic number of chunks of up to
+    // --segment_chunk_datapoints rather than one per flush.
+    size_t merged_count = count;
+    while (!inside && first != datapoint_files.begin()) {
+      auto prev = static_cast<const SegmentFile*>((first - 1)->get());
+      if (prev->chunk.count > merged_count ||
+          merged_count + prev->chunk.count >
+              static_cast<size_t>(FLAGS_segment_chunk_datapoints))
+        break;
+      merged_count += prev->chunk.count;
+      first--;
+    }
+
+    points.clear();
+    points.reserve(merged_count);
+    for (auto it = first; it != next_it; it++)
+      static_cast<const SegmentFile*>(it->get())->ReadAll(points);
+    for (size_t i = 0; i < count; i++)
+      points.push_back(write_op.At(i));
+
+    // Like a sparse file, a chunk keeps every version of a datapoint in the
+    // order they were written, which stable_sort preserves.
+    if (inside)
+      std::stable_sort(points.begin(), points.end());
+
+    segment_store->Append(series->keyint, points.data(), points.size());
+    write_op.Advance(count);
+    ReadChunks();
+  }
+}
+
+
+// Counts the datapoints from write_op's cursor on that a new DenseFile or,
+// if constant, ConstantFile starting at the first of them would take.
+template <typename Buffer>
+static size_t DirectRun(const WriteOperation<Buffer>& write_op, bool constant) {
+  const size_t writable = write_op.WritableDatapoints();
+  const Datapoint& first = write_op.Current();
+  int64_t last_timestamp = first.timestamp;
+  size_t run = 1;
+  for (; run < writable; run++) {
+    const Datapoint& point = write_op.At(run);
+    const int64_t delta = point.timestamp - last_timestamp;
+    if (point.duration != first.duration || delta % first.duration)
+      break;
+    if (constant ? (delta > first.duration ||
+                    !AlmostEquals(point.value, first.value))
+                 : delta / first.duration > FLAGS_max_dense_nan_gap + 1)
+      break;
+    last_timestamp = point.timestamp;
   }
+  return run;
+}
+
+
+template <typename Buffer>
+FileFormat DatapointDirectory::DirectFormat(WriteOperation<Buffer>& write_op) {
+  const Datapoint& first = write_op.Current();
+  if (!cadence || !cadence->Regular() || first.duration <= 0 ||
+      first.duration != cadence->Duration())
+    return FileFormat::SPARSE;
+
+  // A short run that doesn't reach the end of our datapoints is the series
+  // breaking its cadence, so a fresh file would hardly be worth it.
+  write_op.max_writable_datapoints = -1;
+  const size_t writable = write_op.WritableDatapoints();
+  if (cadence->Constant()) {
+    size_t run = DirectRun(write_op, true);
+    if (run == writable ||
+        run >= static_cast<size_t>(FLAGS_min_datapoints_for_constant))
+      return FileFormat::CONSTANT;
+  }
+  size_t run = DirectRun(write_op, false);
+  if (run == writable ||
+      run >= static_cast<size_t>(FLAGS_min_datapoints_for_dense))
+    return FileFormat::DENSE;
+  return FileFormat::SPARSE;
+}
+
+
+// Replaces file with a DenseFile, or a CompressedFile if they don't all fit
+// its slots, holding its datapoints and those from write_op's cursor on that
+// land inside it, the latter where both have one of the same duration.
+// Returns how many datapoints of write_op it took.
+template <typename Buffer>
+size_t DatapointDirectory::RewriteConstantFile(
+    const ConstantFile& file,
+    const WriteOperation<Buffer>& write_op)
+{
+  const size_t writable = write_op.WritableDatapoints();
+  size_t taken = 0;
+  while (taken < writable &&
+         write_op.At(taken).timestamp < file.max_timestamp)
+    taken++;
+
+  // Sorted, the stable sort leaves our datapoints after the file's.
+  vector<Datapoint> points;
+  points.reserve(file.count + taken);
+  for (int64_t i = 0; i < file.count; i++)
+    points.emplace_back(file.min_timestamp + i * file.duration,
+                        file.value,
+                        file.duration);
+  for (size_t i = 0; i < taken; i++)
+    points.push_back(write_op.At(i));
+  std::stable_sort(points.begin(), points.end());
+
+  // Of the datapoints at a timestamp we keep the last one written with the
+  // first one's duration, as SparseFile::ReadSorted() does.
+  size_t len = 0;
+  bool dense = true;
+  for (size_t i = 0; i < points.size();) {
+    size_t next = i + 1;
+    while (next < points.size() &&
+           points[next].timestamp == points[i].timestamp)
+      next++;
+    size_t last = next - 1;
+    while (last != i && points[last].duration != points[i].duration)
+      last--;
+
+    const Datapoint& point = points[last];
+    dense = dense && point.duration == file.duration &&
+            (point.timestamp - file.min_timestamp) % file.duration == 0;
+    points[len++] = point;
+    i = next;
+  }
+
+  LOG(INFO) << "Rewriting " << file.GetPath() << " to take "
+            << taken << " datapoints of another value";
+  std::unique_ptr<DatapointFile> new_file;
+  if (dense)
+    new_file.reset(new DenseFile(this, file.min_timestamp, file.duration));
+  else
+    new_file.reset(new CompressedFile(this,
+                                      file.min_timestamp,
+                                      file.max_timestamp));
+  RawBuffer rawbuf(points.data(), len);
+  WriteOperation<RawBuffer> rewrite_op(&rawbuf);
+  NameUniquely(*new_file);
+  ReplaceFiles({&file}, [&] { new_file->Write(rewrite_op); });
+  ReadFilenames();
+  return taken;
 }
 
 
-void DatapointDirectory::Write(WriteOperation& write_op) {
+template <typename Buffer>
+void DatapointDirectory::Write(WriteOperation<Buffer>& write_op) {
+  if (segment_store) {
+    WriteChunks(write_op);
+    return;
+  }
+
   CreateDirectory(path);
 
   if (!filenames_read)
     ReadFilenames();
 
-  auto file_it = FindFirstPotentialFile(write_op.cursor->timestamp);
+  auto file_it = FindFirstPotentialFile(write_op.Current().timestamp);
+  bool created_file = false;
 
   while (!write_op.Complete()) {
 
@@ -76,7 +306,10 @@ void DatapointDirectory::Write(WriteOperation& write_op) {
       // Ensure we don't make the file too large.
       write_op.max_writable_datapoints = (*file_it)->RemainingWritableDatapoints();
 
-      if (write_op.max_writable_datapoints == 0) {
+      // A full file that starts after the current datapoint is where the
+      // new file goes, so we mustn't skip past it.
+      if (write_op.max_writable_datapoints == 0 &&
+          write_op.Current().timestamp >= (*file_it)->min_timestamp) {
         file_it++;
         continue;
       }
@@ -88,15 +321,36 @@ void DatapointDirectory::Write(WriteOperation& write_op) {
           INT64_MAX : (*next_file)->min_timestamp - 1;
 
       // Skip old files that cannot hold the current datapoint
-      if (write_op.max_writable_timestamp < write_op.cursor->timestamp) {
+      if (write_op.max_writable_timestamp < write_op.Current().timestamp) {
         file_it++;
         continue;
       }
 
-      // If the file doesn't start in the future, attempt a write.
-      if (write_op.cursor->timestamp >= (*file_it)->min_timestamp) {
+      // A series keeping to its cadence moves on from a sparse file to a
+      // dense or constant one rather than appending to it.
+      if (cadence &&
+          write_op.Current().timestamp > (*file_it)->max_timestamp &&
+          dynamic_cast<SparseFile*>(file_it->get()) &&
+          DirectFormat(write_op) != FileFormat::SPARSE) {
+        file_it++;
+      } else if (write_op.Current().timestamp >= (*file_it)->min_timestamp) {
+        // The file doesn't start in the future, so we attempt a write.
+        write_op.max_writable_datapoints =
+            (*file_it)->RemainingWritableDatapoints();
         size_t datapoints_written = (*file_it)->Write(write_op);
-        write_op.cursor += datapoints_written; //TODO have WriteOperation::Advance() update its own cursor or something, called by DatapointFile::Write
+        write_op.Advance(datapoints_written);
+
+        // A new file inside a ConstantFile's range would never be read, so
+        // datapoints it can't take are written along with it instead.
+        auto constant_file = dynamic_cast<ConstantFile*>(file_it->get());
+        if (constant_file && !write_op.Complete() &&
+            write_op.Current().timestamp < constant_file->max_timestamp) {
+          write_op.Advance(RewriteConstantFile(*constant_file, write_op));
+          if (write_op.Complete())
+            break;
+          file_it = FindFirstPotentialFile(write_op.Current().timestamp);
+          continue;
+        }
         file_it++;
 
         // If we wrote some datapoints we can move on to the next file, otherwise
@@ -113,52 +367,360 @@ void DatapointDirectory::Write(WriteOperation& write_op) {
     write_op.max_writable_timestamp = (file_it == datapoint_files.end()) ?
         INT64_MAX : (*file_it)->min_timestamp - 1;
 
-    write_op.max_writable_datapoints = FLAGS_sparse_file_max_size / datapoint_size;
-
-    // Create a new sparse file.
-    std::unique_ptr<DatapointFile> new_file(
-      static_cast<DatapointFile*>(
-        new SparseFile(this,
-                       write_op.cursor->timestamp,
-                       write_op.cursor->timestamp)
-      )
-    );
-    write_op.cursor += new_file->Write(write_op);
+    // Create a new file, sparse unless the series is regular.
+    const Datapoint& first = write_op.Current();
+    std::unique_ptr<DatapointFile> new_file;
+    size_t datapoints_written = 0;
+    switch (DirectFormat(write_op)) {
+      case FileFormat::CONSTANT:
+        new_file.reset(new ConstantFile(
+            this, first.timestamp, first.duration, 0, first.value));
+        break;
+      case FileFormat::DENSE:
+        new_file.reset(new DenseFile(this, first.timestamp, first.duration));
+        break;
+      default:
+        break;
+    }
+    if (new_file) {
+      write_op.max_writable_datapoints = -1;
+      NameUniquely(*new_file);
+      datapoints_written = new_file->Write(write_op);
+    }
+
+    if (!datapoints_written) {
+      write_op.max_writable_datapoints =
+          FLAGS_sparse_file_max_size / datapoint_size;
+      new_file.reset(new SparseFile(this, first.timestamp, first.timestamp));
+      NameUniquely(*new_file);
+      datapoints_written = new_file->Write(write_op);
+    }
+    write_op.Advance(datapoints_written);
     file_it = datapoint_files.insert(file_it, std::move(new_file));
     file_it++;
+    created_file = true;
   }
+
+  if (created_file &&
+      FLAGS_compaction_min_files > 0 &&
+      datapoint_files.size() > static_cast<size_t>(FLAGS_compaction_min_files))
+    series->db->GetDirectoryCompactor()->Fragmented(series);
+
+  if (cadence)
+    cadence->Observe(*write_op.buffer);
+}
+
+
+template void DatapointDirectory::Write(WriteOperation<WriteBuffer>& write_op);
+template void DatapointDirectory::Write(WriteOperation<RawBuffer>& write_op);
+
+
+size_t DatapointDirectory::ExpireBefore(int64_t cutoff) {
+  if (segment_store)
+    return 0;  // Segments don't support expiry
+  if (!filenames_read) {
+    try {
+      ReadFilenames();
+    } catch (IOError& e) {
+      return 0;  // Nothing written yet
+    }
+  }
+
+  // Files are sorted and don't overlap, so the expired ones come first.
+  size_t expired = 0;
+  while (expired < datapoint_files.size() &&
+         datapoint_files[expired]->max_timestamp < cutoff)
+    expired++;
+  if (!expired)
+    return 0;
+
+  for (size_t i = 0; i < expired; i++) {
+    DatapointFile& file = *datapoint_files[i];
+    file_cache->Invalidate(file.GetPath());
+    if (unlink(file.GetPath().c_str()) == -1 && errno != ENOENT)
+      throw IOErrorFromErrno("DatapointDirectory unlink() failed path=" +
+                             file.GetPath());
+    FileRemoved(file);
+  }
+  datapoint_files.erase(datapoint_files.begin(),
+                        datapoint_files.begin() + expired);
+  LOG(INFO) << "Expired " << expired << " files in " << path;
+
+  // Write() recreates the directory, and the manifest as entries are put.
+  if (datapoint_files.empty()) {
+    if (cadence)
+      cadence->Remove();
+    string manifest_path = path + "/" + MANIFEST_FILENAME;
+    file_cache->Invalidate(manifest_path);
+    unlink(manifest_path.c_str());
+    if (rmdir(path.c_str()) == -1)
+      PLOG(WARNING) << "DatapointDirectory rmdir() failed path=" << path;
+  }
+  return expired;
+}
+
+
+bool DatapointDirectory::Empty() {
+  if (!filenames_read) {
+    try {
+      ReadFilenames();
+    } catch (IOError& e) {
+      return true;  // No directory
+    }
+  }
+  return datapoint_files.empty();
+}
+
+
+bool DatapointDirectory::LastTimestamp(int64_t& timestamp) {
+  if (Empty())
+    return false;
+
+  // The last file's max_timestamp may only bound its datapoints, so we read
+  // them.
+  const DatapointFile& last_file = *datapoint_files.back();
+  Datapoint buffer[256];
+  ReadOperation read_op(last_file.min_timestamp, INT64_MAX, INT64_MAX, false,
+                        buffer, 256);
+  bool found = false;
+  do {
+    read_op.ClearBuffer();
+    last_file.Read(read_op);
+    if (read_op.DatapointsInBuffer()) {
+      timestamp = (read_op.cursor - 1)->timestamp;
+      found = true;
+    }
+  } while (!read_op.SpaceLeft());
+  return found;
 }
 
 
 vector<std::unique_ptr<DatapointFile>>::iterator
 DatapointDirectory::FindFirstPotentialFile(int64_t timestamp)
 {
-  // Return the last datapoint_files member with min_timestamp <= timestamp.
-  int left = 0;
-  int middle = 0;
-  int right = datapoint_files.size();
+  // Return the last datapoint_files member with min_timestamp <= timestamp,
+  // or the first one if they all start later.
+  size_t left = 0;
+  size_t right = datapoint_files.size();
   while (left < right) {
-    middle = (right - left) / 2;
+    size_t middle = left + (right - left) / 2;
     if (datapoint_files[middle]->min_timestamp > timestamp)
       right = middle;
-    else if (datapoint_files[middle]->min_timestamp < timestamp)
-      left = middle + 1;
     else
-      break;
+      left = middle + 1;
+  }
+  return datapoint_files.begin() + (left ? left - 1 : 0);
+}
+
+
+void DatapointDirectory::FileChanged(DatapointFile& file) {
+  if (manifest) {
+    if (replacing.empty()) {
+      manifest->Put(file.Describe());
+    } else {
+      manifest->Replace(file.Describe(), replacing);
+      replacing.clear();
+    }
+    return;
+  }
+
+  string new_filename = file.Filename();
+  if (new_filename == file.filename)
+    return;
+
+  string old_path = file.GetPath();
+  file.filename = new_filename;
+  LOG(INFO) << "DatapointDirectory renaming " << old_path
+            << " to " << file.GetPath();
+  if (rename(old_path.c_str(), file.GetPath().c_str()) == -1)
+    throw IOErrorFromErrno("DatapointDirectory rename() failed path=" + old_path);
+  file_cache->Renamed(old_path, file.GetPath());
+}
+
+
+void DatapointDirectory::FileRemoved(const DatapointFile& file) {
+  if (manifest)
+    manifest->Remove(file.filename);
+}
+
+
+void DatapointDirectory::NameUniquely(DatapointFile& file) {
+  if (!manifest)
+    return;
+
+  const string name = file.Filename();
+  file.filename = name;
+  for (int n = 1;
+       manifest->Contains(file.filename) || FileExists(file.GetPath());
+       n++)
+    file.filename = name + "~" + to_string(n);
+}
+
+
+void DatapointDirectory::ReplaceFiles(
+    const vector<const DatapointFile*>& replaced,
+    const std::function<void()>& write)
+{
+  replacing.clear();
+  for (const DatapointFile* file : replaced)
+    replacing.push_back(file->filename);
+  try {
+    write();
+  } catch (...) {
+    replacing.clear();
+    throw;
+  }
+
+  // Otherwise write() wrote nothing, and the old files are all we have.
+  bool recorded = !manifest || replacing.empty();
+  replacing.clear();
+  if (!recorded) {
+    LOG(ERROR) << "Keeping " << replaced.size() << " files in " << path
+               << " that nothing replaced";
+    return;
+  }
+
+  for (const DatapointFile* file : replaced) {
+    file_cache->Invalidate(file->GetPath());
+    if (unlink(file->GetPath().c_str()) == -1)
+      LOG(ERROR) << "Failed to delete replaced file: " << file->GetPath();
+    FileRemoved(*file);
   }
-  return datapoint_files.begin() + middle;
+}
+
+
+DatapointFile* DatapointDirectory::FindFile(const string& filename) {
+  for (auto& file : datapoint_files)
+    if (file->filename == filename)
+      return file.get();
+  return nullptr;
 }
 
 
 void DatapointDirectory::ReadFilenames() {
+  if (segment_store) {
+    ReadChunks();
+    return;
+  }
+
+  if (manifest && manifest->Load()) {
+    ReadManifest();
+    return;
+  }
+
+  ScanDirectory();
+  if (!manifest)
+    return;
+
+  // This directory predates its manifest, or lost it.
+  vector<ManifestEntry> entries;
+  for (auto& file : datapoint_files) {
+    file->size = GetFileSize(file->GetPath(), true);
+    entries.push_back(file->Describe());
+  }
+  manifest->Reset(entries);
+  LOG(INFO) << "Created manifest for " << entries.size()
+            << " files in " << path;
+}
+
+
+void DatapointDirectory::ReadChunks() {
+  // A compaction between here and Chunks() just makes us read them again.
+  segment_generation = segment_store->Generation();
+
+  vector<std::unique_ptr<DatapointFile>> new_files;
+  for (const SegmentChunk& chunk : segment_store->Chunks(series->keyint))
+    new_files.emplace_back(new SegmentFile(this, segment_store, chunk));
+
+  datapoint_files.swap(new_files);
+  filenames_read = true;
+}
+
+
+void DatapointDirectory::ReadManifest() {
+  vector<std::unique_ptr<DatapointFile>> new_files;
+  for (const ManifestEntry& entry : manifest->Entries()) {
+    std::unique_ptr<DatapointFile> data_file = FileFromEntry(entry);
+    if (data_file.get() != nullptr)
+      new_files.push_back(std::move(data_file));
+  }
+
+  // Entries come in the order they were recorded, which the stable sort
+  // keeps among files with the same min_timestamp. Such files are all live,
+  // conversions drop the files they replace in the same record.
+  std::stable_sort(new_files.begin(), new_files.end(),
+      [] (const std::unique_ptr<DatapointFile>& a,
+          const std::unique_ptr<DatapointFile>& b) -> bool {
+        return *a < *b;
+      }
+  );
+
+  datapoint_files.swap(new_files);
+  filenames_read = true;
+}
+
+
+std::unique_ptr<DatapointFile> DatapointDirectory::FileFromEntry(
+    const ManifestEntry& entry)
+{
+  DatapointFile* file;
+  switch (entry.format) {
+    case FileFormat::SPARSE:
+      file = new SparseFile(this,
+                            entry.min_timestamp,
+                            entry.max_timestamp,
+                            entry.flags & FILE_OPTIMIZED,
+                            entry.flags & FILE_SEALED);
+      break;
+
+    case FileFormat::DENSE:
+      file = new DenseFile(this,
+                           entry.min_timestamp,
+                           entry.duration,
+                           entry.max_timestamp);
+      break;
+
+    case FileFormat::CONSTANT:
+      file = new ConstantFile(this,
+                              entry.min_timestamp,
+                              entry.duration,
+                              entry.count,
+                              entry.value);
+      break;
+
+    case FileFormat::COMPRESSED:
+      file = new CompressedFile(this,
+                                entry.min_timestamp,
+                                entry.max_timestamp,
+                                true);  // written
+      break;
+
+    default:
+      LOG(ERROR) << "Unknown format in manifest of " << path
+                 << " file=" << entry.filename;
+      return nullptr;
+  }
+
+  file->filename = entry.filename;
+  file->size = entry.size;
+  file->checksum = entry.checksum;
+  file->checksummed = entry.flags & FILE_CHECKSUMMED;
+  return std::unique_ptr<DatapointFile>(file);
+}
+
+
+void DatapointDirectory::ScanDirectory() {
   DirectoryHandle dir(path);
 
   if (dir.stream == NULL)
     throw IOErrorFromErrno("ReadFilenames opendir() failed path=" + path);
 
   struct dirent64* entry;
+  char name[NAME_MAX + 1] = {};
+  char* tag;
   std::unique_ptr<DatapointFile> data_file;
   vector<std::unique_ptr<DatapointFile>> new_files;
+  bool found_manifest = false;
 
   // Now we update our maps with new directory entries
   while ((entry = readdir64(dir.stream)) != NULL) {
@@ -166,21 +728,30 @@ void DatapointDirectory::ReadFilenames() {
       case DT_REG:
       case DT_LNK:
       case DT_UNKNOWN:
+        if (strcmp(entry->d_name, MANIFEST_FILENAME) == 0) {
+          found_manifest = true;
+          continue;
+        }
 
-        data_file = ConstantFile::FromFilename(this, entry->d_name);
-        if (data_file.get() != nullptr)
-          new_files.push_back(std::move(data_file));
+        // The "~<n>" NameUniquely() may have added says nothing about the
+        // file's contents.
+        strncpy(name, entry->d_name, sizeof(name) - 1);
+        tag = strrchr(name, '~');
+        if (tag && tag[1] && strspn(tag + 1, "0123456789") == strlen(tag + 1))
+          *tag = '\0';
+
+        data_file = ConstantFile::FromFilename(this, name);
+        if (data_file.get() == nullptr)
+          data_file = DenseFile::FromFilename(this, name);
+        if (data_file.get() == nullptr)
+          data_file = CompressedFile::FromFilename(this, name);
+        if (data_file.get() == nullptr)
+          data_file = SparseFile::FromFilename(this, name);
 
-        data_file = DenseFile::FromFilename(this, entry->d_name);
         if (data_file.get() != nullptr) {
+          data_file->filename = entry->d_name;
           new_files.push_back(std::move(data_file));
-          continue;
         }
-
-        data_file = SparseFile::FromFilename(this, entry->d_name);
-        if (data_file.get() != nullptr)
-          new_files.push_back(std::move(data_file));
-
         break;
 
       default: // Ignore uninteresting dirent types
@@ -188,7 +759,45 @@ void DatapointDirectory::ReadFilenames() {
     }
   }
 
-  std::sort(new_files.begin(), new_files.end());
+  // Of files with the same min_timestamp, those NameUniquely() tagged were
+  // created later, "~<n>" after "~<n-1>".
+  std::sort(new_files.begin(), new_files.end(),
+      [] (const std::unique_ptr<DatapointFile>& a,
+          const std::unique_ptr<DatapointFile>& b) -> bool {
+        if (a->min_timestamp != b->min_timestamp)
+          return *a < *b;
+        if (a->filename.size() != b->filename.size())
+          return a->filename.size() < b->filename.size();
+        return a->filename < b->filename;
+      }
+  );
+
+  // Files listed in a manifest aren't renamed as they grow, so sparse files
+  // may hold more than their names say. One named <min>-<min> may extend up
+  // to the next file starting later.
+  if (manifest || found_manifest) {
+    for (size_t i = 0; i < new_files.size(); i++) {
+      DatapointFile* file = new_files[i].get();
+      if (dynamic_cast<SparseFile*>(file) == nullptr ||
+          file->max_timestamp != file->min_timestamp)
+        continue;
+      size_t next = i + 1;
+      while (next < new_files.size() &&
+             new_files[next]->min_timestamp == file->min_timestamp)
+        next++;
+      file->max_timestamp = (next < new_files.size()) ?
+          new_files[next]->min_timestamp - 1 : INT64_MAX;
+    }
+  }
+
+  // A manifest we didn't keep up to date must not be trusted later.
+  if (found_manifest && !manifest) {
+    string manifest_path = path + "/" + MANIFEST_FILENAME;
+    LOG(WARNING) << "Removing stale manifest " << manifest_path;
+    file_cache->Invalidate(manifest_path);
+    unlink(manifest_path.c_str());
+  }
+
   datapoint_files.swap(new_files);
   filenames_read = true;
 }
@@ -2,20 +2,26 @@
 #define VQRO_DB_DATAPOINT_DIRECTORY_H
 
 #include <exception>
+#include <functional>
 #include <vector>
 #include <memory>
 
 #include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/cadence.h"
 #include "vqro/db/read_op.h"
 #include "vqro/db/write_op.h"
 #include "vqro/db/datapoint.h"
 #include "vqro/db/datapoint_file.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/segment_store.h"
 #include "vqro/db/storage_optimizer.h"
 
 namespace vqro {
 namespace db {
 
 
+class ConstantFile;
 class Series;
 
 
@@ -24,10 +30,17 @@ class DatapointDirectory {
 
  public:
   Series* const series;
+  FileCache* const file_cache;  // Shared with the series' worker thread
+  SegmentStore* const segment_store;  // Null unless --storage_engine=segments
   string path;
 
-  DatapointDirectory(Series* s, string p) :
+  DatapointDirectory(Series* s,
+                     FileCache* cache,
+                     string p,
+                     SegmentStore* segments=nullptr) :
     series(s),
+    file_cache(cache),
+    segment_store(segments),
     path(p)
   {
     while (!path.empty() && path.back() == '/')
@@ -35,20 +48,92 @@ class DatapointDirectory {
 
     if (path.empty())
       throw std::logic_error("DatapointDirectory path cannot be empty..");
+
+    if (FLAGS_datapoint_manifest && !segment_store)
+      manifest.reset(new Manifest(path, file_cache));
+    if (FLAGS_cadence_profiles && !segment_store)
+      cadence.reset(new CadenceProfile(path, file_cache));
   }
 
   //disable copy & assign
   DatapointDirectory(const DatapointDirectory& other) = delete;
   DatapointDirectory& operator=(const DatapointDirectory& other) = delete;
 
-  void Write(WriteOperation& wrote_op);
+  // Defined for WriteOperation<WriteBuffer> and WriteOperation<RawBuffer>.
+  template <typename Buffer>
+  void Write(WriteOperation<Buffer>& write_op);
   void Read(ReadOperation& read_op);
 
+  // Reads the directory listing ahead of the first Read() or Write().
+  void Prefetch();
+
+  // Drops what we know of our files, to be read from disk again when next
+  // needed. For when writes queued in an IoBatch failed after our files and
+  // manifest recorded them.
+  void Forget();
+
+  // Removes every file whose datapoints all lie before cutoff, and the
+  // directory itself once it holds no files. Files straddling cutoff are
+  // kept whole. Returns the number of files removed, always zero in a
+  // segment store, which doesn't support expiry. Throws IOError.
+  size_t ExpireBefore(int64_t cutoff);
+
+  // True if we have no files, after reading our filenames if need be.
+  bool Empty();
+
+  // Finds our latest datapoint's timestamp. Returns false if we have none.
+  // Throws IOError.
+  bool LastTimestamp(int64_t& timestamp);
+
+  // Must be called after a file's metadata changes. With a manifest the
+  // file's entry is updated, otherwise the file is renamed to match.
+  void FileChanged(DatapointFile& file);
+
+  // Must be called after a file is unlinked.
+  void FileRemoved(const DatapointFile& file);
+
+  // Names file, which is about to be created, so that it shares its name
+  // with no other file. Files in a manifest keep the name they were created
+  // with, so a new file's Filename() may belong to an older file that has
+  // since grown, or to one a crash left behind.
+  void NameUniquely(DatapointFile& file);
+
+  // Calls write, which must write a new file, and records that file in place
+  // of replaced. With a manifest both are one record, so after a crash we
+  // hold either the new file or the old ones but never both. The old files
+  // are then unlinked, unless write recorded nothing. Throws IOError.
+  void ReplaceFiles(const vector<const DatapointFile*>& replaced,
+                    const std::function<void()>& write);
+
  private:
   bool filenames_read = false;
   vector<std::unique_ptr<DatapointFile>> datapoint_files {};
+  std::unique_ptr<Manifest> manifest;  // Null without --datapoint_manifest
+  std::unique_ptr<CadenceProfile> cadence;  // Null without --cadence_profiles
+  uint64_t segment_generation = 0;  // Of segment_store when our files were read
+  vector<string> replacing;  // By the file ReplaceFiles() is writing
 
+  // Loads our files from the manifest if we have one, otherwise from the
+  // directory listing.
   void ReadFilenames();
+  void ReadChunks();
+  void ReadManifest();
+  void ScanDirectory();
+  std::unique_ptr<DatapointFile> FileFromEntry(const ManifestEntry& entry);
+  DatapointFile* FindFile(const string& filename);
+
+  // The write path with a segment_store, where files can't be appended to.
+  template <typename Buffer>
+  void WriteChunks(WriteOperation<Buffer>& write_op);
+
+  template <typename Buffer>
+  size_t RewriteConstantFile(const ConstantFile& file,
+                             const WriteOperation<Buffer>& write_op);
+
+  // The kind of file our cadence profile says write_op's datapoints from its
+  // cursor on should start, SPARSE unless they keep to a regular cadence.
+  template <typename Buffer>
+  FileFormat DirectFormat(WriteOperation<Buffer>& write_op);
 
   vector<std::unique_ptr<DatapointFile>>::iterator FindFirstPotentialFile(
       int64_t timestamp);
@@ -1,6 +1,37 @@
+#include "vqro/db/datapoint_directory.h"
 #include "vqro/db/datapoint_file.h"
 
 
 DEFINE_int32(datapoint_file_mode,
              0644,
              "Permission bits for datapoint files (default: 0644)");
+DEFINE_bool(mmap_reads,
+            true,
+            "Read datapoint files through memory mappings kept in the file "
+            "cache instead of with read().");
+
+
+namespace vqro {
+namespace db {
+
+
+string DatapointFile::GetPath() const {
+  return dir->path + "/" + filename;
+}
+
+
+ManifestEntry DatapointFile::DescribeAs(FileFormat format) const {
+  ManifestEntry entry {};
+  entry.filename = filename;
+  entry.format = format;
+  entry.flags = checksummed ? FILE_CHECKSUMMED : 0;
+  entry.min_timestamp = min_timestamp;
+  entry.max_timestamp = max_timestamp;
+  entry.size = size;
+  entry.checksum = checksum;
+  return entry;
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -4,11 +4,13 @@
 #include <cstdint>
 #include <gflags/gflags.h>
 #include "vqro/db/datapoint.h"
+#include "vqro/db/manifest.h"
 #include "vqro/db/read_op.h"
 #include "vqro/db/write_op.h"
 
 
 DECLARE_int32(datapoint_file_mode);
+DECLARE_bool(mmap_reads);
 
 
 namespace vqro {
@@ -24,6 +26,14 @@ class DatapointFile {
   int64_t min_timestamp;
   int64_t max_timestamp;
 
+  // Name of the file within dir. Without a manifest this is kept equal to
+  // Filename() by renaming the file, with one it is the name the file was
+  // created with.
+  string filename;
+  int64_t size = 0;         // Bytes, as of our last write
+  uint32_t checksum = 0;    // crc32 of the first size bytes, if checksummed
+  bool checksummed = false;
+
   DatapointFile() = default;
   DatapointFile(DatapointDirectory* _dir, int64_t _min, int64_t _max) :
     dir(_dir),
@@ -31,14 +41,27 @@ class DatapointFile {
     max_timestamp(_max) {}
 
   virtual ~DatapointFile() {}
-  virtual string GetPath() const = 0;
+
+  // The name encoding this file's current metadata.
+  virtual string Filename() const = 0;
+  string GetPath() const;
+
+  virtual ManifestEntry Describe() const = 0;
+
   virtual void Read(ReadOperation& read_op) const = 0;
-  virtual size_t Write(const WriteOperation& write_op) = 0;
+  // One overload per buffer type, since templates can't be virtual.
+  // Subclasses forward both to a common template.
+  virtual size_t Write(const WriteOperation<WriteBuffer>& write_op) = 0;
+  virtual size_t Write(const WriteOperation<RawBuffer>& write_op) = 0;
   virtual size_t RemainingWritableDatapoints() const = 0;
 
   bool operator<(const DatapointFile& rhs) const {
     return min_timestamp < rhs.min_timestamp;
   }
+
+ protected:
+  // The parts of a ManifestEntry common to all formats.
+  ManifestEntry DescribeAs(FileFormat format) const;
 };
 
 
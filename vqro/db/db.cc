@@ -1,16 +1,27 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <thread>
 
 #include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/base/io_backend.h"
 #include "vqro/base/worker.h"
 #include "vqro/rpc/core.pb.h"
 #include "vqro/rpc/storage.pb.h"
 #include "vqro/db/db.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/flush_scheduler.h"
+#include "vqro/db/retention_sweeper.h"
+#include "vqro/db/rollups.h"
 #include "vqro/db/series.h"
+#include "vqro/db/series_buffer.h"
 #include "vqro/db/storage_optimizer.h"
+#include "vqro/db/write_ahead_log.h"
+#include "vqro/db/write_buffer.h"
+#include "vqro/db/write_stream.h"
 
 
 DEFINE_int32(read_buffer_size,
@@ -19,28 +30,93 @@ DEFINE_int32(read_buffer_size,
 DEFINE_int32(db_worker_threads,
              64,
              "Number of database worker threads.");
-DEFINE_int32(flusher_resort_interval,
+DEFINE_int32(maintenance_interval,
              5000,
-             "How often (milliseconds) the flusher thread will re-sort its "
-             "series list.");
+             "How often (milliseconds) the maintenance thread truncates the "
+             "write ahead log and evicts idle series.");
+DEFINE_int32(open_file_cache_size,
+             8192,
+             "Maximum number of datapoint files kept open between reads and "
+             "writes, split evenly between the worker threads.");
+DEFINE_int64(write_buffer_max_idle_bytes,
+             1 << 24,  // 16MB
+             "Maximum bytes of freed write buffer pages each worker keeps "
+             "around for reuse.");
+DEFINE_int64(write_buffer_memory_limit,
+             1LL << 31,  // 2GB
+             "Maximum bytes of memory all series' write buffers may hold "
+             "between them. Writes beyond this are refused with a retry "
+             "hint until flushes catch up. Zero means no limit.");
+DEFINE_double(write_buffer_flush_threshold,
+              0.5,
+              "Fraction of --write_buffer_memory_limit beyond which series "
+              "are flushed ahead of their --flush_max_age deadlines.");
+DEFINE_bool(preload_series,
+            false,
+            "Load every indexed series into memory at startup and read "
+            "their directory listings in the background, rather than "
+            "waiting for each one's first read or write. At most "
+            "--max_series_in_memory are loaded if that is set.");
+DEFINE_int32(series_idle_timeout,
+             3600,
+             "Seconds after its last read or write that a fully flushed "
+             "series is evicted from memory. Zero disables idle eviction.");
+DEFINE_int64(max_series_in_memory,
+             0,
+             "Maximum number of series kept in memory. Beyond this the least "
+             "recently used fully flushed series are evicted regardless of "
+             "--series_idle_timeout. Zero means no limit.");
 
 
 namespace vqro {
 namespace db {
 
 
+// Bounds on the retry hint given to clients refused by CheckWriteBudget().
+static constexpr int64_t min_retry_after_ms = 100;
+static constexpr int64_t max_retry_after_ms = 10000;
+
+
+static int64_t FlushThresholdBytes() {
+  return FLAGS_write_buffer_memory_limit * FLAGS_write_buffer_flush_threshold;
+}
+
+
 Database::Database(string dir) {
   if (dir.empty())
     throw std::invalid_argument("No data directory specified");
 
+  if (FLAGS_write_buffer_format != "paged" &&
+      FLAGS_write_buffer_format != "compressed")
+    throw std::invalid_argument("Invalid --write_buffer_format: " +
+                                FLAGS_write_buffer_format);
+  if (FLAGS_sealed_sparse_format != "compressed" &&
+      FLAGS_sealed_sparse_format != "sorted")
+    throw std::invalid_argument("Invalid --sealed_sparse_format: " +
+                                FLAGS_sealed_sparse_format);
+  if (FLAGS_storage_engine != "directories" &&
+      FLAGS_storage_engine != "segments")
+    throw std::invalid_argument("Invalid --storage_engine: " +
+                                FLAGS_storage_engine);
+  if (FLAGS_io_backend != "sync" && FLAGS_io_backend != "io_uring")
+    throw std::invalid_argument("Invalid --io_backend: " + FLAGS_io_backend);
+  retention_sweeper.reset(new RetentionSweeper(this));
+  rollup_widths = ParseRollupTiers(FLAGS_rollup_tiers);
+
   root_dir = dir;
   if (root_dir.back() != '/')
     root_dir += "/";
 
   CreateDirectory(root_dir);
 
+  series_registry.reset(new SeriesRegistry(
+      std::max(FLAGS_series_registry_shards, 1)));
+
   LOG(INFO) << "initializing search engine";
   search_engine.reset(new SearchEngine(root_dir));
+  search_engine->StartIndexer(
+      [this] (Series* series) { series_registry->AddId(series); },
+      [this] (int64_t series_id) { ForgetSeriesId(series_id); });
 
   LOG(INFO) << "initializing storage optimizer";
   storage_optimizer.reset(new StorageOptimizer(this));
@@ -50,39 +126,541 @@ Database::Database(string dir) {
 
   LOG(INFO) << "starting " << num_workers << " worker threads";
   while (num_workers--) {
+    allocators.emplace_back(new SlabAllocator(
+        WriteBuffer::AllocSizeClasses(),
+        FLAGS_write_buffer_max_idle_bytes));
+    file_caches.emplace_back(new FileCache(
+        std::max(FLAGS_open_file_cache_size, 1) /
+        std::max(FLAGS_db_worker_threads, 1)));
     workers.emplace_back(new WorkerThread());
     workers.back()->Start().wait();
   }
 
-  // Might make more sense to just have a generic schedule thread and use that plus workers.
-  std::thread flusher([&] { FlushWriteBuffers(); });
-  flusher.detach();
+  // Each worker appends to a segment of its own.
+  if (FLAGS_storage_engine == "segments") {
+    LOG(INFO) << "loading segments";
+    segment_store.reset(new SegmentStore(root_dir + "segments",
+                                         workers.size()));
+    segment_store->Start();
+  }
+
+  // Before any flushes, which may leave directories to compact.
+  directory_compactor.reset(new DirectoryCompactor(this));
+  directory_compactor->Start();
+
+  // Replayed writes are scheduled for flushing like any others.
+  flush_scheduler.reset(new FlushScheduler(this));
+  flush_scheduler->Start();
+
+  if (FLAGS_preload_series) {
+    LOG(INFO) << "preloading series";
+    PreloadSeries();
+  }
+
+  if (FLAGS_write_ahead_log) {
+    LOG(INFO) << "replaying write ahead log";
+    wal.reset(new WriteAheadLog(root_dir + "wal/"));
+    ReplayWriteAheadLog();
+    wal->Start();
+  }
+
+  if (retention_sweeper->Enabled())
+    retention_sweeper->Start();
+
+  maintenance = std::thread([this] { RunMaintenance(); });
 }
 
 
 Database::~Database() {
   LOG(INFO) << "Database::~Database()";
+  {
+    std::lock_guard<std::mutex> guard(maintenance_mutex);
+    stop_maintenance = true;
+  }
+  maintenance_wakeup.notify_one();
+  if (maintenance.joinable())
+    maintenance.join();
+
+  retention_sweeper->Stop();
+  flush_scheduler->Stop();
+  directory_compactor->Stop();
   for (auto worker : workers) {
     worker->Stop().wait();
   }
+  segment_store.reset();
+  search_engine->StopIndexer();
 }
 
 
 void Database::Write(vqro::rpc::WriteOperation& op)
 {
-  Series* series = GetSeries(op.series());
-  WorkerThread* worker = GetWorker(series);
-
-  worker->Do([&] {
-    series->Write(op);
-  }).wait();
+  CheckWriteBudget();
+
+  std::shared_ptr<Series> series = GetSeries(op);
+  WorkerThread* worker = GetWorker(series.get());
+
+  // The op is logged only once the worker has taken it. A refused op must
+  // not be in the log or replay would apply it on top of the client's retry.
+  // Errors from the task, ie. a failed log, are rethrown by get().
+  uint64_t lsn = 0;
+  std::future<void> applied;
+  try {
+    applied = worker->Do([&] {
+      if (wal)
+        lsn = wal->Append(op);
+      ApplyWrite(series.get(), op, lsn);
+    });
+  } catch (WorkerThreadTooBusy& err) {
+    throw WriteBackpressure("worker thread queue is full",
+                            RetryAfterMillis());
+  }
+  applied.get();
 
   if (!series->is_indexed)
+    IndexSeries(series);
+
+  if (lsn)
+    wal->WaitDurable(lsn);
+}
+
+
+void Database::Write(const vqro::rpc::WriteBatch& batch)
+{
+  CheckWriteBudget();
+  ValidateBatch(batch);
+
+  vector<std::shared_ptr<Series>> series = GetSeries(batch);
+
+  // Like a single WriteOperation, a batch is refused before anything is
+  // logged or queued if a worker it needs is saturated. Once part of it is
+  // queued the rest must follow.
+  for (auto& s : series) {
+    if (!GetWorker(s.get())->WaitForRoom(0))
+      throw WriteBackpressure("worker thread queue is full",
+                              RetryAfterMillis());
+  }
+
+  uint64_t lsn = 0;
+  std::exception_ptr error;
+  std::promise<void> applied;
+  std::future<void> done = applied.get_future();
+  QueueBatch(batch, series, 0, [&] (uint64_t max_lsn, std::exception_ptr e) {
+    lsn = max_lsn;
+    error = e;
+    applied.set_value();
+  });
+  done.wait();
+
+  for (auto& s : series) {
+    if (!s->is_indexed)
+      IndexSeries(s);
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+  if (lsn)
+    wal->WaitDurable(lsn);
+}
+
+
+void Database::ValidateBatch(const vqro::rpc::WriteBatch& batch) {
+  for (const auto& columns : batch.columns()) {
+    if (!columns.series_handle() &&
+        columns.series_index() >= static_cast<uint32_t>(batch.series_size()))
+      throw InvalidSeriesProto("WriteBatch series_index out of range");
+
+    if (columns.values_size() != columns.timestamps_size())
+      throw InvalidSeriesProto("WriteBatch needs one value per timestamp");
+
+    if (columns.durations_size() > 1 &&
+        columns.durations_size() != columns.timestamps_size())
+      throw InvalidSeriesProto("WriteBatch needs one duration, or one per "
+                               "timestamp");
+  }
+}
+
+
+// The columns of batch at indexes, each labelled with its series' proto
+// rather than a series index or handle.
+static vqro::rpc::WriteBatch BatchPart(
+    const vqro::rpc::WriteBatch& batch,
+    const vector<std::shared_ptr<Series>>& series,
+    const vector<int>& indexes)
+{
+  vqro::rpc::WriteBatch part;
+  for (int i : indexes) {
+    *part.add_series() = series[i]->proto;
+    vqro::rpc::SeriesColumns* columns = part.add_columns();
+    *columns = batch.columns(i);
+    columns->clear_series_handle();
+    columns->set_series_index(part.series_size() - 1);
+  }
+  return part;
+}
+
+
+// series holds the Series of each of batch's columns, as from GetSeries(batch).
+// batch and series must outlive the queued work, ie. until done is called.
+//
+// A replayed batch comes with the lsn it was logged at. Otherwise each worker
+// logs its own part of the batch once it has taken it, as single writes are
+// logged, so every series' records are logged in the order they are applied.
+// A part that fails to be logged isn't applied, though other parts may be.
+void Database::QueueBatch(const vqro::rpc::WriteBatch& batch,
+                          const vector<std::shared_ptr<Series>>& series,
+                          uint64_t lsn,
+                          BatchDoneFunc done)
+{
+  // Group the batch's columns by the worker that owns their series.
+  auto by_worker = std::make_shared<vector<vector<int>>>(workers.size());
+  size_t parts = 0;
+  for (int i = 0; i < batch.columns_size(); i++) {
+    Series* s = series[i].get();
+    vector<int>& columns = (*by_worker)[s->keyint % workers.size()];
+    if (columns.empty())
+      parts++;
+    columns.push_back(i);
+  }
+
+  if (!parts) {
+    if (lsn) wal->Applied(lsn);
+    done(lsn, nullptr);
+    return;
+  }
+
+  // The last worker to finish its part marks a replayed batch applied.
+  struct Progress {
+    std::mutex mutex;
+    size_t remaining;
+    uint64_t max_lsn;
+    std::exception_ptr error;
+  };
+  auto progress = std::make_shared<Progress>();
+  progress->remaining = parts;
+  progress->max_lsn = lsn;
+
+  for (size_t w = 0; w < workers.size(); w++) {
+    if ((*by_worker)[w].empty())
+      continue;
+
+    auto apply = [this, &batch, &series, by_worker, w, progress, lsn, done] {
+      const vector<int>& columns = (*by_worker)[w];
+      uint64_t part_lsn = lsn;
+      std::exception_ptr error;
+      try {
+        if (!part_lsn && wal)
+          part_lsn = wal->Append(BatchPart(batch, series, columns));
+      } catch (std::exception& e) {
+        LOG(ERROR) << "Failed to log WriteBatch columns: " << e.what();
+        error = std::current_exception();
+      }
+
+      if (!error) {
+        for (int i : columns) {
+          Series* s = series[i].get();
+          int64_t bytes_before = s->BytesBuffered();
+          try {
+            s->Write(batch.columns(i), part_lsn);
+          } catch (std::exception& e) {
+            LOG(ERROR) << "Failed to apply WriteBatch columns: " << e.what();
+          }
+          ChargeWriteBuffer(s->BytesBuffered() - bytes_before);
+          flush_scheduler->Buffered(s);
+        }
+        if (part_lsn && part_lsn != lsn)
+          wal->Applied(part_lsn);
+      }
+
+      bool last;
+      {
+        std::lock_guard<std::mutex> guard(progress->mutex);
+        progress->max_lsn = std::max(progress->max_lsn, part_lsn);
+        if (error && !progress->error)
+          progress->error = error;
+        last = --progress->remaining == 0;
+      }
+      if (last) {
+        if (lsn) wal->Applied(lsn);
+        done(progress->max_lsn, progress->error);
+      }
+    };
+
+    // Part of the batch may already be queued on other workers, so rather
+    // than fail we wait for a saturated worker to make room.
+    while (true) {
+      try {
+        workers[w]->Post(apply);
+        break;
+      } catch (WorkerThreadTooBusy& err) {
+        workers[w]->WaitForRoom(100);
+      }
+    }
+  }
+}
+
+
+// Must run on series' worker thread.
+void Database::ApplyWrite(Series* series,
+                          vqro::rpc::WriteOperation& op,
+                          uint64_t lsn)
+{
+  int64_t bytes_before = series->BytesBuffered();
+  try {
+    series->Write(op, lsn);
+  } catch (...) {
+    ChargeWriteBuffer(series->BytesBuffered() - bytes_before);
+    flush_scheduler->Buffered(series);
+    if (lsn) wal->Applied(lsn);
+    throw;
+  }
+  ChargeWriteBuffer(series->BytesBuffered() - bytes_before);
+  flush_scheduler->Buffered(series);
+  if (lsn) wal->Applied(lsn);
+}
+
+
+void Database::CheckWriteBudget() {
+  if (FLAGS_write_buffer_memory_limit <= 0 ||
+      buffered_bytes < FLAGS_write_buffer_memory_limit)
+    return;
+
+  flush_scheduler->MemoryPressure();
+  throw WriteBackpressure(
+      "write buffers hold " + to_string(buffered_bytes.load()) +
+      " bytes, limit is " + to_string(FLAGS_write_buffer_memory_limit),
+      RetryAfterMillis());
+}
+
+
+void Database::ChargeWriteBuffer(int64_t bytes) {
+  int64_t total = buffered_bytes += bytes;
+  if (bytes > 0 &&
+      FLAGS_write_buffer_memory_limit > 0 &&
+      total >= FlushThresholdBytes())
+    flush_scheduler->MemoryPressure();
+}
+
+
+bool Database::OverFlushThreshold() {
+  return FLAGS_write_buffer_memory_limit > 0 &&
+         buffered_bytes >= FlushThresholdBytes();
+}
+
+
+// Must run on the series' worker thread. Their writes are queued in one
+// IoBatch, so they reach the disk in a few submissions rather than a syscall
+// apiece. Sets flushed[i] to whether series[i] was flushed.
+void Database::FlushSeries(const vector<std::shared_ptr<Series>>& series,
+                           vector<bool>& flushed) {
+  flushed.assign(series.size(), true);
+  vector<int64_t> bytes_before(series.size());
+  {
+    IoBatch batch;
+    for (size_t i = 0; i < series.size(); i++) {
+      bytes_before[i] = series[i]->BytesBuffered();
+      batch.SetOwner(i);
+      try {
+        series[i]->WriteBufferedDatapoints();
+      } catch (std::exception& e) {
+        // Whatever it queued before failing is left unwritten, as if those
+        // writes had failed too.
+        LOG(ERROR) << "Failed to flush series " << series[i]->keystr << ": "
+                   << e.what();
+        batch.Abandon(i);
+        series[i]->AbandonFlush();
+        flushed[i] = false;
+      }
+    }
+
+    batch.Drain();
+    for (size_t i = 0; i < series.size(); i++) {
+      int error = batch.Error(i);
+      if (!error || !flushed[i])
+        continue;
+      LOG(ERROR) << "Failed to flush series " << series[i]->keystr << ": "
+                 << strerror(error);
+      series[i]->AbandonFlush();
+      flushed[i] = false;
+    }
+  }
+
+  for (size_t i = 0; i < series.size(); i++) {
+    if (flushed[i]) {
+      try {
+        series[i]->FinishFlush();
+      } catch (std::exception& e) {
+        LOG(ERROR) << "Failed to finish flushing series "
+                   << series[i]->keystr << ": " << e.what();
+        flushed[i] = false;
+      }
+    }
+    int64_t bytes_freed = bytes_before[i] - series[i]->BytesBuffered();
+    ChargeWriteBuffer(-bytes_freed);
+    flushed_bytes += bytes_freed;
+  }
+}
+
+
+int64_t Database::RetryAfterMillis() {
+  // Estimate how long flushes need to get us back under the flush
+  // threshold at the rate it has recently been going.
+  int64_t excess = buffered_bytes - FlushThresholdBytes();
+  int64_t rate = flushed_bytes_per_sec;
+  int64_t retry_ms = (rate > 0) ? excess * 1000 / rate : max_retry_after_ms;
+  return std::min(std::max(retry_ms, min_retry_after_ms), max_retry_after_ms);
+}
+
+
+void Database::ReplayWriteAheadLog() {
+  // Replayed ops are fanned out to the workers just like a client stream's,
+  // so series are rebuilt in parallel while we read the next records.
+  WriteStream replay_stream(this, FLAGS_write_stream_window);
+  wal->Replay([&] (WalRecordType type,
+                   const char* data,
+                   size_t len,
+                   uint64_t lsn) {
+    switch (type) {
+      case WAL_WRITE_OPERATION:
+        replay_stream.Replay(data, len, lsn);
+        break;
+      case WAL_WRITE_BATCH:
+        replay_stream.ReplayBatch(data, len, lsn);
+        break;
+      default:
+        LOG(ERROR) << "Skipping write ahead log record lsn=" << lsn
+                   << " of unknown type " << static_cast<int>(type);
+    }
+  });
+  replay_stream.Wait();
+}
+
+
+// Hands every indexed series to the worker that will own it, which creates it
+// and then lists its directory. We don't wait for them, writes and reads that
+// arrive first simply create the series themselves.
+void Database::PreloadSeries() {
+  int64_t start = TimeInMillis();
+  size_t queued = 0;
+
+  search_engine->ScanSeries(FLAGS_max_series_in_memory, [&] (
+      int64_t series_id,
+      const string& key,
+      const vqro::rpc::Series& series_proto)
+  {
+    auto preload = [this, start, series_id, key, series_proto] {
+      bool created = false;
+      std::shared_ptr<Series> series = series_registry->FindOrCreate(key, [&] {
+        created = true;
+        return new Series(this, series_proto, key);
+      });
+      // A write or read got to it first and owns it now.
+      if (!created)
+        return;
+
+      // Not a use, so the series is idle from the start of the preload and
+      // evicted before any series that has been used since.
+      series->series_id = series_id;
+      series->is_indexed = true;
+      series->last_used = start;
+      series_registry->AddId(series.get());
+      series->PrefetchDirectory();
+    };
+
+    WorkerThread* worker = workers[ComputeHash(key) % workers.size()];
+    while (true) {
+      try {
+        worker->Post(preload);
+        break;
+      } catch (WorkerThreadTooBusy& err) {
+        worker->WaitForRoom(100);
+      }
+    }
+    queued++;
+  });
+
+  LOG(INFO) << "Queued " << queued << " series for preloading in "
+            << TimeInMillis() - start << "ms";
+}
+
+
+// Indexing happens in the background, the series is added to the registry's
+// series_id index once it is done.
+void Database::IndexSeries(const std::shared_ptr<Series>& series) {
+  search_engine->IndexSeries(series);
+}
+
+
+// A handle is the series' series_id tagged with the search engine generation
+// that assigned it.
+static uint64_t MakeSeriesHandle(uint32_t generation, int64_t series_id) {
+  return (static_cast<uint64_t>(generation) << 32) |
+         static_cast<uint32_t>(series_id);
+}
+
+
+uint64_t Database::ResolveSeries(const vqro::rpc::Series& series_proto) {
+  std::shared_ptr<Series> series = GetSeries(series_proto);
+  if (!series->series_id) {
+    search_engine->IndexSeries(series);
+    if (!search_engine->WaitIndexed(series.get()))
+      throw DatabaseError("Failed to index series " + series->keystr);
+  }
+
+  if (series->series_id > UINT32_MAX)
+    throw DatabaseError("series_id " + to_string(series->series_id.load()) +
+                        " is too large for a series handle");
+  return MakeSeriesHandle(search_engine->Generation(), series->series_id);
+}
+
+
+std::shared_ptr<Series> Database::GetSeriesByHandle(uint64_t series_handle) {
+  if (series_handle >> 32 != search_engine->Generation())
+    throw StaleSeriesHandle("handle " + to_string(series_handle) +
+                            " is from another search engine generation");
+  int64_t series_id = static_cast<uint32_t>(series_handle);
+
+  std::shared_ptr<Series> series = series_registry->FindById(series_id);
+  if (series) {
+    series->Touch();
+    return series;
+  }
+
+  // The handle may predate a restart, in which case we find its series the
+  // slow way once.
+  vqro::rpc::Series series_proto;
+  auto lookup = [&] {
     try {
-      search_engine->IndexSeries(series);
+      return search_engine->LookupSeries(series_id, &series_proto);
     } catch (SqliteError& err) {
-      LOG(WARNING) << "Failed to index series: " << err.message;
+      throw DatabaseError("Failed to look up series handle: " + err.message);
     }
+  };
+  uint64_t unindexed_batches = search_engine->UnindexedBatches();
+  if (!lookup())
+    throw StaleSeriesHandle("no series has handle " + to_string(series_handle));
+
+  series = GetSeries(series_proto);
+  series->series_id = series_id;
+  series->is_indexed = true;
+  series_registry->AddId(series.get());
+
+  // The retention sweeper may have unindexed the series since we looked it
+  // up. ForgetSeriesId() catches removals committed from here on, earlier
+  // ones we catch by looking again.
+  if (search_engine->UnindexedBatches() != unindexed_batches && !lookup()) {
+    ForgetSeriesId(series_id);
+    throw StaleSeriesHandle("no series has handle " + to_string(series_handle));
+  }
+  return series;
+}
+
+
+// Called once series_id has been removed from the index. A live series still
+// holding it is indexed anew, under a new series_id, by its next write.
+void Database::ForgetSeriesId(int64_t series_id) {
+  std::shared_ptr<Series> series = series_registry->RemoveId(series_id);
+  if (series && series->series_id.compare_exchange_strong(series_id, 0))
+    series->is_indexed = false;
 }
 
 
@@ -92,10 +670,41 @@ void Database::Read(
     int64_t end_time,
     int64_t datapoint_limit,
     bool prefer_latest,
-    DatapointsCallback callback)
+    DatapointsCallback callback,
+    int64_t step,
+    Aggregate aggregate)
+{
+  ReadSeries(GetSeries(series_proto), start_time, end_time, datapoint_limit,
+             prefer_latest, callback, step, aggregate);
+}
+
+
+void Database::Read(
+    uint64_t series_handle,
+    int64_t start_time,
+    int64_t end_time,
+    int64_t datapoint_limit,
+    bool prefer_latest,
+    DatapointsCallback callback,
+    int64_t step,
+    Aggregate aggregate)
 {
-  Series* series = GetSeries(series_proto);
-  WorkerThread* worker = GetWorker(series);
+  ReadSeries(GetSeriesByHandle(series_handle), start_time, end_time,
+             datapoint_limit, prefer_latest, callback, step, aggregate);
+}
+
+
+void Database::ReadSeries(
+    const std::shared_ptr<Series>& series,
+    int64_t start_time,
+    int64_t end_time,
+    int64_t datapoint_limit,
+    bool prefer_latest,
+    DatapointsCallback callback,
+    int64_t step,
+    Aggregate aggregate)
+{
+  WorkerThread* worker = GetWorker(series.get());
   std::unique_ptr<Datapoint> read_buffer(new Datapoint[FLAGS_read_buffer_size]); //TODO Arena allocation for read buffers
   vqro::db::ReadOperation read_op(start_time,
                                   end_time,
@@ -103,6 +712,8 @@ void Database::Read(
                                   prefer_latest,
                                   read_buffer.get(),
                                   FLAGS_read_buffer_size);
+  read_op.step = step;
+  read_op.aggregate = aggregate;
 
   // TODO Use two read buffers to keep both threads busy simultaneously
   while (!read_op.Complete()) {
@@ -119,7 +730,7 @@ void Database::Read(
 }
 
 
-Series* Database::GetSeries(const vqro::rpc::Series& series_proto) {
+static string SeriesKey(const vqro::rpc::Series& series_proto) {
   // Compute the series' "key" string from its labels
   std::map<string, string> ordered(series_proto.labels().begin(),
                                    series_proto.labels().end());
@@ -133,17 +744,70 @@ Series* Database::GetSeries(const vqro::rpc::Series& series_proto) {
   }
   if (key.empty())
     throw InvalidSeriesProto("At least one label is required");
+  return key;
+}
+
+
+// Lookup our vqro::db::Series object by key, creating it if it doesn't exist.
+std::shared_ptr<Series> Database::GetSeries(
+    const vqro::rpc::Series& series_proto)
+{
+  string key = SeriesKey(series_proto);
+  std::shared_ptr<Series> series = series_registry->FindOrCreate(key, [&] {
+    return new Series(this, series_proto, key);
+  });
+  series->Touch();
+  return series;
+}
+
+
+std::shared_ptr<Series> Database::GetSeries(
+    const vqro::rpc::WriteOperation& op)
+{
+  if (op.series_handle())
+    return GetSeriesByHandle(op.series_handle());
+  return GetSeries(op.series());
+}
 
-  // Lookup our vqro::db::Series object by key, creating it if it doesn't exist.
-  // TODO These objects should expire when unused.
-  {
-    std::unique_lock<std::mutex> my_lock(series_by_key_mutex);
 
-    auto it = series_by_key.find(key);
-    if (it != series_by_key.end())
-      return it->second;
-    return series_by_key[key] = new Series(this, series_proto, key);
+// Returns the Series of each of batch's columns.
+vector<std::shared_ptr<Series>> Database::GetSeries(
+    const vqro::rpc::WriteBatch& batch)
+{
+  vector<std::shared_ptr<Series>> dictionary = GetSeries(batch.series());
+  vector<std::shared_ptr<Series>> series;
+  series.reserve(batch.columns_size());
+  for (const auto& columns : batch.columns()) {
+    if (columns.series_handle())
+      series.push_back(GetSeriesByHandle(columns.series_handle()));
+    else
+      series.push_back(dictionary[columns.series_index()]);
+  }
+  return series;
+}
+
+
+// Validates every key before creating any series, so a malformed batch
+// leaves no trace.
+vector<std::shared_ptr<Series>> Database::GetSeries(
+    const google::protobuf::RepeatedPtrField<vqro::rpc::Series>& protos)
+{
+  vector<string> keys;
+  keys.reserve(protos.size());
+  for (const auto& series_proto : protos)
+    keys.push_back(SeriesKey(series_proto));
+
+  vector<std::shared_ptr<Series>> series;
+  series.reserve(protos.size());
+  for (int i = 0; i < protos.size(); i++) {
+    const vqro::rpc::Series& series_proto = protos.Get(i);
+    const string& key = keys[i];
+    series.push_back(series_registry->FindOrCreate(key, [&] {
+      return new Series(this, series_proto, key);
+    }));
+    series.back()->Touch();
   }
+  return series;
 }
 
 
@@ -152,61 +816,176 @@ WorkerThread* Database::GetWorker(Series* series) {
 }
 
 
-void Database::FlushWriteBuffers() {
-  LOG(INFO) << "FlushWriteBuffers thread reporting for duty.";
+SlabAllocator* Database::GetAllocator(Series* series) {
+  return allocators[series->keyint % allocators.size()].get();
+}
+
+
+FileCache* Database::GetFileCache(Series* series) {
+  return file_caches[series->keyint % file_caches.size()].get();
+}
+
+
+void Database::LogFileCacheStats() {
+  FileCache::Stats total {0, 0, 0, 0, 0};
+  size_t open_files = 0;
+  for (auto& cache : file_caches) {
+    FileCache::Stats stats = cache->GetStats();
+    total.hits += stats.hits;
+    total.misses += stats.misses;
+    total.evictions += stats.evictions;
+    total.invalidations += stats.invalidations;
+    total.mappings += stats.mappings;
+    open_files += cache->Size();
+  }
+  LOG(INFO) << "File cache open_files=" << open_files
+            << " hits=" << total.hits
+            << " misses=" << total.misses
+            << " evictions=" << total.evictions
+            << " invalidations=" << total.invalidations
+            << " mappings=" << total.mappings;
+}
+
+
+void Database::LogWriteBufferMemory() {
+  size_t live_bytes = 0;
+  size_t idle_bytes = 0;
+  for (auto& allocator : allocators) {
+    live_bytes += allocator->LiveBytes();
+    idle_bytes += allocator->IdleBytes();
+  }
+  LOG(INFO) << "Write buffer memory buffered_bytes=" << buffered_bytes
+            << " live_bytes=" << live_bytes
+            << " idle_bytes=" << idle_bytes;
+}
 
-  //TODO Figure out how to safely delete a Series. This code grabs a pointer
-  // while holding the mutex but uses it after releasing.
 
-  vector<Series*> all_series;
+// all_series must hold the only references to its series outside the
+// registry, apart from those of any series still in use.
+void Database::EvictIdleSeries(
+    const vector<std::shared_ptr<Series>>& all_series)
+{
   int64_t now = TimeInMillis();
-  int64_t resort_deadline = now + FLAGS_flusher_resort_interval;
+  int64_t idle_before = (FLAGS_series_idle_timeout > 0) ?
+      now - FLAGS_series_idle_timeout * 1000LL : INT64_MIN;
+  size_t excess = 0;
+  if (FLAGS_max_series_in_memory > 0 &&
+      all_series.size() > static_cast<size_t>(FLAGS_max_series_in_memory))
+    excess = all_series.size() - FLAGS_max_series_in_memory;
+
+  // Least recently used first. We sort a copy of last_used since writers
+  // keep updating it.
+  vector<std::pair<int64_t,size_t>> by_age;
+  by_age.reserve(all_series.size());
+  for (size_t i = 0; i < all_series.size(); i++)
+    by_age.emplace_back(all_series[i]->last_used.load(), i);
+  std::sort(by_age.begin(), by_age.end());
+
+  // Series with unflushed datapoints must stay until they are flushed.
+  auto flushed = [] (Series& series) {
+    return series.DatapointsBuffered() == 0;
+  };
+
+  size_t evicted = 0;
+  for (auto& it : by_age) {
+    if (it.first >= idle_before && evicted >= excess)
+      break;
+    if (series_registry->EraseIfUnused(all_series[it.second], flushed))
+      evicted++;
+  }
+
+  if (evicted)
+    LOG(INFO) << "Evicted " << evicted << " idle series, "
+              << all_series.size() - evicted << " remain";
+}
+
+
+void Database::RunMaintenance() {
+  LOG(INFO) << "Maintenance thread reporting for duty.";
+
+  // We hold a reference to every series in our snapshot, so any that are
+  // erased from the registry meanwhile stay alive until the pass is over.
+  vector<std::shared_ptr<Series>> all_series;
+  int64_t last_pass = TimeInMillis();
+  int64_t last_flushed_bytes = flushed_bytes;
 
   while (true) {
-    // Prioritize which series should be flushed first.
-    all_series.clear();
-    all_series.reserve(series_by_key.size());
     {
-      std::lock_guard<std::mutex> guard(series_by_key_mutex);
-      for (auto it : series_by_key) {
-        all_series.push_back(it.second);
-      }
+      std::unique_lock<std::mutex> lock(maintenance_mutex);
+      maintenance_wakeup.wait_for(
+          lock,
+          std::chrono::milliseconds(std::max(FLAGS_maintenance_interval, 1)),
+          [this] { return stop_maintenance; });
+      if (stop_maintenance)
+        return;
     }
 
-    // Sort them to flush the largest buffers first
-    std::sort(all_series.begin(), all_series.end(),
-        [&] (Series* a, Series* b) -> bool {
-          return a->DatapointsBuffered() > b->DatapointsBuffered();
-        }
-    );
-
-    // Now we flush until its time to re-sort the directories
-    int flushed = 0;
-    int64_t start = TimeInMillis();
+    // Every write ahead log record we still need is either unapplied or
+    // is the oldest unflushed record of some series in our snapshot.
+    uint64_t wal_min_lsn = wal ? wal->OldestUnapplied() : 0;
 
-    for (auto series : all_series) {
-      if (series->DatapointsBuffered()) {
-        series->FlushBufferedDatapoints();
-        flushed++;
-      } else {
-        continue;
+    all_series.clear();
+    for (size_t shard = 0; shard < series_registry->NumShards(); shard++)
+      series_registry->AppendShard(shard, all_series);
+
+    if (wal) {
+      for (auto& series : all_series) {
+        uint64_t lsn = series->wal_lsn;
+        if (lsn && lsn < wal_min_lsn)
+          wal_min_lsn = lsn;
       }
-
-      if (flushed % 50 == 0) {
-        now = TimeInMillis();
-        if (now >= resort_deadline) {
-          resort_deadline += FLAGS_flusher_resort_interval;
-          break;
-        }
+      // Flushes write datapoint files, manifests and segments without
+      // syncing them, so one syncfs() covers them all before the log
+      // records they replace are deleted.
+      try {
+        wal->Truncate(wal_min_lsn, [this] { SyncFilesystem(root_dir); });
+      } catch (IOError& err) {
+        LOG(ERROR) << "Not truncating write ahead log: " << err.message;
       }
     }
 
-    if (flushed) {
-      int64_t elapsed = TimeInMillis() - start;
-      LOG(INFO) << "Flushed " << flushed << " series in " << elapsed << "ms";
-    } else {
-      std::this_thread::sleep_for(std::chrono::seconds(5));
+    // Charges from writes can race with a flush of the same series, so we
+    // resync the total from our snapshot once per pass.
+    int64_t total_bytes = 0;
+    int64_t oldest_buffered = 0;
+    for (auto& series : all_series) {
+      total_bytes += series->BytesBuffered();
+      int64_t first_buffered = series->first_buffered;
+      if (first_buffered &&
+          (!oldest_buffered || first_buffered < oldest_buffered))
+        oldest_buffered = first_buffered;
+    }
+    buffered_bytes = total_bytes;
+
+    int64_t now = TimeInMillis();
+    int64_t freed_bytes = flushed_bytes - last_flushed_bytes;
+    flushed_bytes_per_sec = freed_bytes * 1000 /
+                            std::max<int64_t>(now - last_pass, 1);
+    last_flushed_bytes += freed_bytes;
+    last_pass = now;
+
+    EvictIdleSeries(all_series);
+    all_series.clear();
+
+    // A series that never gets flushed never reports a lag to the flush
+    // scheduler, so the age of the oldest unflushed datapoint counts too.
+    int64_t pending_lag = oldest_buffered ? now - oldest_buffered : 0;
+    flush_lag = std::max(flush_scheduler->TakeMaxFlushLag(), pending_lag);
+
+    int64_t flushes = flush_scheduler->TakeFlushCount();
+    if (flushes || pending_lag) {
+      LOG(INFO) << "Flushed " << flushes << " series, flush lag "
+                << flush_lag << "ms, oldest unflushed datapoint "
+                << pending_lag << "ms";
+    }
+    if (flushes) {
+      LogWriteBufferMemory();
+      LogFileCacheStats();
     }
+
+    int64_t compactions = directory_compactor->TakeCompactionCount();
+    if (compactions)
+      LOG(INFO) << "Compacted " << compactions << " series directories";
   } // while (true)
 }
 
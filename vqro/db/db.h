@@ -1,19 +1,30 @@
 #ifndef VQRO_DB_DB_H
 #define VQRO_DB_DB_H
 
+#include <atomic>
+#include <condition_variable>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/slab_allocator.h"
 #include "vqro/base/worker.h"
 #include "vqro/rpc/core.pb.h"
 #include "vqro/rpc/storage.pb.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/flush_scheduler.h"
+#include "vqro/db/retention_sweeper.h"
 #include "vqro/db/series.h"
+#include "vqro/db/series_registry.h"
 #include "vqro/db/search_engine.h"
+#include "vqro/db/segment_store.h"
 #include "vqro/db/storage_optimizer.h"
+#include "vqro/db/write_ahead_log.h"
 
 
 DECLARE_int32(read_buffer_size);
@@ -25,6 +36,10 @@ namespace db {
 
 using DatapointsCallback = std::function<void(Datapoint*, size_t)>;
 
+// Called once every part of a queued WriteBatch is done, with the highest LSN
+// its parts were logged at and the error of the first part that failed.
+using BatchDoneFunc = std::function<void(uint64_t, std::exception_ptr)>;
+
 
 class DatabaseError : public Error {
  public:
@@ -46,9 +61,37 @@ class InvalidSeriesProto : public DatabaseError {
 };
 
 
+// Thrown for a series handle that was not issued by this database's current
+// search engine, or whose series no longer exists. Clients should resolve
+// their series again.
+class StaleSeriesHandle : public InvalidSeriesProto {
+ public:
+  StaleSeriesHandle(string msg) : InvalidSeriesProto("StaleSeriesHandle: " + msg) {}
+  virtual ~StaleSeriesHandle() {}
+};
+
+
+// Thrown when a write is refused because unflushed datapoints have used up
+// the write buffer memory budget. Clients should retry after retry_after_ms.
+class WriteBackpressure : public DatabaseError {
+ public:
+  WriteBackpressure(string msg, int64_t retry) :
+      DatabaseError("WriteBackpressure: " + msg),
+      retry_after_ms(retry) {}
+  virtual ~WriteBackpressure() {}
+
+  int64_t retry_after_ms;
+};
+
+
 class Database {
  public:
+  friend class DatabaseTest;
+  friend class DirectoryCompactor;
+  friend class FlushScheduler;
+  friend class RetentionSweeper;
   friend class StorageOptimizer;
+  friend class WriteStream;
   Database(string dir);
   ~Database();
 
@@ -58,27 +101,131 @@ class Database {
     return storage_optimizer.get();
   }
 
+  DirectoryCompactor* GetDirectoryCompactor() const {
+    return directory_compactor.get();
+  }
+
+  // Each worker has its own allocator for the write buffers of its series.
+  SlabAllocator* GetAllocator(Series* series);
+
+  // Likewise each worker keeps its own series' datapoint files open.
+  FileCache* GetFileCache(Series* series);
+
+  // Null unless --storage_engine=segments.
+  SegmentStore* GetSegmentStore() const { return segment_store.get(); }
+
+  // Bucket widths of --rollup_tiers in timestamp units, finest first.
+  const vector<int64_t>& GetRollupWidths() const { return rollup_widths; }
+
   void Write(vqro::rpc::WriteOperation& op);
 
+  // Writes every series in a multi-series batch, queueing one task per
+  // worker instead of one per series. Throws InvalidSeriesProto without
+  // writing anything if any part of the batch is malformed, and
+  // WriteBackpressure if a worker it needs is saturated. Each worker logs its
+  // part of the batch separately, so if the log fails the error is rethrown
+  // though parts on other workers may have been applied.
+  void Write(const vqro::rpc::WriteBatch& batch);
+
+  // Throws WriteBackpressure if the write buffers are over their memory
+  // budget. Checked before a write is accepted.
+  void CheckWriteBudget();
+
+  // With a step, time ranges covered by --rollup_tiers are read as buckets
+  // of the coarsest tier no wider than step, combined by aggregate.
   void Read(const vqro::rpc::Series& series,
             int64_t start_time,
             int64_t end_time,
             int64_t datapoint_limit,
             bool prefer_latest,
-            DatapointsCallback callback);
+            DatapointsCallback callback,
+            int64_t step=0,
+            Aggregate aggregate=Aggregate::AVG);
+
+  // Like above but addressing the series by handle. Throws StaleSeriesHandle.
+  void Read(uint64_t series_handle,
+            int64_t start_time,
+            int64_t end_time,
+            int64_t datapoint_limit,
+            bool prefer_latest,
+            DatapointsCallback callback,
+            int64_t step=0,
+            Aggregate aggregate=Aggregate::AVG);
+
+  // Returns a handle that can stand in for series' labels in later writes and
+  // reads, indexing the series first if it hasn't been already. Throws
+  // InvalidSeriesProto, or DatabaseError if the series can't be indexed.
+  uint64_t ResolveSeries(const vqro::rpc::Series& series);
+
+  // Milliseconds that buffered datapoints waited to be flushed, as of the
+  // last maintenance pass: the longest of that pass's flushes or the age of
+  // the oldest datapoint still unflushed, whichever is greater.
+  int64_t FlushLagMillis() const { return flush_lag; }
 
   std::unique_ptr<SearchEngine> search_engine;
 
  private:
   string root_dir;
   std::vector<WorkerThread*> workers;
+  std::vector<std::unique_ptr<SlabAllocator>> allocators;
+  std::vector<std::unique_ptr<FileCache>> file_caches;
   std::unique_ptr<StorageOptimizer> storage_optimizer;
-  std::unordered_map<string,Series*> series_by_key {};
-  std::mutex series_by_key_mutex;
-
-  Series* GetSeries(const vqro::rpc::Series& series);
+  std::unique_ptr<SegmentStore> segment_store;
+  std::unique_ptr<WriteAheadLog> wal;
+  std::unique_ptr<SeriesRegistry> series_registry;
+
+  std::unique_ptr<FlushScheduler> flush_scheduler;
+  std::unique_ptr<DirectoryCompactor> directory_compactor;
+  std::unique_ptr<RetentionSweeper> retention_sweeper;
+  vector<int64_t> rollup_widths;
+
+  // Bytes held by all series' write buffers, bytes freed by flushes so far,
+  // and how fast flushes have recently been freeing them.
+  std::atomic<int64_t> buffered_bytes {0};
+  std::atomic<int64_t> flushed_bytes {0};
+  std::atomic<int64_t> flushed_bytes_per_sec {0};
+  std::atomic<int64_t> flush_lag {0};
+
+  // Runs RunMaintenance() until we are destroyed.
+  std::thread maintenance;
+  std::mutex maintenance_mutex;
+  std::condition_variable maintenance_wakeup;
+  bool stop_maintenance = false;
+
+  std::shared_ptr<Series> GetSeries(const vqro::rpc::Series& series);
+  std::shared_ptr<Series> GetSeries(const vqro::rpc::WriteOperation& op);
+  vector<std::shared_ptr<Series>> GetSeries(const vqro::rpc::WriteBatch& batch);
+  vector<std::shared_ptr<Series>> GetSeries(
+      const google::protobuf::RepeatedPtrField<vqro::rpc::Series>& protos);
+  std::shared_ptr<Series> GetSeriesByHandle(uint64_t series_handle);
+  void ForgetSeriesId(int64_t series_id);
+  static void ValidateBatch(const vqro::rpc::WriteBatch& batch);
+  void QueueBatch(const vqro::rpc::WriteBatch& batch,
+                  const vector<std::shared_ptr<Series>>& series,
+                  uint64_t lsn,
+                  BatchDoneFunc done);
   WorkerThread* GetWorker(Series* series);
-  void FlushWriteBuffers();
+  void IndexSeries(const std::shared_ptr<Series>& series);
+  void ApplyWrite(Series* series, vqro::rpc::WriteOperation& op, uint64_t lsn);
+  void ReplayWriteAheadLog();
+  void PreloadSeries();
+  void ReadSeries(const std::shared_ptr<Series>& series,
+                  int64_t start_time,
+                  int64_t end_time,
+                  int64_t datapoint_limit,
+                  bool prefer_latest,
+                  DatapointsCallback callback,
+                  int64_t step,
+                  Aggregate aggregate);
+  void FlushSeries(const vector<std::shared_ptr<Series>>& series,
+                   vector<bool>& flushed);
+  bool OverFlushThreshold();
+  void RunMaintenance();
+  void EvictIdleSeries(const vector<std::shared_ptr<Series>>& all_series);
+  void LogWriteBufferMemory();
+  void LogFileCacheStats();
+  void ChargeWriteBuffer(int64_t bytes);
+  int64_t RetryAfterMillis();
 };
 
 
@@ -0,0 +1,593 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/db.h"
+#include "vqro/db/search_engine.h"
+#include "vqro/db/test_util.h"
+#include "vqro/db/write_ahead_log.h"
+#include "vqro/db/write_stream.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int64(max_series_in_memory);
+DECLARE_string(search_db_file);
+DECLARE_int32(series_idle_timeout);
+DECLARE_double(write_buffer_flush_threshold);
+DECLARE_int64(write_buffer_memory_limit);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+vqro::rpc::Series MakeProto(const string& name) {
+  vqro::rpc::Series proto;
+  (*proto.mutable_labels())["name"] = name;
+  return proto;
+}
+
+
+vector<Datapoint> ReadAll(Database* db, const string& name) {
+  vector<Datapoint> points;
+  db->Read(MakeProto(name), INT64_MIN, INT64_MAX, -1, false,
+           [&] (Datapoint* batch, size_t n) {
+             points.insert(points.end(), batch, batch + n);
+           });
+  return points;
+}
+
+
+vector<Datapoint> ReadAll(Database* db, uint64_t series_handle) {
+  vector<Datapoint> points;
+  db->Read(series_handle, INT64_MIN, INT64_MAX, -1, false,
+           [&] (Datapoint* batch, size_t n) {
+             points.insert(points.end(), batch, batch + n);
+           });
+  return points;
+}
+
+
+// A write of one datapoint to the series with handle series_handle.
+vqro::rpc::WriteOperation MakeWrite(uint64_t series_handle, int64_t timestamp) {
+  vqro::rpc::WriteOperation op;
+  op.set_series_handle(series_handle);
+  vqro::rpc::Datapoint* point = op.add_datapoints();
+  point->set_timestamp(timestamp);
+  point->set_value(1);
+  return op;
+}
+
+
+// Adds columns for the series named name to batch, with a datapoint at each
+// of timestamps valued by its timestamp.
+void AddColumns(vqro::rpc::WriteBatch& batch,
+                const string& name,
+                const vector<int64_t>& timestamps) {
+  *batch.add_series() = MakeProto(name);
+  vqro::rpc::SeriesColumns* columns = batch.add_columns();
+  columns->set_series_index(batch.series_size() - 1);
+  for (int64_t timestamp : timestamps) {
+    columns->add_timestamps(timestamp);
+    columns->add_values(timestamp);
+  }
+}
+
+
+// Writes as a client would, retrying while the database pushes back.
+template <typename W>
+void WriteRetrying(Database* db, W& write) {
+  while (true) {
+    try {
+      db->Write(write);
+      return;
+    } catch (WriteBackpressure&) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+
+TEST_F(DatabaseTest, HandlesStandInForTheirSeries) {
+  uint64_t handle = db->ResolveSeries(MakeProto("a"));
+  EXPECT_EQ(db->ResolveSeries(MakeProto("a")), handle);
+  EXPECT_NE(db->ResolveSeries(MakeProto("b")), handle);
+
+  vqro::rpc::WriteOperation op = MakeWrite(handle, 1000);
+  db->Write(op);
+  const vector<Datapoint> written {Datapoint(1000, 1, 0)};
+  EXPECT_EQ(ReadAll(db.get(), handle), written);
+  EXPECT_EQ(ReadAll(db.get(), "a"), written);
+
+  // After a restart the series is found from its handle once more. Without
+  // a write ahead log what was buffered is gone.
+  Reopen();
+  op = MakeWrite(handle, 2000);
+  db->Write(op);
+  const vector<Datapoint> rewritten {Datapoint(2000, 1, 0)};
+  EXPECT_EQ(ReadAll(db.get(), handle), rewritten);
+  EXPECT_EQ(ReadAll(db.get(), "a"), rewritten);
+  EXPECT_EQ(db->ResolveSeries(MakeProto("a")), handle);
+}
+
+
+TEST_F(DatabaseTest, HandlesOfAnotherGenerationAreStale) {
+  uint64_t handle = db->ResolveSeries(MakeProto("a"));
+
+  // A new search index starts a new generation, in which the same series
+  // may well get the same series_id.
+  string dir = db->GetDataDirectory();
+  db.reset();
+  for (const char* suffix : {"", "-wal", "-shm", "-journal"})
+    unlink((dir + FLAGS_search_db_file + suffix).c_str());
+  db.reset(new Database(dir));
+
+  EXPECT_THROW(ReadAll(db.get(), handle), StaleSeriesHandle);
+  vqro::rpc::WriteOperation op = MakeWrite(handle, 1000);
+  EXPECT_THROW(db->Write(op), StaleSeriesHandle);
+  EXPECT_NE(db->ResolveSeries(MakeProto("a")), handle);
+}
+
+
+TEST_F(DatabaseTest, HandlesOfUnknownSeriesAreStale) {
+  uint64_t handle = db->ResolveSeries(MakeProto("a"));
+  uint64_t unknown = handle + 1000;  // Same generation, no such series_id
+
+  EXPECT_THROW(ReadAll(db.get(), unknown), StaleSeriesHandle);
+  vqro::rpc::WriteOperation op = MakeWrite(unknown, 1000);
+  EXPECT_THROW(db->Write(op), StaleSeriesHandle);
+
+  // Nor does a restart turn one up.
+  Reopen();
+  EXPECT_THROW(ReadAll(db.get(), unknown), StaleSeriesHandle);
+  EXPECT_EQ(ReadAll(db.get(), handle), vector<Datapoint>());
+}
+
+
+TEST_F(DatabaseTest, ResolvingWaitsForAPendingIndexBatch) {
+  // The write queues the series to be indexed without waiting for it.
+  vqro::rpc::WriteOperation op;
+  *op.mutable_series() = MakeProto("a");
+  vqro::rpc::Datapoint* point = op.add_datapoints();
+  point->set_timestamp(1000);
+  point->set_value(1);
+  db->Write(op);
+
+  uint64_t handle = db->ResolveSeries(MakeProto("a"));
+  EXPECT_EQ(ReadAll(db.get(), handle), vector<Datapoint>({Datapoint(1000, 1, 0)}));
+  EXPECT_EQ(db->ResolveSeries(MakeProto("a")), handle);
+}
+
+
+TEST_F(DatabaseTest, MalformedBatchesWriteNothing) {
+  auto expect_refused = [&] (const vqro::rpc::WriteBatch& batch) {
+    EXPECT_THROW(db->Write(batch), InvalidSeriesProto);
+    EXPECT_EQ(ReadAll(db.get(), "good"), vector<Datapoint>());
+  };
+
+  // Every batch starts with well formed columns that mustn't be written
+  // either.
+  vqro::rpc::WriteBatch batch;
+  AddColumns(batch, "good", {1000});
+  AddColumns(batch, "bad", {1000, 1010});
+  batch.mutable_columns(1)->add_values(1);
+  expect_refused(batch);
+
+  batch.Clear();
+  AddColumns(batch, "good", {1000});
+  AddColumns(batch, "bad", {1000, 1010, 1020});
+  batch.mutable_columns(1)->add_durations(10);
+  batch.mutable_columns(1)->add_durations(10);
+  expect_refused(batch);
+
+  batch.Clear();
+  AddColumns(batch, "good", {1000});
+  batch.add_columns()->set_series_index(1);
+  expect_refused(batch);
+}
+
+
+TEST_F(DatabaseTest, EmptyBatchesAreAccepted) {
+  vqro::rpc::WriteBatch batch;
+  db->Write(batch);
+
+  AddColumns(batch, "a", {});
+  db->Write(batch);
+  EXPECT_EQ(ReadAll(db.get(), "a"), vector<Datapoint>());
+}
+
+
+TEST_F(DatabaseTest, BatchesSpanWorkers) {
+  // Enough series that both workers get some.
+  vqro::rpc::WriteBatch batch;
+  vector<string> names;
+  for (int i = 0; i < 20; i++) {
+    names.push_back("s" + std::to_string(i));
+    AddColumns(batch, names.back(), {1000 + i, 2000 + i});
+  }
+  batch.mutable_columns(0)->add_durations(5);  // Shared by its datapoints
+
+  // Columns may also name their series by handle.
+  uint64_t handle = db->ResolveSeries(MakeProto("by_handle"));
+  vqro::rpc::SeriesColumns* columns = batch.add_columns();
+  columns->set_series_handle(handle);
+  columns->add_timestamps(3000);
+  columns->add_values(3);
+
+  db->Write(batch);
+  EXPECT_EQ(ReadAll(db.get(), names[0]), vector<Datapoint>({
+    Datapoint(1000, 1000, 5),
+    Datapoint(2000, 2000, 5)
+  }));
+  for (int i = 1; i < 20; i++) {
+    EXPECT_EQ(ReadAll(db.get(), names[i]), vector<Datapoint>({
+      Datapoint(1000 + i, 1000 + i, 0),
+      Datapoint(2000 + i, 2000 + i, 0)
+    })) << names[i];
+  }
+  EXPECT_EQ(ReadAll(db.get(), handle), vector<Datapoint>({Datapoint(3000, 3, 0)}));
+}
+
+
+class SeriesEvictionTest : public DatabaseTest {
+ protected:
+  void TearDown() override {
+    DatabaseTest::TearDown();
+    FLAGS_series_idle_timeout = series_idle_timeout;
+    FLAGS_max_series_in_memory = max_series_in_memory;
+  }
+
+  // Puts the series named name in the registry, last used age_ms ago.
+  void Use(const string& name, int64_t age_ms, bool buffered=false) {
+    if (buffered) {
+      vqro::rpc::WriteOperation op;
+      *op.mutable_series() = MakeProto(name);
+      vqro::rpc::Datapoint* point = op.add_datapoints();
+      point->set_timestamp(1000);
+      point->set_value(1);
+      db->Write(op);
+    } else {
+      db->ResolveSeries(MakeProto(name));
+    }
+    FindSeries(name)->last_used = TimeInMillis() - age_ms;
+  }
+
+  const int32_t series_idle_timeout = FLAGS_series_idle_timeout;
+  const int64_t max_series_in_memory = FLAGS_max_series_in_memory;
+};
+
+
+TEST_F(SeriesEvictionTest, IdleSeriesAreEvicted) {
+  FLAGS_series_idle_timeout = 3600;
+  FLAGS_max_series_in_memory = 0;
+  uint64_t idle_handle = db->ResolveSeries(MakeProto("idle"));
+  Use("idle", 7200 * 1000);
+  Use("recent", 0);
+  Use("buffered", 7200 * 1000, true);
+  Use("held", 7200 * 1000);
+  std::shared_ptr<Series> held = FindSeries("held");
+
+  EvictIdleSeries();
+  EXPECT_FALSE(FindSeries("idle"));
+  EXPECT_TRUE(FindSeries("recent"));
+  EXPECT_TRUE(FindSeries("buffered"));
+  EXPECT_EQ(FindSeries("held"), held);
+
+  // An evicted series comes back from the index by its handle.
+  EXPECT_EQ(ReadAll(db.get(), idle_handle), vector<Datapoint>());
+  EXPECT_TRUE(FindSeries("idle"));
+  EXPECT_EQ(ReadAll(db.get(), "buffered"),
+            vector<Datapoint>({Datapoint(1000, 1, 0)}));
+}
+
+
+TEST_F(SeriesEvictionTest, LeastRecentlyUsedAreEvictedOverTheLimit) {
+  FLAGS_series_idle_timeout = 0;
+  FLAGS_max_series_in_memory = 2;
+  Use("a", 4000, true);
+  Use("b", 3000);
+  Use("c", 2000);
+  Use("d", 1000);
+
+  // a is the oldest but can't go until it is flushed.
+  EvictIdleSeries();
+  EXPECT_TRUE(FindSeries("a"));
+  EXPECT_FALSE(FindSeries("b"));
+  EXPECT_FALSE(FindSeries("c"));
+  EXPECT_TRUE(FindSeries("d"));
+}
+
+
+TEST_F(DatabaseTest, PreloadedSeriesAreIndexedButNotUsed) {
+  std::map<string, uint64_t> handles;
+  for (const string& name : {"a", "b", "c"})
+    handles[name] = db->ResolveSeries(MakeProto(name));
+  Reopen();
+
+  // b is written to before the preload gets to it.
+  vqro::rpc::WriteOperation op = MakeWrite(handles["b"], 1000);
+  db->Write(op);
+  std::shared_ptr<Series> b = FindSeries("b");
+  ASSERT_TRUE(b);
+  b->last_used = 12345;
+
+  int64_t before = TimeInMillis();
+  PreloadSeries();
+  int64_t after = TimeInMillis();
+
+  EXPECT_EQ(FindSeries("b"), b);
+  EXPECT_EQ(b->last_used, 12345);
+  EXPECT_EQ(b->DatapointsBuffered(), 1);
+
+  for (const string& name : {"a", "c"}) {
+    std::shared_ptr<Series> series = FindSeries(name);
+    ASSERT_TRUE(series) << name;
+    EXPECT_TRUE(series->is_indexed);
+    EXPECT_FALSE(series->index_queued);
+    EXPECT_EQ(series->series_id, handles[name] & 0xffffffff);
+    EXPECT_GE(series->last_used, before);
+    EXPECT_LE(series->last_used, after);
+  }
+}
+
+
+// A database with a write ahead log.
+class DatabaseLogTest : public DatabaseTest {
+ protected:
+  void SetUp() override {
+    DatabaseTest::SetUp();
+    FLAGS_write_ahead_log = true;
+    Reopen();
+  }
+
+  void TearDown() override {
+    DatabaseTest::TearDown();
+    FLAGS_wal_segment_size = wal_segment_size;
+  }
+
+  const int64_t wal_segment_size = FLAGS_wal_segment_size;
+};
+
+
+TEST_F(DatabaseLogTest, ReplayMatchesWhatWasServed) {
+  // Every kind of write writes the same timestamps of the same series at
+  // once, and reads keep whichever was applied first, so what is served
+  // depends on the order writes were applied in. Replay must apply them in
+  // that order too. With one worker every series' writes queue up behind
+  // one another.
+  FLAGS_db_worker_threads = 1;
+  Reopen();
+
+  // Writers drift apart as they go, so they write a few fresh series at a
+  // time and then start over in step.
+  const int attempts = 10;
+  const int rounds = 200;
+  auto timestamp = [] (int round) { return 1000 + round; };
+  vector<string> all_names;
+
+  for (int attempt = 0; attempt < attempts; attempt++) {
+    vector<string> names;
+    for (const char* name : {"a", "b", "c", "d"})
+      names.push_back(name + std::to_string(attempt));
+    all_names.insert(all_names.end(), names.begin(), names.end());
+
+    auto write_batches = [&] (int writer) {
+      for (int round = 0; round < rounds; round++) {
+        vqro::rpc::WriteBatch batch;
+        for (const string& name : names) {
+          *batch.add_series() = MakeProto(name);
+          vqro::rpc::SeriesColumns* columns = batch.add_columns();
+          columns->set_series_index(batch.series_size() - 1);
+          columns->add_timestamps(timestamp(round));
+          columns->add_values(writer * rounds + round);
+        }
+        WriteRetrying(db.get(), batch);
+      }
+    };
+
+    auto write_singles = [&] (int writer) {
+      for (int round = 0; round < rounds; round++) {
+        for (const string& name : names) {
+          vqro::rpc::WriteOperation op;
+          *op.mutable_series() = MakeProto(name);
+          vqro::rpc::Datapoint* point = op.add_datapoints();
+          point->set_timestamp(timestamp(round));
+          point->set_value(writer * rounds + round);
+          WriteRetrying(db.get(), op);
+        }
+      }
+    };
+
+    auto write_stream = [&] (int writer) {
+      WriteStream stream(db.get(), 8);
+      for (int round = 0; round < rounds; round++) {
+        for (const string& name : names) {
+          vqro::rpc::WriteOperation* op = stream.NextOperation();
+          *op->mutable_series() = MakeProto(name);
+          vqro::rpc::Datapoint* point = op->add_datapoints();
+          point->set_timestamp(timestamp(round));
+          point->set_value(writer * rounds + round);
+          stream.Write(op);
+        }
+      }
+      stream.WaitDurable();
+    };
+
+    vector<std::thread> writers;
+    for (int writer = 0; writer < 6; writer++) {
+      switch (writer % 3) {
+        case 0: writers.emplace_back(write_batches, writer); break;
+        case 1: writers.emplace_back(write_singles, writer); break;
+        case 2: writers.emplace_back(write_stream, writer); break;
+      }
+    }
+    for (auto& writer : writers)
+      writer.join();
+  }
+
+  std::map<string,vector<Datapoint>> served;
+  for (const string& name : all_names) {
+    served[name] = ReadAll(db.get(), name);
+    EXPECT_EQ(served[name].size(), rounds) << name;
+  }
+
+  Reopen();
+  for (const string& name : all_names)
+    EXPECT_EQ(ReadAll(db.get(), name), served[name]) << name;
+}
+
+
+TEST_F(DatabaseLogTest, BatchIsLoggedAfterTheWritesItQueuedBehind) {
+  FLAGS_db_worker_threads = 1;
+  Reopen();
+
+  // Big writes to another series keep the worker busy so that the batch is
+  // queued while the stream's write to the same datapoint still is.
+  WriteStream stream(db.get(), 16);
+  for (int i = 0; i < 10; i++) {
+    vqro::rpc::WriteOperation* op = stream.NextOperation();
+    *op->mutable_series() = MakeProto("filler");
+    for (int j = 0; j < 10000; j++) {
+      vqro::rpc::Datapoint* point = op->add_datapoints();
+      point->set_timestamp(i * 10000 + j);
+      point->set_value(j);
+    }
+    stream.Write(op);
+  }
+
+  vqro::rpc::WriteOperation* op = stream.NextOperation();
+  *op->mutable_series() = MakeProto("a");
+  vqro::rpc::Datapoint* point = op->add_datapoints();
+  point->set_timestamp(1000);
+  point->set_value(1);
+  stream.Write(op);
+
+  vqro::rpc::WriteBatch batch;
+  *batch.add_series() = MakeProto("a");
+  vqro::rpc::SeriesColumns* columns = batch.add_columns();
+  columns->set_series_index(0);
+  columns->add_timestamps(1000);
+  columns->add_values(2);
+  WriteRetrying(db.get(), batch);
+  stream.WaitDurable();
+
+  // Reads keep the datapoint applied first.
+  const vector<Datapoint> served {Datapoint(1000, 1, 0)};
+  EXPECT_EQ(ReadAll(db.get(), "a"), served);
+  Reopen();
+  EXPECT_EQ(ReadAll(db.get(), "a"), served);
+}
+
+
+TEST_F(DatabaseLogTest, StreamStopsOnceTheLogFails) {
+  // Every write opens a new log segment, which fails once the log's
+  // directory is gone.
+  FLAGS_wal_segment_size = 1;
+  Reopen();
+
+  WriteStream stream(db.get(), 4);
+  auto write = [&] (int64_t timestamp) {
+    vqro::rpc::WriteOperation* op = stream.NextOperation();
+    *op->mutable_series() = MakeProto("a");
+    vqro::rpc::Datapoint* point = op->add_datapoints();
+    point->set_timestamp(timestamp);
+    point->set_value(1);
+    stream.Write(op);
+  };
+  write(1000);
+  stream.WaitDurable();
+  EXPECT_FALSE(stream.Failed());
+
+  string wal_dir = db->GetDataDirectory() + "wal";
+  ASSERT_EQ(rename(wal_dir.c_str(), (wal_dir + "_gone").c_str()), 0);
+  int64_t timestamp = 1001;
+  while (!stream.Failed() && timestamp < 100000)
+    write(timestamp++);
+  EXPECT_TRUE(stream.Failed());
+  EXPECT_THROW(stream.WaitDurable(), IOError);
+}
+
+
+TEST_F(DatabaseLogTest, LoggedBatchesAreReplayed) {
+  vqro::rpc::WriteBatch batch;
+  vector<string> names;
+  for (int i = 0; i < 20; i++) {
+    names.push_back("s" + std::to_string(i));
+    AddColumns(batch, names.back(), {1000 + i});
+  }
+  uint64_t handle = db->ResolveSeries(MakeProto("by_handle"));
+  vqro::rpc::SeriesColumns* columns = batch.add_columns();
+  columns->set_series_handle(handle);
+  columns->add_timestamps(3000);
+  columns->add_values(3);
+  db->Write(batch);
+
+  Reopen();
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(ReadAll(db.get(), names[i]),
+              vector<Datapoint>({Datapoint(1000 + i, 1000 + i, 0)}))
+        << names[i];
+  }
+  EXPECT_EQ(ReadAll(db.get(), handle), vector<Datapoint>({Datapoint(3000, 3, 0)}));
+}
+
+
+// A logged database whose write buffers are over budget after one write.
+// Series are never flushed early, so they stay that way.
+class WriteBudgetTest : public DatabaseLogTest {
+ protected:
+  void SetUp() override {
+    DatabaseLogTest::SetUp();
+    FLAGS_write_buffer_memory_limit = 1;
+    FLAGS_write_buffer_flush_threshold = 1e9;
+  }
+
+  void TearDown() override {
+    DatabaseLogTest::TearDown();
+    FLAGS_write_buffer_memory_limit = write_buffer_memory_limit;
+    FLAGS_write_buffer_flush_threshold = write_buffer_flush_threshold;
+  }
+
+  const int64_t write_buffer_memory_limit = FLAGS_write_buffer_memory_limit;
+  const double write_buffer_flush_threshold =
+      FLAGS_write_buffer_flush_threshold;
+};
+
+
+TEST_F(WriteBudgetTest, WritesOverBudgetAreRefused) {
+  uint64_t handle = db->ResolveSeries(MakeProto("a"));
+  vqro::rpc::WriteOperation op = MakeWrite(handle, 1000);
+  db->Write(op);
+
+  op = MakeWrite(handle, 2000);
+  try {
+    db->Write(op);
+    FAIL() << "write over budget was accepted";
+  } catch (WriteBackpressure& err) {
+    EXPECT_GE(err.retry_after_ms, 100);
+    EXPECT_LE(err.retry_after_ms, 10000);
+  }
+
+  vqro::rpc::WriteBatch batch;
+  AddColumns(batch, "b", {3000});
+  EXPECT_THROW(db->Write(batch), WriteBackpressure);
+
+  // Neither refused write was applied, or logged for replay to apply.
+  const vector<Datapoint> accepted {Datapoint(1000, 1, 0)};
+  EXPECT_EQ(ReadAll(db.get(), handle), accepted);
+  EXPECT_EQ(ReadAll(db.get(), "b"), vector<Datapoint>());
+  FLAGS_write_buffer_memory_limit = write_buffer_memory_limit;
+  Reopen();
+  EXPECT_EQ(ReadAll(db.get(), handle), accepted);
+  EXPECT_EQ(ReadAll(db.get(), "b"), vector<Datapoint>());
+}
+
+
+} // namespace
@@ -23,8 +23,20 @@ namespace vqro {
 namespace db {
 
 
-string DenseFile::GetPath() const {
-  return dir->path + "/" + to_string(min_timestamp) + "@" + to_string(duration);
+// Reads of mapped dense files at least this large ask for readahead.
+static constexpr size_t dense_readahead_bytes = 1 << 16;
+
+
+string DenseFile::Filename() const {
+  return to_string(min_timestamp) + "@" + to_string(duration);
+}
+
+
+ManifestEntry DenseFile::Describe() const {
+  ManifestEntry entry = DescribeAs(FileFormat::DENSE);
+  entry.duration = duration;
+  entry.count = size / dense_datapoint_size;
+  return entry;
 }
 
 
@@ -33,6 +45,7 @@ std::unique_ptr<DatapointFile> DenseFile::FromFilename(
     char* filename)
 {
   // dense filename format is "<start_time>@<duration>"
+  const string name = filename;
   char* endptr;
   int64_t start_time;
   int64_t duration;
@@ -46,83 +59,141 @@ std::unique_ptr<DatapointFile> DenseFile::FromFilename(
   if (endptr == filename || *endptr != '\0')
     return nullptr;
 
-  return std::unique_ptr<DatapointFile>(
-    static_cast<DatapointFile*>(new DenseFile(dir, start_time, duration))
-  );
+  DenseFile* file = new DenseFile(dir, start_time, duration);
+  file->filename = name;
+  return std::unique_ptr<DatapointFile>(static_cast<DatapointFile*>(file));
 }
 
 
 void DenseFile::Read(ReadOperation& read_op) const {
-  if (read_op.next_time % duration)
-    read_op.next_time = (read_op.next_time / duration + 1) * duration;
+  // Values sit at min_timestamp plus a multiple of duration, so round up to
+  // the next of those.
+  if (read_op.next_time < min_timestamp)
+    read_op.next_time = min_timestamp;
+  int64_t misalignment = (read_op.next_time - min_timestamp) % duration;
+  if (misalignment)
+    read_op.next_time += duration - misalignment;
 
   if (max_timestamp < read_op.next_time)
     return;
 
-  FileHandle file(GetPath(), O_RDONLY);
-  if (file.fd == -1)
-    throw IOErrorFromErrno("DenseFile::Read open() failed");
-
-  off64_t offset = (read_op.next_time - min_timestamp) / duration * dense_datapoint_size;
-  if (lseek(file.fd, offset, SEEK_SET) == -1)
-    throw IOErrorFromErrno("DenseFile::Read lseek() failed");
-
+  off_t offset = (read_op.next_time - min_timestamp) / duration * dense_datapoint_size;
   int64_t read_end_time = std::min(max_timestamp, read_op.end_time);
   int64_t datapoints_to_read = (read_end_time - read_op.next_time) / duration;
-  std::unique_ptr<vector<double>> values = ReadValues<double>(
-      file, datapoints_to_read);
+  off_t file_size;
+
+  if (!FLAGS_mmap_reads) {
+    std::shared_ptr<FileHandle> file = dir->file_cache->Open(GetPath(), file_size);
+    std::unique_ptr<vector<double>> values = ReadValues<double>(
+        *file, datapoints_to_read, offset);
+    CopyValues(read_op, values->data(), values->size());
+    return;
+  }
+
+  // Range queries usually want a small slice of a dense file, so readahead
+  // is off unless we're about to read a large part of it.
+  std::shared_ptr<MappedFile> mapping = dir->file_cache->Map(
+      GetPath(), file_size, MADV_RANDOM);
+  if (offset >= file_size)
+    return;
 
-  for (double value : *values) {
-    if (std::isnan(value)) continue;
-    read_op.cursor->timestamp = read_op.next_time;
-    read_op.cursor->value = value;
+  size_t len = std::min<int64_t>(datapoints_to_read,
+                                 (file_size - offset) / dense_datapoint_size);
+  if (len * dense_datapoint_size >= dense_readahead_bytes)
+    mapping->Advise(offset, len * dense_datapoint_size, MADV_WILLNEED);
+  CopyValues(read_op,
+             reinterpret_cast<const double*>(mapping->data + offset),
+             len);
+}
+
+
+// values must start at read_op.next_time.
+void DenseFile::CopyValues(ReadOperation& read_op,
+                           const double* values,
+                           size_t len) const
+{
+  // NANs are gaps, so we track timestamps by position rather than by the
+  // last datapoint appended.
+  int64_t timestamp = read_op.next_time;
+  for (size_t i = 0; i < len && read_op.SpaceLeft(); i++, timestamp += duration) {
+    if (std::isnan(values[i])) continue;
+    read_op.cursor->timestamp = timestamp;
+    read_op.cursor->value = values[i];
     read_op.cursor->duration = duration;
     read_op.Advance();
   }
 }
 
 
-size_t DenseFile::Write(const WriteOperation& write_op) {
-  size_t datapoints_to_write = write_op.WritableDatapoints();
-  if (!datapoints_to_write)
+// Writes datapoints from write_op's cursor on for as long as each lands on
+// a slot of ours, lasts as long as a slot and leaves at most
+// --max_dense_nan_gap slots of NAN padding before it. Slots between the
+// datapoints that we already hold keep their values.
+template <typename Buffer>
+size_t DenseFile::WriteDatapoints(const WriteOperation<Buffer>& write_op) {
+  const size_t writable = write_op.WritableDatapoints();
+  const int64_t slots = size / dense_datapoint_size;
+  int64_t first_slot = -1;
+  int64_t last_slot = -1;
+  size_t fitting = 0;
+
+  for (; fitting < writable; fitting++) {
+    const Datapoint& point = write_op.At(fitting);
+    const int64_t offset = point.timestamp - min_timestamp;
+    if (offset < 0 || offset % duration || point.duration != duration)
+      break;
+
+    const int64_t slot = offset / duration;
+    if (slot > std::max(last_slot + 1, slots) + FLAGS_max_dense_nan_gap)
+      break;
+    if (first_slot == -1)
+      first_slot = slot;
+    last_slot = slot;
+  }
+  if (!fitting)
     return 0;
 
-  // Figure out how much NAN padding is needed, if any.
-  auto it = write_op.cursor;
-  unsigned int num_nans = 0;
-
-  if (it->timestamp > max_timestamp)  // avoid underflow
-    num_nans = (it->timestamp - max_timestamp) / duration;
+  // Padding runs from our last slot up to the first datapoint.
+  const int64_t start_slot = std::min(first_slot, slots);
+  const size_t len = last_slot - start_slot + 1;
+  std::unique_ptr<double[]> values(new double[len]);
+  std::fill(values.get(), values.get() + len, double_nan);
+
+  off_t file_size;
+  std::shared_ptr<FileHandle> file = dir->file_cache->Open(
+      GetPath(), file_size, true, FLAGS_datapoint_file_mode);
+
+  const off_t offset = start_slot * dense_datapoint_size;
+  if (start_slot < slots) {
+    std::unique_ptr<vector<double>> existing = ReadValues<double>(
+        *file, std::min<int64_t>(len, slots - start_slot), offset);
+    std::copy(existing->begin(), existing->end(), values.get());
+  }
 
-  if (num_nans > static_cast<unsigned int>(FLAGS_max_dense_nan_gap))
-    return 0;
+  // Sorted datapoints sharing a slot leave the last written in it.
+  for (size_t i = 0; i < fitting; i++) {
+    const Datapoint& point = write_op.At(i);
+    values[(point.timestamp - min_timestamp) / duration - start_slot] =
+        point.value;
+  }
 
-  datapoints_to_write += num_nans;
-  std::unique_ptr<double[]> values(new double[datapoints_to_write]);
+  Iovec iov {values.get(), len * dense_datapoint_size};
+  QueueWrite(file, &iov, 1, offset);
+  size = std::max<off_t>(file_size, offset + len * dense_datapoint_size);
+  dir->file_cache->SetSize(file->path, size);
+  max_timestamp = min_timestamp + size / dense_datapoint_size * duration;
+  dir->FileChanged(*this);
+  return fitting;
+}
 
-  unsigned int i = 0;
-  for (; i < num_nans; i++)
-    values[i] = double_nan;
 
-  for (; i < datapoints_to_write; i++)
-    values[i] = (it++)->value;
-  it = write_op.cursor;
+size_t DenseFile::Write(const WriteOperation<WriteBuffer>& write_op) {
+  return WriteDatapoints(write_op);
+}
 
-  FileHandle file(GetPath(),
-                  O_WRONLY|O_CREAT,
-                  FLAGS_datapoint_file_mode);
-  if (file.fd == -1)
-    throw IOErrorFromErrno("DenseFile::Write open() failed");
 
-  off_t offset = std::min(it->timestamp, max_timestamp) / duration * dense_datapoint_size;
-  if (offset) {
-    if (lseek(file.fd, offset, SEEK_SET) == -1)
-      throw IOErrorFromErrno("DenseFile::Write lseek() failed offset=" +
-                             to_string(offset));
-  }
-  WriteValues<double>(file, values.get(), datapoints_to_write);
-  max_timestamp += datapoints_to_write * duration;
-  return datapoints_to_write - num_nans;
+size_t DenseFile::Write(const WriteOperation<RawBuffer>& write_op) {
+  return WriteDatapoints(write_op);
 }
 
 
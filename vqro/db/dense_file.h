@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <memory>
 
+#include <gflags/gflags.h>
+
 #include "vqro/base/base.h"
 #include "vqro/base/fileutil.h"
 #include "vqro/db/datapoint.h"
@@ -11,6 +13,9 @@
 #include "vqro/db/read_op.h"
 #include "vqro/db/write_op.h"
 
+DECLARE_int32(max_dense_nan_gap);
+
+
 namespace vqro {
 namespace db {
 
@@ -27,17 +32,37 @@ class DenseFile: public DatapointFile {
   DenseFile(DatapointDirectory* _dir, int64_t start_time, int64_t dur) :
     DatapointFile(_dir, start_time, start_time),
     duration(dur) {
-      max_timestamp = start_time + GetFileSize(GetPath()) / dense_datapoint_size * dur;
+      filename = Filename();
+      // A new file may not exist yet, in which case it is empty.
+      size = GetFileSize(GetPath(), true);
+      max_timestamp = start_time + size / dense_datapoint_size * dur;
+    }
+
+  // For files whose size we already know.
+  DenseFile(DatapointDirectory* _dir,
+            int64_t start_time,
+            int64_t dur,
+            int64_t _max) :
+    DatapointFile(_dir, start_time, _max),
+    duration(dur) {
+      filename = Filename();
     }
 
   static std::unique_ptr<DatapointFile> FromFilename(
       DatapointDirectory* dir,
       char* filename);
 
-  string GetPath() const;
+  string Filename() const;
+  ManifestEntry Describe() const;
   void Read(ReadOperation& read_op) const;
-  size_t Write(const WriteOperation& write_op);
+  size_t Write(const WriteOperation<WriteBuffer>& write_op);
+  size_t Write(const WriteOperation<RawBuffer>& write_op);
   size_t RemainingWritableDatapoints() const { return -1; }
+
+ private:
+  template <typename Buffer>
+  size_t WriteDatapoints(const WriteOperation<Buffer>& write_op);
+  void CopyValues(ReadOperation& read_op, const double* values, size_t len) const;
 };
 
 
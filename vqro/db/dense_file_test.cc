@@ -0,0 +1,129 @@
+#include <cmath>
+#include <cstring>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/dense_file.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+size_t Write(DenseFile& file, vector<Datapoint> points) {
+  RawBuffer buffer(points.data(), points.size());
+  WriteOperation<RawBuffer> write_op(&buffer);
+  return file.Write(write_op);
+}
+
+
+vector<Datapoint> ReadAll(const DatapointFile& file) {
+  vector<Datapoint> buffer(100);
+  ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false,
+                        buffer.data(), buffer.size());
+  file.Read(read_op);
+  return vector<Datapoint>(buffer.data(), read_op.cursor);
+}
+
+
+// The file's slots as they are on disk.
+vector<double> Slots(const DenseFile& file) {
+  FileHandle handle(file.GetPath(), O_RDONLY);
+  EXPECT_NE(handle.fd, -1);
+  return *ReadValues<double>(
+      handle, GetFileSize(file.GetPath()) / dense_datapoint_size, 0);
+}
+
+
+class DenseFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir.reset(new DatapointDirectory(nullptr, &file_cache,
+                                     MakeTestDirForTest()));
+  }
+
+  void TearDown() override {
+    FLAGS_max_dense_nan_gap = max_dense_nan_gap;
+    FLAGS_mmap_reads = true;
+  }
+
+  const int32_t max_dense_nan_gap = FLAGS_max_dense_nan_gap;
+
+  FileCache file_cache {16};
+  std::unique_ptr<DatapointDirectory> dir;
+};
+
+
+TEST_F(DenseFileTest, DatapointsLandInTheirSlots) {
+  DenseFile file(dir.get(), 100, 10);
+  EXPECT_EQ(Write(file, {Datapoint(100, 1, 10), Datapoint(110, 2, 10),
+                         Datapoint(120, 3, 10)}), 3);
+  EXPECT_EQ(file.Describe().count, 3);
+  EXPECT_EQ(file.max_timestamp, 130);
+
+  // Slots skipped over are padded with NAN, which reads leave out.
+  EXPECT_EQ(Write(file, {Datapoint(150, 6, 10)}), 1);
+  EXPECT_EQ(file.Describe().count, 6);
+  EXPECT_EQ(file.max_timestamp, 160);
+  vector<double> slots = Slots(file);
+  ASSERT_EQ(slots.size(), 6);
+  EXPECT_TRUE(std::isnan(slots[3]));
+  EXPECT_TRUE(std::isnan(slots[4]));
+
+  // Datapoints inside the file overwrite their slot and nothing else, and
+  // the last of a timestamp written wins.
+  EXPECT_EQ(Write(file, {Datapoint(110, 7, 10), Datapoint(130, 4, 10),
+                         Datapoint(130, 8, 10)}), 3);
+  EXPECT_EQ(file.Describe().count, 6);
+  EXPECT_EQ(Slots(file)[2], 3);
+
+  vector<Datapoint> expected = {
+    Datapoint(100, 1, 10), Datapoint(110, 7, 10), Datapoint(120, 3, 10),
+    Datapoint(130, 8, 10), Datapoint(150, 6, 10),
+  };
+  char filename[256];
+  strncpy(filename, file.filename.c_str(), sizeof(filename));
+  std::unique_ptr<DatapointFile> reopened =
+      DenseFile::FromFilename(dir.get(), filename);
+  ASSERT_NE(reopened, nullptr);
+  for (bool mmap_reads : {true, false}) {
+    FLAGS_mmap_reads = mmap_reads;
+    EXPECT_EQ(ReadAll(file), expected) << "mmap_reads=" << mmap_reads;
+    EXPECT_EQ(ReadAll(*reopened), expected) << "mmap_reads=" << mmap_reads;
+  }
+}
+
+
+TEST_F(DenseFileTest, DatapointsOffItsSlotsAreLeftOut) {
+  FLAGS_max_dense_nan_gap = 2;
+  DenseFile file(dir.get(), 100, 10);
+  EXPECT_EQ(Write(file, {Datapoint(100, 1, 10), Datapoint(110, 2, 10),
+                         Datapoint(120, 3, 10)}), 3);
+
+  // Before the file, between slots or lasting another duration.
+  EXPECT_EQ(Write(file, {Datapoint(90, 0, 10)}), 0);
+  EXPECT_EQ(Write(file, {Datapoint(115, 0, 10)}), 0);
+  EXPECT_EQ(Write(file, {Datapoint(110, 0, 5)}), 0);
+
+  // Writes stop where more than --max_dense_nan_gap slots would be padded,
+  // whether after the file or after the write's previous datapoint.
+  EXPECT_EQ(Write(file, {Datapoint(110, 5, 10), Datapoint(160, 6, 10)}), 1);
+  EXPECT_EQ(Write(file, {Datapoint(150, 5, 10), Datapoint(190, 9, 10)}), 1);
+  EXPECT_EQ(file.Describe().count, 6);
+
+  vector<Datapoint> expected = {
+    Datapoint(100, 1, 10), Datapoint(110, 5, 10), Datapoint(120, 3, 10),
+    Datapoint(150, 5, 10),
+  };
+  EXPECT_EQ(ReadAll(file), expected);
+}
+
+
+} // namespace
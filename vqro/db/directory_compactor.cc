@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/db/db.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/series.h"
+
+
+DEFINE_int32(compaction_min_files,
+             4,
+             "Runs of at least this many small files in a series directory "
+             "are merged into one. Zero disables compaction.");
+DEFINE_int64(compaction_small_file_size,
+             1 << 16,  // 64kb fits ~2.7k datapoints
+             "Sparse and compressed files smaller than this many bytes may "
+             "be compacted.");
+DEFINE_int32(compaction_max_datapoints,
+             1 << 16,
+             "Maximum number of datapoints merged by one compaction.");
+DEFINE_int64(compaction_max_bytes_per_sec,
+             8 << 20,  // 8MB
+             "Compaction pauses as needed to read at most this many bytes "
+             "of datapoint files per second. Zero means no limit.");
+
+
+namespace vqro {
+namespace db {
+
+
+// How long to wait before retrying a compaction whose worker was too busy.
+static constexpr int64_t compaction_retry_ms = 100;
+
+
+void DirectoryCompactor::Start() {
+  compactor = std::thread([this] { Run(); });
+}
+
+
+void DirectoryCompactor::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    stop = true;
+  }
+  wakeup.notify_one();
+  if (compactor.joinable())
+    compactor.join();
+}
+
+
+void DirectoryCompactor::Fragmented(Series* series) {
+  if (FLAGS_compaction_min_files <= 0)
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (!queued.insert(series).second)
+      return;
+    queue.push_back(series->shared_from_this());
+  }
+  wakeup.notify_one();
+}
+
+
+void DirectoryCompactor::Run() {
+  LOG(INFO) << "DirectoryCompactor thread reporting for duty.";
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stop) {
+    if (queue.empty()) {
+      wakeup.wait(lock);
+      continue;
+    }
+
+    std::shared_ptr<Series> series = std::move(queue.front());
+    queue.pop_front();
+    lock.unlock();
+    int64_t bytes = Compact(series);
+    lock.lock();
+
+    // A directory may hold more runs to merge, so after a compaction it goes
+    // to the back of the line rather than hogging its worker.
+    int64_t pause_ms = 0;
+    if (bytes < 0) {
+      queue.push_back(series);
+      pause_ms = compaction_retry_ms;
+    } else if (bytes > 0) {
+      queue.push_back(series);
+      if (FLAGS_compaction_max_bytes_per_sec > 0)
+        pause_ms = bytes * 1000 / FLAGS_compaction_max_bytes_per_sec;
+    } else {
+      queued.erase(series.get());
+    }
+
+    // New work wakes us up too, so we wait out the pause in a loop.
+    int64_t resume = TimeInMillis() + pause_ms;
+    int64_t now;
+    while (!stop && (now = TimeInMillis()) < resume)
+      wakeup.wait_for(lock, std::chrono::milliseconds(resume - now));
+  }
+}
+
+
+// Returns the bytes compacted, or -1 if series' worker was too busy.
+int64_t DirectoryCompactor::Compact(const std::shared_ptr<Series>& series) {
+  int64_t bytes = 0;
+  try {
+    db->GetWorker(series.get())->Do([&] {
+      try {
+        bytes = series->CompactDirectory();
+      } catch (IOError& e) {
+        LOG(ERROR) << "DirectoryCompactor failed to compact series "
+                   << series->keystr << ": " << e.what();
+      }
+    }).wait();
+  } catch (WorkerThreadTooBusy& err) {
+    return -1;
+  }
+
+  if (bytes > 0)
+    compaction_count++;
+  return bytes;
+}
+
+
+} // namespace db
+} // namespace vqro
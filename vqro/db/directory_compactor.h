@@ -0,0 +1,77 @@
+#ifndef VQRO_DB_DIRECTORY_COMPACTOR_H
+#define VQRO_DB_DIRECTORY_COMPACTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/db/series.h"
+
+
+DECLARE_int32(compaction_min_files);
+DECLARE_int64(compaction_small_file_size);
+DECLARE_int32(compaction_max_datapoints);
+
+
+namespace vqro {
+namespace db {
+
+
+class Database;
+
+
+// Late and out of order writes leave a series directory with many small
+// sparse files, each of which a read has to open, sort and walk. The
+// DirectoryCompactor merges runs of them into one file of the best format,
+// see StorageOptimizer::CompactDirectory().
+//
+// Directories are queued when a write creates a file or a read walks many,
+// and compacted one at a time on their series' worker thread, so compaction
+// never races with the series' reads and writes. After each compaction the
+// compactor waits long enough to keep under --compaction_max_bytes_per_sec,
+// and compactions are bounded by --compaction_max_datapoints, so foreground
+// tasks never queue behind much compaction work.
+class DirectoryCompactor {
+ public:
+  explicit DirectoryCompactor(Database* d) : db(d) {}
+  ~DirectoryCompactor() { Stop(); }
+
+  DirectoryCompactor(const DirectoryCompactor& other) = delete;
+  DirectoryCompactor& operator=(const DirectoryCompactor& other) = delete;
+
+  void Start();
+  void Stop();
+
+  // Must run on series' worker thread. Queues series' directory unless it
+  // already is.
+  void Fragmented(Series* series);
+
+  // Returns the number of compactions since the last call.
+  int64_t TakeCompactionCount() { return compaction_count.exchange(0); }
+
+ private:
+  Database* const db;
+  std::thread compactor;
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  bool stop = false;
+  std::deque<std::shared_ptr<Series>> queue;
+  std::unordered_set<Series*> queued;
+
+  std::atomic<int64_t> compaction_count {0};
+
+  void Run();
+  int64_t Compact(const std::shared_ptr<Series>& series);
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_DIRECTORY_COMPACTOR_H
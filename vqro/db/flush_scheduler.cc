@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/db/db.h"
+#include "vqro/db/flush_scheduler.h"
+#include "vqro/db/series.h"
+
+
+DEFINE_int32(flush_max_age,
+             60000,
+             "Maximum milliseconds a datapoint may wait in a write buffer "
+             "before its series is flushed.");
+DEFINE_int64(flush_max_buffer_bytes,
+             1 << 20,  // 1MB
+             "Series whose write buffers grow to this many bytes are "
+             "flushed right away. Zero means no limit.");
+DEFINE_int32(flush_max_in_flight,
+             128,
+             "Maximum number of flushes queued on the worker threads at "
+             "once.");
+DEFINE_int32(flush_batch_series,
+             32,
+             "Maximum number of series a worker thread flushes in one task, "
+             "submitting their writes together.");
+
+
+namespace vqro {
+namespace db {
+
+
+// How long to wait before retrying a flush that failed.
+static constexpr int64_t flush_retry_ms = 1000;
+
+
+void FlushScheduler::Start() {
+  scheduler = std::thread([this] { Run(); });
+}
+
+
+void FlushScheduler::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    stop = true;
+  }
+  wakeup.notify_one();
+  if (scheduler.joinable())
+    scheduler.join();
+}
+
+
+void FlushScheduler::Buffered(Series* series) {
+  int64_t first_buffered = series->first_buffered;
+  if (!first_buffered)
+    return;  // Nothing was buffered
+
+  // A buffer over the size limit is due as of its first datapoint, which has
+  // already passed.
+  int64_t deadline = first_buffered + FLAGS_flush_max_age;
+  if (FLAGS_flush_max_buffer_bytes > 0 &&
+      static_cast<int64_t>(series->BytesBuffered()) >= FLAGS_flush_max_buffer_bytes)
+    deadline = first_buffered;
+
+  Schedule(series, deadline);
+}
+
+
+void FlushScheduler::MemoryPressure() {
+  // Setting the flag under the lock means Run() can't miss the wakeup between
+  // checking the flush threshold and waiting.
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    pressure = true;
+  }
+  wakeup.notify_one();
+}
+
+
+int64_t FlushScheduler::TakeMaxFlushLag() {
+  return max_flush_lag.exchange(0);
+}
+
+
+void FlushScheduler::Schedule(Series* series, int64_t deadline) {
+  // Most writes land in a series that is already scheduled at least as soon,
+  // which we check without taking the lock.
+  auto already_scheduled = [&] {
+    int64_t current = series->flush_deadline;
+    return current == flush_queued ||
+           (current != unscheduled && current <= deadline);
+  };
+  if (already_scheduled())
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (already_scheduled())
+      return;
+
+    // Any entry for an earlier deadline of ours is now stale, Run() drops it.
+    series->flush_deadline = deadline;
+    queue.push(Entry {deadline, series->shared_from_this()});
+    if (queue.top().deadline < deadline)
+      return;  // We don't change when the scheduler next wakes up
+  }
+  wakeup.notify_one();
+}
+
+
+void FlushScheduler::Run() {
+  LOG(INFO) << "FlushScheduler thread reporting for duty.";
+  const size_t max_in_flight = std::max(FLAGS_flush_max_in_flight, 1);
+  const size_t max_batch = std::max(FLAGS_flush_batch_series, 1);
+
+  // Due series are flushed in batches, one task per worker.
+  std::map<WorkerThread*,vector<Due>> batches;
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stop) {
+    int64_t now = TimeInMillis();
+    bool worker_busy = false;
+    pressure = false;
+
+    while (!queue.empty() && in_flight < max_in_flight) {
+      Due top {queue.top().deadline, queue.top().series.lock()};
+      if (!top.series || top.series->flush_deadline != top.deadline) {
+        queue.pop();  // Stale, or the series is gone
+        continue;
+      }
+
+      // Under memory pressure we flush early, earliest deadline first.
+      if (top.deadline > now && !db->OverFlushThreshold())
+        break;
+
+      queue.pop();
+      top.series->flush_deadline = flush_queued;
+      in_flight++;
+
+      WorkerThread* worker = db->GetWorker(top.series.get());
+      vector<Due>& batch = batches[worker];
+      batch.push_back(std::move(top));
+      if (batch.size() >= max_batch) {
+        worker_busy = !QueueFlush(worker, batch);
+        batch.clear();
+        if (worker_busy)
+          break;
+      }
+    }
+
+    for (auto& it : batches) {
+      if (!it.second.empty() && !QueueFlush(it.first, it.second))
+        worker_busy = true;
+      it.second.clear();
+    }
+
+    // Flush completions, new deadlines and memory pressure all wake us up.
+    if (pressure)
+      continue;  // Signalled since we last looked
+    if (worker_busy) {
+      wakeup.wait_for(lock, std::chrono::milliseconds(10));
+    } else if (queue.empty() || in_flight >= max_in_flight) {
+      wakeup.wait(lock);
+    } else {
+      wakeup.wait_for(lock, std::chrono::milliseconds(
+          std::max<int64_t>(queue.top().deadline - now, 1)));
+    }
+  }
+}
+
+
+// Must hold mutex. Queues one task on worker flushing the series of batch,
+// which are counted in flight. Returns false, putting them back in the queue,
+// if worker is too busy.
+bool FlushScheduler::QueueFlush(WorkerThread* worker,
+                                const vector<Due>& batch) {
+  auto series = std::make_shared<vector<std::shared_ptr<Series>>>();
+  for (const Due& due : batch)
+    series->push_back(due.series);
+
+  try {
+    worker->Post([this, series] { Flush(*series); });
+  } catch (WorkerThreadTooBusy& err) {
+    for (const Due& due : batch) {
+      due.series->flush_deadline = due.deadline;
+      queue.push(Entry {due.deadline, due.series});
+    }
+    in_flight -= batch.size();
+    return false;
+  }
+  return true;
+}
+
+
+// Runs on the series' worker thread.
+void FlushScheduler::Flush(const vector<std::shared_ptr<Series>>& series) {
+  vector<int64_t> first_buffered;
+  for (auto& s : series)
+    first_buffered.push_back(s->first_buffered);
+
+  vector<bool> flushed;
+  db->FlushSeries(series, flushed);
+  int64_t now = TimeInMillis();
+
+  for (size_t i = 0; i < series.size(); i++) {
+    if (flushed[i] && first_buffered[i]) {
+      int64_t lag = now - first_buffered[i];
+      int64_t max_lag = max_flush_lag;
+      while (lag > max_lag && !max_flush_lag.compare_exchange_weak(max_lag, lag));
+      flush_count++;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    for (auto& s : series)
+      s->flush_deadline = unscheduled;
+    in_flight -= series.size();
+  }
+  wakeup.notify_one();
+
+  for (size_t i = 0; i < series.size(); i++) {
+    if (!flushed[i])
+      Schedule(series[i].get(), now + flush_retry_ms);
+  }
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,109 @@
+#ifndef VQRO_DB_FLUSH_SCHEDULER_H
+#define VQRO_DB_FLUSH_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/db/series.h"
+
+
+DECLARE_int32(flush_max_age);
+DECLARE_int64(flush_max_buffer_bytes);
+
+
+namespace vqro {
+namespace db {
+
+
+class Database;
+
+
+// The FlushScheduler decides when each series' write buffer is flushed to
+// disk. A series is scheduled when its buffer goes from empty to holding
+// datapoints, with a deadline --flush_max_age milliseconds later, and is moved
+// up to now if its buffer grows past --flush_max_buffer_bytes. While the
+// database's write buffers are over their flush threshold the scheduler
+// flushes the series with the earliest deadlines without waiting for them.
+//
+// Deadlines are kept in a priority queue rather than re-sorting every series.
+// Flushes run as tasks on the series' own worker thread, so they never race
+// with its writes and reads, and run in parallel across workers. Series due
+// together on the same worker are flushed by one task, up to
+// --flush_batch_series of them, whose writes are submitted as one IoBatch.
+class FlushScheduler {
+ public:
+  explicit FlushScheduler(Database* d) : db(d) {}
+  ~FlushScheduler() { Stop(); }
+
+  FlushScheduler(const FlushScheduler& other) = delete;
+  FlushScheduler& operator=(const FlushScheduler& other) = delete;
+
+  void Start();
+  void Stop();
+
+  // Must run on series' worker thread after a write to it.
+  void Buffered(Series* series);
+
+  // Wakes the scheduler because the write buffers went over their flush
+  // threshold.
+  void MemoryPressure();
+
+  // Flush lag is how long a series' oldest datapoint waited in memory before
+  // being flushed. Returns the greatest flush lag, and the number of flushes,
+  // since the last call.
+  int64_t TakeMaxFlushLag();
+  int64_t TakeFlushCount() { return flush_count.exchange(0); }
+
+ private:
+  // Values of Series::flush_deadline other than a deadline.
+  static constexpr int64_t unscheduled = 0;
+  static constexpr int64_t flush_queued = -1;
+
+  // Entries don't keep a series alive, one erased from the registry before
+  // its deadline is dropped as stale.
+  struct Entry {
+    int64_t deadline;
+    std::weak_ptr<Series> series;
+
+    bool operator>(const Entry& other) const {
+      return deadline > other.deadline;
+    }
+  };
+
+  // A series taken off the queue to be flushed.
+  struct Due {
+    int64_t deadline;
+    std::shared_ptr<Series> series;
+  };
+
+  Database* const db;
+  std::thread scheduler;
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  bool stop = false;
+  bool pressure = false;  // Set by MemoryPressure() until Run() wakes up
+  size_t in_flight = 0;  // Flushes queued on workers
+  std::priority_queue<Entry, vector<Entry>, std::greater<Entry>> queue;
+
+  std::atomic<int64_t> max_flush_lag {0};
+  std::atomic<int64_t> flush_count {0};
+
+  void Run();
+  void Schedule(Series* series, int64_t deadline);
+  bool QueueFlush(WorkerThread* worker, const vector<Due>& batch);
+  void Flush(const vector<std::shared_ptr<Series>>& series);
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_FLUSH_SCHEDULER_H
@@ -0,0 +1,243 @@
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/flush_scheduler.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/series.h"
+#include "vqro/db/sparse_file.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int32(flush_max_in_flight);
+DECLARE_int32(flush_batch_series);
+DECLARE_int32(sparse_file_optimize_size);
+DECLARE_double(write_buffer_flush_threshold);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+// Our own scheduler over the database's workers, fed series the database
+// doesn't know about. Series are written before the scheduler starts, since
+// from then on their flushes may be running on a worker.
+class FlushSchedulerTest : public DatabaseTest {
+ protected:
+  void SetUp() override {
+    DatabaseTest::SetUp();
+    FLAGS_flush_max_buffer_bytes = 0;
+    scheduler.reset(new FlushScheduler(db.get()));
+  }
+
+  void TearDown() override {
+    // Flushes still queued on the workers finish before they stop.
+    scheduler->Stop();
+    DatabaseTest::TearDown();
+    scheduler.reset();
+
+    FLAGS_flush_max_age = flush_max_age;
+    FLAGS_flush_max_buffer_bytes = flush_max_buffer_bytes;
+    FLAGS_flush_max_in_flight = flush_max_in_flight;
+    FLAGS_flush_batch_series = flush_batch_series;
+    FLAGS_write_buffer_flush_threshold = write_buffer_flush_threshold;
+  }
+
+  // Buffers a datapoint in a new series and schedules it with a deadline
+  // flush_max_age milliseconds from now.
+  std::shared_ptr<Series> Buffer(const string& name, int32_t flush_max_age) {
+    std::shared_ptr<Series> series = MakeSeries(name);
+    vqro::rpc::WriteOperation op;
+    vqro::rpc::Datapoint* point = op.add_datapoints();
+    point->set_timestamp(1000);
+    point->set_value(1);
+    series->Write(op);
+
+    FLAGS_flush_max_age = flush_max_age;
+    scheduler->Buffered(series.get());
+    return series;
+  }
+
+  static bool Flushed(const std::shared_ptr<Series>& series) {
+    return series->DatapointsBuffered() == 0;
+  }
+
+  // Waits up to five seconds for series to be flushed.
+  static bool WaitFlushed(const std::shared_ptr<Series>& series) {
+    for (int i = 0; i < 5000 && !Flushed(series); i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return Flushed(series);
+  }
+
+  const int32_t flush_max_age = FLAGS_flush_max_age;
+  const int64_t flush_max_buffer_bytes = FLAGS_flush_max_buffer_bytes;
+  const int32_t flush_max_in_flight = FLAGS_flush_max_in_flight;
+  const int32_t flush_batch_series = FLAGS_flush_batch_series;
+  const double write_buffer_flush_threshold =
+      FLAGS_write_buffer_flush_threshold;
+
+  std::unique_ptr<FlushScheduler> scheduler;
+};
+
+
+TEST_F(FlushSchedulerTest, SeriesAreFlushedByTheirDeadlines) {
+  int64_t start = TimeInMillis();
+  std::shared_ptr<Series> later = Buffer("later", 800);
+  std::shared_ptr<Series> sooner = Buffer("sooner", 200);
+  scheduler->Start();
+
+  ASSERT_TRUE(WaitFlushed(sooner));
+  EXPECT_GE(TimeInMillis() - start, 200);
+  EXPECT_FALSE(Flushed(later));
+
+  ASSERT_TRUE(WaitFlushed(later));
+  EXPECT_GE(TimeInMillis() - start, 800);
+  EXPECT_EQ(scheduler->TakeFlushCount(), 2);
+  EXPECT_GE(scheduler->TakeMaxFlushLag(), 800);
+}
+
+
+TEST_F(FlushSchedulerTest, FullBuffersAreFlushedRightAway) {
+  std::shared_ptr<Series> small = Buffer("small", 3600 * 1000);
+  FLAGS_flush_max_buffer_bytes = 1;
+  std::shared_ptr<Series> full = Buffer("full", 3600 * 1000);
+  scheduler->Start();
+
+  ASSERT_TRUE(WaitFlushed(full));
+  EXPECT_FALSE(Flushed(small));
+}
+
+
+TEST_F(FlushSchedulerTest, MemoryPressureFlushesEarliestDeadlinesFirst) {
+  FLAGS_flush_max_in_flight = 1;
+  FLAGS_flush_batch_series = 1;
+  std::shared_ptr<Series> later = Buffer("later", 7200 * 1000);
+  std::shared_ptr<Series> sooner = Buffer("sooner", 3600 * 1000);
+  scheduler->Start();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(Flushed(sooner));
+  EXPECT_FALSE(Flushed(later));
+
+  // Now the write buffers are over the threshold. Our series' writes weren't
+  // charged to the database but their flushes are credited, so it must stay
+  // below zero.
+  FLAGS_write_buffer_flush_threshold = -1;
+  scheduler->MemoryPressure();
+
+  // One flush at a time, so sooner's is done before later's is queued.
+  int64_t sooner_flushed = 0;
+  int64_t later_flushed = 0;
+  for (int i = 0; i < 5000 && !(sooner_flushed && later_flushed); i++) {
+    if (!later_flushed && Flushed(later))
+      later_flushed = i + 1;
+    if (!sooner_flushed && Flushed(sooner))
+      sooner_flushed = i + 1;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_TRUE(sooner_flushed && later_flushed);
+  EXPECT_LE(sooner_flushed, later_flushed);
+}
+
+
+// Series whose datapoint files hold two datapoints each and are named after
+// their timestamps, so a test can block where one will go.
+class FailedFlushTest : public FlushSchedulerTest {
+ protected:
+  void SetUp() override {
+    FlushSchedulerTest::SetUp();
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 0;
+    FLAGS_datapoint_manifest = false;
+    FLAGS_sparse_file_max_size = 2 * datapoint_size;
+    FLAGS_sparse_file_optimize_size = 1 << 20;
+  }
+
+  void TearDown() override {
+    FlushSchedulerTest::TearDown();
+    FLAGS_datapoint_manifest = datapoint_manifest;
+    FLAGS_sparse_file_max_size = sparse_file_max_size;
+    FLAGS_sparse_file_optimize_size = sparse_file_optimize_size;
+  }
+
+  // Where series keeps its datapoint files, as Series::Init() names it.
+  string DirectoryOf(const std::shared_ptr<Series>& series) {
+    string series_dir = HexString<size_t>(series->keyint);
+    series_dir.insert(series_dir.begin() + 4, '/');
+    return db->GetDataDirectory() + "datapoints/" + series_dir;
+  }
+
+  // The size of the regular files in dir, and how many there are.
+  static off_t BytesInFiles(const string& dir, int* files) {
+    off_t bytes = 0;
+    *files = 0;
+    DIR* d = opendir(dir.c_str());
+    if (!d)
+      return 0;
+    while (struct dirent* entry = readdir(d)) {
+      struct stat st;
+      string path = dir + "/" + entry->d_name;
+      if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+        bytes += st.st_size;
+        (*files)++;
+      }
+    }
+    closedir(d);
+    return bytes;
+  }
+
+  DirectoryFlagSaver flag_saver;
+  const bool datapoint_manifest = FLAGS_datapoint_manifest;
+  const int64_t sparse_file_max_size = FLAGS_sparse_file_max_size;
+  const int32_t sparse_file_optimize_size = FLAGS_sparse_file_optimize_size;
+};
+
+
+TEST_F(FailedFlushTest, FailedFlushesLeaveNothingOnDisk) {
+  std::shared_ptr<Series> series = MakeSeries("blocked");
+  vqro::rpc::WriteOperation op;
+  for (int64_t t = 1000; t < 1040; t += 10) {
+    vqro::rpc::Datapoint* point = op.add_datapoints();
+    point->set_timestamp(t);
+    point->set_value(1);
+  }
+  series->Write(op);
+
+  // The first file is written before the second can't be created. Neither
+  // may keep any datapoints while the flush as a whole has failed.
+  string dir = DirectoryOf(series);
+  string blocker = dir + "/1020-1020";
+  CreateDirectory(blocker);
+  FLAGS_flush_max_buffer_bytes = 1;
+  scheduler->Buffered(series.get());
+  scheduler->Start();
+
+  int files = 0;
+  for (int i = 0; i < 5000 && !files; i++) {
+    BytesInFiles(dir, &files);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_EQ(files, 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(BytesInFiles(dir, &files), 0);
+  EXPECT_FALSE(Flushed(series));
+
+  // The retry writes every datapoint, once.
+  ASSERT_EQ(rmdir(blocker.c_str()), 0);
+  ASSERT_TRUE(WaitFlushed(series));
+  EXPECT_EQ(BytesInFiles(dir, &files), 4 * datapoint_size);
+  EXPECT_EQ(files, 2);
+}
+
+
+} // namespace
@@ -0,0 +1,265 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <algorithm>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint_file.h"
+#include "vqro/db/manifest.h"
+
+
+DEFINE_bool(datapoint_manifest,
+            true,
+            "Keep the metadata of datapoint files in a manifest per series "
+            "directory instead of in their filenames.");
+
+
+namespace vqro {
+namespace db {
+
+
+constexpr uint8_t manifest_put = 1;
+constexpr uint8_t manifest_remove = 2;
+constexpr uint8_t manifest_replace = 3;
+
+
+// Fixed part of a record body, the filename follows.
+struct ManifestRecord {
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  int64_t duration;
+  int64_t count;
+  double value;
+  int64_t size;
+  uint32_t checksum;
+  uint8_t op;
+  uint8_t format;
+  uint8_t flags;
+  uint8_t unused;
+};
+static_assert(sizeof(ManifestRecord) == 56,
+              "ManifestRecord must have no padding");
+
+constexpr size_t manifest_header_size = 2 * sizeof(uint32_t);
+
+// The manifest file is rewritten once it holds this many records more than
+// twice its number of entries.
+constexpr size_t manifest_slack_records = 16;
+
+
+static void AppendRecord(string& out,
+                         uint8_t op,
+                         const ManifestEntry& entry,
+                         const vector<string>& replaced={}) {
+  ManifestRecord record {
+    entry.min_timestamp,
+    entry.max_timestamp,
+    entry.duration,
+    entry.count,
+    entry.value,
+    entry.size,
+    entry.checksum,
+    op,
+    static_cast<uint8_t>(entry.format),
+    entry.flags,
+    0
+  };
+  string body(reinterpret_cast<const char*>(&record), sizeof(record));
+  body += entry.filename;
+  for (const string& filename : replaced) {
+    body += '\0';
+    body += filename;
+  }
+
+  uint32_t len = body.size();
+  uint32_t crc = crc32(0, reinterpret_cast<const Bytef*>(body.data()), len);
+  out.append(reinterpret_cast<const char*>(&len), sizeof(len));
+  out.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+  out += body;
+}
+
+
+Manifest::Manifest(string dir_path, FileCache* cache) :
+  path(dir_path + "/" + MANIFEST_FILENAME),
+  file_cache(cache) {}
+
+
+bool Manifest::Load() {
+  entries.clear();
+  record_count = 0;
+
+  std::unique_ptr<vector<char>> data;
+  {
+    FileHandle file(path, O_RDONLY | O_CLOEXEC);
+    if (file.fd == -1) {
+      if (errno == ENOENT)
+        return false;
+      throw IOErrorFromErrno("Manifest::Load open() failed path=" + path);
+    }
+    data = ReadValues<char>(file, GetFileSize(path));
+  }
+
+  const char* pos = data->data();
+  const char* end = pos + data->size();
+  while (pos < end) {
+    uint32_t len;
+    uint32_t crc;
+    if (end - pos < static_cast<long>(manifest_header_size))
+      break;
+    memcpy(&len, pos, sizeof(len));
+    memcpy(&crc, pos + sizeof(len), sizeof(crc));
+    pos += manifest_header_size;
+
+    if (end - pos < len ||
+        len < sizeof(ManifestRecord) ||
+        crc32(0, reinterpret_cast<const Bytef*>(pos), len) != crc) {
+      pos -= manifest_header_size;
+      break;
+    }
+
+    ManifestRecord record;
+    memcpy(&record, pos, sizeof(record));
+    string filename(pos + sizeof(record), len - sizeof(record));
+    pos += len;
+    record_count++;
+
+    if (record.op == manifest_remove) {
+      entries.erase(filename);
+      continue;
+    }
+    if (record.op == manifest_replace) {
+      // The replaced names follow the filename, each after a NUL.
+      size_t name_end = filename.find('\0');
+      for (size_t name_start = name_end; name_start != string::npos; ) {
+        size_t next = filename.find('\0', name_start + 1);
+        entries.erase(filename.substr(name_start + 1, next - name_start - 1));
+        name_start = next;
+      }
+      if (name_end != string::npos)
+        filename.resize(name_end);
+    }
+    entries[filename] = std::make_pair(next_seq++, ManifestEntry {
+      filename,
+      static_cast<FileFormat>(record.format),
+      record.flags,
+      record.min_timestamp,
+      record.max_timestamp,
+      record.duration,
+      record.count,
+      record.value,
+      record.size,
+      record.checksum
+    });
+  }
+
+  // Records appended after a torn one would never be read back.
+  if (pos < end) {
+    LOG(WARNING) << "Manifest ignoring " << (end - pos)
+                 << " trailing bytes of " << path;
+    Rewrite();
+  }
+  return true;
+}
+
+
+vector<ManifestEntry> Manifest::Entries() const {
+  vector<std::pair<uint64_t,ManifestEntry>> ordered;
+  ordered.reserve(entries.size());
+  for (const auto& it : entries)
+    ordered.push_back(it.second);
+  std::sort(ordered.begin(), ordered.end(),
+      [] (const std::pair<uint64_t,ManifestEntry>& a,
+          const std::pair<uint64_t,ManifestEntry>& b) -> bool {
+        return a.first < b.first;
+      }
+  );
+
+  vector<ManifestEntry> result;
+  result.reserve(ordered.size());
+  for (auto& it : ordered)
+    result.push_back(std::move(it.second));
+  return result;
+}
+
+
+void Manifest::Put(const ManifestEntry& entry) {
+  entries[entry.filename] = std::make_pair(next_seq++, entry);
+  string records;
+  AppendRecord(records, manifest_put, entry);
+  Append(records, 1);
+}
+
+
+void Manifest::Remove(const string& filename) {
+  if (!entries.erase(filename))
+    return;
+
+  ManifestEntry entry {};
+  entry.filename = filename;
+  string records;
+  AppendRecord(records, manifest_remove, entry);
+  Append(records, 1);
+}
+
+
+void Manifest::Replace(const ManifestEntry& entry,
+                       const vector<string>& replaced) {
+  for (const string& filename : replaced)
+    entries.erase(filename);
+  entries[entry.filename] = std::make_pair(next_seq++, entry);
+  string records;
+  AppendRecord(records, manifest_replace, entry, replaced);
+  Append(records, 1);
+}
+
+
+void Manifest::Reset(const vector<ManifestEntry>& new_entries) {
+  entries.clear();
+  for (const ManifestEntry& entry : new_entries)
+    entries[entry.filename] = std::make_pair(next_seq++, entry);
+  Rewrite();
+}
+
+
+void Manifest::Append(const string& records, size_t count) {
+  off_t size;
+  std::shared_ptr<FileHandle> file = file_cache->Open(
+      path, size, true, FLAGS_datapoint_file_mode);
+  Iovec iov {const_cast<char*>(records.data()), records.size()};
+  QueueWrite(file, &iov, 1, size);
+  file_cache->SetSize(path, size + records.size());
+  record_count += count;
+
+  if (record_count > 2 * entries.size() + manifest_slack_records)
+    Rewrite();
+}
+
+
+void Manifest::Rewrite() {
+  string records;
+  for (const ManifestEntry& entry : Entries())
+    AppendRecord(records, manifest_put, entry);
+
+  string tmp_path = path + ".tmp";
+  {
+    FileHandle file(tmp_path,
+                    O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC,
+                    FLAGS_datapoint_file_mode);
+    if (file.fd == -1)
+      throw IOErrorFromErrno("Manifest::Rewrite open() failed path=" + tmp_path);
+    WriteValues<char>(file, const_cast<char*>(records.data()), records.size());
+    SyncFile(file);
+  }
+  if (rename(tmp_path.c_str(), path.c_str()) == -1)
+    throw IOErrorFromErrno("Manifest::Rewrite rename() failed path=" + path);
+  file_cache->Invalidate(path);
+  record_count = entries.size();
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,117 @@
+#ifndef VQRO_DB_MANIFEST_H
+#define VQRO_DB_MANIFEST_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+
+
+DECLARE_bool(datapoint_manifest);
+
+
+namespace vqro {
+namespace db {
+
+
+// Name of the manifest file in a datapoint directory.
+constexpr const char* MANIFEST_FILENAME = "MANIFEST";
+
+
+enum class FileFormat : uint8_t {
+  SPARSE = 1,
+  DENSE = 2,
+  CONSTANT = 3,
+  COMPRESSED = 4,
+  SEGMENT = 5,  // Never in a manifest, see SegmentFile
+};
+
+
+// ManifestEntry flags.
+constexpr uint8_t FILE_OPTIMIZED = 1;    // SparseFile only
+constexpr uint8_t FILE_SEALED = 2;       // SparseFile only
+constexpr uint8_t FILE_CHECKSUMMED = 4;  // checksum covers the first size bytes
+
+
+// Everything needed to open a datapoint file without looking at its name or
+// the file itself.
+struct ManifestEntry {
+  string filename;
+  FileFormat format;
+  uint8_t flags;
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  int64_t duration;  // DenseFile and ConstantFile
+  int64_t count;     // Datapoints
+  double value;      // ConstantFile
+  int64_t size;      // Bytes
+  uint32_t checksum; // crc32 of the contents if FILE_CHECKSUMMED
+};
+
+
+// A Manifest records the metadata of every file in a datapoint directory, so
+// files can keep the name they were created with instead of being renamed
+// whenever their metadata changes, and a directory can be loaded with one
+// read instead of a readdir() and a stat() per file.
+//
+// The manifest file is a log of records, each replacing or removing the entry
+// of one file. Once most records are obsolete the log is rewritten with just
+// the current entries, under a temporary name then renamed into place.
+//
+// Record format (little endian):
+//   uint32 body length | uint32 crc32(body) | body
+// where the body is a ManifestRecord followed by the filename. A record
+// replacing other files follows the filename with a NUL and the name of each
+// file it replaces, so a conversion is recorded whole or not at all. A torn
+// or corrupt record ends the log.
+//
+// Not thread-safe, a manifest belongs to its directory's worker thread.
+class Manifest {
+ public:
+  Manifest(string dir_path, FileCache* cache);
+
+  Manifest(const Manifest& other) = delete;
+  Manifest& operator=(const Manifest& other) = delete;
+
+  // Reads the manifest file. Returns false if there is none. Throws IOError.
+  bool Load();
+
+  // Current entries, in the order they were last recorded.
+  vector<ManifestEntry> Entries() const;
+
+  // Adds or replaces the entry for entry.filename.
+  void Put(const ManifestEntry& entry);
+  void Remove(const string& filename);
+
+  // Puts entry and removes the entries of the files named replaced, in one
+  // record. Filenames must not contain NULs.
+  void Replace(const ManifestEntry& entry, const vector<string>& replaced);
+
+  // True if we have an entry for filename.
+  bool Contains(const string& filename) const { return entries.count(filename); }
+
+  // Replaces the manifest file with one holding just entries.
+  void Reset(const vector<ManifestEntry>& entries);
+
+ private:
+  const string path;
+  FileCache* const file_cache;
+
+  uint64_t next_seq = 0;  // Orders entries by when they were recorded
+  std::unordered_map<string,std::pair<uint64_t,ManifestEntry>> entries;
+  size_t record_count = 0;  // In the manifest file
+
+  void Append(const string& records, size_t count);
+  void Rewrite();
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_MANIFEST_H
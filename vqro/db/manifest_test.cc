@@ -0,0 +1,320 @@
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/sparse_file.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_bool(cadence_profiles);
+DECLARE_int32(compaction_min_files);
+DECLARE_int32(sparse_file_optimize_size);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+ManifestEntry MakeEntry(const string& filename, int64_t min, int64_t max) {
+  ManifestEntry entry {};
+  entry.filename = filename;
+  entry.format = FileFormat::SPARSE;
+  entry.flags = FILE_CHECKSUMMED;
+  entry.min_timestamp = min;
+  entry.max_timestamp = max;
+  entry.count = max - min + 1;
+  entry.size = entry.count * datapoint_size;
+  entry.checksum = 0xdeadbeef;
+  return entry;
+}
+
+
+vector<string> Filenames(const Manifest& manifest) {
+  vector<string> names;
+  for (const ManifestEntry& entry : manifest.Entries())
+    names.push_back(entry.filename);
+  return names;
+}
+
+
+// What a restart would see.
+vector<string> Reload(const string& dir, FileCache* file_cache) {
+  Manifest manifest(dir, file_cache);
+  EXPECT_TRUE(manifest.Load());
+  return Filenames(manifest);
+}
+
+
+TEST(ManifestTest, MissingManifestDoesNotLoad) {
+  FileCache file_cache(16);
+  Manifest manifest(MakeTestDir("manifest_missing"), &file_cache);
+  EXPECT_FALSE(manifest.Load());
+  EXPECT_TRUE(manifest.Entries().empty());
+}
+
+
+TEST(ManifestTest, ReplaysPutsAndRemoves) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_replay");
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("a", 0, 9));
+  manifest.Put(MakeEntry("b", 10, 19));
+  manifest.Put(MakeEntry("c", 20, 29));
+  manifest.Remove("b");
+  manifest.Remove("nonexistent");
+  manifest.Put(MakeEntry("a", 0, 15));  // Grew, so it moves to the back
+
+  Manifest reloaded(dir, &file_cache);
+  ASSERT_TRUE(reloaded.Load());
+  EXPECT_EQ(Filenames(reloaded), vector<string>({"c", "a"}));
+
+  ManifestEntry a = reloaded.Entries().back();
+  EXPECT_EQ(a.format, FileFormat::SPARSE);
+  EXPECT_EQ(a.flags, FILE_CHECKSUMMED);
+  EXPECT_EQ(a.min_timestamp, 0);
+  EXPECT_EQ(a.max_timestamp, 15);
+  EXPECT_EQ(a.count, 16);
+  EXPECT_EQ(a.size, 16 * datapoint_size);
+  EXPECT_EQ(a.checksum, 0xdeadbeef);
+}
+
+
+TEST(ManifestTest, RecordFormat) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_format");
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("0-9", 0, 9));
+
+  // uint32 length | uint32 crc | 56 byte record | filename
+  string path = dir + "/" + MANIFEST_FILENAME;
+  ASSERT_EQ(GetFileSize(path), 8 + 56 + 3);
+  FileHandle file(path, O_RDONLY);
+  auto header = ReadValues<uint32_t>(file, 2, 0);
+  EXPECT_EQ(header->at(0), 56 + 3);
+  auto name = ReadValues<char>(file, 3, 8 + 56);
+  EXPECT_EQ(string(name->begin(), name->end()), "0-9");
+}
+
+
+TEST(ManifestTest, TornTailIsDropped) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_torn");
+  string path = dir + "/" + MANIFEST_FILENAME;
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("a", 0, 9));
+  off_t good_size = GetFileSize(path);
+  manifest.Put(MakeEntry("b", 10, 19));
+
+  // A record cut short by a crash.
+  ASSERT_EQ(truncate(path.c_str(), GetFileSize(path) - 5), 0);
+  file_cache.Invalidate(path);
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"a"}));
+
+  // The torn record was dropped from the file, so later records aren't
+  // stranded behind it.
+  EXPECT_EQ(GetFileSize(path), good_size);
+  Manifest appender(dir, &file_cache);
+  ASSERT_TRUE(appender.Load());
+  appender.Put(MakeEntry("c", 20, 29));
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"a", "c"}));
+}
+
+
+TEST(ManifestTest, CorruptRecordEndsTheLog) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_corrupt");
+  string path = dir + "/" + MANIFEST_FILENAME;
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("a", 0, 9));
+  off_t good_size = GetFileSize(path);
+  manifest.Put(MakeEntry("b", 10, 19));
+  manifest.Put(MakeEntry("c", 20, 29));
+
+  // Flip a bit in the body of b's record, its crc no longer matches.
+  {
+    FileHandle file(path, O_RDWR);
+    char byte;
+    ASSERT_EQ(pread(file.fd, &byte, 1, good_size + 8 + 4), 1);
+    byte ^= 1;
+    ASSERT_EQ(pwrite(file.fd, &byte, 1, good_size + 8 + 4), 1);
+  }
+  file_cache.Invalidate(path);
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"a"}));
+}
+
+
+TEST(ManifestTest, RewritesObsoleteRecords) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_rewrite");
+  string path = dir + "/" + MANIFEST_FILENAME;
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("a", 0, 0));
+  off_t one_record = GetFileSize(path);
+  manifest.Put(MakeEntry("b", 100, 100));
+
+  // A growing file is recorded again on every write, but the log is
+  // rewritten before it holds more than a few records per entry.
+  for (int64_t i = 1; i < 100; i++) {
+    manifest.Put(MakeEntry("a", 0, i));
+    EXPECT_LE(GetFileSize(path), one_record * (2 * 2 + 16 + 1));
+  }
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"b", "a"}));
+  Manifest reloaded(dir, &file_cache);
+  ASSERT_TRUE(reloaded.Load());
+  EXPECT_EQ(reloaded.Entries().back().max_timestamp, 99);
+
+  manifest.Reset({MakeEntry("c", 0, 1)});
+  EXPECT_EQ(GetFileSize(path), one_record);
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"c"}));
+}
+
+
+TEST(ManifestTest, ReplaceIsOneRecord) {
+  FileCache file_cache(16);
+  string dir = MakeTestDir("manifest_replace");
+  string path = dir + "/" + MANIFEST_FILENAME;
+  Manifest manifest(dir, &file_cache);
+  manifest.Put(MakeEntry("a", 0, 9));
+  manifest.Put(MakeEntry("b", 10, 19));
+  manifest.Put(MakeEntry("c", 20, 29));
+  off_t before_replace = GetFileSize(path);
+
+  manifest.Replace(MakeEntry("ab.gor", 0, 19), {"a", "b"});
+  EXPECT_EQ(Filenames(manifest), vector<string>({"c", "ab.gor"}));
+  EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"c", "ab.gor"}));
+
+  // A crash part way through the conversion's record leaves the originals.
+  off_t after_replace = GetFileSize(path);
+  for (off_t size = before_replace + 1; size < after_replace; size += 7) {
+    ASSERT_EQ(truncate(path.c_str(), size), 0);
+    file_cache.Invalidate(path);
+    EXPECT_EQ(Reload(dir, &file_cache), vector<string>({"a", "b", "c"}))
+        << "size=" << size;
+  }
+}
+
+
+class ManifestDirectoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 0;
+    FLAGS_sparse_file_optimize_size = 1 << 20;
+    FLAGS_sparse_file_max_size = 4 * datapoint_size;
+  }
+
+  void TearDown() override {
+    FLAGS_sparse_file_optimize_size = sparse_file_optimize_size;
+    FLAGS_sparse_file_max_size = sparse_file_max_size;
+  }
+
+  DirectoryFlagSaver flag_saver;
+  const int32_t sparse_file_optimize_size = FLAGS_sparse_file_optimize_size;
+  const int64_t sparse_file_max_size = FLAGS_sparse_file_max_size;
+
+  void Write(DatapointDirectory& dir, vector<Datapoint> points) {
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    dir.Write(write_op);
+  }
+
+  vector<Datapoint> ReadAll(DatapointDirectory& dir) {
+    Datapoint buffer[100];
+    ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false, buffer, 100);
+    dir.Read(read_op);
+    return vector<Datapoint>(buffer, read_op.cursor);
+  }
+};
+
+
+TEST_F(ManifestDirectoryTest, FilesSharingAMinAreKept) {
+  FileCache file_cache(16);
+  string path = MakeTestDir("manifest_same_min");
+  vector<Datapoint> points {
+    Datapoint(100, 1.0, 10),
+    Datapoint(110, 2.0, 10),
+    Datapoint(120, 3.0, 10),
+    Datapoint(130, 4.0, 10)
+  };
+  vector<string> names;
+  {
+    DatapointDirectory dir(nullptr, &file_cache, path);
+    Write(dir, points);  // Fills the first file, named 100-100
+
+    // A late rewrite of the first datapoint goes in a new file starting at
+    // the same timestamp, which must not take the full file's name.
+    Write(dir, {Datapoint(100, 5.0, 10)});
+    names = Reload(path, &file_cache);
+    ASSERT_EQ(names.size(), 2);
+    EXPECT_NE(names[0], names[1]);
+    EXPECT_EQ(GetFileSize(path + "/" + names[0]), 4 * datapoint_size);
+    EXPECT_EQ(GetFileSize(path + "/" + names[1]), datapoint_size);
+  }
+
+  // Both survive a restart, with their own metadata.
+  DatapointDirectory dir(nullptr, &file_cache, path);
+  EXPECT_EQ(ReadAll(dir), points);
+  EXPECT_EQ(Reload(path, &file_cache), names);
+  Manifest manifest(path, &file_cache);
+  ASSERT_TRUE(manifest.Load());
+  EXPECT_EQ(manifest.Entries()[0].max_timestamp, 130);
+  EXPECT_EQ(manifest.Entries()[1].max_timestamp, 100);
+
+  // Without the manifest both are found by their names.
+  ASSERT_EQ(unlink((path + "/" + MANIFEST_FILENAME).c_str()), 0);
+  file_cache.Invalidate(path + "/" + MANIFEST_FILENAME);
+  DatapointDirectory rescanned(nullptr, &file_cache, path);
+  EXPECT_EQ(ReadAll(rescanned), points);
+  vector<string> rescanned_names = Reload(path, &file_cache);
+  std::sort(names.begin(), names.end());
+  std::sort(rescanned_names.begin(), rescanned_names.end());
+  EXPECT_EQ(rescanned_names, names);
+}
+
+
+TEST_F(ManifestDirectoryTest, ReplacedFilesGoOnlyOnceRecorded) {
+  FileCache file_cache(16);
+  string path = MakeTestDir("manifest_replace_files");
+  vector<Datapoint> points {
+    Datapoint(100, 1.0, 10),
+    Datapoint(110, 2.0, 10),
+  };
+  DatapointDirectory dir(nullptr, &file_cache, path);
+  Write(dir, points);
+  vector<string> original = Reload(path, &file_cache);
+  ASSERT_EQ(original.size(), 1);
+
+  // The sealed file standing in for the original.
+  Manifest manifest(path, &file_cache);
+  ASSERT_TRUE(manifest.Load());
+  SparseFile old_file(&dir, 100, 110);
+  old_file.filename = original[0];
+  SparseFile new_file(&dir, 100, 110, true, true);
+  dir.NameUniquely(new_file);
+
+  // A write that records nothing leaves the original be.
+  dir.ReplaceFiles({&old_file}, [] {});
+  EXPECT_EQ(Reload(path, &file_cache), original);
+  EXPECT_TRUE(FileExists(path + "/" + original[0]));
+
+  dir.ReplaceFiles({&old_file}, [&] {
+    new_file.WriteSealed(points.data(), points.size());
+  });
+  EXPECT_EQ(Reload(path, &file_cache), vector<string>({new_file.filename}));
+  EXPECT_FALSE(FileExists(path + "/" + original[0]));
+
+  DatapointDirectory reopened(nullptr, &file_cache, path);
+  EXPECT_EQ(ReadAll(reopened), points);
+}
+
+
+} // namespace
@@ -1,5 +1,9 @@
 #ifndef VQRO_DB_RAW_BUFFER_H
 #define VQRO_DB_RAW_BUFFER_H
+
+#include <memory>
+
+#include "vqro/base/fileutil.h"
 #include "vqro/db/datapoint_buffer.h"
 
 
@@ -14,44 +18,16 @@ class RawBuffer: public DatapointBuffer {
 
   class RawIterImpl: public IteratorImpl {
    public:
-    explicit RawIterImpl(Datapoint* b, size_t l) :
-        buf(b),
-        len(l) {}
+    explicit RawIterImpl(Datapoint* b) : buf(b) {}
 
     Datapoint& ValueAt(size_t i) const override { return buf[i]; }
 
     IteratorImpl* Clone() const override {
-      return static_cast<IteratorImpl*>(new RawIterImpl(buf, len));
-    }
-
-    std::unique_ptr<Iovec[]> GetIOVector(
-        const size_t pos,
-        size_t& iov_count,
-        size_t& writable_datapoints,
-        size_t max_writable_datapoints,
-        const int64_t max_writable_timestamp) const override
-    {
-      iov_count = 1;
-      writable_datapoints = std::min((len > pos) ? (len - pos) : 0,
-                                     max_writable_datapoints);
-      while (writable_datapoints > 0 &&
-             buf[pos + writable_datapoints - 1].timestamp > max_writable_timestamp)
-        writable_datapoints--;
-
-      if (!writable_datapoints) {
-        iov_count = 0;
-        return nullptr;
-      }
-
-      std::unique_ptr<Iovec[]> iov(new Iovec[iov_count]);
-      iov[0].iov_base = buf + pos;
-      iov[0].iov_len = writable_datapoints;
-      return iov;
+      return static_cast<IteratorImpl*>(new RawIterImpl(buf));
     }
 
    private:
     Datapoint* buf;
-    size_t len;
   };
 
  public:
@@ -60,8 +36,22 @@ class RawBuffer: public DatapointBuffer {
   RawBuffer& operator=(const RawBuffer& other) = delete; // no assignment
 
   size_t Size() const override { return len; }
-  Iterator begin() { return Iterator(new RawIterImpl(buf, len), 0); }
-  Iterator end() { return Iterator(new RawIterImpl(buf, len), len); }
+  Iterator begin() override { return Iterator(new RawIterImpl(buf), 0); }
+  Iterator end() override { return Iterator(new RawIterImpl(buf), len); }
+
+  // Direct access for WriteOperation<RawBuffer>.
+  Datapoint& At(size_t i) const { return buf[i]; }
+
+  std::unique_ptr<Iovec[]> GetIOVector(size_t pos,
+                                       size_t count,
+                                       size_t& iov_count) const
+  {
+    iov_count = 1;
+    std::unique_ptr<Iovec[]> iov(new Iovec[iov_count]);
+    iov[0].iov_base = buf + pos;
+    iov[0].iov_len = count * datapoint_size;
+    return iov;
+  }
 };
 
 
@@ -9,6 +9,11 @@ namespace vqro {
 namespace db {
 
 
+// How the datapoints in each bucket are combined when a read with a step is
+// served from rollups.
+enum class Aggregate { AVG, MIN, MAX, SUM, COUNT };
+
+
 // Holds state for a Read() call so we can Read() chunk by chunk. This allows
 // interleaving of a large reads with other operations and the ability to
 // resume a read later if we run out of buffer space. This is needed to
@@ -35,6 +40,12 @@ struct ReadOperation {
   int64_t datapoint_limit;    // Limits total number of datapoints we will read
   bool prefer_latest;         // Specifies if we want first or last N datapoints
 
+  // Resolution the reader needs, in timestamps between datapoints. When
+  // non-zero, time ranges covered by a rollup tier at least this fine are
+  // read from the coarsest such tier, bucket values combined by aggregate.
+  int64_t step = 0;
+  Aggregate aggregate = Aggregate::AVG;
+
   // All underlying read operations populate our buffer, and we track how
   // much we've already read with a cursor.
   Datapoint* const buffer;
@@ -46,7 +57,7 @@ struct ReadOperation {
     cursor++;
   }
 
-  void Append(Datapoint& point) {
+  void Append(const Datapoint& point) {
     *cursor = point;
     Advance();
   }
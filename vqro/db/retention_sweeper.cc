@@ -0,0 +1,258 @@
+#include <stdlib.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/db/db.h"
+#include "vqro/db/retention_sweeper.h"
+#include "vqro/db/series.h"
+
+
+DEFINE_string(retention_policies,
+              "",
+              "Comma separated rules of the form '<label>=<regex>:<age>' or "
+              "'*:<age>'. Datapoints of series matched by a rule are deleted "
+              "once older than its age, in seconds or suffixed with m, h, d "
+              "or w. The first matching rule applies. Empty keeps everything.");
+DEFINE_int32(rollup_retention_multiple,
+             10,
+             "Rollups of a series are kept this many times as long as its "
+             "datapoints under --retention_policies. Zero keeps them forever.");
+DEFINE_int32(retention_sweep_interval,
+             3600,
+             "How often (seconds) expired datapoints are deleted.");
+DEFINE_int64(timestamps_per_second,
+             1000,
+             "Datapoint timestamp units per second of wall clock time, used "
+             "to tell how old datapoints are.");
+
+
+namespace vqro {
+namespace db {
+
+
+int64_t ParseAge(const string& age) {
+  char* endptr;
+  int64_t count = strtoll(age.c_str(), &endptr, 10);
+  if (endptr == age.c_str() || count < 0)
+    throw std::invalid_argument("Invalid age: " + age);
+
+  string unit(endptr);
+  if (unit.empty() || unit == "s")
+    return count;
+  if (unit == "m")
+    return count * 60;
+  if (unit == "h")
+    return count * 3600;
+  if (unit == "d")
+    return count * 86400;
+  if (unit == "w")
+    return count * 604800;
+  throw std::invalid_argument("Invalid age: " + age);
+}
+
+
+int64_t TimestampNow() {
+  const int64_t now = TimeInMillis();
+  return now / 1000 * FLAGS_timestamps_per_second +
+         now % 1000 * FLAGS_timestamps_per_second / 1000;
+}
+
+
+RetentionSweeper::RetentionSweeper(Database* d) : db(d) {
+  if (FLAGS_timestamps_per_second <= 0)
+    throw std::invalid_argument("Invalid --timestamps_per_second: " +
+                                to_string(FLAGS_timestamps_per_second));
+  if (FLAGS_rollup_retention_multiple < 0)
+    throw std::invalid_argument("Invalid --rollup_retention_multiple: " +
+                                to_string(FLAGS_rollup_retention_multiple));
+
+  const string& flag = FLAGS_retention_policies;
+  size_t pos = 0;
+  while (pos < flag.size()) {
+    size_t end = flag.find(',', pos);
+    if (end == string::npos)
+      end = flag.size();
+    string rule = flag.substr(pos, end - pos);
+    pos = end + 1;
+
+    // Regexes may hold colons, ages don't.
+    size_t colon = rule.rfind(':');
+    if (colon == string::npos)
+      throw std::invalid_argument("Invalid retention policy: " + rule);
+
+    RetentionPolicy policy;
+    string selector = rule.substr(0, colon);
+    policy.seconds = ParseAge(rule.substr(colon + 1));
+    if (selector != "*") {
+      size_t equals = selector.find('=');
+      if (equals == string::npos || equals == 0)
+        throw std::invalid_argument("Invalid retention policy: " + rule);
+      policy.label = selector.substr(0, equals);
+      policy.pattern.reset(new RE2(selector.substr(equals + 1)));
+      if (!policy.pattern->ok())
+        throw std::invalid_argument("Invalid retention policy regex: " + rule);
+    }
+    policies.push_back(std::move(policy));
+  }
+}
+
+
+// Segments hold no per-series files to expire, and a series of theirs looks
+// empty to a sweep, which would drop it from the index. So no sweeper runs.
+void RetentionSweeper::Start() {
+  if (db->GetSegmentStore()) {
+    LOG(WARNING) << "--retention_policies are ignored with "
+                 << "--storage_engine=segments";
+    return;
+  }
+  sweeper = std::thread([this] { Run(); });
+}
+
+
+void RetentionSweeper::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    stop = true;
+  }
+  wakeup.notify_one();
+  if (sweeper.joinable())
+    sweeper.join();
+}
+
+
+int64_t RetentionSweeper::RetentionFor(const vqro::rpc::Series& series) const {
+  for (const RetentionPolicy& policy : policies) {
+    if (policy.label.empty())
+      return policy.seconds;
+
+    auto label = series.labels().find(policy.label);
+    if (label != series.labels().end() &&
+        RE2::FullMatch(label->second, *policy.pattern))
+      return policy.seconds;
+  }
+  return 0;
+}
+
+
+int64_t RetentionSweeper::RollupCutoff(int64_t now, int64_t seconds) const {
+  if (FLAGS_rollup_retention_multiple == 0)
+    return INT64_MIN;
+  return now - seconds * FLAGS_rollup_retention_multiple *
+               FLAGS_timestamps_per_second;
+}
+
+
+void RetentionSweeper::Run() {
+  LOG(INFO) << "RetentionSweeper thread reporting for duty.";
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stop) {
+    lock.unlock();
+    Sweep();
+    lock.lock();
+
+    wakeup.wait_for(lock, std::chrono::seconds(
+        std::max(FLAGS_retention_sweep_interval, 1)));
+  }
+}
+
+
+void RetentionSweeper::Sweep() {
+  const int64_t start = TimeInMillis();
+  const int64_t now = TimestampNow();
+
+  // We don't hold the search engine's statement open while we wait on the
+  // workers.
+  vector<Target> targets;
+  db->search_engine->ScanSeries(0, [&] (
+      int64_t series_id,
+      const string& key,
+      const vqro::rpc::Series& series_proto)
+  {
+    int64_t seconds = RetentionFor(series_proto);
+    if (seconds > 0)
+      targets.push_back(Target {
+        series_id,
+        key,
+        series_proto,
+        now - seconds * FLAGS_timestamps_per_second,
+        RollupCutoff(now, seconds)
+      });
+  });
+
+  size_t files = 0;
+  size_t removed = 0;
+  for (const Target& target : targets) {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      if (stop)
+        return;
+    }
+    if (Expire(target, start, files))
+      removed++;
+  }
+
+  LOG(INFO) << "RetentionSweeper checked " << targets.size() << " series in "
+            << (TimeInMillis() - start) << "ms, expired " << files
+            << " files and removed " << removed << " empty series";
+}
+
+
+// Expires target's files on its worker thread, adding the number expired to
+// files. Returns true if the series was left empty and removed.
+bool RetentionSweeper::Expire(const Target& target,
+                              int64_t sweep_start,
+                              size_t& files) {
+  std::shared_ptr<Series> series;
+  bool empty = false;
+
+  // Like a preload, without touching the series since nobody asked for it.
+  auto expire = [&] {
+    series = db->series_registry->FindOrCreate(target.key, [&] {
+      return new Series(db, target.proto, target.key);
+    });
+    if (!series->series_id) {
+      series->series_id = target.series_id;
+      series->is_indexed = true;
+      db->series_registry->AddId(series.get());
+    }
+
+    try {
+      files += series->ExpireBefore(target.cutoff, target.rollup_cutoff);
+      empty = series->IsEmpty();
+    } catch (IOError& e) {
+      LOG(ERROR) << "RetentionSweeper failed to expire series "
+                 << target.key << ": " << e.what();
+    }
+  };
+
+  WorkerThread* worker = db->workers[ComputeHash(target.key) % db->workers.size()];
+  while (true) {
+    try {
+      worker->Do(expire).wait();
+      break;
+    } catch (WorkerThreadTooBusy& err) {
+      worker->WaitForRoom(100);
+    }
+  }
+  if (!empty)
+    return false;
+
+  // A series written or read since we started may be about to get datapoints
+  // again. With the registry locked nobody can recreate the series until it
+  // is queued for unindexing, so a recreated one is indexed anew.
+  return db->series_registry->EraseIfUnused(series, [&] (Series& s) {
+    if (s.DatapointsBuffered() || s.last_used >= sweep_start)
+      return false;
+    db->search_engine->UnindexSeries(target.series_id, target.proto);
+    return true;
+  });
+}
+
+
+} // namespace db
+} // namespace vqro
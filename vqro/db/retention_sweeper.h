@@ -0,0 +1,110 @@
+#ifndef VQRO_DB_RETENTION_SWEEPER_H
+#define VQRO_DB_RETENTION_SWEEPER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <re2/re2.h>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/core.pb.h"
+
+
+DECLARE_string(retention_policies);
+DECLARE_int64(timestamps_per_second);
+DECLARE_int32(rollup_retention_multiple);
+
+
+namespace vqro {
+namespace db {
+
+
+class Database;
+
+
+// Parses a number of seconds optionally suffixed with s, m, h, d or w.
+// Throws std::invalid_argument.
+int64_t ParseAge(const string& age);
+
+// The wall clock in datapoint timestamp units, see --timestamps_per_second.
+int64_t TimestampNow();
+
+
+// One rule of --retention_policies.
+struct RetentionPolicy {
+  string label;                  // Empty matches every series
+  std::unique_ptr<RE2> pattern;  // Must fully match the label's value
+  int64_t seconds;               // Of datapoints kept, zero for forever
+};
+
+
+// The RetentionSweeper enforces --retention_policies, a comma separated list
+// of rules of the form "<label>=<regex>:<age>" or "*:<age>". The first rule
+// matching a series decides how old its datapoints may get, where age is a
+// number of seconds optionally suffixed with m, h, d or w.
+//
+// Every --retention_sweep_interval seconds the sweeper walks every indexed
+// series and, on the series' worker thread, removes its files holding only
+// datapoints older than that. Expiry is by whole files, so a file straddling
+// the cutoff is kept until all of it has expired. A series left with no
+// datapoints at all is dropped from memory and from the search index, and
+// its directory removed.
+//
+// Rollups outlive the datapoints they summarize, they are kept
+// --rollup_retention_multiple times as long.
+//
+// Timestamps are compared to the wall clock through --timestamps_per_second.
+// The segment storage engine doesn't support expiry, under it Start() only
+// logs that the policies are ignored.
+class RetentionSweeper {
+ public:
+  // Throws std::invalid_argument if --retention_policies can't be parsed.
+  explicit RetentionSweeper(Database* d);
+  ~RetentionSweeper() { Stop(); }
+
+  RetentionSweeper(const RetentionSweeper& other) = delete;
+  RetentionSweeper& operator=(const RetentionSweeper& other) = delete;
+
+  bool Enabled() const { return !policies.empty(); }
+
+  void Start();
+  void Stop();
+
+  // Seconds of datapoints kept for series, zero for forever.
+  int64_t RetentionFor(const vqro::rpc::Series& series) const;
+
+  // Timestamp before which the rollups of a series keeping seconds of
+  // datapoints expire, INT64_MIN if they never do.
+  int64_t RollupCutoff(int64_t now, int64_t seconds) const;
+
+ private:
+  struct Target {
+    int64_t series_id;
+    string key;
+    vqro::rpc::Series proto;
+    int64_t cutoff;  // Timestamp before which datapoints expire
+    int64_t rollup_cutoff;  // And rollups
+  };
+
+  Database* const db;
+  vector<RetentionPolicy> policies;
+
+  std::thread sweeper;
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  bool stop = false;
+
+  void Run();
+  void Sweep();
+  bool Expire(const Target& target, int64_t sweep_start, size_t& files);
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_RETENTION_SWEEPER_H
@@ -0,0 +1,302 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/retention_sweeper.h"
+#include "vqro/db/rollups.h"
+#include "vqro/db/sparse_file.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_bool(cadence_profiles);
+DECLARE_int32(compaction_min_files);
+DECLARE_int32(retention_sweep_interval);
+DECLARE_int32(sparse_file_optimize_size);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+vqro::rpc::Series MakeProto(std::initializer_list<std::pair<string, string>> labels) {
+  vqro::rpc::Series proto;
+  for (auto& label : labels)
+    (*proto.mutable_labels())[label.first] = label.second;
+  return proto;
+}
+
+
+class RetentionPolicyTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    FLAGS_retention_policies = retention_policies;
+    FLAGS_timestamps_per_second = timestamps_per_second;
+    FLAGS_rollup_retention_multiple = rollup_retention_multiple;
+  }
+
+  // The sweeper only parses the flag, it needs no database until started.
+  int64_t RetentionFor(const string& policies, const vqro::rpc::Series& proto) {
+    FLAGS_retention_policies = policies;
+    RetentionSweeper sweeper(nullptr);
+    return sweeper.RetentionFor(proto);
+  }
+
+  const string retention_policies = FLAGS_retention_policies;
+  const int64_t timestamps_per_second = FLAGS_timestamps_per_second;
+  const int32_t rollup_retention_multiple = FLAGS_rollup_retention_multiple;
+};
+
+
+TEST_F(RetentionPolicyTest, ParseAge) {
+  EXPECT_EQ(ParseAge("0"), 0);
+  EXPECT_EQ(ParseAge("90"), 90);
+  EXPECT_EQ(ParseAge("90s"), 90);
+  EXPECT_EQ(ParseAge("2m"), 120);
+  EXPECT_EQ(ParseAge("3h"), 3 * 3600);
+  EXPECT_EQ(ParseAge("1d"), 86400);
+  EXPECT_EQ(ParseAge("2w"), 2 * 604800);
+
+  for (const char* age : {"", "h", "-1", "5y", "1hh"})
+    EXPECT_THROW(ParseAge(age), std::invalid_argument) << "age=" << age;
+}
+
+
+TEST_F(RetentionPolicyTest, FirstMatchingRuleApplies) {
+  const string policies = "name=web.*:1d,dc=us:2h,*:1w";
+  EXPECT_EQ(RetentionFor(policies, MakeProto({{"name", "web1"}, {"dc", "us"}})),
+            86400);
+  EXPECT_EQ(RetentionFor(policies, MakeProto({{"name", "db1"}, {"dc", "us"}})),
+            7200);
+  EXPECT_EQ(RetentionFor(policies, MakeProto({{"name", "db1"}})), 604800);
+
+  // Regexes must match the whole value, and a series no rule matches is
+  // kept forever.
+  EXPECT_EQ(RetentionFor("name=web:1d", MakeProto({{"name", "web1"}})), 0);
+  EXPECT_EQ(RetentionFor("name=web:1d", MakeProto({{"dc", "web"}})), 0);
+  EXPECT_EQ(RetentionFor("", MakeProto({{"name", "web"}})), 0);
+
+  // Only the last colon ends the regex.
+  EXPECT_EQ(RetentionFor("url=http://.*:1h", MakeProto({{"url", "http://a"}})),
+            3600);
+}
+
+
+TEST_F(RetentionPolicyTest, EmptyPoliciesAreDisabled) {
+  FLAGS_retention_policies = "";
+  EXPECT_FALSE(RetentionSweeper(nullptr).Enabled());
+  FLAGS_retention_policies = "*:1d";
+  EXPECT_TRUE(RetentionSweeper(nullptr).Enabled());
+}
+
+
+TEST_F(RetentionPolicyTest, InvalidPoliciesThrow) {
+  for (const char* policies : {"1d", "name=web", "name:1d", "=web:1d",
+                               "name=(:1d", "*:1y"}) {
+    FLAGS_retention_policies = policies;
+    EXPECT_THROW(RetentionSweeper(nullptr), std::invalid_argument)
+        << "policies=" << policies;
+  }
+
+  FLAGS_retention_policies = "*:1d";
+  FLAGS_timestamps_per_second = 0;
+  EXPECT_THROW(RetentionSweeper(nullptr), std::invalid_argument);
+
+  FLAGS_timestamps_per_second = 1000;
+  FLAGS_rollup_retention_multiple = -1;
+  EXPECT_THROW(RetentionSweeper(nullptr), std::invalid_argument);
+}
+
+
+TEST_F(RetentionPolicyTest, RollupsAreKeptAMultipleOfTheRetention) {
+  FLAGS_timestamps_per_second = 1000;
+  FLAGS_rollup_retention_multiple = 10;
+  RetentionSweeper sweeper(nullptr);
+  EXPECT_EQ(sweeper.RollupCutoff(100000000, 3600), 100000000 - 36000000);
+
+  FLAGS_rollup_retention_multiple = 0;
+  EXPECT_EQ(sweeper.RollupCutoff(100000000, 3600), INT64_MIN);
+}
+
+
+class ExpireBeforeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 0;
+    FLAGS_sparse_file_optimize_size = 1 << 20;
+    FLAGS_sparse_file_max_size = 4 * datapoint_size;
+  }
+
+  void TearDown() override {
+    FLAGS_sparse_file_optimize_size = sparse_file_optimize_size;
+    FLAGS_sparse_file_max_size = sparse_file_max_size;
+  }
+
+  DirectoryFlagSaver flag_saver;
+  const int32_t sparse_file_optimize_size = FLAGS_sparse_file_optimize_size;
+  const int64_t sparse_file_max_size = FLAGS_sparse_file_max_size;
+
+  // Writes four datapoints from start on, filling one file.
+  void WriteFile(DatapointDirectory& dir, int64_t start) {
+    vector<Datapoint> points;
+    for (int64_t t = start; t < start + 40; t += 10)
+      points.emplace_back(t, 1.0, 10);
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    dir.Write(write_op);
+  }
+
+  vector<int64_t> ReadTimestamps(DatapointDirectory& dir) {
+    Datapoint buffer[100];
+    ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false, buffer, 100);
+    dir.Read(read_op);
+    vector<int64_t> timestamps;
+    for (Datapoint* point = buffer; point < read_op.cursor; point++)
+      timestamps.push_back(point->timestamp);
+    return timestamps;
+  }
+};
+
+
+TEST_F(ExpireBeforeTest, ExpiresWholeFiles) {
+  FileCache file_cache(16);
+  string path = MakeTestDirForTest();
+  DatapointDirectory dir(nullptr, &file_cache, path);
+  WriteFile(dir, 100);
+  WriteFile(dir, 140);
+  WriteFile(dir, 180);
+
+  EXPECT_EQ(dir.ExpireBefore(100), 0);
+
+  // The second file straddles the cutoff so it is kept whole.
+  EXPECT_EQ(dir.ExpireBefore(150), 1);
+  EXPECT_EQ(ReadTimestamps(dir),
+            vector<int64_t>({140, 150, 160, 170, 180, 190, 200, 210}));
+
+  // Once every file is gone so is the directory, until the next write.
+  EXPECT_EQ(dir.ExpireBefore(1000), 2);
+  EXPECT_TRUE(dir.Empty());
+  EXPECT_EQ(access(path.c_str(), F_OK), -1);
+  EXPECT_EQ(dir.ExpireBefore(1000), 0);
+
+  WriteFile(dir, 2000);
+  EXPECT_EQ(ReadTimestamps(dir), vector<int64_t>({2000, 2010, 2020, 2030}));
+}
+
+
+TEST_F(ExpireBeforeTest, MissingDirectoryHasNothingToExpire) {
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache,
+                         MakeTestDirForTest() + "/never_written");
+  EXPECT_EQ(dir.ExpireBefore(INT64_MAX), 0);
+  EXPECT_TRUE(dir.Empty());
+}
+
+
+// A database sweeping every second whose series named old* keep an hour of
+// datapoints and ten of minutely rollups, flushing every write right away.
+class RetentionSweeperTest : public DatabaseTest {
+ protected:
+  void SetUp() override {
+    FLAGS_retention_policies = "name=old.*:1h";
+    FLAGS_retention_sweep_interval = 1;
+    FLAGS_flush_max_buffer_bytes = 1;
+    FLAGS_rollup_tiers = "1m";
+    FLAGS_rollup_retention_multiple = 10;
+    DatabaseTest::SetUp();
+  }
+
+  void TearDown() override {
+    DatabaseTest::TearDown();
+    FLAGS_retention_policies = retention_policies;
+    FLAGS_retention_sweep_interval = retention_sweep_interval;
+    FLAGS_flush_max_buffer_bytes = flush_max_buffer_bytes;
+    FLAGS_rollup_tiers = rollup_tiers;
+    FLAGS_rollup_retention_multiple = rollup_retention_multiple;
+  }
+
+  // Indexes the series named name and writes one datapoint to it.
+  void Write(const string& name, int64_t timestamp) {
+    vqro::rpc::WriteOperation op;
+    *op.mutable_series() = MakeProto({{"name", name}});
+    db->ResolveSeries(op.series());
+    vqro::rpc::Datapoint* point = op.add_datapoints();
+    point->set_timestamp(timestamp);
+    point->set_value(1);
+    db->Write(op);
+  }
+
+  std::set<string> IndexedNames() {
+    std::set<string> names;
+    db->search_engine->ScanSeries(0, [&] (int64_t,
+                                          const string&,
+                                          const vqro::rpc::Series& proto) {
+      names.insert(proto.labels().at("name"));
+    });
+    return names;
+  }
+
+  // Counts datapoints read at step, which reads rollups where it can.
+  size_t CountDatapoints(const string& name, int64_t step=0) {
+    size_t count = 0;
+    db->Read(MakeProto({{"name", name}}), INT64_MIN, INT64_MAX, -1, false,
+             [&] (Datapoint*, size_t n) { count += n; }, step);
+    return count;
+  }
+
+  const string retention_policies = FLAGS_retention_policies;
+  const int32_t retention_sweep_interval = FLAGS_retention_sweep_interval;
+  const int64_t flush_max_buffer_bytes = FLAGS_flush_max_buffer_bytes;
+  const string rollup_tiers = FLAGS_rollup_tiers;
+  const int32_t rollup_retention_multiple = FLAGS_rollup_retention_multiple;
+};
+
+
+TEST_F(RetentionSweeperTest, ExpiredSeriesAreErasedAndUnindexed) {
+  Write("old", 1000);
+  Write("old_recent", TimestampNow());
+  Write("kept", 1000);
+  EXPECT_EQ(IndexedNames(), std::set<string>({"kept", "old", "old_recent"}));
+
+  // A sweep can't remove a series whose write is still buffered or that was
+  // written since it began, so it may take a few.
+  const std::set<string> survivors {"kept", "old_recent"};
+  for (int i = 0; i < 10000 && IndexedNames() != survivors; i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(IndexedNames(), survivors);
+
+  EXPECT_EQ(CountDatapoints("old"), 0);
+  EXPECT_EQ(CountDatapoints("old_recent"), 1);
+  EXPECT_EQ(CountDatapoints("kept"), 1);
+}
+
+
+TEST_F(RetentionSweeperTest, RollupsOutliveTheirDatapoints) {
+  // Old enough for its datapoint to expire but not its rollup, which the
+  // flush made since the bucket is long over.
+  Write("old_rolled_up", TimestampNow() - 2 * 3600 * 1000);
+  EXPECT_EQ(CountDatapoints("old_rolled_up", 60 * 1000), 1);
+
+  for (int i = 0; i < 10000 && CountDatapoints("old_rolled_up"); i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(CountDatapoints("old_rolled_up"), 0);
+
+  // A series holding rollups isn't empty, so it stays.
+  std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+  EXPECT_EQ(CountDatapoints("old_rolled_up", 60 * 1000), 1);
+  EXPECT_EQ(IndexedNames(), std::set<string>({"old_rolled_up"}));
+}
+
+
+} // namespace
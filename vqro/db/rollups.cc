@@ -0,0 +1,432 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "vqro/base/base.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/retention_sweeper.h"
+#include "vqro/db/rollups.h"
+#include "vqro/db/write_op.h"
+
+
+DEFINE_string(rollup_tiers,
+              "",
+              "Comma separated bucket widths, finest first, of the rollup "
+              "tiers kept for every series, e.g. '1m,10m,1h'. Widths are in "
+              "seconds or suffixed with m, h, d or w, and each must be a "
+              "multiple of the one before. Reads with a step are served from "
+              "the coarsest tier fine enough. Empty disables rollups.");
+DEFINE_int32(rollup_delay,
+             300,
+             "How long (seconds) after a bucket ends before it is rolled up. "
+             "Datapoints arriving later than this are left out of rollups.");
+DEFINE_int32(rollup_max_buckets,
+             1440,
+             "Maximum number of buckets each tier rolls up per flush, to "
+             "bound the work of catching up on old datapoints.");
+
+
+namespace vqro {
+namespace db {
+
+
+// Datapoints read at a time while rolling up.
+static const size_t ROLLUP_READ_SIZE = 4096;
+
+
+vector<int64_t> ParseRollupTiers(const string& tiers) {
+  vector<int64_t> widths;
+  size_t pos = 0;
+  while (pos < tiers.size()) {
+    size_t end = tiers.find(',', pos);
+    if (end == string::npos)
+      end = tiers.size();
+    string tier = tiers.substr(pos, end - pos);
+    pos = end + 1;
+
+    int64_t width = ParseAge(tier) * FLAGS_timestamps_per_second;
+    if (width <= 0 ||
+        (!widths.empty() && (width <= widths.back() ||
+                             width % widths.back() != 0)))
+      throw std::invalid_argument("Invalid rollup tier: " + tier);
+    widths.push_back(width);
+  }
+  return widths;
+}
+
+
+// Start of the bucket holding timestamp, rounding towards negative infinity.
+static int64_t BucketStart(int64_t timestamp, int64_t width) {
+  int64_t remainder = timestamp % width;
+  return timestamp - (remainder < 0 ? remainder + width : remainder);
+}
+
+
+// Appends every datapoint of dir in [from, to) onto points.
+static void ReadAll(DatapointDirectory* dir,
+                    int64_t from,
+                    int64_t to,
+                    vector<Datapoint>& points) {
+  vector<Datapoint> buffer(ROLLUP_READ_SIZE);
+  int64_t next = from;
+  while (next < to) {
+    ReadOperation read_op(next, to, INT64_MAX, false,
+                          buffer.data(), buffer.size());
+    dir->Read(read_op);
+    points.insert(points.end(), read_op.buffer, read_op.cursor);
+    if (read_op.SpaceLeft())
+      break;
+    next = read_op.next_time;
+  }
+}
+
+
+// Finds the first timestamp of dir in [from, to). Returns false if none.
+static bool FirstTimestamp(DatapointDirectory* dir,
+                           int64_t from,
+                           int64_t to,
+                           int64_t& timestamp) {
+  Datapoint point;
+  ReadOperation read_op(from, to, 1, false, &point, 1);
+  dir->Read(read_op);
+  if (!read_op.DatapointsInBuffer())
+    return false;
+  timestamp = point.timestamp;
+  return true;
+}
+
+
+RollupTier::RollupTier(Series* series,
+                       FileCache* cache,
+                       const string& path,
+                       int64_t w) :
+  width(w),
+  min_dir(new DatapointDirectory(series, cache, path + "/min")),
+  max_dir(new DatapointDirectory(series, cache, path + "/max")),
+  sum_dir(new DatapointDirectory(series, cache, path + "/sum")),
+  count_dir(new DatapointDirectory(series, cache, path + "/count")) {}
+
+
+DatapointDirectory* RollupTier::Directory(Aggregate aggregate) {
+  switch (aggregate) {
+    case Aggregate::MIN:
+      return min_dir.get();
+    case Aggregate::MAX:
+      return max_dir.get();
+    case Aggregate::COUNT:
+      return count_dir.get();
+    case Aggregate::AVG:
+    case Aggregate::SUM:
+      break;
+  }
+  return sum_dir.get();
+}
+
+
+Rollups::Rollups(Series* series,
+                 FileCache* cache,
+                 DatapointDirectory* src,
+                 const string& path,
+                 const vector<int64_t>& widths) :
+  source(src)
+{
+  for (int64_t width : widths)
+    tiers.emplace_back(
+        new RollupTier(series, cache, path + "/" + to_string(width), width));
+}
+
+
+void Rollups::Update() {
+  const int64_t now = TimestampNow();
+  for (size_t t = 0; t < tiers.size(); t++) {
+    try {
+      UpdateTier(t, now);
+    } catch (IOError& e) {
+      // Coarser tiers are rolled up from this one, so they wait too.
+      LOG(WARNING) << "Failed to roll up " << tiers[t]->count_dir->path
+                   << ": " << e.what();
+      return;
+    }
+  }
+}
+
+
+void Rollups::Read(ReadOperation& read_op) {
+  // Coarsest tier first, each finer tier picking up where the last ended.
+  for (size_t t = tiers.size(); t-- > 0;) {
+    RollupTier& tier = *tiers[t];
+    if (tier.width > read_op.step)
+      continue;
+    if (read_op.Complete() || !read_op.SpaceLeft())
+      return;
+    if (!TryLoad(tier))
+      continue;
+
+    int64_t bound = std::min(read_op.end_time, tier.rolled_up_to);
+    if (read_op.next_time < bound && !ReadSpan(t, read_op, bound))
+      return;
+  }
+}
+
+
+size_t Rollups::ExpireBefore(int64_t cutoff) {
+  size_t expired = 0;
+  for (auto& tier : tiers) {
+    expired += tier->min_dir->ExpireBefore(cutoff);
+    expired += tier->max_dir->ExpireBefore(cutoff);
+    expired += tier->sum_dir->ExpireBefore(cutoff);
+    expired += tier->count_dir->ExpireBefore(cutoff);
+  }
+  return expired;
+}
+
+
+bool Rollups::Empty() {
+  for (auto& tier : tiers) {
+    if (!tier->min_dir->Empty() || !tier->max_dir->Empty() ||
+        !tier->sum_dir->Empty() || !tier->count_dir->Empty())
+      return false;
+  }
+  return true;
+}
+
+
+// Finds where the tier ends from its last bucket on disk.
+void Rollups::Load(RollupTier& tier) {
+  if (tier.loaded)
+    return;
+
+  int64_t last;
+  if (tier.count_dir->LastTimestamp(last))
+    tier.rolled_up_to = last + tier.width;
+  tier.loaded = true;
+}
+
+
+// Loads tier for a read, returning false if it can't be read from.
+bool Rollups::TryLoad(RollupTier& tier) {
+  try {
+    Load(tier);
+  } catch (IOError& e) {
+    LOG(WARNING) << "Failed to load rollups " << tier.count_dir->path
+                 << ": " << e.what();
+    return false;
+  }
+  return true;
+}
+
+
+void Rollups::UpdateTier(size_t t, int64_t now) {
+  RollupTier& tier = *tiers[t];
+  Load(tier);
+
+  // Buckets before limit are complete, in the tier before us too.
+  int64_t limit = BucketStart(
+      now - FLAGS_rollup_delay * FLAGS_timestamps_per_second, tier.width);
+  DatapointDirectory* source_dir = source;
+  if (t > 0) {
+    const RollupTier& finer = *tiers[t - 1];
+    if (finer.rolled_up_to == INT64_MIN)
+      return;
+    limit = std::min(limit, BucketStart(finer.rolled_up_to, tier.width));
+    source_dir = finer.count_dir.get();
+  }
+
+  // A new tier starts at the first datapoint.
+  if (tier.rolled_up_to == INT64_MIN) {
+    int64_t first;
+    if (!FirstTimestamp(source_dir, INT64_MIN, limit, first))
+      return;
+    tier.rolled_up_to = BucketStart(first, tier.width);
+  }
+
+  const int64_t from = tier.rolled_up_to;
+  if (from >= limit)
+    return;
+  const int64_t max_span = FLAGS_rollup_max_buckets * tier.width;
+  const int64_t to = (limit - from > max_span) ? from + max_span : limit;
+
+  vector<RollupBucket> finer_buckets;
+  ReadSource(t, from, to, finer_buckets);
+
+  // Skip straight over a gap in the source instead of a span at a time.
+  if (finer_buckets.empty()) {
+    int64_t next;
+    tier.rolled_up_to = FirstTimestamp(source_dir, to, limit, next) ?
+        BucketStart(next, tier.width) : limit;
+    return;
+  }
+
+  vector<RollupBucket> buckets;
+  for (RollupBucket& bucket : finer_buckets) {
+    int64_t start = BucketStart(bucket.timestamp, tier.width);
+    if (buckets.empty() || buckets.back().timestamp != start) {
+      bucket.timestamp = start;
+      buckets.push_back(bucket);
+      continue;
+    }
+    RollupBucket& ours = buckets.back();
+    ours.min = std::min(ours.min, bucket.min);
+    ours.max = std::max(ours.max, bucket.max);
+    ours.sum += bucket.sum;
+    ours.count += bucket.count;
+  }
+
+  WriteBuckets(tier, buckets);
+  tier.rolled_up_to = to;
+}
+
+
+// Reads the datapoints in [from, to) that tier t rolls up, as buckets of
+// one datapoint each for the finest tier or the finer tier's buckets.
+void Rollups::ReadSource(size_t t,
+                         int64_t from,
+                         int64_t to,
+                         vector<RollupBucket>& buckets) {
+  if (t == 0) {
+    vector<Datapoint> points;
+    ReadAll(source, from, to, points);
+    for (const Datapoint& point : points) {
+      if (!std::isnan(point.value))
+        buckets.push_back(RollupBucket {
+          point.timestamp, point.value, point.value, point.value, 1
+        });
+    }
+    return;
+  }
+
+  RollupTier& finer = *tiers[t - 1];
+  vector<Datapoint> mins, maxes, sums, counts;
+  ReadAll(finer.min_dir.get(), from, to, mins);
+  ReadAll(finer.max_dir.get(), from, to, maxes);
+  ReadAll(finer.sum_dir.get(), from, to, sums);
+  ReadAll(finer.count_dir.get(), from, to, counts);
+
+  // The directories are written together so they should hold the same
+  // buckets, but we only take buckets found in all four.
+  size_t i = 0, j = 0, k = 0;
+  auto seek = [] (const vector<Datapoint>& points,
+                  size_t& index,
+                  int64_t timestamp) {
+    while (index < points.size() && points[index].timestamp < timestamp)
+      index++;
+    return index < points.size() && points[index].timestamp == timestamp;
+  };
+  for (const Datapoint& count : counts) {
+    if (seek(mins, i, count.timestamp) &&
+        seek(maxes, j, count.timestamp) &&
+        seek(sums, k, count.timestamp))
+      buckets.push_back(RollupBucket {
+        count.timestamp, mins[i].value, maxes[j].value, sums[k].value,
+        count.value
+      });
+  }
+}
+
+
+// Reads read_op from its next_time up to bound out of tier t. A bucket that
+// starts before next_time also holds datapoints we weren't asked for, so the
+// rest of it is read from the next finer tier, or the source datapoints for
+// the finest. Returns false if the read stopped short of bound.
+bool Rollups::ReadSpan(size_t t, ReadOperation& read_op, int64_t bound) {
+  RollupTier& tier = *tiers[t];
+  const int64_t start = BucketStart(read_op.next_time, tier.width);
+  if (start < read_op.next_time) {
+    const int64_t head_end = std::min(start + tier.width, bound);
+    if (t > 0 && TryLoad(*tiers[t - 1])) {
+      int64_t finer_bound = std::min(head_end, tiers[t - 1]->rolled_up_to);
+      if (read_op.next_time < finer_bound &&
+          !ReadSpan(t - 1, read_op, finer_bound))
+        return false;
+    }
+    if (read_op.next_time < head_end)
+      ReadDatapoints(read_op, head_end);
+    if (read_op.next_time < head_end)
+      return false;
+  }
+
+  if (read_op.next_time < bound)
+    ReadTier(tier, read_op, bound);
+  return read_op.next_time >= bound;
+}
+
+
+// Reads source datapoints from read_op.next_time up to bound into read_op.
+void Rollups::ReadDatapoints(ReadOperation& read_op, int64_t bound) {
+  ReadOperation source_op(read_op.next_time,
+                          bound,
+                          read_op.datapoint_limit,
+                          read_op.prefer_latest,
+                          read_op.cursor,
+                          read_op.SpaceLeft());
+  source->Read(source_op);
+
+  bool exhausted = source_op.Complete() || source_op.SpaceLeft();
+  read_op.cursor = source_op.cursor;
+  read_op.next_time = exhausted ? bound : source_op.next_time;
+}
+
+
+// Reads buckets of tier from read_op.next_time up to bound into read_op.
+void Rollups::ReadTier(RollupTier& tier,
+                       ReadOperation& read_op,
+                       int64_t bound) {
+  ReadOperation tier_op(read_op.next_time,
+                        bound,
+                        read_op.datapoint_limit,
+                        read_op.prefer_latest,
+                        read_op.cursor,
+                        read_op.SpaceLeft());
+  tier.Directory(read_op.aggregate)->Read(tier_op);
+
+  if (read_op.aggregate == Aggregate::AVG && tier_op.DatapointsInBuffer()) {
+    vector<Datapoint> counts;
+    ReadAll(tier.count_dir.get(),
+            tier_op.buffer->timestamp,
+            (tier_op.cursor - 1)->timestamp + 1,
+            counts);
+    auto count = counts.begin();
+    for (Datapoint* point = tier_op.buffer; point != tier_op.cursor; point++) {
+      while (count != counts.end() && count->timestamp < point->timestamp)
+        count++;
+      if (count != counts.end() &&
+          count->timestamp == point->timestamp &&
+          count->value > 0)
+        point->value /= count->value;
+      else
+        point->value = NAN;
+    }
+  }
+
+  // Running out of buckets before filling the buffer means we're done.
+  bool exhausted = tier_op.Complete() || tier_op.SpaceLeft();
+  read_op.cursor = tier_op.cursor;
+  read_op.next_time = exhausted ? bound : tier_op.next_time;
+}
+
+
+void Rollups::WriteBuckets(RollupTier& tier,
+                           const vector<RollupBucket>& buckets) {
+  vector<Datapoint> points(buckets.size());
+  auto write = [&] (DatapointDirectory* dir, double RollupBucket::*field) {
+    for (size_t i = 0; i < buckets.size(); i++)
+      points[i] = Datapoint(buckets[i].timestamp,
+                            buckets[i].*field,
+                            tier.width);
+    RawBuffer rawbuf(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&rawbuf);
+    dir->Write(write_op);
+  };
+
+  // Counts last, since they mark where the tier ends when we next Load().
+  write(tier.min_dir.get(), &RollupBucket::min);
+  write(tier.max_dir.get(), &RollupBucket::max);
+  write(tier.sum_dir.get(), &RollupBucket::sum);
+  write(tier.count_dir.get(), &RollupBucket::count);
+}
+
+
+} // namespace db
+} // namespace vqro
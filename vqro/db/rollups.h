@@ -0,0 +1,121 @@
+#ifndef VQRO_DB_ROLLUPS_H
+#define VQRO_DB_ROLLUPS_H
+
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/read_op.h"
+
+
+DECLARE_string(rollup_tiers);
+
+
+namespace vqro {
+namespace db {
+
+
+class Series;
+
+
+// Parses --rollup_tiers into bucket widths in timestamp units, finest first.
+// Throws std::invalid_argument unless every width is a whole multiple of the
+// one before it.
+vector<int64_t> ParseRollupTiers(const string& tiers);
+
+
+// A bucket of datapoints as rolled up, or of finer buckets rolled up again.
+struct RollupBucket {
+  int64_t timestamp;  // Start of the bucket
+  double min;
+  double max;
+  double sum;
+  double count;
+};
+
+
+// One downsampled copy of a series. Every bucket of width timestamps holding
+// datapoints is stored as one datapoint in each of the tier's directories,
+// timestamped at the start of the bucket and lasting width.
+struct RollupTier {
+  const int64_t width;
+  std::unique_ptr<DatapointDirectory> min_dir;
+  std::unique_ptr<DatapointDirectory> max_dir;
+  std::unique_ptr<DatapointDirectory> sum_dir;
+  std::unique_ptr<DatapointDirectory> count_dir;
+
+  // Buckets before this timestamp have been rolled up, INT64_MIN until we
+  // know where the tier ends.
+  int64_t rolled_up_to = INT64_MIN;
+  bool loaded = false;
+
+  RollupTier(Series* series, FileCache* cache, const string& path, int64_t w);
+
+  // The directory holding aggregate, sums for AVG.
+  DatapointDirectory* Directory(Aggregate aggregate);
+};
+
+
+// A series' rollup tiers, one per --rollup_tiers width. The finest tier is
+// rolled up from the series' datapoints and each coarser tier from the tier
+// before it. Only complete buckets ending --rollup_delay seconds ago are
+// rolled up, so datapoints arriving later than that for a bucket already
+// rolled up are left out of it.
+//
+// Update() runs from Series::FinishFlush() once a flush has landed, not
+// from the StorageOptimizer. Tiers expire on their own cutoff, see
+// --rollup_retention_multiple.
+//
+// Not thread safe, all calls must run on the series' worker thread.
+class Rollups {
+ public:
+  // source holds the datapoints we roll up, tiers are stored under path.
+  Rollups(Series* series,
+          FileCache* cache,
+          DatapointDirectory* source,
+          const string& path,
+          const vector<int64_t>& widths);
+
+  Rollups(const Rollups& other) = delete;
+  Rollups& operator=(const Rollups& other) = delete;
+
+  // Rolls up whatever complete buckets are due, up to --rollup_max_buckets
+  // per tier. Failures are logged and retried next time.
+  void Update();
+
+  // Reads what it can of read_op from the coarsest tiers no coarser than
+  // read_op.step, leaving read_op.next_time where rolled up buckets end. The
+  // part of a bucket after an unaligned read_op.next_time comes from finer
+  // tiers or the source datapoints.
+  void Read(ReadOperation& read_op);
+
+  // See DatapointDirectory::ExpireBefore(). Throws IOError.
+  size_t ExpireBefore(int64_t cutoff);
+
+  bool Empty();
+
+ private:
+  DatapointDirectory* const source;
+  vector<std::unique_ptr<RollupTier>> tiers;
+
+  void Load(RollupTier& tier);
+  bool TryLoad(RollupTier& tier);
+  void UpdateTier(size_t t, int64_t now);
+  void ReadSource(size_t t, int64_t from, int64_t to,
+                  vector<RollupBucket>& buckets);
+  bool ReadSpan(size_t t, ReadOperation& read_op, int64_t bound);
+  void ReadDatapoints(ReadOperation& read_op, int64_t bound);
+  void ReadTier(RollupTier& tier, ReadOperation& read_op, int64_t bound);
+  void WriteBuckets(RollupTier& tier, const vector<RollupBucket>& buckets);
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_ROLLUPS_H
@@ -0,0 +1,198 @@
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/rollups.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int32(sparse_file_optimize_size);
+DECLARE_int32(rollup_max_buckets);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+class RollupsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // No Series or DB behind our directories.
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 0;
+    FLAGS_sparse_file_optimize_size = 1 << 20;
+
+    path = MakeTestDirForTest();
+    source.reset(new DatapointDirectory(nullptr, &file_cache, path + "/data"));
+
+    // A datapoint every 2 timestamps, valued by its index, long ago enough
+    // that every bucket is due.
+    vector<Datapoint> points;
+    for (int64_t i = 0; i < 300; i++)
+      points.emplace_back(i * 2, i, 2);
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    source->Write(write_op);
+  }
+
+  void TearDown() override {
+    FLAGS_sparse_file_optimize_size = sparse_file_optimize_size;
+    FLAGS_rollup_max_buckets = rollup_max_buckets;
+  }
+
+  std::unique_ptr<Rollups> MakeRollups() {
+    return std::unique_ptr<Rollups>(new Rollups(
+        nullptr, &file_cache, source.get(), path + "/rollups", {10, 60}));
+  }
+
+  // Reads [start, end) at step into a buffer of buffer_size, leaving what
+  // rollups couldn't read, as Series::Read() would read from source next.
+  vector<Datapoint> Read(Rollups& rollups,
+                         int64_t start,
+                         int64_t end,
+                         int64_t step,
+                         Aggregate aggregate,
+                         size_t buffer_size=100) {
+    vector<Datapoint> buffer(buffer_size);
+    ReadOperation read_op(start, end, INT64_MAX, false,
+                          buffer.data(), buffer.size());
+    read_op.step = step;
+    read_op.aggregate = aggregate;
+    rollups.Read(read_op);
+    next_time = read_op.next_time;
+    return vector<Datapoint>(read_op.buffer, read_op.cursor);
+  }
+
+  DirectoryFlagSaver flag_saver;
+  const int32_t sparse_file_optimize_size = FLAGS_sparse_file_optimize_size;
+  const int32_t rollup_max_buckets = FLAGS_rollup_max_buckets;
+
+  FileCache file_cache {16};
+  string path;
+  std::unique_ptr<DatapointDirectory> source;
+  int64_t next_time = 0;
+};
+
+
+TEST_F(RollupsTest, EachTierRollsUpTheOneBefore) {
+  std::unique_ptr<Rollups> rollups = MakeRollups();
+  EXPECT_TRUE(rollups->Empty());
+  rollups->Update();
+  EXPECT_FALSE(rollups->Empty());
+
+  vector<Datapoint> counts = Read(*rollups, 0, 600, 10, Aggregate::COUNT);
+  ASSERT_EQ(counts.size(), 60);
+  for (size_t i = 0; i < counts.size(); i++)
+    EXPECT_EQ(counts[i], Datapoint(i * 10, 5, 10)) << i;
+
+  vector<Datapoint> mins = Read(*rollups, 0, 600, 60, Aggregate::MIN);
+  vector<Datapoint> maxes = Read(*rollups, 0, 600, 60, Aggregate::MAX);
+  vector<Datapoint> avgs = Read(*rollups, 0, 600, 60, Aggregate::AVG);
+  ASSERT_EQ(mins.size(), 10);
+  ASSERT_EQ(maxes.size(), 10);
+  ASSERT_EQ(avgs.size(), 10);
+  for (size_t i = 0; i < 10; i++) {
+    EXPECT_EQ(mins[i], Datapoint(i * 60, i * 30, 60)) << i;
+    EXPECT_EQ(maxes[i], Datapoint(i * 60, i * 30 + 29, 60)) << i;
+    EXPECT_EQ(avgs[i], Datapoint(i * 60, i * 30 + 14.5, 60)) << i;
+  }
+}
+
+
+TEST_F(RollupsTest, UpdatesCatchUpAFewBucketsAtATime) {
+  FLAGS_rollup_max_buckets = 3;
+  std::unique_ptr<Rollups> rollups = MakeRollups();
+
+  // The finest tier takes its first three buckets, too few to complete one
+  // of the coarser tier's, so only they are read.
+  rollups->Update();
+  vector<Datapoint> counts = Read(*rollups, 0, 600, 60, Aggregate::COUNT);
+  EXPECT_EQ(counts, vector<Datapoint>({
+    Datapoint(0, 5, 10), Datapoint(10, 5, 10), Datapoint(20, 5, 10),
+  }));
+  EXPECT_EQ(next_time, 30);
+
+  rollups->Update();
+  counts = Read(*rollups, 0, 600, 60, Aggregate::COUNT);
+  ASSERT_EQ(counts.size(), 1);
+  EXPECT_EQ(counts[0], Datapoint(0, 30, 60));
+  EXPECT_EQ(next_time, 60);
+
+  for (int i = 0; i < 20; i++)
+    rollups->Update();
+  EXPECT_EQ(Read(*rollups, 0, 600, 60, Aggregate::COUNT).size(), 10);
+
+  // Reloaded, each tier ends after its last bucket.
+  rollups = MakeRollups();
+  EXPECT_EQ(Read(*rollups, 0, INT64_MAX, 10, Aggregate::COUNT).size(), 60);
+  EXPECT_EQ(next_time, 600);
+}
+
+
+TEST_F(RollupsTest, ReadsRouteToTheCoarsestTierFineEnough) {
+  std::unique_ptr<Rollups> rollups = MakeRollups();
+  rollups->Update();
+
+  // Steps between tiers read the finer one, steps finer than every tier
+  // leave the whole read to the source.
+  vector<Datapoint> counts = Read(*rollups, 0, 600, 59, Aggregate::COUNT);
+  EXPECT_EQ(counts.size(), 60);
+  EXPECT_EQ(next_time, 600);
+  EXPECT_TRUE(Read(*rollups, 0, 600, 9, Aggregate::COUNT).empty());
+  EXPECT_EQ(next_time, 0);
+
+  // Reads past the rollups stop where they end, after the last bucket once
+  // reloaded.
+  rollups = MakeRollups();
+  counts = Read(*rollups, 540, 100000, 3600, Aggregate::COUNT);
+  ASSERT_EQ(counts.size(), 1);
+  EXPECT_EQ(next_time, 600);
+}
+
+
+TEST_F(RollupsTest, UnalignedReadsStartFromFinerTiers) {
+  std::unique_ptr<Rollups> rollups = MakeRollups();
+  rollups->Update();
+
+  // Source datapoints up to the finest tier's next bucket, that tier's
+  // buckets up to the coarser tier's next bucket, then the coarser tier.
+  vector<Datapoint> counts = Read(*rollups, 25, 600, 60, Aggregate::COUNT);
+  vector<Datapoint> expected = {
+    Datapoint(26, 13, 2), Datapoint(28, 14, 2),
+    Datapoint(30, 5, 10), Datapoint(40, 5, 10), Datapoint(50, 5, 10),
+  };
+  for (int64_t timestamp = 60; timestamp < 600; timestamp += 60)
+    expected.emplace_back(timestamp, 30, 60);
+  EXPECT_EQ(counts, expected);
+  EXPECT_EQ(next_time, 600);
+
+  // A read ending inside the first coarse bucket never reaches it.
+  counts = Read(*rollups, 25, 50, 60, Aggregate::COUNT);
+  EXPECT_EQ(counts, vector<Datapoint>(expected.begin(), expected.begin() + 4));
+  EXPECT_EQ(next_time, 50);
+}
+
+
+TEST_F(RollupsTest, FullBuffersResumeWhereTheyStopped) {
+  std::unique_ptr<Rollups> rollups = MakeRollups();
+  rollups->Update();
+
+  vector<Datapoint> counts = Read(*rollups, 25, 600, 60, Aggregate::COUNT, 3);
+  EXPECT_EQ(counts, vector<Datapoint>({
+    Datapoint(26, 13, 2), Datapoint(28, 14, 2), Datapoint(30, 5, 10),
+  }));
+  EXPECT_EQ(next_time, 40);
+
+  counts = Read(*rollups, next_time, 600, 60, Aggregate::COUNT, 3);
+  EXPECT_EQ(counts, vector<Datapoint>({
+    Datapoint(40, 5, 10), Datapoint(50, 5, 10), Datapoint(60, 30, 60),
+  }));
+  EXPECT_EQ(next_time, 120);
+}
+
+
+} // namespace
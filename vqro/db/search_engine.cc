@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <random>
 #include <sstream>
 
 #include <gflags/gflags.h>
@@ -18,6 +20,8 @@ DEFINE_string(sqlite_pragma_journal_mode,"WAL",
               "Value to use for 'PRAGMA journal_mode'");
 DEFINE_int32(search_results_batch_size, 1024, "Maximum number of results "
              "contained in each search result protobuf.");
+DEFINE_int32(index_batch_size, 4096, "Maximum number of new series indexed "
+             "in one sqlite transaction.");
 
 using vqro::rpc::LabelConstraint;
 
@@ -79,21 +83,28 @@ SearchEngine::SearchEngine(string db_dir) {
   MaybeThrowSqliteError(ret, "Failed to create REGEXP sqlite function");
   LOG(INFO) << "sqlite REGEXP function registered";
 
-  // Initialize internal tables
+  // Initialize internal tables. AUTOINCREMENT keeps sqlite from handing the
+  // series_id of an unindexed series to a new one, which would make stale
+  // series handles resolve to the wrong series.
   string init_sql = R"(
     CREATE TABLE IF NOT EXISTS "vqro:series" (
-        series_id INTEGER PRIMARY KEY NOT NULL,
+        series_id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
         key TEXT UNIQUE NOT NULL,
         protobuf BLOB NOT NULL);
+    CREATE TABLE IF NOT EXISTS "vqro:meta" (
+        name TEXT PRIMARY KEY NOT NULL,
+        value INTEGER NOT NULL);
   )";
   ret = sqlite3_exec(sqlite_db, init_sql.c_str(), NULL, NULL, NULL);
   MaybeThrowSqliteError(ret, "Failed to sqlite3_exec() table initialization sql");
+  MigrateSeriesTable();
+  InitGeneration();
 
   // Scan for all existing label tables
   string scan_sql = R"(
     SELECT name
     FROM SQLITE_MASTER
-    WHERE type='table' AND name NOT LIKE 'vqro:%';
+    WHERE type='table' AND name NOT LIKE 'vqro:%' AND name NOT LIKE 'sqlite\_%' ESCAPE '\';
   )";
   auto callback = [] (void* all_labels, int cols, char** values, char** names) -> int {
     static_cast<std::unordered_set<string>*>(all_labels)->insert(values[0]);
@@ -122,12 +133,282 @@ void SearchEngine::MaybeThrowSqliteError(int return_code, string message) {
 }
 
 
-void SearchEngine::IndexSeries(Series* series) {
-  //TODO Figure out how to hold onto these prepared statements thread-safely.
-  SqlStatement series_insert = Prepare(
-      R"(INSERT OR IGNORE INTO "vqro:series" (key, protobuf) VALUES (?, ?);)");
-  SqlStatement begin_transaction = Prepare("BEGIN TRANSACTION");
-  SqlStatement end_transaction = Prepare("END TRANSACTION");
+// Rebuilds a vqro:series table created before series_ids were AUTOINCREMENT.
+// Ids already deleted from the top of an old table can't be known, but none
+// up to the highest remaining one are handed out again.
+void SearchEngine::MigrateSeriesTable() {
+  SqlStatement select = Prepare(
+      R"(SELECT sql FROM SQLITE_MASTER WHERE type='table' AND name='vqro:series';)");
+  if (!select.Step())
+    throw SqliteError("vqro:series table is missing");
+  string sql = reinterpret_cast<const char*>(sqlite3_column_text(select.stmt, 0));
+  select.Reset();
+  if (sql.find("AUTOINCREMENT") != string::npos)
+    return;
+
+  LOG(INFO) << "Migrating vqro:series table to AUTOINCREMENT series_ids";
+  string migrate_sql = R"(
+    BEGIN TRANSACTION;
+    CREATE TABLE "vqro:series_migration" (
+        series_id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
+        key TEXT UNIQUE NOT NULL,
+        protobuf BLOB NOT NULL);
+    INSERT INTO "vqro:series_migration" (series_id, key, protobuf)
+        SELECT series_id, key, protobuf FROM "vqro:series";
+    DROP TABLE "vqro:series";
+    ALTER TABLE "vqro:series_migration" RENAME TO "vqro:series";
+    COMMIT TRANSACTION;
+  )";
+  int ret = sqlite3_exec(sqlite_db, migrate_sql.c_str(), NULL, NULL, NULL);
+  if (ret != SQLITE_OK) {
+    string message = string("Failed to migrate vqro:series table: ") +
+                     sqlite3_errmsg(sqlite_db);
+    sqlite3_exec(sqlite_db, "ROLLBACK TRANSACTION", NULL, NULL, NULL);
+    throw SqliteError(message);
+  }
+}
+
+
+void SearchEngine::InitGeneration() {
+  // The first open of a new db picks the generation, later opens keep it.
+  std::random_device random;
+  std::uniform_int_distribution<uint32_t> dist(1, UINT32_MAX);
+
+  SqlStatement insert = Prepare(
+      R"(INSERT OR IGNORE INTO "vqro:meta" (name, value) VALUES ('generation', ?);)");
+  insert.BindInt64(1, dist(random));
+  insert.Execute();
+
+  SqlStatement select = Prepare(
+      R"(SELECT value FROM "vqro:meta" WHERE name = 'generation';)");
+  if (!select.Step())
+    throw SqliteError("vqro:meta has no generation");
+  generation = static_cast<uint32_t>(sqlite3_column_int64(select.stmt, 0));
+  LOG(INFO) << "Search engine generation " << generation;
+}
+
+
+void SearchEngine::StartIndexer(SeriesIndexedCallback indexed_callback,
+                                SeriesUnindexedCallback unindexed_callback) {
+  on_indexed = indexed_callback;
+  on_unindexed = unindexed_callback;
+  indexer = std::thread([this] { RunIndexer(); });
+}
+
+
+void SearchEngine::StopIndexer() {
+  {
+    std::lock_guard<std::mutex> guard(index_mutex);
+    stop_indexer = true;
+  }
+  index_wakeup.notify_one();
+  if (indexer.joinable())
+    indexer.join();
+}
+
+
+void SearchEngine::IndexSeries(std::shared_ptr<Series> series) {
+  if (series->is_indexed || series->index_queued.exchange(true))
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(index_mutex);
+    index_queue.push_back(std::move(series));
+  }
+  index_wakeup.notify_one();
+}
+
+
+void SearchEngine::UnindexSeries(int64_t series_id,
+                                 const vqro::rpc::Series& proto) {
+  vector<string> labels;
+  for (auto it : proto.labels())
+    labels.push_back(it.first);
+
+  {
+    std::lock_guard<std::mutex> guard(index_mutex);
+    unindex_queue.emplace_back(series_id, std::move(labels));
+  }
+  index_wakeup.notify_one();
+}
+
+
+bool SearchEngine::WaitIndexed(Series* series) {
+  std::unique_lock<std::mutex> lock(index_mutex);
+  index_done.wait(lock, [&] {
+    return series->is_indexed || !series->index_queued;
+  });
+  return series->is_indexed;
+}
+
+
+void SearchEngine::RunIndexer() {
+  LOG(INFO) << "Series indexer thread reporting for duty.";
+  vector<std::shared_ptr<Series>> batch;
+  vector<int64_t> series_ids;
+  vector<std::pair<int64_t,vector<string>>> removals;
+
+  while (true) {
+    // Whatever queued up while we were committing the last batch makes up
+    // the next one, so batches grow with the rate of new series.
+    {
+      std::unique_lock<std::mutex> lock(index_mutex);
+      index_wakeup.wait(lock, [&] {
+        return stop_indexer || !index_queue.empty() || !unindex_queue.empty();
+      });
+      if (index_queue.empty() && unindex_queue.empty())
+        return;  // Stopped
+
+      removals.assign(unindex_queue.begin(), unindex_queue.end());
+      unindex_queue.clear();
+
+      size_t batch_size = std::min(
+          index_queue.size(),
+          static_cast<size_t>(std::max(FLAGS_index_batch_size, 1)));
+      batch.assign(index_queue.begin(), index_queue.begin() + batch_size);
+      index_queue.erase(index_queue.begin(), index_queue.begin() + batch_size);
+    }
+
+    if (!removals.empty()) {
+      if (UnindexBatch(removals)) {
+        unindexed_batches++;
+        if (on_unindexed) {
+          for (auto& removal : removals)
+            on_unindexed(removal.first);
+        }
+      }
+      removals.clear();
+    }
+    if (batch.empty())
+      continue;
+
+    bool committed = IndexBatch(batch, series_ids);
+
+    {
+      std::lock_guard<std::mutex> guard(index_mutex);
+      for (size_t i = 0; i < batch.size(); i++) {
+        if (committed) {
+          batch[i]->series_id = series_ids[i];
+          batch[i]->is_indexed = true;
+        }
+        batch[i]->index_queued = false;
+      }
+    }
+    index_done.notify_all();
+
+    if (committed && on_indexed) {
+      for (auto& series : batch)
+        on_indexed(series.get());
+    }
+    batch.clear();
+  }
+}
+
+
+// Indexes a batch of series in one transaction, filling series_ids with their
+// series_ids. Returns false if the transaction failed.
+bool SearchEngine::IndexBatch(const vector<std::shared_ptr<Series>>& batch,
+                              vector<int64_t>& series_ids)
+{
+  series_ids.clear();
+  labels_created.clear();
+  int ret = sqlite3_exec(sqlite_db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+  if (ret != SQLITE_OK) {
+    LOG(ERROR) << "Failed to begin series index transaction: "
+               << sqlite3_errmsg(sqlite_db);
+    return false;
+  }
+
+  try {
+    for (auto& series : batch)
+      series_ids.push_back(IndexOne(series.get()));
+    MaybeThrowSqliteError(
+        sqlite3_exec(sqlite_db, "COMMIT TRANSACTION", NULL, NULL, NULL),
+        "Failed to commit series index transaction");
+  } catch (SqliteError& err) {
+    LOG(ERROR) << "Failed to index batch of " << batch.size() << " series: "
+               << err.message;
+    sqlite3_exec(sqlite_db, "ROLLBACK TRANSACTION", NULL, NULL, NULL);
+    for (const string& name : labels_created) {
+      all_labels.erase(name);
+      insert_label.erase(name);
+    }
+    return false;
+  }
+
+  VLOG(1) << "Indexed batch of " << batch.size() << " series";
+  return true;
+}
+
+
+// Removes a batch of series from the vqro:series table and their label tables
+// in one transaction. Failures are logged, leaving the series searchable, and
+// false returned.
+bool SearchEngine::UnindexBatch(
+    const vector<std::pair<int64_t,vector<string>>>& batch)
+{
+  int ret = sqlite3_exec(sqlite_db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+  if (ret != SQLITE_OK) {
+    LOG(ERROR) << "Failed to begin series unindex transaction: "
+               << sqlite3_errmsg(sqlite_db);
+    return false;
+  }
+
+  try {
+    SqlStatement delete_series = Prepare(
+        R"(DELETE FROM "vqro:series" WHERE series_id = ?;)");
+    for (auto& removal : batch) {
+      delete_series.Reset();
+      delete_series.BindInt64(1, removal.first);
+      delete_series.Execute();
+
+      for (const string& label : removal.second) {
+        SqlStatement delete_label = Prepare(
+            "DELETE FROM " + SqlQuoteIdentifier(label) + " WHERE series_id = ?;");
+        delete_label.BindInt64(1, removal.first);
+        delete_label.Execute();
+      }
+    }
+    MaybeThrowSqliteError(
+        sqlite3_exec(sqlite_db, "COMMIT TRANSACTION", NULL, NULL, NULL),
+        "Failed to commit series unindex transaction");
+  } catch (SqliteError& err) {
+    LOG(ERROR) << "Failed to unindex batch of " << batch.size() << " series: "
+               << err.message;
+    sqlite3_exec(sqlite_db, "ROLLBACK TRANSACTION", NULL, NULL, NULL);
+    return false;
+  }
+
+  LOG(INFO) << "Unindexed batch of " << batch.size() << " series";
+  return true;
+}
+
+
+// Returns the series_id of the series with this key, or zero if there is none.
+// Must run on the indexer thread.
+int64_t SearchEngine::FindSeriesId(const string& key) {
+  select_series_id.Reset();
+  select_series_id.BindText(1, key);
+  int64_t series_id = select_series_id.Step() ?
+      sqlite3_column_int64(select_series_id.stmt, 0) : 0;
+  select_series_id.Reset();
+  return series_id;
+}
+
+
+// Returns series' series_id, adding it to the vqro:series table and its
+// label tables if it isn't already there. Must run on the indexer thread.
+int64_t SearchEngine::IndexOne(Series* series) {
+  if (!select_series_id.stmt) {
+    select_series_id = Prepare(
+        R"(SELECT series_id FROM "vqro:series" WHERE key = ?;)");
+    insert_series = Prepare(
+        R"(INSERT OR IGNORE INTO "vqro:series" (key, protobuf) VALUES (?, ?);)");
+  }
+
+  int64_t series_id = FindSeriesId(series->keystr);
+  if (series_id)
+    return series_id;
 
   string proto_str;
   if (!series->proto.SerializeToString(&proto_str)) {
@@ -135,39 +416,96 @@ void SearchEngine::IndexSeries(Series* series) {
     throw SqliteError("Failed to serialize series protobuf!");
   }
 
-  series_insert.BindText(1, series->keystr);
-  series_insert.BindText(2, proto_str);
-  series_insert.Execute();
+  insert_series.Reset();
+  insert_series.BindText(1, series->keystr);
+  insert_series.BindText(2, proto_str);
+  insert_series.Execute();
+
+  series_id = FindSeriesId(series->keystr);
+  if (!series_id)
+    throw SqliteError("vqro:series row missing after insert");
 
   // Now we create the series' label tables and insert our label values into them
-  int64_t series_id = sqlite3_last_insert_rowid(sqlite_db);
+  LOG(INFO) << "Indexing series: " << series->keystr;
+  for (auto it : series->proto.labels()) {
+    IndexLabel(series_id, it.first, it.second);
+  }
+  return series_id;
+}
+
+
+bool SearchEngine::LookupSeries(int64_t series_id, vqro::rpc::Series* proto) {
+  SqlStatement select = Prepare(
+      R"(SELECT protobuf FROM "vqro:series" WHERE series_id = ?;)");
+  select.BindInt64(1, series_id);
+  if (!select.Step())
+    return false;
+
+  const char* protobuf = static_cast<const char*>(sqlite3_column_blob(select.stmt, 0));
+  int len = sqlite3_column_bytes(select.stmt, 0);
+  if (!proto->ParseFromArray(protobuf, len)) {
+    LOG(ERROR) << "Error: vqro:series row " << series_id
+               << " contains invalid protobuf";
+    return false;
+  }
+  return true;
+}
 
-  if (series_id) { // No insert happened if the row already existed
-    LOG(INFO) << "Indexing series: " << series->keystr;
-    begin_transaction.Execute();
-    for (auto it : series->proto.labels()) {
-      IndexLabel(series_id, it.first, it.second);
+
+void SearchEngine::ScanSeries(int64_t limit, SeriesScanCallback callback) {
+  string sql = R"(SELECT series_id, key, protobuf FROM "vqro:series")";
+  if (limit > 0)
+    sql += " LIMIT " + to_string(limit);
+  sql += ";";
+  SqlStatement select = Prepare(sql);
+
+  vqro::rpc::Series proto;
+  while (select.Step()) {
+    int64_t series_id = sqlite3_column_int64(select.stmt, 0);
+    const char* key = static_cast<const char*>(sqlite3_column_blob(select.stmt, 1));
+    int key_len = sqlite3_column_bytes(select.stmt, 1);
+    const char* protobuf = static_cast<const char*>(sqlite3_column_blob(select.stmt, 2));
+    int len = sqlite3_column_bytes(select.stmt, 2);
+
+    if (!proto.ParseFromArray(protobuf, len)) {
+      LOG(ERROR) << "Error: vqro:series row " << series_id
+                 << " contains invalid protobuf";
+      continue;
     }
-    end_transaction.Execute();
+    callback(series_id, string(key, key_len), proto);
   }
-  series->is_indexed = true;
 }
 
 
-void SearchEngine::IndexLabel(int64_t series_id, string name, string value) {
-  LOG(INFO) << "IndexLabel() series_id=" << series_id << " " << name << "=" << value;
-  string table_name = SqlQuoteIdentifier(name);
+void SearchEngine::IndexLabel(int64_t series_id,
+                              const string& name,
+                              const string& value)
+{
+  VLOG(1) << "IndexLabel() series_id=" << series_id << " " << name << "=" << value;
 
-  // Create the label table
-  string create_sql = "CREATE TABLE IF NOT EXISTS " + table_name +
-      " (series_id INTEGER PRIMARY KEY NOT NULL, value TEXT NOT NULL)";
+  auto it = insert_label.find(name);
+  if (it == insert_label.end()) {
+    string table_name = SqlQuoteIdentifier(name);
 
-  int ret = sqlite3_exec(sqlite_db, create_sql.c_str(), NULL, NULL, NULL);
-  MaybeThrowSqliteError(ret, "Failed to sqlite3_exec() label table creation sql");
+    // Create the label table
+    if (all_labels.find(name) == all_labels.end()) {
+      string create_sql = "CREATE TABLE IF NOT EXISTS " + table_name +
+          " (series_id INTEGER PRIMARY KEY NOT NULL, value TEXT NOT NULL)";
+
+      int ret = sqlite3_exec(sqlite_db, create_sql.c_str(), NULL, NULL, NULL);
+      MaybeThrowSqliteError(ret, "Failed to sqlite3_exec() label table creation sql");
+      all_labels.insert(name);
+      labels_created.push_back(name);
+    }
+
+    it = insert_label.emplace(name, Prepare(
+        "INSERT OR IGNORE INTO " + table_name + " (series_id, value) VALUES (?, ?);"
+    )).first;
+  }
 
   // Insert the label value for this series into the label table
-  SqlStatement insert = Prepare(
-      "INSERT OR IGNORE INTO " + table_name + " (series_id, value) VALUES (?, ?);");
+  SqlStatement& insert = it->second;
+  insert.Reset();
   insert.BindInt64(1, series_id);
   insert.BindText(2, value);
   insert.Execute();
@@ -285,6 +623,7 @@ void SearchEngine::SearchLabels(const vqro::rpc::LabelsQuery& query,
     FROM SQLITE_MASTER
     WHERE type='table' AND
     name NOT LIKE 'vqro:%' AND
+    name NOT LIKE 'sqlite\_%' ESCAPE '\' AND
     name REGEXP ?
   )";
 
@@ -1,7 +1,14 @@
 #ifndef VQRO_DB_SEARCH_ENGINE_H
 #define VQRO_DB_SEARCH_ENGINE_H
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <sqlite3.h>
@@ -18,13 +25,61 @@ namespace db {
 
 using SearchSeriesResultsCallback = std::function<void(vqro::rpc::SearchSeriesResults&)>;
 using SearchLabelsResultsCallback = std::function<void(vqro::rpc::SearchLabelsResults&)>;
+using SeriesIndexedCallback = std::function<void(Series*)>;
+using SeriesUnindexedCallback = std::function<void(int64_t series_id)>;
+using SeriesScanCallback = std::function<void(int64_t series_id,
+                                                 const string& key,
+                                                 const vqro::rpc::Series&)>;
 
 
 class SearchEngine {
  public:
   SearchEngine(string db_dir);
-
-  void IndexSeries(Series* series);
+  // Our cached statements are finalized after the connection is closed, so
+  // it is closed with sqlite3_close_v2(), which waits for them.
+  ~SearchEngine() {
+    StopIndexer();
+    sqlite3_close_v2(sqlite_db);
+  }
+
+  // Series are indexed in batches by a background thread. on_indexed is
+  // called from that thread for each series once its batch has committed,
+  // and on_unindexed for each series_id once its removal has.
+  void StartIndexer(SeriesIndexedCallback on_indexed,
+                    SeriesUnindexedCallback on_unindexed);
+
+  // Indexes every series still queued, then stops the indexer thread.
+  void StopIndexer();
+
+  // Queues series to be added to the vqro:series table and its label tables
+  // if it isn't already there. Once its batch commits the series' series_id
+  // is set and it is marked is_indexed. Series already queued are ignored.
+  void IndexSeries(std::shared_ptr<Series> series);
+
+  // Queues the series with this series_id and proto to be removed from the
+  // index. Removals are done ahead of any series queued after them, so a
+  // series recreated with the same key gets indexed anew.
+  void UnindexSeries(int64_t series_id, const vqro::rpc::Series& proto);
+
+  // Bumped whenever a batch of removals commits, before their on_unindexed
+  // calls.
+  uint64_t UnindexedBatches() const { return unindexed_batches; }
+
+  // Blocks until a queued series has been indexed, returning false if its
+  // batch failed.
+  bool WaitIndexed(Series* series);
+
+  // Reads back the proto of an indexed series. Returns false if there is no
+  // series with that series_id.
+  bool LookupSeries(int64_t series_id, vqro::rpc::Series* proto);
+
+  // Calls callback for every series in the vqro:series table, or only the
+  // first limit of them if limit is positive.
+  void ScanSeries(int64_t limit, SeriesScanCallback callback);
+
+  // Random tag chosen when the sqlite db was created. Series handles embed it
+  // so that handles issued against a different db are recognized as stale.
+  uint32_t Generation() const { return generation; }
 
   void SearchSeries(const vqro::rpc::SeriesQuery& query,
                     SearchSeriesResultsCallback callback);
@@ -34,10 +89,40 @@ class SearchEngine {
 
  private:
   sqlite3* sqlite_db = NULL;
-  std::unordered_set<string> all_labels;
+  std::unordered_set<string> all_labels;  // Only used by the indexer
+  uint32_t generation = 0;
+
+  std::thread indexer;
+  std::mutex index_mutex;
+  std::condition_variable index_wakeup;
+  std::condition_variable index_done;
+  std::deque<std::shared_ptr<Series>> index_queue;
+  std::deque<std::pair<int64_t,vector<string>>> unindex_queue;  // Label names
+  bool stop_indexer = false;
+  SeriesIndexedCallback on_indexed;
+  SeriesUnindexedCallback on_unindexed;
+  std::atomic<uint64_t> unindexed_batches {0};
+
+  // Prepared statements cached by the indexer thread, which is the only one
+  // to use them.
+  SqlStatement select_series_id;
+  SqlStatement insert_series;
+  std::unordered_map<string,SqlStatement> insert_label;
+
+  // Label tables created by the open index transaction. A rollback drops
+  // them, so they are forgotten along with their cached statements.
+  vector<string> labels_created;
 
   void MaybeThrowSqliteError(int return_code, string message);
-  void IndexLabel(int64_t series_id, string name, string value);
+  void MigrateSeriesTable();
+  void InitGeneration();
+  void RunIndexer();
+  bool IndexBatch(const vector<std::shared_ptr<Series>>& batch,
+                  vector<int64_t>& series_ids);
+  int64_t IndexOne(Series* series);
+  bool UnindexBatch(const vector<std::pair<int64_t,vector<string>>>& batch);
+  int64_t FindSeriesId(const string& key);
+  void IndexLabel(int64_t series_id, const string& name, const string& value);
   SqlStatement Prepare(string sql);
 };
 
@@ -0,0 +1,152 @@
+#include <set>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/search.pb.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/db.h"
+#include "vqro/db/search_engine.h"
+#include "vqro/db/series.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int32(index_batch_size);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+vqro::rpc::Series MakeProto(std::initializer_list<std::pair<string, string>> labels) {
+  vqro::rpc::Series proto;
+  for (auto& label : labels)
+    (*proto.mutable_labels())[label.first] = label.second;
+  return proto;
+}
+
+
+class SearchEngineTest : public DatabaseTest {
+ protected:
+  void TearDown() override {
+    DatabaseTest::TearDown();
+    FLAGS_index_batch_size = index_batch_size;
+  }
+
+  // The names of the series whose label has exactly value.
+  std::set<string> Search(const string& label, const string& value) {
+    vqro::rpc::SeriesQuery query;
+    vqro::rpc::LabelConstraint* constraint = query.add_constraints();
+    constraint->set_label_name(label);
+    constraint->set_exact_value(value);
+
+    std::set<string> names;
+    db->search_engine->SearchSeries(query, [&] (
+        vqro::rpc::SearchSeriesResults& results) {
+      for (const auto& match : results.matches())
+        names.insert(match.labels().at("name"));
+    });
+    return names;
+  }
+
+  // How many rows of the index have key.
+  size_t CountRows(const string& key) {
+    size_t rows = 0;
+    db->search_engine->ScanSeries(0, [&] (int64_t,
+                                          const string& row_key,
+                                          const vqro::rpc::Series&) {
+      if (row_key == key)
+        rows++;
+    });
+    return rows;
+  }
+
+  const int32_t index_batch_size = FLAGS_index_batch_size;
+};
+
+
+TEST_F(SearchEngineTest, ManyNewSeriesAreIndexedInBatches) {
+  // Small batches, each of which creates label tables of its own.
+  FLAGS_index_batch_size = 16;
+  const int count = 1000;
+  for (int i = 0; i < count; i++) {
+    vqro::rpc::WriteOperation op;
+    *op.mutable_series() = MakeProto({
+      {"name", "s" + std::to_string(i)},
+      {"group", "g" + std::to_string(i % 10)},
+      {"label" + std::to_string(i % 50), "x"}
+    });
+    vqro::rpc::Datapoint* point = op.add_datapoints();
+    point->set_timestamp(1000);
+    point->set_value(i);
+    db->Write(op);
+  }
+
+  // Resolving waits for each series' batch.
+  std::set<uint64_t> handles;
+  for (int i = 0; i < count; i++) {
+    handles.insert(db->ResolveSeries(MakeProto({
+      {"name", "s" + std::to_string(i)},
+      {"group", "g" + std::to_string(i % 10)},
+      {"label" + std::to_string(i % 50), "x"}
+    })));
+  }
+  EXPECT_EQ(handles.size(), count);
+
+  std::set<string> group3;
+  for (int i = 3; i < count; i += 10)
+    group3.insert("s" + std::to_string(i));
+  EXPECT_EQ(Search("group", "g3"), group3);
+
+  std::set<string> label7;
+  for (int i = 7; i < count; i += 50)
+    label7.insert("s" + std::to_string(i));
+  EXPECT_EQ(Search("label7", "x"), label7);
+  EXPECT_EQ(Search("name", "s999"), std::set<string>({"s999"}));
+}
+
+
+TEST_F(SearchEngineTest, FailedBatchesForgetTheLabelTablesTheyCreated) {
+  // A label named after the series table can't be inserted into, failing
+  // the batch after some of the fresh label tables were created.
+  vqro::rpc::Series bad = MakeProto({{"name", "bad"}, {"vqro:series", "x"}});
+  vqro::rpc::Series good = MakeProto({{"name", "good"}});
+  for (int i = 0; i < 10; i++) {
+    (*bad.mutable_labels())["fresh" + std::to_string(i)] = "1";
+    (*good.mutable_labels())["fresh" + std::to_string(i)] = "2";
+  }
+  EXPECT_THROW(db->ResolveSeries(bad), DatabaseError);
+
+  // The rollback dropped the tables, so they must be created again.
+  db->ResolveSeries(good);
+  for (int i = 0; i < 10; i++)
+    EXPECT_EQ(Search("fresh" + std::to_string(i), "2"),
+              std::set<string>({"good"}));
+  EXPECT_EQ(Search("fresh0", "1"), std::set<string>());
+}
+
+
+TEST_F(SearchEngineTest, UnindexedSeriesCanBeRecreatedRightAway) {
+  std::shared_ptr<Series> series = MakeSeries("a");
+  db->search_engine->IndexSeries(series);
+  ASSERT_TRUE(db->search_engine->WaitIndexed(series.get()));
+
+  // As the retention sweeper removes a series while a writer recreates it.
+  // The removal is done first, so the new series isn't given the row that
+  // is about to go.
+  for (int i = 0; i < 100; i++) {
+    db->search_engine->UnindexSeries(series->series_id, series->proto);
+    series = MakeSeries("a");
+    db->search_engine->IndexSeries(series);
+    ASSERT_TRUE(db->search_engine->WaitIndexed(series.get()));
+
+    vqro::rpc::Series proto;
+    EXPECT_TRUE(db->search_engine->LookupSeries(series->series_id, &proto));
+    EXPECT_EQ(CountRows("name=a"), 1);
+    EXPECT_EQ(Search("name", "a"), std::set<string>({"a"}));
+  }
+}
+
+
+} // namespace
@@ -0,0 +1,40 @@
+#include "vqro/base/base.h"
+#include "vqro/db/segment_file.h"
+#include "vqro/db/sparse_file.h"
+
+
+namespace vqro {
+namespace db {
+
+
+string SegmentFile::Filename() const {
+  // segment filename format is "<segment id>.seg+<chunk offset>", which
+  // only ever shows up in logs.
+  return to_string(chunk.segment->id) + ".seg+" + to_string(chunk.offset);
+}
+
+
+ManifestEntry SegmentFile::Describe() const {
+  ManifestEntry entry = DescribeAs(FileFormat::SEGMENT);
+  entry.count = chunk.count;
+  entry.size = chunk.Bytes();
+  return entry;
+}
+
+
+void SegmentFile::Read(ReadOperation& read_op) const {
+  std::unique_ptr<vector<Datapoint>> datapoints = store->Read(chunk);
+  SparseFile::ReadSorted(read_op,
+                         datapoints->data(),
+                         datapoints->data() + datapoints->size());
+}
+
+
+void SegmentFile::ReadAll(vector<Datapoint>& points) const {
+  std::unique_ptr<vector<Datapoint>> datapoints = store->Read(chunk);
+  points.insert(points.end(), datapoints->begin(), datapoints->end());
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,61 @@
+#ifndef VQRO_DB_SEGMENT_FILE_H
+#define VQRO_DB_SEGMENT_FILE_H
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "vqro/base/base.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_file.h"
+#include "vqro/db/read_op.h"
+#include "vqro/db/segment_store.h"
+#include "vqro/db/write_op.h"
+
+
+namespace vqro {
+namespace db {
+
+
+class DatapointDirectory;
+
+
+// A SegmentFile is one chunk of a series in a SegmentStore, presented to its
+// DatapointDirectory as a read-only datapoint file. Chunks are replaced
+// rather than appended to, see DatapointDirectory::WriteChunks(), so writing
+// one throws std::logic_error.
+class SegmentFile: public DatapointFile {
+ public:
+  const SegmentChunk chunk;
+
+  SegmentFile(DatapointDirectory* _dir,
+              SegmentStore* _store,
+              const SegmentChunk& _chunk) :
+    DatapointFile(_dir, _chunk.min_timestamp, _chunk.max_timestamp),
+    chunk(_chunk),
+    store(_store) {
+      filename = Filename();
+    }
+
+  string Filename() const;
+  ManifestEntry Describe() const;
+  void Read(ReadOperation& read_op) const;
+  size_t Write(const WriteOperation<WriteBuffer>&) {
+    throw std::logic_error("SegmentFile is read-only path=" + GetPath());
+  }
+  size_t Write(const WriteOperation<RawBuffer>&) {
+    throw std::logic_error("SegmentFile is read-only path=" + GetPath());
+  }
+  size_t RemainingWritableDatapoints() const { return 0; }
+
+  // Appends the chunk's datapoints to points. Throws IOError.
+  void ReadAll(vector<Datapoint>& points) const;
+
+ private:
+  SegmentStore* const store;
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_SEGMENT_FILE_H
@@ -0,0 +1,521 @@
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint_file.h"
+#include "vqro/db/segment_store.h"
+
+
+DEFINE_string(storage_engine,
+              "directories",
+              "How datapoints are stored on disk. 'directories' gives every "
+              "series a directory of datapoint files, 'segments' packs the "
+              "datapoints of many series into shared segment files.");
+DEFINE_int64(segment_size,
+             1 << 26,  // 64MB
+             "Segment files are sealed once they reach this many bytes.");
+DEFINE_int32(segment_chunk_datapoints,
+             4096,
+             "Chunks of a series in a segment aren't merged with the next "
+             "one past this many datapoints.");
+DEFINE_int32(segment_compaction_interval,
+             60000,
+             "How often (milliseconds) sealed segments are checked for "
+             "compaction.");
+
+
+namespace vqro {
+namespace db {
+
+
+// Identifies a SegmentFooter.
+static constexpr uint64_t segment_magic = 0x7671726f7365676d;  // "vqrosegm"
+
+
+static uint32_t Checksum(const Datapoint* buf, size_t len) {
+  return crc32(0, reinterpret_cast<const Bytef*>(buf), len * datapoint_size);
+}
+
+
+SegmentStore::SegmentStore(string d, size_t writers) :
+  dir(d),
+  active(std::max<size_t>(writers, 1))
+{
+  CreateDirectory(dir);
+
+  vector<uint64_t> ids;
+  {
+    DirectoryHandle dir_handle(dir);
+    if (dir_handle.stream == NULL)
+      throw IOErrorFromErrno("SegmentStore opendir() failed path=" + dir);
+
+    struct dirent64* entry;
+    char* endptr;
+    while ((entry = readdir64(dir_handle.stream)) != NULL) {
+      uint64_t id = strtoull(entry->d_name, &endptr, 10);
+      if (endptr != entry->d_name && strcmp(endptr, ".seg") == 0)
+        ids.push_back(id);
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+
+  LoadSegments(ids);
+  if (!ids.empty())
+    next_segment_id = ids.back() + 1;
+
+  size_t series_count = chunks.size();
+  LOG(INFO) << "SegmentStore loaded " << ids.size() << " segments holding "
+            << series_count << " series";
+}
+
+
+SegmentStore::~SegmentStore() {
+  Stop();
+  for (auto& segment : active)
+    if (segment)
+      Seal(*segment);
+}
+
+
+void SegmentStore::Start() {
+  compactor = std::thread([this] { RunCompactor(); });
+}
+
+
+void SegmentStore::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    stop = true;
+  }
+  wakeup.notify_one();
+  if (compactor.joinable())
+    compactor.join();
+}
+
+
+string SegmentStore::SegmentPath(uint64_t id) const {
+  return dir + "/" + to_string(id) + ".seg";
+}
+
+
+static bool ValidFooter(const SegmentFooter& footer, off_t size) {
+  return footer.magic == segment_magic &&
+         footer.index_offset +
+             footer.index_entries * sizeof(SegmentIndexEntry) +
+             sizeof(footer) == static_cast<uint64_t>(size);
+}
+
+
+// Only called from the constructor. Opening every segment first lets us read
+// all their footers, then all the sealed ones' indexes, in one batch each.
+void SegmentStore::LoadSegments(const vector<uint64_t>& ids) {
+  vector<std::shared_ptr<Segment>> loading;
+  vector<SegmentFooter> footers(ids.size(), SegmentFooter {0, 0, 0});
+  vector<Iovec> iovs;
+  vector<IoRequest> requests;
+  iovs.reserve(ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    auto segment = std::make_shared<Segment>(
+        ids[i], SegmentPath(ids[i]), O_RDWR | O_CLOEXEC,
+        FLAGS_datapoint_file_mode);
+    if (segment->file.fd == -1)
+      throw IOErrorFromErrno("SegmentStore open() failed path=" + segment->path);
+    segment->size = GetFileSize(segment->path);
+
+    if (segment->size >= static_cast<off_t>(sizeof(SegmentFooter))) {
+      iovs.push_back(Iovec {&footers[i], sizeof(SegmentFooter)});
+      requests.emplace_back(IoRequest::READ, segment->file.fd, &iovs.back(),
+                            1, segment->size - sizeof(SegmentFooter));
+    }
+    loading.push_back(segment);
+  }
+  ThreadIoBackend()->Submit(requests.data(), requests.size());
+  for (const IoRequest& request : requests)
+    if (request.result != static_cast<ssize_t>(sizeof(SegmentFooter)))
+      memset(request.iov->iov_base, 0, sizeof(SegmentFooter));
+
+  iovs.clear();
+  requests.clear();
+  for (size_t i = 0; i < loading.size(); i++) {
+    Segment& segment = *loading[i];
+    if (!ValidFooter(footers[i], segment.size) || !footers[i].index_entries)
+      continue;
+    segment.index.resize(footers[i].index_entries);
+    iovs.push_back(Iovec {
+      segment.index.data(),
+      segment.index.size() * sizeof(SegmentIndexEntry)
+    });
+    requests.emplace_back(IoRequest::READ, segment.file.fd, &iovs.back(), 1,
+                          footers[i].index_offset);
+  }
+  ThreadIoBackend()->Submit(requests.data(), requests.size());
+
+  for (size_t i = 0, r = 0; i < loading.size(); i++) {
+    Segment& segment = *loading[i];
+    if (!ValidFooter(footers[i], segment.size) || !footers[i].index_entries)
+      continue;
+
+    // Short reads are retried the slow way.
+    const IoRequest& request = requests[r++];
+    if (request.result != static_cast<ssize_t>(request.iov->iov_len))
+      segment.index = std::move(*ReadValues<SegmentIndexEntry>(
+          segment.file, footers[i].index_entries, footers[i].index_offset));
+  }
+
+  for (size_t i = 0; i < loading.size(); i++)
+    LoadSegment(loading[i], footers[i]);
+}
+
+
+// Only called from the constructor, with segment's index already read if
+// footer is valid.
+void SegmentStore::LoadSegment(std::shared_ptr<Segment> segment,
+                               const SegmentFooter& footer) {
+  const uint64_t id = segment->id;
+  if (ValidFooter(footer, segment->size)) {
+    segment->sealed = true;
+  } else {
+    // Never sealed, so we find its chunks by their headers and seal it now.
+    // A torn or corrupt chunk ends the segment.
+    auto data = ReadValues<char>(segment->file, segment->size, 0);
+    const char* const begin = data->data();
+    const char* pos = begin;
+    const char* const end = begin + data->size();
+    SegmentChunkHeader header;
+    while (end - pos >= static_cast<long>(sizeof(header))) {
+      memcpy(&header, pos, sizeof(header));
+      const Datapoint* points = reinterpret_cast<const Datapoint*>(pos + sizeof(header));
+      if (header.count == 0 ||
+          (end - pos - sizeof(header)) / datapoint_size < header.count ||
+          Checksum(points, header.count) != header.checksum)
+        break;
+
+      segment->index.push_back(SegmentIndexEntry {
+        header.series,
+        header.min_timestamp,
+        header.max_timestamp,
+        header.sequence,
+        static_cast<uint64_t>(pos - begin),
+        header.count,
+        0
+      });
+      pos += sizeof(header) + header.count * datapoint_size;
+    }
+
+    if (pos < end) {
+      LOG(WARNING) << "SegmentStore ignoring " << (end - pos)
+                   << " trailing bytes of " << segment->path;
+      if (ftruncate(segment->file.fd, pos - begin) == -1)
+        throw IOErrorFromErrno("SegmentStore ftruncate() failed path=" + segment->path);
+      segment->size = pos - begin;
+    }
+    Seal(*segment);
+  }
+
+  for (const SegmentIndexEntry& entry : segment->index) {
+    AddChunk(entry.series, SegmentChunk {
+      segment,
+      entry.offset,
+      entry.min_timestamp,
+      entry.max_timestamp,
+      entry.sequence,
+      entry.count
+    });
+    if (entry.sequence >= next_sequence)
+      next_sequence = entry.sequence + 1;
+  }
+  segments[id] = segment;
+}
+
+
+// Must hold mutex, or be the constructor.
+void SegmentStore::AddChunk(uint64_t series, SegmentChunk chunk) {
+  vector<SegmentChunk>& series_chunks = chunks[series];
+  auto overlaps = [&] (const SegmentChunk& other) {
+    return other.min_timestamp <= chunk.max_timestamp &&
+           other.max_timestamp >= chunk.min_timestamp;
+  };
+
+  // Compaction copies have the sequence numbers of their originals.
+  for (const SegmentChunk& other : series_chunks)
+    if (overlaps(other) && other.sequence >= chunk.sequence)
+      return;
+
+  for (auto it = series_chunks.begin(); it != series_chunks.end();) {
+    if (overlaps(*it)) {
+      it->segment->live_bytes -= it->Bytes();
+      it = series_chunks.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  chunk.segment->live_bytes += chunk.Bytes();
+  auto pos = std::upper_bound(
+      series_chunks.begin(), series_chunks.end(), chunk,
+      [] (const SegmentChunk& a, const SegmentChunk& b) -> bool {
+        return a.min_timestamp < b.min_timestamp;
+      }
+  );
+  series_chunks.insert(pos, std::move(chunk));
+}
+
+
+vector<SegmentChunk> SegmentStore::Chunks(uint64_t series) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto found = chunks.find(series);
+  if (found == chunks.end())
+    return {};
+  return found->second;
+}
+
+
+// Must hold mutex.
+std::shared_ptr<Segment> SegmentStore::NewSegment() {
+  uint64_t id = next_segment_id++;
+  auto segment = std::make_shared<Segment>(
+      id, SegmentPath(id),
+      O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+      FLAGS_datapoint_file_mode);
+  if (segment->file.fd == -1)
+    throw IOErrorFromErrno("SegmentStore open() failed path=" + segment->path);
+  return segment;
+}
+
+
+void SegmentStore::WriteChunk(Segment& segment,
+                              const SegmentChunkHeader& header,
+                              const Datapoint* buf) {
+  Iovec iov[2];
+  iov[0].iov_base = const_cast<SegmentChunkHeader*>(&header);
+  iov[0].iov_len = sizeof(header);
+  iov[1].iov_base = const_cast<Datapoint*>(buf);
+  iov[1].iov_len = header.count * datapoint_size;
+  WriteVector(segment.file, iov, 2, segment.size);
+
+  segment.index.push_back(SegmentIndexEntry {
+    header.series,
+    header.min_timestamp,
+    header.max_timestamp,
+    header.sequence,
+    static_cast<uint64_t>(segment.size),
+    header.count,
+    0
+  });
+  segment.size += iov[0].iov_len + iov[1].iov_len;
+}
+
+
+void SegmentStore::Seal(Segment& segment) {
+  SegmentFooter footer {
+    static_cast<uint64_t>(segment.size),
+    segment.index.size(),
+    segment_magic
+  };
+
+  Iovec iov[2];
+  iov[0].iov_base = segment.index.data();
+  iov[0].iov_len = segment.index.size() * sizeof(SegmentIndexEntry);
+  iov[1].iov_base = &footer;
+  iov[1].iov_len = sizeof(footer);
+  WriteVector(segment.file, iov, 2, segment.size);
+  segment.size += iov[0].iov_len + iov[1].iov_len;
+  segment.sealed = true;
+}
+
+
+void SegmentStore::Append(uint64_t series, const Datapoint* buf, size_t len) {
+  SegmentChunkHeader header {
+    series,
+    buf[0].timestamp,
+    buf[len - 1].timestamp,
+    next_sequence++,
+    static_cast<uint32_t>(len),
+    Checksum(buf, len)
+  };
+
+  std::shared_ptr<Segment> segment;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    std::shared_ptr<Segment>& writer_segment = active[series % active.size()];
+    if (!writer_segment)
+      writer_segment = NewSegment();
+    segment = writer_segment;
+  }
+
+  // Nobody else writes to our active segment.
+  off_t offset = segment->size;
+  WriteChunk(*segment, header, buf);
+
+  bool full = segment->size >= FLAGS_segment_size;
+  if (full)
+    Seal(*segment);
+
+  std::lock_guard<std::mutex> guard(mutex);
+  AddChunk(series, SegmentChunk {
+    segment,
+    static_cast<uint64_t>(offset),
+    header.min_timestamp,
+    header.max_timestamp,
+    header.sequence,
+    header.count
+  });
+  if (full) {
+    segments[segment->id] = segment;
+    active[series % active.size()] = nullptr;
+  }
+}
+
+
+std::unique_ptr<vector<Datapoint>> SegmentStore::Read(const SegmentChunk& chunk) {
+  auto header = ReadValues<SegmentChunkHeader>(chunk.segment->file, 1, chunk.offset);
+  auto points = ReadValues<Datapoint>(chunk.segment->file,
+                                      chunk.count,
+                                      chunk.offset + sizeof(SegmentChunkHeader));
+  if (header->empty() ||
+      header->front().sequence != chunk.sequence ||
+      points->size() != chunk.count ||
+      Checksum(points->data(), points->size()) != header->front().checksum)
+    throw IOError("SegmentStore corrupt chunk path=" + chunk.segment->path +
+                  " offset=" + to_string(chunk.offset));
+  return points;
+}
+
+
+void SegmentStore::RunCompactor() {
+  LOG(INFO) << "SegmentStore compactor reporting for duty.";
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stop) {
+    wakeup.wait_for(lock, std::chrono::milliseconds(
+        std::max(FLAGS_segment_compaction_interval, 1)));
+    if (stop)
+      break;
+
+    lock.unlock();
+    try {
+      while (Compact());
+    } catch (IOError& e) {
+      LOG(ERROR) << "SegmentStore compaction failed: " << e.what();
+    }
+    lock.lock();
+  }
+}
+
+
+// Merges sealed segments that are mostly superseded or small, oldest first,
+// into one. Returns true if it did anything.
+bool SegmentStore::Compact() {
+  vector<std::shared_ptr<Segment>> victims;
+  vector<SegmentChunk> live;
+  vector<uint64_t> live_series;
+  int64_t live_bytes = 0;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    for (auto& it : segments) {
+      Segment& segment = *it.second;
+      bool mostly_dead = segment.live_bytes * 2 < segment.size;
+      bool small = segment.size < FLAGS_segment_size / 4;
+      if (!mostly_dead && !small)
+        continue;
+      if (!victims.empty() && live_bytes + segment.live_bytes > FLAGS_segment_size)
+        break;
+      victims.push_back(it.second);
+      live_bytes += segment.live_bytes;
+    }
+
+    // A lone small segment would just be copied as is.
+    if (victims.empty() ||
+        (victims.size() == 1 && victims[0]->live_bytes * 2 >= victims[0]->size))
+      return false;
+
+    for (auto& segment : victims) {
+      for (const SegmentIndexEntry& entry : segment->index) {
+        auto found = chunks.find(entry.series);
+        if (found == chunks.end())
+          continue;
+        for (const SegmentChunk& chunk : found->second) {
+          if (chunk.segment == segment && chunk.offset == entry.offset) {
+            live.push_back(chunk);
+            live_series.push_back(entry.series);
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // We copy without holding the lock. Chunks superseded meanwhile just
+  // won't be moved.
+  std::shared_ptr<Segment> merged;
+  vector<uint64_t> new_offsets;
+  if (!live.empty()) {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      merged = NewSegment();
+    }
+    for (size_t i = 0; i < live.size(); i++) {
+      std::unique_ptr<vector<Datapoint>> points = Read(live[i]);
+      SegmentChunkHeader header {
+        live_series[i],
+        live[i].min_timestamp,
+        live[i].max_timestamp,
+        live[i].sequence,
+        live[i].count,
+        Checksum(points->data(), points->size())
+      };
+      new_offsets.push_back(merged->size);
+      WriteChunk(*merged, header, points->data());
+    }
+    Seal(*merged);
+  }
+
+  // The copies must be durable before the victims go, since nothing else
+  // holds their chunks.
+  if (merged)
+    SyncFile(merged->file);
+  SyncDirectory(dir);
+
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    for (size_t i = 0; i < live.size(); i++) {
+      for (SegmentChunk& chunk : chunks[live_series[i]]) {
+        if (chunk.segment == live[i].segment && chunk.offset == live[i].offset) {
+          chunk.segment->live_bytes -= chunk.Bytes();
+          chunk.segment = merged;
+          chunk.offset = new_offsets[i];
+          merged->live_bytes += chunk.Bytes();
+          break;
+        }
+      }
+    }
+    if (merged)
+      segments[merged->id] = merged;
+    for (auto& segment : victims)
+      segments.erase(segment->id);
+  }
+  generation++;
+
+  // Readers may still hold the victims open.
+  for (auto& segment : victims) {
+    if (unlink(segment->path.c_str()) == -1)
+      PLOG(ERROR) << "SegmentStore failed to unlink " << segment->path;
+  }
+  LOG(INFO) << "SegmentStore compacted " << victims.size() << " segments into "
+            << (merged ? merged->path : "nothing") << ", "
+            << live.size() << " chunks moved";
+  return true;
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,185 @@
+#ifndef VQRO_DB_SEGMENT_STORE_H
+#define VQRO_DB_SEGMENT_STORE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint.h"
+
+
+DECLARE_string(storage_engine);
+DECLARE_int32(segment_chunk_datapoints);
+
+
+namespace vqro {
+namespace db {
+
+
+// Precedes each chunk's datapoints in a segment file.
+struct SegmentChunkHeader {
+  uint64_t series;     // Series::keyint
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  uint64_t sequence;   // Chunks supersede older chunks they overlap
+  uint32_t count;      // Datapoints that follow
+  uint32_t checksum;   // crc32 of the datapoints
+};
+static_assert(sizeof(SegmentChunkHeader) == 40,
+              "SegmentChunkHeader must have no padding");
+
+
+// One per chunk in a sealed segment's index.
+struct SegmentIndexEntry {
+  uint64_t series;
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  uint64_t sequence;
+  uint64_t offset;     // Of the chunk's header
+  uint32_t count;
+  uint32_t unused;
+};
+static_assert(sizeof(SegmentIndexEntry) == 48,
+              "SegmentIndexEntry must have no padding");
+
+
+// Ends a sealed segment.
+struct SegmentFooter {
+  uint64_t index_offset;
+  uint64_t index_entries;
+  uint64_t magic;
+};
+static_assert(sizeof(SegmentFooter) == 24,
+              "SegmentFooter must have no padding");
+
+
+// An open segment file. Chunk references hold on to it, so it stays readable
+// after compaction unlinks it.
+class Segment {
+ public:
+  const uint64_t id;
+  const string path;
+  FileHandle file;
+  off_t size = 0;
+  bool sealed = false;
+  vector<SegmentIndexEntry> index;  // Every chunk written, live or not
+  std::atomic<int64_t> live_bytes {0};
+
+  Segment(uint64_t i, string p, int flags, mode_t mode) :
+    id(i), path(p), file(p, flags, mode) {}
+
+  Segment(const Segment& other) = delete;
+  Segment& operator=(const Segment& other) = delete;
+};
+
+
+// Where one chunk of a series' datapoints lives.
+struct SegmentChunk {
+  std::shared_ptr<Segment> segment;
+  uint64_t offset;
+  int64_t min_timestamp;
+  int64_t max_timestamp;
+  uint64_t sequence;
+  uint32_t count;
+
+  // Bytes of the chunk including its header.
+  int64_t Bytes() const {
+    return sizeof(SegmentChunkHeader) + int64_t(count) * datapoint_size;
+  }
+};
+
+
+// With --storage_engine=segments, series don't get directories of their
+// own. Each flush of a series instead appends a chunk of its sorted
+// datapoints to a segment file shared by every series of the same worker
+// thread, and DatapointDirectory reads and writes those chunks through
+// SegmentFiles.
+//
+// A series' chunks never overlap in time. DatapointDirectory merges
+// datapoints that land inside an existing chunk, and small chunks followed by
+// more datapoints, into a new chunk which supersedes the ones it covers.
+//
+// A segment is sealed once it reaches --segment_size, by appending an index
+// of its chunks, so loading it later takes one read of its tail. At startup
+// every segment's index is loaded, and a series' live chunks are those not
+// overlapped by a chunk with a later sequence number. A background thread
+// compacts sealed segments that are mostly superseded, or small, by copying
+// their live chunks into a new segment with their sequence numbers unchanged
+// and unlinking them.
+//
+// Thread-safe. Appends for a series must all come from its worker thread,
+// which alone writes to the worker's active segment.
+class SegmentStore {
+ public:
+  // Loads the segments in dir, which is created if need be. Appends are
+  // spread over writers active segments by series.
+  SegmentStore(string dir, size_t writers);
+  ~SegmentStore();
+
+  SegmentStore(const SegmentStore& other) = delete;
+  SegmentStore& operator=(const SegmentStore& other) = delete;
+
+  // Starts and stops the compaction thread.
+  void Start();
+  void Stop();
+
+  // The live chunks of series, ordered by time.
+  vector<SegmentChunk> Chunks(uint64_t series);
+
+  // Writes buf as a new chunk of series. It supersedes every chunk of
+  // series it overlaps, whose time ranges it must cover. buf must be sorted.
+  // Nothing is synced, like other flushes the chunk is made durable by the
+  // syncfs() that precedes write ahead log truncation.
+  void Append(uint64_t series, const Datapoint* buf, size_t len);
+
+  // Reads a chunk's datapoints. Throws IOError.
+  std::unique_ptr<vector<Datapoint>> Read(const SegmentChunk& chunk);
+
+  // Bumped whenever compaction moves chunks, after which Chunks() must be
+  // called again.
+  uint64_t Generation() const { return generation; }
+
+ private:
+  const string dir;
+  std::atomic<uint64_t> generation {0};
+  std::atomic<uint64_t> next_sequence {1};
+
+  std::mutex mutex;  // Guards everything below
+  uint64_t next_segment_id = 1;
+  std::map<uint64_t,std::shared_ptr<Segment>> segments;  // Sealed ones
+  vector<std::shared_ptr<Segment>> active;               // One per writer
+  std::unordered_map<uint64_t,vector<SegmentChunk>> chunks;
+
+  std::thread compactor;
+  std::condition_variable wakeup;
+  bool stop = false;
+
+  string SegmentPath(uint64_t id) const;
+  void LoadSegments(const vector<uint64_t>& ids);
+  void LoadSegment(std::shared_ptr<Segment> segment,
+                   const SegmentFooter& footer);
+  void AddChunk(uint64_t series, SegmentChunk chunk);
+  std::shared_ptr<Segment> NewSegment();
+  void Seal(Segment& segment);
+  void WriteChunk(Segment& segment,
+                  const SegmentChunkHeader& header,
+                  const Datapoint* buf);
+  void RunCompactor();
+  bool Compact();
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_SEGMENT_STORE_H
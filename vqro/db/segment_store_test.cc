@@ -0,0 +1,212 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/segment_store.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int64(segment_size);
+DECLARE_int32(segment_compaction_interval);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+vector<Datapoint> MakeDatapoints(int64_t start, size_t count) {
+  vector<Datapoint> points;
+  for (size_t i = 0; i < count; i++)
+    points.emplace_back(start + i * 10, start * 0.5 + i, 10);
+  return points;
+}
+
+
+// Every live datapoint of series, in order.
+vector<Datapoint> ReadSeries(SegmentStore& store, uint64_t series) {
+  vector<Datapoint> points;
+  for (const SegmentChunk& chunk : store.Chunks(series)) {
+    std::unique_ptr<vector<Datapoint>> chunk_points = store.Read(chunk);
+    points.insert(points.end(), chunk_points->begin(), chunk_points->end());
+  }
+  return points;
+}
+
+
+class SegmentStoreTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    FLAGS_segment_size = segment_size;
+    FLAGS_segment_compaction_interval = segment_compaction_interval;
+  }
+
+  const int64_t segment_size = FLAGS_segment_size;
+  const int32_t segment_compaction_interval = FLAGS_segment_compaction_interval;
+};
+
+
+TEST_F(SegmentStoreTest, ChunksSurviveReopening) {
+  string dir = MakeTestDir("segments_reopen");
+  vector<Datapoint> first = MakeDatapoints(100, 5);
+  vector<Datapoint> second = MakeDatapoints(1000, 3);
+  vector<Datapoint> other = MakeDatapoints(100, 7);
+  {
+    SegmentStore store(dir, 2);
+    store.Append(1, first.data(), first.size());
+    store.Append(1, second.data(), second.size());
+    store.Append(2, other.data(), other.size());
+  }
+
+  SegmentStore store(dir, 2);
+  vector<Datapoint> expected = first;
+  expected.insert(expected.end(), second.begin(), second.end());
+  EXPECT_EQ(ReadSeries(store, 1), expected);
+  EXPECT_EQ(ReadSeries(store, 2), other);
+  EXPECT_TRUE(store.Chunks(3).empty());
+}
+
+
+TEST_F(SegmentStoreTest, LaterChunksSupersedeOverlappedOnes) {
+  string dir = MakeTestDir("segments_supersede");
+  vector<Datapoint> old_points = MakeDatapoints(100, 5);
+  vector<Datapoint> untouched = MakeDatapoints(5000, 2);
+  vector<Datapoint> new_points = MakeDatapoints(100, 10);
+  {
+    SegmentStore store(dir, 1);
+    store.Append(1, old_points.data(), old_points.size());
+    store.Append(1, untouched.data(), untouched.size());
+    store.Append(1, new_points.data(), new_points.size());
+
+    vector<SegmentChunk> chunks = store.Chunks(1);
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(chunks[0].count, new_points.size());
+    EXPECT_GT(chunks[0].sequence, chunks[1].sequence);
+  }
+
+  // The superseded chunk is still in the segment, but loses to the later
+  // sequence number however the chunks are loaded.
+  SegmentStore store(dir, 1);
+  vector<Datapoint> expected = new_points;
+  expected.insert(expected.end(), untouched.begin(), untouched.end());
+  EXPECT_EQ(ReadSeries(store, 1), expected);
+
+  // Sequence numbers carry on from the highest loaded.
+  vector<Datapoint> newest = MakeDatapoints(100, 1);
+  store.Append(1, newest.data(), newest.size());
+  vector<SegmentChunk> chunks = store.Chunks(1);
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(chunks[0].count, 1);
+}
+
+
+TEST_F(SegmentStoreTest, TornTailIsTruncated) {
+  string dir = MakeTestDir("segments_torn");
+  string path = dir + "/1.seg";
+  vector<Datapoint> first = MakeDatapoints(100, 5);
+  vector<Datapoint> second = MakeDatapoints(1000, 4);
+
+  // What the unsealed segment held when we "crashed", before the store
+  // sealed it on the way out.
+  std::unique_ptr<vector<char>> unsealed;
+  {
+    SegmentStore store(dir, 1);
+    store.Append(1, first.data(), first.size());
+    store.Append(1, second.data(), second.size());
+    FileHandle file(path, O_RDONLY);
+    unsealed = ReadValues<char>(file, GetFileSize(path), 0);
+  }
+  const off_t chunks_size = unsealed->size();
+  EXPECT_EQ(chunks_size, 2 * sizeof(SegmentChunkHeader) +
+                         (first.size() + second.size()) * datapoint_size);
+
+  // A third chunk torn part way through its datapoints.
+  vector<Datapoint> torn = MakeDatapoints(2000, 4);
+  SegmentChunkHeader header {1, 2000, 2030, 99, 4, 0};
+  unsealed->insert(unsealed->end(),
+                   reinterpret_cast<char*>(&header),
+                   reinterpret_cast<char*>(&header + 1));
+  unsealed->insert(unsealed->end(),
+                   reinterpret_cast<char*>(torn.data()),
+                   reinterpret_cast<char*>(torn.data()) + 30);
+  {
+    FileHandle file(path, O_WRONLY | O_TRUNC);
+    WriteValues<char>(file, unsealed->data(), unsealed->size());
+  }
+
+  vector<Datapoint> expected = first;
+  expected.insert(expected.end(), second.begin(), second.end());
+  {
+    SegmentStore store(dir, 1);
+    EXPECT_EQ(ReadSeries(store, 1), expected);
+
+    // The torn chunk was cut off and an index written after the rest.
+    const off_t sealed_size = chunks_size +
+                              2 * sizeof(SegmentIndexEntry) +
+                              sizeof(SegmentFooter);
+    EXPECT_EQ(GetFileSize(path), sealed_size);
+  }
+
+  // Sealed now, so the index is all that's read.
+  SegmentStore store(dir, 1);
+  EXPECT_EQ(ReadSeries(store, 1), expected);
+}
+
+
+TEST_F(SegmentStoreTest, CompactorKeepsOnlyLiveChunks) {
+  string dir = MakeTestDir("segments_compact");
+  // Room for a few chunks per segment, so rewriting the same range seals
+  // segments that are then mostly superseded.
+  const size_t chunk_datapoints = 10;
+  FLAGS_segment_size = 4 * (sizeof(SegmentChunkHeader) +
+                            chunk_datapoints * datapoint_size);
+  FLAGS_segment_compaction_interval = 1;
+
+  vector<Datapoint> latest[3];
+  {
+    SegmentStore store(dir, 1);
+    for (int round = 0; round < 6; round++) {
+      for (uint64_t series = 0; series < 3; series++) {
+        latest[series] = MakeDatapoints(100 * (series + 1), chunk_datapoints);
+        for (Datapoint& point : latest[series])
+          point.value += round;
+        store.Append(series, latest[series].data(), latest[series].size());
+      }
+    }
+    size_t segment_files = 0;
+    for (uint64_t id = 1; id < 10; id++)
+      segment_files += FileExists(dir + "/" + to_string(id) + ".seg");
+    EXPECT_GE(segment_files, 4);
+
+    store.Start();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (store.Generation() == 0 &&
+           std::chrono::steady_clock::now() < deadline)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    store.Stop();
+    ASSERT_GT(store.Generation(), 0);
+
+    for (uint64_t series = 0; series < 3; series++)
+      EXPECT_EQ(ReadSeries(store, series), latest[series]) << series;
+
+    // The segments compacted away are gone.
+    size_t remaining_files = 0;
+    for (uint64_t id = 1; id < 20; id++)
+      remaining_files += FileExists(dir + "/" + to_string(id) + ".seg");
+    EXPECT_LT(remaining_files, segment_files);
+  }
+
+  // Copies keep their sequence numbers, so nothing older than them comes
+  // back when we reload.
+  SegmentStore store(dir, 1);
+  for (uint64_t series = 0; series < 3; series++)
+    EXPECT_EQ(ReadSeries(store, series), latest[series]) << series;
+}
+
+
+} // namespace
@@ -2,32 +2,90 @@
 #include <memory>
 
 #include "vqro/base/base.h"
+#include "vqro/db/compressed_buffer.h"
 #include "vqro/db/series.h"
 #include "vqro/db/db.h"
-#include "vqro/db/write_op.h"
+#include "vqro/db/write_buffer.h"
+
+
+DEFINE_string(write_buffer_format,
+              "paged",
+              "How series buffer datapoints in memory until they are flushed. "
+              "'paged' stores raw datapoints, 'compressed' stores them "
+              "delta/XOR encoded.");
 
 namespace vqro {
 namespace db {
 
 
 void Series::Init() {
+  if (FLAGS_write_buffer_format == "compressed")
+    write_buffer.reset(new CompressedBuffer());
+  else
+    write_buffer.reset(new WriteBuffer(db->GetAllocator(this)));
+
   string series_dir = HexString<size_t>(keyint);
   series_dir.insert(series_dir.begin() + 4, '/');
 
   data_dir.reset(new DatapointDirectory(
-      this, db->GetDataDirectory() + "datapoints/" + series_dir + "/"));
+      this,
+      db->GetFileCache(this),
+      db->GetDataDirectory() + "datapoints/" + series_dir + "/",
+      db->GetSegmentStore()));
+
+  if (!db->GetRollupWidths().empty())
+    rollups.reset(new Rollups(
+        this,
+        db->GetFileCache(this),
+        data_dir.get(),
+        db->GetDataDirectory() + "rollups/" + series_dir,
+        db->GetRollupWidths()));
 }
 
 
-void Series::Write(vqro::rpc::WriteOperation& op) 
+void Series::Write(vqro::rpc::WriteOperation& op, uint64_t lsn)
 {
-  write_buffer->Append(op);
+  if (lsn && (wal_lsn == 0 || lsn < wal_lsn))
+    wal_lsn = lsn;
+
+  try {
+    write_buffer->Append(op);
+  } catch (...) {
+    CountBuffered();  // Some of it may have been buffered
+    throw;
+  }
+  CountBuffered();
+  if (first_buffered == 0 && !write_buffer->IsEmpty())
+    first_buffered = TimeInMillis();
+}
+
+
+void Series::Write(const vqro::rpc::SeriesColumns& columns, uint64_t lsn)
+{
+  if (lsn && (wal_lsn == 0 || lsn < wal_lsn))
+    wal_lsn = lsn;
+
+  try {
+    write_buffer->Append(columns);
+  } catch (...) {
+    CountBuffered();  // Some of it may have been buffered
+    throw;
+  }
+  CountBuffered();
+  if (first_buffered == 0 && !write_buffer->IsEmpty())
+    first_buffered = TimeInMillis();
 }
 
 
 void Series::Read(ReadOperation& read_op) {
+  // Reads with a step take whatever rollups cover first, then datapoints
+  // newer than the rollups.
+  if (rollups && read_op.step > 0)
+    rollups->Read(read_op);
+
   // First we read any datapoints stored on disk.
-  data_dir->Read(read_op);
+  if (!read_op.Complete() && read_op.SpaceLeft())
+    data_dir->Read(read_op);
 
   // Next we append datapoints from our write_buffer onto the read_op buffer.
   // We only guarantee that the write buffer datapoints are merged into read
@@ -46,6 +104,7 @@ void Series::Read(ReadOperation& read_op) {
         point.timestamp < read_op.end_time)
       read_op.Append(point);
   }
+  write_buffer->ReleaseScratchSpace();
 
   // If we didn't fill the read_op buffer then there is no more work we can
   // do, so we force completion.
@@ -54,21 +113,55 @@ void Series::Read(ReadOperation& read_op) {
 }
 
 
-size_t Series::DatapointsBuffered() {
-  return write_buffer->Size();
+void Series::CountBuffered() {
+  buffered_datapoints = write_buffer->Size();
+  buffered_bytes = write_buffer->AllocatedBytes();
 }
 
 
-void Series::FlushBufferedDatapoints() {
+size_t Series::ExpireBefore(int64_t cutoff, int64_t rollup_cutoff) {
+  size_t expired = data_dir->ExpireBefore(cutoff);
+  if (rollups)
+    expired += rollups->ExpireBefore(rollup_cutoff);
+  return expired;
+}
+
+
+bool Series::IsEmpty() {
+  return write_buffer->IsEmpty() &&
+         data_dir->Empty() &&
+         (!rollups || rollups->Empty());
+}
+
+
+int64_t Series::CompactDirectory() {
+  return db->GetStorageOptimizer()->CompactDirectory(data_dir.get());
+}
+
+
+void Series::WriteBufferedDatapoints() {
+  if (!write_buffer->IsEmpty())
+    write_buffer->WriteTo(*data_dir);
+}
+
+
+void Series::FinishFlush() {
   if (write_buffer->IsEmpty())
     return;
 
-  if (!write_buffer->IsSorted())
-    write_buffer->Sort();
-
-  WriteOperation write_op(write_buffer.get());
-  data_dir->Write(write_op);
   write_buffer->Clear();
+  CountBuffered();
+  wal_lsn = 0;
+  first_buffered = 0;
+
+  if (rollups)
+    rollups->Update();
+}
+
+
+void Series::AbandonFlush() {
+  data_dir->Forget();
+  CountBuffered();
 }
 
 
@@ -1,15 +1,18 @@
 #ifndef VQRO_DB_SERIES_H
 #define VQRO_DB_SERIES_H
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
 #include "vqro/base/base.h"
 #include "vqro/rpc/core.pb.h"
 #include "vqro/rpc/storage.pb.h"
 #include "vqro/db/datapoint_directory.h"
 #include "vqro/db/read_op.h"
+#include "vqro/db/rollups.h"
+#include "vqro/db/series_buffer.h"
 #include "vqro/db/write_op.h"
-#include "vqro/db/write_buffer.h"
 
 
 namespace vqro {
@@ -24,31 +27,88 @@ inline static size_t ComputeHash(const string& s) {
 }
 
 
-class Series {
+// Series are owned by the SeriesRegistry through shared_ptrs. Anything that
+// uses a Series beyond the scope of a lookup, such as work queued on a worker
+// thread, must hold a reference so the series can't be evicted under it.
+class Series : public std::enable_shared_from_this<Series> {
  public:
   Database* const db;
-  std::unique_ptr<WriteBuffer> write_buffer;
+  std::unique_ptr<SeriesBuffer> write_buffer;
   const vqro::rpc::Series proto;
   const string keystr;
   const size_t keyint;
-  bool is_indexed = false;
+  std::atomic<bool> is_indexed {false};
+  std::atomic<bool> index_queued {false};  // Waiting on the indexer thread
+
+  // Row id of the series in the search engine's vqro:series table, or zero
+  // until it has been indexed.
+  std::atomic<int64_t> series_id {0};
+
+  // TimeInMillis() of the last time the series was looked up for a read or
+  // write. Series idle for long enough are evicted from memory.
+  std::atomic<int64_t> last_used {0};
+
+  // LSN of the oldest write ahead log record whose datapoints are still only
+  // in write_buffer, or zero if there is none.
+  std::atomic<uint64_t> wal_lsn {0};
+
+  // TimeInMillis() when the oldest datapoint in write_buffer was written, or
+  // zero if it is empty.
+  std::atomic<int64_t> first_buffered {0};
+
+  // When the FlushScheduler will flush write_buffer. Only the scheduler
+  // changes this.
+  std::atomic<int64_t> flush_deadline {0};
+
+  // write_buffer's size and AllocatedBytes() as of our last write or flush.
+  // Unlike write_buffer itself these may be read from any thread.
+  std::atomic<size_t> buffered_datapoints {0};
+  std::atomic<size_t> buffered_bytes {0};
 
   Series(Database* d, const vqro::rpc::Series& pb, string key) :
     db(d),
-    write_buffer(new WriteBuffer()),
     proto(pb),
     keystr(key),
     keyint(ComputeHash(key)) { Init(); }
 
-  void Write(vqro::rpc::WriteOperation& op);
+  void Touch() { last_used = TimeInMillis(); }
+
+  // Writes, reads and flushes must run on our worker thread. A flush clears
+  // wal_lsn, so one racing a write could let the write ahead log drop the
+  // record of a datapoint that is still only in write_buffer.
+  void Write(vqro::rpc::WriteOperation& op, uint64_t lsn=0);
+  void Write(const vqro::rpc::SeriesColumns& columns, uint64_t lsn=0);
   void Read(ReadOperation& op);
-  size_t DatapointsBuffered();
-  void FlushBufferedDatapoints();
+  size_t DatapointsBuffered() { return buffered_datapoints; }
+  size_t BytesBuffered() { return buffered_bytes; }
+
+  // A flush writes write_buffer out with WriteBufferedDatapoints(), whose
+  // writes may only be queued in an IoBatch. Once they are known to have
+  // landed FinishFlush() empties write_buffer and rolls up what is due,
+  // otherwise AbandonFlush() makes us read our files from disk again and
+  // keeps write_buffer for a retry.
+  void WriteBufferedDatapoints();
+  void FinishFlush();
+  void AbandonFlush();
+  void PrefetchDirectory() { data_dir->Prefetch(); }
+
+  // See StorageOptimizer::CompactDirectory().
+  int64_t CompactDirectory();
+
+  // See DatapointDirectory::ExpireBefore(), our rollups expire before
+  // rollup_cutoff rather than cutoff. Must run on our worker thread.
+  size_t ExpireBefore(int64_t cutoff, int64_t rollup_cutoff);
+
+  // True if we hold no datapoints or rollups in memory or on disk. Must run
+  // on our worker thread.
+  bool IsEmpty();
 
  private:
   void Init();
+  void CountBuffered();
 
   std::unique_ptr<DatapointDirectory> data_dir;
+  std::unique_ptr<Rollups> rollups;  // Null without --rollup_tiers
 };
 
 
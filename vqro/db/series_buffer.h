@@ -0,0 +1,53 @@
+#ifndef VQRO_DB_SERIES_BUFFER_H
+#define VQRO_DB_SERIES_BUFFER_H
+
+#include <cstddef>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/datapoint_buffer.h"
+
+
+DECLARE_string(write_buffer_format);
+
+
+namespace vqro {
+namespace db {
+
+
+class DatapointDirectory;
+
+
+// The interface a Series uses to hold written datapoints until they are
+// flushed to disk. Implementations decide how the datapoints are stored.
+class SeriesBuffer: public DatapointBuffer {
+ public:
+  virtual ~SeriesBuffer() {}
+
+  virtual void Append(vqro::rpc::WriteOperation& op) = 0;
+
+  // columns must already be validated, see Database::Write(WriteBatch).
+  virtual void Append(const vqro::rpc::SeriesColumns& columns) = 0;
+  virtual bool IsEmpty() const = 0;
+  virtual bool IsSorted() const = 0;
+  virtual void Sort() = 0;
+  virtual void Clear() = 0;
+
+  // Sorts the buffer if needed and writes its datapoints to dir. Each
+  // implementation hands dir a WriteOperation over its own concrete type so
+  // the write path is statically dispatched.
+  virtual void WriteTo(DatapointDirectory& dir) = 0;
+
+  // Bytes of memory held by this buffer.
+  virtual size_t AllocatedBytes() const = 0;
+
+  // Called when the buffer won't be iterated again for a while. Buffers that
+  // keep scratch space for iteration can release it here.
+  virtual void ReleaseScratchSpace() {}
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_SERIES_BUFFER_H
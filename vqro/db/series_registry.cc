@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+#include "vqro/base/base.h"
+#include "vqro/db/series.h"
+#include "vqro/db/series_registry.h"
+
+
+DEFINE_int32(series_registry_shards,
+             256,
+             "Number of independently locked shards the series registry is "
+             "split into.");
+
+
+namespace vqro {
+namespace db {
+
+
+using SharedLock = std::shared_lock<std::shared_timed_mutex>;
+using UniqueLock = std::unique_lock<std::shared_timed_mutex>;
+
+
+SeriesRegistry::SeriesRegistry(size_t num_shards) {
+  num_shards = std::max(num_shards, static_cast<size_t>(1));
+  for (size_t i = 0; i < num_shards; i++)
+    shards.emplace_back(new Shard());
+}
+
+
+std::shared_ptr<Series> SeriesRegistry::Find(const string& key) {
+  Shard& shard = ShardForKey(ComputeHash(key));
+  SharedLock lock(shard.mutex);
+  auto it = shard.by_key.find(key);
+  return (it == shard.by_key.end()) ? nullptr : it->second;
+}
+
+
+std::shared_ptr<Series> SeriesRegistry::FindById(int64_t series_id) {
+  Shard& shard = ShardForId(series_id);
+  SharedLock lock(shard.mutex);
+  auto it = shard.by_id.find(series_id);
+  return (it == shard.by_id.end()) ? nullptr : it->second;
+}
+
+
+std::shared_ptr<Series> SeriesRegistry::FindOrCreate(
+    const string& key,
+    const SeriesFactory& create)
+{
+  Shard& shard = ShardForKey(ComputeHash(key));
+  {
+    SharedLock lock(shard.mutex);
+    auto it = shard.by_key.find(key);
+    if (it != shard.by_key.end())
+      return it->second;
+  }
+
+  // Construction stays out from under the lock. Someone may have beaten us
+  // to it meanwhile, in which case theirs wins and ours is dropped.
+  std::shared_ptr<Series> created(create());
+  UniqueLock lock(shard.mutex);
+  return shard.by_key.emplace(key, std::move(created)).first->second;
+}
+
+
+void SeriesRegistry::AddId(Series* series) {
+  std::shared_ptr<Series> owner = Find(series->keystr);
+  if (owner.get() != series)
+    return;  // Erased
+
+  Shard& shard = ShardForId(series->series_id);
+  UniqueLock lock(shard.mutex);
+  shard.by_id[series->series_id] = owner;
+}
+
+
+std::shared_ptr<Series> SeriesRegistry::RemoveId(int64_t series_id) {
+  Shard& shard = ShardForId(series_id);
+  UniqueLock lock(shard.mutex);
+  auto it = shard.by_id.find(series_id);
+  if (it == shard.by_id.end())
+    return nullptr;
+  std::shared_ptr<Series> series = std::move(it->second);
+  shard.by_id.erase(it);
+  return series;
+}
+
+
+bool SeriesRegistry::EraseIfUnused(
+    const std::shared_ptr<Series>& series,
+    const std::function<bool(Series&)>& can_erase)
+{
+  Shard& key_shard = ShardForKey(series->keyint);
+  Shard& id_shard = series->series_id ?
+      ShardForId(series->series_id) : key_shard;
+
+  // Lock both shards, always in the same order so two erasers can't deadlock.
+  Shard* first = std::min(&key_shard, &id_shard);
+  Shard* second = std::max(&key_shard, &id_shard);
+  UniqueLock first_lock(first->mutex);
+  UniqueLock second_lock;
+  if (second != first)
+    second_lock = UniqueLock(second->mutex);
+
+  auto key_it = key_shard.by_key.find(series->keystr);
+  if (key_it == key_shard.by_key.end() || key_it->second != series)
+    return false;
+
+  auto id_it = id_shard.by_id.find(series->series_id);
+  bool has_id = id_it != id_shard.by_id.end() && id_it->second == series;
+
+  // With the shards locked nobody can take a new reference from us, so if
+  // the only references left are ours and the caller's nobody else is using
+  // the series. The fence pairs with the release of the last other reference
+  // so that can_erase sees everything its holder did to the series.
+  long our_refs = has_id ? 3 : 2;
+  if (series.use_count() != our_refs)
+    return false;
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  if (!can_erase(*series))
+    return false;
+
+  key_shard.by_key.erase(key_it);
+  if (has_id)
+    id_shard.by_id.erase(id_it);
+  return true;
+}
+
+
+void SeriesRegistry::AppendShard(size_t shard_num,
+                                 vector<std::shared_ptr<Series>>& out)
+{
+  Shard& shard = *shards[shard_num];
+  SharedLock lock(shard.mutex);
+  out.reserve(out.size() + shard.by_key.size());
+  for (auto& it : shard.by_key)
+    out.push_back(it.second);
+}
+
+
+size_t SeriesRegistry::Size() {
+  size_t size = 0;
+  for (auto& shard : shards) {
+    SharedLock lock(shard->mutex);
+    size += shard->by_key.size();
+  }
+  return size;
+}
+
+
+} // namespace db
+} // namespace vqro
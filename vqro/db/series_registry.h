@@ -0,0 +1,93 @@
+#ifndef VQRO_DB_SERIES_REGISTRY_H
+#define VQRO_DB_SERIES_REGISTRY_H
+
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "vqro/base/base.h"
+#include "vqro/db/series.h"
+
+
+DECLARE_int32(series_registry_shards);
+
+
+namespace vqro {
+namespace db {
+
+
+// The registry owns every live Series, indexed by key and (once indexed by
+// the search engine) by series_id. It is split into shards, each behind its
+// own reader/writer lock, so lookups of existing series only ever take a
+// shared lock on one shard and never contend with each other.
+//
+// Entries are held by shared_ptr, and a series is only ever erased while no
+// one outside the registry holds a reference to it, so nothing can be left
+// using a series that has been replaced by a newer one of the same key.
+class SeriesRegistry {
+ public:
+  using SeriesFactory = std::function<Series*()>;
+
+  explicit SeriesRegistry(size_t num_shards);
+
+  SeriesRegistry(const SeriesRegistry& other) = delete;
+  SeriesRegistry& operator=(const SeriesRegistry& other) = delete;
+
+  // Returns nullptr if there is no series with this key or series_id.
+  std::shared_ptr<Series> Find(const string& key);
+  std::shared_ptr<Series> FindById(int64_t series_id);
+
+  // Returns the series with this key, calling create to make it if there is
+  // none. create is called without the shard locked, so racing callers may
+  // each make one, of which all but the registered one are dropped. If
+  // create throws nothing is registered.
+  std::shared_ptr<Series> FindOrCreate(const string& key,
+                                       const SeriesFactory& create);
+
+  // Makes an indexed series findable by its series_id.
+  void AddId(Series* series);
+
+  // Makes the series with this series_id unfindable by it, returning it or
+  // nullptr if there was none.
+  std::shared_ptr<Series> RemoveId(int64_t series_id);
+
+  // Removes series from the registry if series is the only reference to it
+  // outside the registry and can_erase(series) returns true. can_erase is
+  // called with the series' shards locked, so no new references can be taken
+  // while it runs.
+  bool EraseIfUnused(const std::shared_ptr<Series>& series,
+                     const std::function<bool(Series&)>& can_erase);
+
+  // For incremental iteration, one shard at a time. Appends the shard's
+  // series to out, holding the shard's lock only while copying.
+  size_t NumShards() const { return shards.size(); }
+  void AppendShard(size_t shard, vector<std::shared_ptr<Series>>& out);
+
+  size_t Size();
+
+ private:
+  struct Shard {
+    std::shared_timed_mutex mutex;
+    std::unordered_map<string,std::shared_ptr<Series>> by_key;
+    std::unordered_map<int64_t,std::shared_ptr<Series>> by_id;
+  };
+
+  vector<std::unique_ptr<Shard>> shards;
+
+  // Takes the key's hash, ie. Series::keyint.
+  Shard& ShardForKey(size_t keyint) {
+    return *shards[keyint % shards.size()];
+  }
+
+  Shard& ShardForId(int64_t series_id) {
+    return *shards[static_cast<uint64_t>(series_id) % shards.size()];
+  }
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_SERIES_REGISTRY_H
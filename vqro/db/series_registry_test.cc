@@ -0,0 +1,110 @@
+#include <stdexcept>
+
+#include "vqro/base/base.h"
+#include "vqro/db/series.h"
+#include "vqro/db/series_registry.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+class SeriesRegistryTest : public DatabaseTest {
+ protected:
+  // Makes the series named name, counting how many were made.
+  SeriesRegistry::SeriesFactory Factory(const string& name) {
+    return [this, name] {
+      created++;
+      vqro::rpc::Series proto;
+      (*proto.mutable_labels())["name"] = name;
+      return new Series(db.get(), proto, name);
+    };
+  }
+
+  std::function<bool(Series&)> always = [] (Series&) { return true; };
+
+  SeriesRegistry registry {4};
+  int created = 0;
+};
+
+
+TEST_F(SeriesRegistryTest, FindOrCreateMakesEachSeriesOnce) {
+  EXPECT_EQ(registry.Find("a"), nullptr);
+
+  std::shared_ptr<Series> a = registry.FindOrCreate("a", Factory("a"));
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(a->keystr, "a");
+  EXPECT_EQ(registry.FindOrCreate("a", Factory("a")), a);
+  EXPECT_EQ(registry.Find("a"), a);
+  EXPECT_EQ(created, 1);
+
+  std::shared_ptr<Series> b = registry.FindOrCreate("b", Factory("b"));
+  EXPECT_NE(b, a);
+  EXPECT_EQ(created, 2);
+  EXPECT_EQ(registry.Size(), 2);
+}
+
+
+TEST_F(SeriesRegistryTest, FailedCreateRegistersNothing) {
+  auto fail = [] () -> Series* { throw std::runtime_error("no series"); };
+  EXPECT_THROW(registry.FindOrCreate("a", fail), std::runtime_error);
+  EXPECT_EQ(registry.Find("a"), nullptr);
+  EXPECT_EQ(registry.Size(), 0);
+
+  EXPECT_NE(registry.FindOrCreate("a", Factory("a")), nullptr);
+  EXPECT_EQ(registry.Size(), 1);
+}
+
+
+TEST_F(SeriesRegistryTest, EraseIfUnusedOnlyErasesUnreferencedSeries) {
+  std::shared_ptr<Series> series = registry.FindOrCreate("a", Factory("a"));
+
+  // Someone else still holds it.
+  std::shared_ptr<Series> holder = registry.Find("a");
+  EXPECT_FALSE(registry.EraseIfUnused(series, always));
+  holder.reset();
+
+  // can_erase gets the last word.
+  EXPECT_FALSE(registry.EraseIfUnused(series, [] (Series&) { return false; }));
+  EXPECT_EQ(registry.Find("a"), series);
+
+  EXPECT_TRUE(registry.EraseIfUnused(series, always));
+  EXPECT_EQ(registry.Find("a"), nullptr);
+  EXPECT_EQ(registry.Size(), 0);
+
+  // Erasing again is a no-op, and a new series takes the key.
+  EXPECT_FALSE(registry.EraseIfUnused(series, always));
+  EXPECT_NE(registry.FindOrCreate("a", Factory("a")), series);
+  EXPECT_EQ(created, 2);
+}
+
+
+TEST_F(SeriesRegistryTest, IdsCountAsTheRegistrysReferences) {
+  std::shared_ptr<Series> series = registry.FindOrCreate("a", Factory("a"));
+  series->series_id = 7;
+  registry.AddId(series.get());
+  EXPECT_EQ(registry.FindById(7), series);
+
+  EXPECT_TRUE(registry.EraseIfUnused(series, always));
+  EXPECT_EQ(registry.FindById(7), nullptr);
+
+  // An erased series doesn't come back by its id.
+  registry.AddId(series.get());
+  EXPECT_EQ(registry.FindById(7), nullptr);
+
+  // RemoveId hands back the registry's reference.
+  std::shared_ptr<Series> other = registry.FindOrCreate("b", Factory("b"));
+  other->series_id = 8;
+  registry.AddId(other.get());
+  EXPECT_EQ(registry.RemoveId(8), other);
+  EXPECT_EQ(registry.FindById(8), nullptr);
+  EXPECT_EQ(registry.RemoveId(8), nullptr);
+  EXPECT_TRUE(registry.EraseIfUnused(other, always));
+}
+
+
+} // namespace
@@ -1,6 +1,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <zlib.h>
 
 #include <algorithm>
 #include <cstring>
@@ -20,6 +21,20 @@ DEFINE_int32(sparse_file_optimize_size,
              1 << 12,  // 4kb fits 170 datapoints
              "When a sparse file reaches this size in bytes, it may be "
              "converted to a more optimal storage format.");
+DEFINE_int64(sparse_file_compress_size,
+             1 << 18,  // 256kb fits ~11k datapoints
+             "When a sparse file that wasn't converted to a better format "
+             "reaches this size in bytes, it is sealed, which compresses it "
+             "unless --sealed_sparse_format says otherwise. Zero means files "
+             "are only sealed once they reach --sparse_file_max_size.");
+DEFINE_string(sealed_sparse_format,
+              "compressed",
+              "What sealed sparse files become. 'compressed' converts them to "
+              "compressed files, 'sorted' keeps raw datapoints but sorted, "
+              "deduplicated and block indexed.");
+DEFINE_int32(sparse_index_block_datapoints,
+             256,
+             "Datapoints per index entry of a sealed sparse file.");
 DEFINE_int64(sparse_file_max_size,
              1 << 22,  // 4MB fits ~175k datapoints
              "Maximum allowable size in bytes for a sparse file.");
@@ -29,21 +44,35 @@ namespace vqro {
 namespace db {
 
 
-string SparseFile::GetPath() const {
-  return (dir->path + "/" +
-          to_string(min_timestamp) + "-" + to_string(max_timestamp) +
-          (optimized ? SPARSE_OPT_SUFFIX : ""));
+// Identifies a SparseIndexFooter.
+static constexpr uint64_t sparse_index_magic = 0x7671726f73696478;  // "vqrosidx"
+
+
+string SparseFile::Filename() const {
+  return (to_string(min_timestamp) + "-" + to_string(max_timestamp) +
+          (sealed ? SPARSE_SEALED_SUFFIX : optimized ? SPARSE_OPT_SUFFIX : ""));
+}
+
+
+ManifestEntry SparseFile::Describe() const {
+  ManifestEntry entry = DescribeAs(FileFormat::SPARSE);
+  if (optimized) entry.flags |= FILE_OPTIMIZED;
+  if (sealed) entry.flags |= FILE_SEALED;
+  entry.count = sealed ? sealed_count : size / datapoint_size;
+  return entry;
 }
 
 
 std::unique_ptr<DatapointFile> SparseFile::FromFilename(
     DatapointDirectory* dir,
     char* filename) {
-  // sparse filename format is "<min_timestamp>-<max_timestamp>(.opt)?"
+  // sparse filename format is "<min_timestamp>-<max_timestamp>(.opt|.sealed)?"
+  const string name = filename;
   char* endptr;
   int64_t min;
   int64_t max;
   bool opt = false;
+  bool seal = false;
 
   min = strtoll(filename, &endptr, 10);
   if (endptr == filename || *endptr != '-')
@@ -57,49 +86,84 @@ std::unique_ptr<DatapointFile> SparseFile::FromFilename(
   if (strncmp(endptr, SPARSE_OPT_SUFFIX, SPARSE_OPT_SUFFIX_LEN) == 0) {
     opt = true;
     endptr += SPARSE_OPT_SUFFIX_LEN;
+  } else if (strncmp(endptr, SPARSE_SEALED_SUFFIX, SPARSE_SEALED_SUFFIX_LEN) == 0) {
+    opt = true;
+    seal = true;
+    endptr += SPARSE_SEALED_SUFFIX_LEN;
   }
 
   if (*endptr != '\0')
     return nullptr;
 
-  return std::unique_ptr<DatapointFile>(
-    static_cast<DatapointFile*>(new SparseFile(dir, min, max, opt))
-  );
+  SparseFile* file = new SparseFile(dir, min, max, opt, seal);
+  file->filename = name;
+  return std::unique_ptr<DatapointFile>(static_cast<DatapointFile*>(file));
 }
 
 
 void SparseFile::Read(ReadOperation& read_op) const
 {
+  if (sealed) {
+    ReadSealed(read_op);
+    return;
+  }
+
   // We read the entire file into memory (up to our safety limit).
-  LOG(INFO) << "SparseFile::Read() opening file " << GetPath();
-  FileHandle file(GetPath(), O_RDONLY);
-  if (file.fd == -1)
-    throw IOErrorFromErrno("SparseFile::Read open() failed");
+  LOG(INFO) << "SparseFile::Read() reading file " << GetPath();
+  off_t file_size;
+  std::shared_ptr<MappedFile> mapping;
+  std::shared_ptr<FileHandle> file;
+  if (FLAGS_mmap_reads)
+    mapping = dir->file_cache->Map(GetPath(), file_size, MADV_SEQUENTIAL);
+  else
+    file = dir->file_cache->Open(GetPath(), file_size);
 
-  int64_t file_size = GetFileSize(file.path);
   if (file_size > FLAGS_sparse_file_max_size) {
     LOG(ERROR) << "SparseFile::Read oversized file, ignoring some datapoints. "
-               << "file=" << file.path;
+               << "file=" << GetPath();
+  }
+  int num_points = std::min<int64_t>(file_size, FLAGS_sparse_file_max_size) / datapoint_size;
+
+  std::unique_ptr<vector<Datapoint>> datapoints;
+  if (mapping) {
+    // Each write appends a sorted run of datapoints, so unless they were
+    // written out of order we can read straight from the mapped pages.
+    const Datapoint* begin = reinterpret_cast<const Datapoint*>(mapping->data);
+    const Datapoint* end = begin + num_points;
+    if (std::is_sorted(begin, end)) {
+      ReadSorted(read_op, begin, end);
+      return;
+    }
+    datapoints.reset(new vector<Datapoint>(begin, end));
+  } else {
+    datapoints = ReadValues<Datapoint>(*file, num_points, 0);
   }
-  int num_points = std::min(file_size, FLAGS_sparse_file_max_size) / datapoint_size;
-  std::unique_ptr<vector<Datapoint>> datapoints =
-      ReadValues<Datapoint>(file, num_points);
 
   // Datapoint ordering is based on timestamp only, duration is ignored. Thus
   // doing a stable_sort will preserve the order in which different datapoints
   // with the same timestamp were written in, so we can use the latest one.
   std::stable_sort(datapoints->begin(), datapoints->end());
+  ReadSorted(read_op,
+             datapoints->data(),
+             datapoints->data() + datapoints->size());
+}
 
+
+// Datapoints with the same timestamp must be in the order they were written.
+void SparseFile::ReadSorted(ReadOperation& read_op,
+                            const Datapoint* begin,
+                            const Datapoint* end)
+{
   // Search for the first datapoint with timestamp >= read_start
   Datapoint search_point = Datapoint(read_op.next_time, 0.0, 0);
-  auto it = std::lower_bound(datapoints->begin(), datapoints->end(), search_point);
+  auto it = std::lower_bound(begin, end, search_point);
   auto original = it;  // Track starting point of lookahead
   auto next = it;      // Next datapoint with a greater timestamp
 
   // Copy point by point into the buffer until we're at the end. This is trivial
   // except for complexity incurred in filtering out multiple datapoints with
   // the same timestamp. Such is the cost of an efficient append-only write path.
-  while (it != datapoints->end() &&
+  while (it != end &&
          it->timestamp >= read_op.next_time &&
          it->timestamp < read_op.end_time &&
          read_op.SpaceLeft() &&
@@ -110,7 +174,7 @@ void SparseFile::Read(ReadOperation& read_op) const
     // that has the originally-written duration for that timestamp.
     original = it;
     next = it + 1;
-    while (next != datapoints->end() &&
+    while (next != end &&
            next->timestamp == original->timestamp)
       next++;
 
@@ -128,51 +192,231 @@ void SparseFile::Read(ReadOperation& read_op) const
 }
 
 
-size_t SparseFile::Write(const WriteOperation& write_op) {
-  // Find the max_timestamp we'll be writing
-  int64_t buffer_max_timestamp = max_timestamp;
-  for (auto it : write_op) {
-    if (it.timestamp > buffer_max_timestamp) {
-      buffer_max_timestamp = std::min(it.timestamp,
-                                      write_op.max_writable_timestamp);
-    }
+static uint32_t Checksum(uint32_t crc, const Iovec* iov, size_t iov_count) {
+  for (size_t i = 0; i < iov_count; i++)
+    crc = crc32(crc, static_cast<const Bytef*>(iov[i].iov_base), iov[i].iov_len);
+  return crc;
+}
+
+
+// Returns len bytes of the file at offset, straight from mapping if there is
+// one, otherwise read into scratch. len must be a multiple of 8 bytes.
+static const char* FileRange(const MappedFile* mapping,
+                             const FileHandle* file,
+                             off_t offset,
+                             size_t len,
+                             std::unique_ptr<vector<uint64_t>>& scratch)
+{
+  if (mapping)
+    return mapping->data + offset;
+
+  scratch = ReadValues<uint64_t>(*file, len / sizeof(uint64_t), offset);
+  if (scratch->size() * sizeof(uint64_t) < len)
+    throw IOError("SparseFile short read path=" + file->path);
+  return reinterpret_cast<const char*>(scratch->data());
+}
+
+
+void SparseFile::ReadSealed(ReadOperation& read_op) const {
+  off_t file_size;
+  std::shared_ptr<MappedFile> mapping;
+  std::shared_ptr<FileHandle> file;
+  if (FLAGS_mmap_reads)
+    mapping = dir->file_cache->Map(GetPath(), file_size, MADV_RANDOM);
+  else
+    file = dir->file_cache->Open(GetPath(), file_size);
+
+  std::unique_ptr<vector<uint64_t>> footer_scratch;
+  std::unique_ptr<vector<uint64_t>> index_scratch;
+  std::unique_ptr<vector<uint64_t>> datapoints_scratch;
+
+  if (file_size < static_cast<off_t>(sizeof(SparseIndexFooter))) {
+    LOG(ERROR) << "SparseFile::ReadSealed truncated file=" << GetPath();
+    return;
+  }
+  SparseIndexFooter footer;
+  memcpy(&footer,
+         FileRange(mapping.get(), file.get(),
+                   file_size - sizeof(SparseIndexFooter),
+                   sizeof(SparseIndexFooter),
+                   footer_scratch),
+         sizeof(SparseIndexFooter));
+
+  off_t index_offset = footer.datapoint_count * datapoint_size;
+  if (footer.magic != sparse_index_magic ||
+      footer.block_datapoints == 0 ||
+      index_offset + footer.block_count * sizeof(int64_t) +
+          sizeof(SparseIndexFooter) != static_cast<uint64_t>(file_size)) {
+    LOG(ERROR) << "SparseFile::ReadSealed corrupt footer file=" << GetPath();
+    return;
   }
+  if (!footer.datapoint_count)
+    return;
+
+  const int64_t* index = reinterpret_cast<const int64_t*>(
+      FileRange(mapping.get(), file.get(),
+                index_offset,
+                footer.block_count * sizeof(int64_t),
+                index_scratch));
+  const int64_t* index_end = index + footer.block_count;
+
+  // The blocks overlapping [next_time, end_time), but no more than the read
+  // buffer can take.
+  size_t first_block = std::upper_bound(index, index_end, read_op.next_time) - index;
+  if (first_block) first_block--;
+  size_t end_block = std::lower_bound(index, index_end, read_op.end_time) - index;
+  if (end_block <= first_block)
+    return;
+
+  size_t first = first_block * footer.block_datapoints;
+  size_t count = std::min<size_t>(
+      std::min<size_t>(end_block * footer.block_datapoints, footer.datapoint_count) - first,
+      read_op.SpaceLeft() + footer.block_datapoints);
+
+  const Datapoint* begin = reinterpret_cast<const Datapoint*>(
+      FileRange(mapping.get(), file.get(),
+                first * datapoint_size,
+                count * datapoint_size,
+                datapoints_scratch));
+  const Datapoint* end = begin + count;
 
-  FileHandle file(GetPath(),
-                  O_WRONLY|O_CREAT|O_APPEND,
-                  FLAGS_datapoint_file_mode);
-  if (file.fd == -1)
-    throw IOErrorFromErrno("SparseFile::Write open() failed");
+  Datapoint search_point = Datapoint(read_op.next_time, 0.0, 0);
+  for (auto it = std::lower_bound(begin, end, search_point);
+       it != end &&
+       it->timestamp < read_op.end_time &&
+       read_op.SpaceLeft();
+       it++)
+    read_op.Append(*it);
+}
+
+
+void SparseFile::WriteSealed(const Datapoint* buf, size_t len) {
+  const size_t block_datapoints = std::max(FLAGS_sparse_index_block_datapoints, 1);
+  vector<int64_t> index;
+  for (size_t i = 0; i < len; i += block_datapoints)
+    index.push_back(buf[i].timestamp);
+
+  SparseIndexFooter footer {
+    len,
+    static_cast<uint32_t>(block_datapoints),
+    static_cast<uint32_t>(index.size()),
+    sparse_index_magic
+  };
+
+  Iovec iov[3];
+  iov[0].iov_base = const_cast<Datapoint*>(buf);
+  iov[0].iov_len = len * datapoint_size;
+  iov[1].iov_base = index.data();
+  iov[1].iov_len = index.size() * sizeof(int64_t);
+  iov[2].iov_base = &footer;
+  iov[2].iov_len = sizeof(footer);
+
+  // Written and synced under a temporary name first so a crash can't leave a
+  // partial file for ReadFilenames() to find.
+  string tmp_path = GetPath() + ".tmp";
+  {
+    FileHandle file(tmp_path,
+                    O_WRONLY|O_CREAT|O_TRUNC,
+                    FLAGS_datapoint_file_mode);
+    if (file.fd == -1)
+      throw IOErrorFromErrno("SparseFile::WriteSealed open() failed");
+    WriteVector(file, iov, 3);
+    SyncFile(file);
+  }
+  if (rename(tmp_path.c_str(), GetPath().c_str()) == -1)
+    throw IOErrorFromErrno("SparseFile::WriteSealed rename() failed");
+  dir->file_cache->Invalidate(GetPath());
+
+  sealed_count = len;
+  size = iov[0].iov_len + iov[1].iov_len + iov[2].iov_len;
+  checksum = Checksum(0, iov, 3);
+  checksummed = true;
+  dir->FileChanged(*this);
+}
+
+
+template <typename Buffer>
+size_t SparseFile::WriteDatapoints(const WriteOperation<Buffer>& write_op) {
+  if (sealed)
+    return 0;
 
   size_t iov_count = 0;
   size_t writable_datapoints = 0;
   auto iov = write_op.GetIOVector(iov_count, writable_datapoints);
-  if (writable_datapoints)
-    WriteVector(file, iov.get(), iov_count);
+  if (!writable_datapoints)
+    return 0;
+
+  // The buffer is sorted, so the last datapoint we write has the greatest
+  // timestamp.
+  int64_t buffer_max_timestamp = std::max(
+      max_timestamp,
+      write_op.At(writable_datapoints - 1).timestamp);
+
+  off_t file_size;
+  std::shared_ptr<FileHandle> file = dir->file_cache->Open(
+      GetPath(), file_size, true, FLAGS_datapoint_file_mode);
+
+  // Appending at the size we know of, the descriptor is shared.
+  off_t write_size = 0;
+  for (size_t i = 0; i < iov_count; i++)
+    write_size += iov[i].iov_len;
+  QueueWrite(file, iov.get(), iov_count, file_size);
+
+  // Our checksum can only be extended if it covers everything before what
+  // we just appended.
+  if (file_size == 0) {
+    size = 0;
+    checksum = 0;
+    checksummed = true;
+  }
+  if (checksummed && file_size == size)
+    checksum = Checksum(checksum, iov.get(), iov_count);
+  else
+    checksummed = false;
+
+  file_size += write_size;
+  size = file_size;
+  dir->file_cache->SetSize(file->path, file_size);
+
+  max_timestamp = buffer_max_timestamp;
+  bool too_big = !optimized && file_size > FLAGS_sparse_file_optimize_size;
+  if (too_big)
+    optimized = true;
+  dir->FileChanged(*this);
+
+  if (too_big) {
+    FileIsTooBig();
+  } else if (optimized) {
+    // Only the write that crosses a threshold queues the file.
+    auto crossed = [&] (int64_t threshold) {
+      return file_size >= threshold && file_size - write_size < threshold;
+    };
+    if ((FLAGS_sparse_file_compress_size > 0 &&
+         crossed(FLAGS_sparse_file_compress_size)) ||
+        crossed(FLAGS_sparse_file_max_size - datapoint_size + 1))
+      dir->series->db->GetStorageOptimizer()->SparseFileSealed(this);
+  }
 
-  // If we've increased our max_timestamp we have to rename the file.
-  if (buffer_max_timestamp > max_timestamp) {
-    max_timestamp = buffer_max_timestamp;
+  return writable_datapoints;
+}
 
-    string new_path = GetPath();
-    LOG(INFO) << "SparseFile::Write() renaming " << file.path
-              << " to " << new_path;
-    if (rename(file.path.c_str(), new_path.c_str()) == -1)
-      throw IOErrorFromErrno("SparseFile::Write rename() failed");
 
-    file.path = new_path;
-  }
+size_t SparseFile::Write(const WriteOperation<WriteBuffer>& write_op) {
+  return WriteDatapoints(write_op);
+}
 
-  if (!optimized &&
-      GetFileSize(file.path) > FLAGS_sparse_file_optimize_size)
-      FileIsTooBig();
 
-  return writable_datapoints;
+size_t SparseFile::Write(const WriteOperation<RawBuffer>& write_op) {
+  return WriteDatapoints(write_op);
 }
 
 
 size_t SparseFile::RemainingWritableDatapoints() const {
-  off_t filesize = GetFileSize(GetPath());
+  if (sealed)
+    return 0;
+
+  off_t filesize;
+  dir->file_cache->Open(GetPath(), filesize);
   if (filesize < FLAGS_sparse_file_max_size)
     return (FLAGS_sparse_file_max_size - filesize) / datapoint_size;
   return 0;
@@ -182,10 +426,6 @@ size_t SparseFile::RemainingWritableDatapoints() const {
 void SparseFile::FileIsTooBig() {
   LOG(INFO) << "SparseFile too big, queueing for optimization. file=" << GetPath();
   dir->series->db->GetStorageOptimizer()->SparseFileTooBig(this);
-  string old_path = GetPath();
-  optimized = true;
-  if (rename(old_path.c_str(), GetPath().c_str()) == -1)
-    throw IOErrorFromErrno("SparseFile::FileIsTooBig rename() failed");
 }
 
 
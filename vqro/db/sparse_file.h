@@ -12,6 +12,8 @@
 
 
 DECLARE_int64(sparse_file_max_size);
+DECLARE_string(sealed_sparse_format);
+DECLARE_int32(sparse_index_block_datapoints);
 
 
 namespace vqro {
@@ -22,28 +24,76 @@ class DatapointDirectory;
 
 // Filename suffix for optimized sparse files.
 constexpr const char* SPARSE_OPT_SUFFIX = ".opt";
-constexpr int SPARSE_OPT_SUFFIX_LEN = sizeof(SPARSE_OPT_SUFFIX);
+constexpr int SPARSE_OPT_SUFFIX_LEN = 4;
 
+// Filename suffix for sealed sparse files.
+constexpr const char* SPARSE_SEALED_SUFFIX = ".sealed";
+constexpr int SPARSE_SEALED_SUFFIX_LEN = 7;
 
+
+// Ends a sealed sparse file. Sealed files hold sorted datapoints with unique
+// timestamps, then the timestamp of the first datapoint of every block of
+// block_datapoints, then this footer.
+struct SparseIndexFooter {
+  uint64_t datapoint_count;
+  uint32_t block_datapoints;
+  uint32_t block_count;
+  uint64_t magic;
+};
+static_assert(sizeof(SparseIndexFooter) == 24,
+              "SparseIndexFooter must have no padding");
+
+
+// Sparse files are appended to in whatever order datapoints are flushed, so
+// reads generally have to sort them. Once a sparse file is full, or has grown
+// past --sparse_file_compress_size without qualifying for a better format, the
+// StorageOptimizer seals it: it is either compressed or, with
+// --sealed_sparse_format=sorted, rewritten sorted and deduplicated with a
+// block index in its footer. Reads of sealed files only touch the blocks
+// overlapping their range. Sealed files are never appended to.
 class SparseFile: public DatapointFile {
  public:
   SparseFile() = default;
-  SparseFile(DatapointDirectory* _dir, int64_t _min, int64_t _max, bool opt=false) :
-    DatapointFile(_dir, _min, _max), optimized(opt) {}
+  SparseFile(DatapointDirectory* _dir,
+             int64_t _min,
+             int64_t _max,
+             bool opt=false,
+             bool seal=false) :
+    DatapointFile(_dir, _min, _max), optimized(opt), sealed(seal) {
+      filename = Filename();
+    }
 
   static std::unique_ptr<DatapointFile> FromFilename(
       DatapointDirectory* dir,
       char* filename);
 
-  string GetPath() const;
+  string Filename() const;
+  ManifestEntry Describe() const;
   void Read(ReadOperation& read_op) const;
-  size_t Write(const WriteOperation& write_op);
+  size_t Write(const WriteOperation<WriteBuffer>& write_op);
+  size_t Write(const WriteOperation<RawBuffer>& write_op);
   size_t RemainingWritableDatapoints() const;
 
+  // Writes a new sealed file. buf must be sorted with unique timestamps.
+  void WriteSealed(const Datapoint* buf, size_t len);
+
+  // Reads sorted datapoints into read_op. Of datapoints with the same
+  // timestamp, which must be in the order they were written, the latest with
+  // the first one's duration wins.
+  static void ReadSorted(ReadOperation& read_op,
+                         const Datapoint* begin,
+                         const Datapoint* end);
+
  private:
+  template <typename Buffer>
+  size_t WriteDatapoints(const WriteOperation<Buffer>& write_op);
+
   bool optimized = false;
+  bool sealed = false;
+  int64_t sealed_count = 0;  // Set by WriteSealed()
 
   void FileIsTooBig();
+  void ReadSealed(ReadOperation& read_op) const;
 };
 
 
@@ -0,0 +1,139 @@
+#include <unistd.h>
+
+#include <cstring>
+
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/sparse_file.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+// Reads [start, end) from file into a buffer of buffer_size datapoints at a
+// time, resuming until the read is done.
+vector<Datapoint> ReadRange(const DatapointFile& file,
+                            int64_t start,
+                            int64_t end,
+                            size_t buffer_size) {
+  vector<Datapoint> buffer(buffer_size);
+  ReadOperation read_op(start, end, -1, false, buffer.data(), buffer_size);
+  vector<Datapoint> read;
+  do {
+    read_op.ClearBuffer();
+    file.Read(read_op);
+    read.insert(read.end(), read_op.buffer, read_op.cursor);
+  } while (!read_op.SpaceLeft() && !read_op.Complete());
+  return read;
+}
+
+
+class SealedSparseFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_sparse_index_block_datapoints = 8;
+    for (int64_t i = 0; i < 100; i++)
+      points.emplace_back(1000 + i * 10 + (i % 3), i * 1.5, 1);
+  }
+
+  void TearDown() override {
+    FLAGS_mmap_reads = true;
+  }
+
+  vector<Datapoint> points;
+};
+
+
+TEST_F(SealedSparseFileTest, WritesDatapointsIndexAndFooter) {
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache, MakeTestDir("sealed_layout"));
+  SparseFile file(&dir, points.front().timestamp, points.back().timestamp,
+                  true, true);
+  file.WriteSealed(points.data(), points.size());
+  EXPECT_EQ(file.Describe().count, points.size());
+  EXPECT_EQ(file.Describe().flags & FILE_SEALED, FILE_SEALED);
+
+  const size_t blocks = (points.size() + 7) / 8;
+  const size_t expected_size = points.size() * datapoint_size +
+                               blocks * sizeof(int64_t) +
+                               sizeof(SparseIndexFooter);
+  EXPECT_EQ(GetFileSize(file.GetPath()), expected_size);
+  EXPECT_EQ(file.size, expected_size);
+
+  FileHandle handle(file.GetPath(), O_RDONLY);
+  ASSERT_NE(handle.fd, -1);
+  auto footer = ReadValues<SparseIndexFooter>(
+      handle, 1, expected_size - sizeof(SparseIndexFooter));
+  ASSERT_EQ(footer->size(), 1);
+  EXPECT_EQ(footer->at(0).datapoint_count, points.size());
+  EXPECT_EQ(footer->at(0).block_datapoints, 8);
+  EXPECT_EQ(footer->at(0).block_count, blocks);
+
+  auto index = ReadValues<int64_t>(handle, blocks,
+                                   points.size() * datapoint_size);
+  ASSERT_EQ(index->size(), blocks);
+  for (size_t i = 0; i < blocks; i++)
+    EXPECT_EQ(index->at(i), points[i * 8].timestamp) << i;
+}
+
+
+TEST_F(SealedSparseFileTest, ReadsRoundTripByBlock) {
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache, MakeTestDir("sealed_read"));
+  SparseFile file(&dir, points.front().timestamp, points.back().timestamp,
+                  true, true);
+  file.WriteSealed(points.data(), points.size());
+
+  char filename[256];
+  strncpy(filename, file.filename.c_str(), sizeof(filename));
+  std::unique_ptr<DatapointFile> reopened =
+      SparseFile::FromFilename(&dir, filename);
+  ASSERT_NE(reopened, nullptr);
+
+  for (bool mmap_reads : {true, false}) {
+    FLAGS_mmap_reads = mmap_reads;
+
+    vector<Datapoint> all = ReadRange(*reopened, 0, INT64_MAX, 1000);
+    EXPECT_EQ(all, points);
+
+    // Starting between two datapoints in the middle of a block, and ending
+    // exactly on a block's first timestamp, in reads smaller than a block.
+    const size_t first = 8 * 3 + 2;
+    const size_t last = 8 * 9;
+    vector<Datapoint> some = ReadRange(*reopened,
+                                       points[first].timestamp - 1,
+                                       points[last].timestamp,
+                                       3);
+    EXPECT_EQ(some, vector<Datapoint>(points.begin() + first,
+                                      points.begin() + last))
+        << "mmap_reads=" << mmap_reads;
+
+    EXPECT_TRUE(ReadRange(*reopened, 0, points.front().timestamp, 10).empty());
+    EXPECT_TRUE(ReadRange(*reopened, points.back().timestamp + 1, INT64_MAX,
+                          10).empty());
+  }
+}
+
+
+TEST_F(SealedSparseFileTest, CorruptFooterReadsNothing) {
+  FileCache file_cache(16);
+  DatapointDirectory dir(nullptr, &file_cache, MakeTestDir("sealed_corrupt"));
+  SparseFile file(&dir, points.front().timestamp, points.back().timestamp,
+                  true, true);
+  file.WriteSealed(points.data(), points.size());
+
+  // A file cut short no longer ends in a footer.
+  ASSERT_EQ(truncate(file.GetPath().c_str(), file.size - 8), 0);
+  file_cache.Invalidate(file.GetPath());
+  EXPECT_TRUE(ReadRange(file, 0, INT64_MAX, 1000).empty());
+}
+
+
+} // namespace
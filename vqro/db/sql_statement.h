@@ -58,7 +58,7 @@ class SqlStatement {
                           param_num,
                           val.c_str(),
                           val.size(),
-                          SQLITE_STATIC) != SQLITE_OK)
+                          SQLITE_TRANSIENT) != SQLITE_OK)
       Throw("sqlite3_bind_text() failed");
   }
 
@@ -75,6 +75,21 @@ class SqlStatement {
       Throw("sqlite3_step() != SQLITE_DONE");
   }
 
+  // Steps a query, returning true if a row is available and false once the
+  // results are exhausted. Call Reset() before running it again.
+  bool Step() {
+    int ret = sqlite3_step(stmt);
+    if (ret == SQLITE_ROW)
+      return true;
+    if (ret != SQLITE_DONE)
+      Throw("sqlite3_step() failed");
+    return false;
+  }
+
+  void Reset() {
+    sqlite3_reset(stmt);
+  }
+
  private:
   void Throw(string msg) {
     throw SqliteError(msg + ": " + sqlite3_errmsg(db) +
@@ -1,10 +1,13 @@
 #include <cfloat>
 #include <cmath>
+#include <functional>
 #include "vqro/base/base.h"
 #include "vqro/base/floatutil.h"
 #include "vqro/db/db.h"
+#include "vqro/db/compressed_file.h"
 #include "vqro/db/constant_file.h"
 #include "vqro/db/dense_file.h"
+#include "vqro/db/directory_compactor.h"
 #include "vqro/db/raw_buffer.h"
 #include "vqro/db/storage_optimizer.h"
 #include "vqro/db/write_op.h"
@@ -41,8 +44,10 @@ bool StorageOptimizer::IsDense(Datapoint* buf, size_t len) {
   int64_t last_timestamp = buf->timestamp;
   for (unsigned int i = 0; i < len; i++) {
     int64_t delta = buf[i].timestamp - last_timestamp;
+    // A DenseFile only takes as much padding as --max_dense_nan_gap.
     if (buf[i].duration != dur ||
         delta / dur > FLAGS_max_dense_nan_padding ||
+        delta / dur > FLAGS_max_dense_nan_gap + 1 ||
         delta % dur)
       return false;
 
@@ -56,25 +61,94 @@ bool StorageOptimizer::IsConstant(Datapoint* buf, size_t len) {
   if (len < static_cast<uint32_t>(FLAGS_min_datapoints_for_constant))
     return false;
 
+  // A ConstantFile can't hold gaps, though repeated timestamps are fine.
   const double value = buf->value;
   Datapoint* const end = buf + len;
-  while (buf < end && AlmostEquals(buf->value, value))
+  int64_t last_timestamp = buf->timestamp;
+  while (buf < end && AlmostEquals(buf->value, value) &&
+         (buf->timestamp == last_timestamp ||
+          buf->timestamp == last_timestamp + buf->duration)) {
+    last_timestamp = buf->timestamp;
     buf++;
+  }
 
   return buf == end;
 }
 
 
 void StorageOptimizer::SparseFileTooBig(SparseFile* sparse_file) {
-  Series* series = sparse_file->dir->series;
-  series->db->GetWorker(series)->Do([=] {
-    HandleSparseFileTooBig(*sparse_file);
+  // The queued task holds a reference to the series, so it can't be evicted
+  // before the task runs. Conversions and compactions may still free the
+  // file itself, so like SparseFileSealed() we queue its filename.
+  std::shared_ptr<Series> series = sparse_file->dir->series->shared_from_this();
+  DatapointDirectory* dir = sparse_file->dir;
+  string filename = sparse_file->filename;
+  series->db->GetWorker(series.get())->Do([this, dir, filename, series] {
+    HandleSparseFileTooBig(dir, filename);
   });  // Don't wait on the worker, that would result in deadlock.
 }
 
 
-void StorageOptimizer::HandleSparseFileTooBig(SparseFile& sparse_file) {
-  LOG(INFO) << "HandleSparseFileTooBig file=" << sparse_file.GetPath();
+void StorageOptimizer::SparseFileSealed(SparseFile* sparse_file) {
+  // Other conversions in the directory re-read its filenames and free its
+  // DatapointFiles before our task may run, so we queue the filename rather
+  // than the file.
+  std::shared_ptr<Series> series = sparse_file->dir->series->shared_from_this();
+  DatapointDirectory* dir = sparse_file->dir;
+  string filename = sparse_file->filename;
+  series->db->GetWorker(series.get())->Do([this, dir, filename, series] {
+    HandleSparseFileSealed(dir, filename);
+  });  // Don't wait on the worker, that would result in deadlock.
+}
+
+
+void StorageOptimizer::HandleSparseFileSealed(DatapointDirectory* dir,
+                                              const string& filename) {
+  LOG(INFO) << "HandleSparseFileSealed file=" << dir->path << "/" << filename;
+  // Our file may have been converted already, which would have freed it.
+  SparseFile* sparse_file = dynamic_cast<SparseFile*>(dir->FindFile(filename));
+  if (!sparse_file)
+    return;
+
+  size_t max_datapoints = FLAGS_sparse_file_max_size / datapoint_size;
+  std::unique_ptr<Datapoint[]> read_buffer(new Datapoint[max_datapoints]);
+  ReadOperation read_op(INT64_MIN,  // start_time
+                        INT64_MAX,  // end_time
+                        INT64_MAX,  // datapoint_limit
+                        true,       // prefer_latest
+                        read_buffer.get(),
+                        max_datapoints);
+
+  try {
+    sparse_file->Read(read_op);
+  } catch (IOError& e) {
+    // Already converted or otherwise gone.
+    return;
+  }
+
+  if (!read_op.DatapointsInBuffer())
+    return;
+
+  if (FLAGS_sealed_sparse_format == "sorted") {
+    ConvertSparseToSealed(*sparse_file,
+                          read_op.buffer,
+                          read_op.DatapointsInBuffer());
+  } else {
+    ConvertSparseToCompressed(*sparse_file,
+                              read_op.buffer,
+                              read_op.DatapointsInBuffer());
+  }
+}
+
+
+void StorageOptimizer::HandleSparseFileTooBig(DatapointDirectory* dir,
+                                              const string& filename) {
+  LOG(INFO) << "HandleSparseFileTooBig file=" << dir->path << "/" << filename;
+  // Our file may have been converted or compacted already, freeing it.
+  SparseFile* found = dynamic_cast<SparseFile*>(dir->FindFile(filename));
+  if (!found)
+    return;
+  SparseFile& sparse_file = *found;
 
   //TODO Arena allocation for read buffers
   std::unique_ptr<Datapoint> read_buffer(new Datapoint[FLAGS_sparse_file_max_size]);
@@ -116,11 +190,11 @@ void StorageOptimizer::ConvertSparseToConstant(const SparseFile& sparse_file,
                         buf->value);
 
   RawBuffer rawbuf(buf, len);
-  WriteOperation write_op(&rawbuf);
-  new_file.Write(write_op);
-  if (unlink(sparse_file.GetPath().c_str()) == -1) {
-    LOG(ERROR) << "Failed to delete converted sparse file: " << sparse_file.GetPath();
-  }
+  WriteOperation<RawBuffer> write_op(&rawbuf);
+  sparse_file.dir->NameUniquely(new_file);
+  sparse_file.dir->ReplaceFiles({&sparse_file}, [&] {
+    new_file.Write(write_op);
+  });
   LOG(INFO) << "Created ConstantFile: " << new_file.GetPath();
   sparse_file.dir->ReadFilenames();
 }
@@ -136,16 +210,185 @@ void StorageOptimizer::ConvertSparseToDense(const SparseFile& sparse_file,
                      buf->duration);
 
   RawBuffer rawbuf(buf, len);
-  WriteOperation write_op(&rawbuf);
-  new_file.Write(write_op);
-  if (unlink(sparse_file.GetPath().c_str()) == -1) {
-    LOG(ERROR) << "Failed to delete converted sparse file: " << sparse_file.GetPath();
-  }
+  WriteOperation<RawBuffer> write_op(&rawbuf);
+  sparse_file.dir->NameUniquely(new_file);
+  sparse_file.dir->ReplaceFiles({&sparse_file}, [&] {
+    new_file.Write(write_op);
+  });
   LOG(INFO) << "Created DenseFile: " << new_file.GetPath();
   sparse_file.dir->ReadFilenames();
 }
 
 
+// buf must be sorted with unique timestamps, as SparseFile::Read() leaves it.
+void StorageOptimizer::ConvertSparseToCompressed(const SparseFile& sparse_file,
+                                                 Datapoint* buf,
+                                                 size_t len)
+{
+  LOG(INFO) << "Compressing SparseFile: " << sparse_file.GetPath();
+  CompressedFile new_file(sparse_file.dir,
+                          sparse_file.min_timestamp,
+                          sparse_file.max_timestamp);
+
+  RawBuffer rawbuf(buf, len);
+  WriteOperation<RawBuffer> write_op(&rawbuf);
+  sparse_file.dir->NameUniquely(new_file);
+  sparse_file.dir->ReplaceFiles({&sparse_file}, [&] {
+    new_file.Write(write_op);
+  });
+  LOG(INFO) << "Created CompressedFile: " << new_file.GetPath();
+  sparse_file.dir->ReadFilenames();
+}
+
+
+void StorageOptimizer::ConvertSparseToSealed(const SparseFile& sparse_file,
+                                             Datapoint* buf,
+                                             size_t len)
+{
+  LOG(INFO) << "Sealing SparseFile: " << sparse_file.GetPath();
+  SparseFile new_file(sparse_file.dir,
+                      sparse_file.min_timestamp,
+                      sparse_file.max_timestamp,
+                      true,   // optimized
+                      true);  // sealed
+
+  sparse_file.dir->NameUniquely(new_file);
+  sparse_file.dir->ReplaceFiles({&sparse_file}, [&] {
+    new_file.WriteSealed(buf, len);
+  });
+  LOG(INFO) << "Created sealed SparseFile: " << new_file.GetPath();
+  sparse_file.dir->ReadFilenames();
+}
+
+
+// Small sparse and compressed files are what late and out of order writes
+// leave behind.
+static bool IsCompactable(DatapointDirectory* dir,
+                          DatapointFile& file,
+                          off_t& file_size) {
+  if (dynamic_cast<SparseFile*>(&file) == nullptr &&
+      dynamic_cast<CompressedFile*>(&file) == nullptr)
+    return false;
+
+  try {
+    dir->file_cache->Open(file.GetPath(), file_size);
+  } catch (IOError& e) {
+    return false;
+  }
+  return file_size < FLAGS_compaction_small_file_size;
+}
+
+
+int64_t StorageOptimizer::CompactDirectory(DatapointDirectory* dir) {
+  const size_t min_files = std::max(FLAGS_compaction_min_files, 2);
+  if (dir->segment_store || FLAGS_compaction_min_files <= 0)
+    return 0;
+
+  if (!dir->filenames_read) {
+    try {
+      dir->ReadFilenames();
+    } catch (IOError& e) {
+      return 0;  // Nothing written yet
+    }
+  }
+
+  // Find the first run of compactable files. The last file is left alone as
+  // it still takes appends.
+  auto& files = dir->datapoint_files;
+  vector<off_t> sizes(files.size());
+  size_t run_start = 0;
+  size_t run_end = 0;
+  for (size_t i = 0; i + 1 < files.size(); i++) {
+    if (!IsCompactable(dir, *files[i], sizes[i])) {
+      if (run_end - run_start >= min_files)
+        break;
+      run_start = i + 1;
+    }
+    run_end = i + 1;
+  }
+  if (run_end - run_start < min_files)
+    return 0;
+
+  size_t max_datapoints = std::max(FLAGS_compaction_max_datapoints, 1);
+  std::unique_ptr<Datapoint[]> read_buffer(new Datapoint[max_datapoints]);
+  ReadOperation read_op(INT64_MIN,  // start_time
+                        INT64_MAX,  // end_time
+                        INT64_MAX,  // datapoint_limit
+                        true,       // prefer_latest
+                        read_buffer.get(),
+                        max_datapoints);
+
+  // Reading the files in order through one ReadOperation merges them just
+  // like DatapointDirectory::Read() would. We take as many as surely fit.
+  size_t end = run_start;
+  size_t len = 0;
+  int64_t bytes = 0;
+  while (end < run_end) {
+    files[end]->Read(read_op);
+    if (!read_op.SpaceLeft())
+      break;
+    len = read_op.DatapointsInBuffer();
+    bytes += sizes[end];
+    end++;
+  }
+  if (end - run_start < 2)
+    return 0;
+
+  const DatapointFile& first = *files[run_start];
+  const DatapointFile& last = *files[end - 1];
+  Datapoint* buf = read_buffer.get();
+  LOG(INFO) << "Compacting " << (end - run_start) << " files in " << dir->path
+            << " from " << first.filename << " to " << last.filename;
+
+  // The merged file is recorded in place of the originals, so a crash
+  // leaves one or the other.
+  vector<const DatapointFile*> merged;
+  for (size_t i = run_start; i < end; i++)
+    merged.push_back(files[i].get());
+  std::unique_ptr<DatapointFile> new_file;
+  std::function<void()> write;
+  RawBuffer rawbuf(buf, len);
+  WriteOperation<RawBuffer> write_op(&rawbuf);
+  if (!len) {
+    // Nothing but empty files.
+  } else if (IsDense(buf, len)) {
+    if (IsConstant(buf, len))
+      new_file.reset(new ConstantFile(dir, buf->timestamp, buf->duration, 0,
+                                      buf->value));
+    else
+      new_file.reset(new DenseFile(dir, buf->timestamp, buf->duration));
+    write = [&] { new_file->Write(write_op); };
+  } else if (FLAGS_sealed_sparse_format == "sorted") {
+    SparseFile* sealed_file = new SparseFile(dir,
+                                             first.min_timestamp,
+                                             last.max_timestamp,
+                                             true,   // optimized
+                                             true);  // sealed
+    new_file.reset(sealed_file);
+    write = [&] { sealed_file->WriteSealed(buf, len); };
+  } else {
+    new_file.reset(new CompressedFile(dir,
+                                      first.min_timestamp,
+                                      last.max_timestamp));
+    write = [&] { new_file->Write(write_op); };
+  }
+
+  if (new_file) {
+    dir->NameUniquely(*new_file);
+    dir->ReplaceFiles(merged, write);
+  } else {
+    for (const DatapointFile* file : merged) {
+      dir->file_cache->Invalidate(file->GetPath());
+      if (unlink(file->GetPath().c_str()) == -1)
+        LOG(ERROR) << "Failed to delete compacted file: " << file->GetPath();
+      dir->FileRemoved(*file);
+    }
+  }
+  dir->ReadFilenames();
+  return bytes;
+}
+
+
 // Other things the optimizer might do:
 // - handle ephemeral Series promotion to persisted Series (for event store use case)
 // - roll up aggregation
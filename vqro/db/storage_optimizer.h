@@ -2,10 +2,15 @@
 #define VQRO_DB_STORAGE_OPTIMIZER_H
 
 #include <memory>
+#include <gflags/gflags.h>
 #include "vqro/base/base.h"
 #include "vqro/db/sparse_file.h"
 
 
+DECLARE_int32(min_datapoints_for_dense);
+DECLARE_int32(min_datapoints_for_constant);
+
+
 namespace vqro {
 namespace db {
 
@@ -20,8 +25,20 @@ class StorageOptimizer {
 
   void SparseFileTooBig(SparseFile* sparse_file);
 
+  // Rewrites a sparse file that has filled up or grown past
+  // --sparse_file_compress_size without qualifying for a better format, in the
+  // --sealed_sparse_format.
+  void SparseFileSealed(SparseFile* sparse_file);
+
+  // Merges the first run of at least --compaction_min_files small files in
+  // dir into one file of the best format. Returns the bytes of files merged,
+  // or zero if there was no such run. Must run on dir's worker thread.
+  // Throws IOError.
+  int64_t CompactDirectory(DatapointDirectory* dir);
+
  private:
-  void HandleSparseFileTooBig(SparseFile& sparse_file);
+  void HandleSparseFileTooBig(DatapointDirectory* dir, const string& filename);
+  void HandleSparseFileSealed(DatapointDirectory* dir, const string& filename);
   bool IsDense(Datapoint* buf, size_t len);
   bool IsConstant(Datapoint* buf, size_t len);
 
@@ -31,6 +48,12 @@ class StorageOptimizer {
   void ConvertSparseToConstant(const SparseFile& sparse_file,
                                Datapoint* buf,
                                size_t len);
+  void ConvertSparseToCompressed(const SparseFile& sparse_file,
+                                 Datapoint* buf,
+                                 size_t len);
+  void ConvertSparseToSealed(const SparseFile& sparse_file,
+                             Datapoint* buf,
+                             size_t len);
 };
 
 
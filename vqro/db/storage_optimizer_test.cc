@@ -0,0 +1,154 @@
+#include "vqro/base/base.h"
+#include "vqro/base/file_cache.h"
+#include "vqro/db/compressed_file.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/dense_file.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/manifest.h"
+#include "vqro/db/raw_buffer.h"
+#include "vqro/db/sparse_file.h"
+#include "vqro/db/storage_optimizer.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+// count datapoints from start, step apart, or jittered if step is zero.
+vector<Datapoint> MakeDatapoints(int64_t start, size_t count, int64_t step) {
+  vector<Datapoint> points;
+  for (size_t i = 0; i < count; i++) {
+    int64_t offset = step ? i * step : i * 7 + (i % 3);
+    points.emplace_back(start + offset, start + i * 0.25, step ? step : 1);
+  }
+  return points;
+}
+
+
+class CompactDirectoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_cadence_profiles = false;
+    FLAGS_compaction_min_files = 3;
+    path = MakeTestDirForTest();
+    dir.reset(new DatapointDirectory(nullptr, &file_cache, path));
+  }
+
+  void TearDown() override {
+    FLAGS_compaction_max_datapoints = compaction_max_datapoints;
+    FLAGS_min_datapoints_for_dense = min_datapoints_for_dense;
+  }
+
+  template <typename File>
+  void Write(File&& file, vector<Datapoint> points) {
+    RawBuffer buffer(points.data(), points.size());
+    WriteOperation<RawBuffer> write_op(&buffer);
+    file.Write(write_op);
+    all_points.insert(all_points.end(), points.begin(), points.end());
+  }
+
+  // Compacts a directory holding the files we wrote, as after a restart.
+  int64_t Compact() {
+    dir.reset(new DatapointDirectory(nullptr, &file_cache, path));
+    StorageOptimizer optimizer(nullptr);
+    return optimizer.CompactDirectory(dir.get());
+  }
+
+  vector<ManifestEntry> Entries() {
+    Manifest manifest(path, &file_cache);
+    EXPECT_TRUE(manifest.Load());
+    return manifest.Entries();
+  }
+
+  vector<Datapoint> ReadAll() {
+    FLAGS_compaction_min_files = 0;  // Reads would report fragmentation
+    vector<Datapoint> buffer(all_points.size() + 1);
+    ReadOperation read_op(INT64_MIN, INT64_MAX, -1, false,
+                          buffer.data(), buffer.size());
+    dir->Read(read_op);
+    return vector<Datapoint>(buffer.data(), read_op.cursor);
+  }
+
+  DirectoryFlagSaver flag_saver;
+  const int32_t compaction_max_datapoints = FLAGS_compaction_max_datapoints;
+  const int32_t min_datapoints_for_dense = FLAGS_min_datapoints_for_dense;
+
+  FileCache file_cache {16};
+  string path;
+  std::unique_ptr<DatapointDirectory> dir;
+  vector<Datapoint> all_points;
+};
+
+
+TEST_F(CompactDirectoryTest, MergesSparseAndCompressedFiles) {
+  Write(SparseFile(dir.get(), 100, 100), MakeDatapoints(100, 5, 0));
+  Write(CompressedFile(dir.get(), 200, 200), MakeDatapoints(200, 6, 0));
+  Write(SparseFile(dir.get(), 300, 300), MakeDatapoints(300, 4, 0));
+  // Dense files aren't compacted, and end the run.
+  Write(DenseFile(dir.get(), 1000, 10), MakeDatapoints(1000, 8, 10));
+  Write(SparseFile(dir.get(), 2000, 2000), MakeDatapoints(2000, 3, 0));
+  ASSERT_EQ(Entries().size(), 5);
+
+  EXPECT_GT(Compact(), 0);
+  vector<ManifestEntry> entries = Entries();
+  ASSERT_EQ(entries.size(), 3);
+  // Irregular datapoints are merged into a compressed file, recorded last.
+  EXPECT_EQ(entries[0].format, FileFormat::DENSE);
+  EXPECT_EQ(entries[1].format, FileFormat::SPARSE);
+  EXPECT_EQ(entries[2].format, FileFormat::COMPRESSED);
+  EXPECT_EQ(entries[2].min_timestamp, 100);
+  EXPECT_EQ(entries[2].count, 5 + 6 + 4);
+  EXPECT_EQ(ReadAll(), all_points);
+
+  // What's left is no run at all.
+  EXPECT_EQ(Compact(), 0);
+}
+
+
+TEST_F(CompactDirectoryTest, LeavesTheLastFileAlone) {
+  Write(SparseFile(dir.get(), 100, 100), MakeDatapoints(100, 5, 0));
+  Write(SparseFile(dir.get(), 200, 200), MakeDatapoints(200, 5, 0));
+  Write(SparseFile(dir.get(), 300, 300), MakeDatapoints(300, 5, 0));
+
+  // Three small files, but the last still takes appends.
+  EXPECT_EQ(Compact(), 0);
+  EXPECT_EQ(Entries().size(), 3);
+
+  Write(SparseFile(dir.get(), 400, 400), MakeDatapoints(400, 5, 0));
+  EXPECT_GT(Compact(), 0);
+  vector<ManifestEntry> entries = Entries();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].min_timestamp, 400);
+  EXPECT_EQ(entries[1].count, 15);
+  EXPECT_EQ(ReadAll(), all_points);
+}
+
+
+TEST_F(CompactDirectoryTest, StopsAtTheBufferLimit) {
+  // Regular datapoints, so what is merged becomes a dense file.
+  for (int64_t start = 100; start < 700; start += 100)
+    Write(SparseFile(dir.get(), start, start), MakeDatapoints(start, 5, 20));
+
+  // The third file doesn't fit, so only the first two are merged.
+  FLAGS_compaction_max_datapoints = 12;
+  FLAGS_min_datapoints_for_dense = 10;
+  EXPECT_GT(Compact(), 0);
+  vector<ManifestEntry> entries = Entries();
+  ASSERT_EQ(entries.size(), 5);
+  ManifestEntry merged = entries.back();
+  EXPECT_EQ(merged.format, FileFormat::DENSE);
+  EXPECT_EQ(merged.min_timestamp, 100);
+  EXPECT_EQ(merged.max_timestamp, 280 + 20);  // End of the last slot
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(entries[i].format, FileFormat::SPARSE);
+    EXPECT_EQ(entries[i].min_timestamp, 300 + 100 * i);
+  }
+  EXPECT_EQ(ReadAll(), all_points);
+}
+
+
+} // namespace
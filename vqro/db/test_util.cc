@@ -0,0 +1,121 @@
+#include <stdlib.h>
+
+#include <future>
+#include <memory>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/db/cadence.h"
+#include "vqro/db/db.h"
+#include "vqro/db/directory_compactor.h"
+#include "vqro/db/series.h"
+#include "vqro/db/test_util.h"
+#include "gtest/gtest.h"
+
+
+namespace vqro {
+namespace db {
+
+
+string MakeTestDir(const string& name) {
+  string path = GetEnvVar("TEST_TMPDIR") + "/" + name + ".XXXXXX";
+  if (mkdtemp(&path[0]) == nullptr)
+    throw IOErrorFromErrno("mkdtemp() failed path=" + path);
+  return path;
+}
+
+
+string MakeTestDirForTest() {
+  return MakeTestDir(::testing::UnitTest::GetInstance()
+                         ->current_test_info()->name());
+}
+
+
+DirectoryFlagSaver::DirectoryFlagSaver() :
+    cadence_profiles(FLAGS_cadence_profiles),
+    compaction_min_files(FLAGS_compaction_min_files) {}
+
+
+DirectoryFlagSaver::~DirectoryFlagSaver() {
+  FLAGS_cadence_profiles = cadence_profiles;
+  FLAGS_compaction_min_files = compaction_min_files;
+}
+
+
+void DatabaseTest::SetUp() {
+  FLAGS_db_worker_threads = 2;
+  FLAGS_maintenance_interval = 3600 * 1000;
+  FLAGS_write_ahead_log = false;
+  db.reset(new Database(MakeTestDirForTest()));
+}
+
+
+void DatabaseTest::TearDown() {
+  db.reset();
+  FLAGS_db_worker_threads = db_worker_threads;
+  FLAGS_maintenance_interval = maintenance_interval;
+  FLAGS_write_ahead_log = write_ahead_log;
+}
+
+
+void DatabaseTest::Reopen() {
+  string dir = db->GetDataDirectory();
+  db.reset();
+  db.reset(new Database(dir));
+}
+
+
+std::shared_ptr<Series> DatabaseTest::FindSeries(const string& name) {
+  return db->series_registry->Find("name=" + name + ";");
+}
+
+
+void DatabaseTest::EvictIdleSeries() {
+  vector<std::shared_ptr<Series>> all_series;
+  for (size_t shard = 0; shard < db->series_registry->NumShards(); shard++)
+    db->series_registry->AppendShard(shard, all_series);
+  db->EvictIdleSeries(all_series);
+}
+
+
+void DatabaseTest::PreloadSeries() {
+  db->PreloadSeries();
+  for (WorkerThread* worker : db->workers) {
+    while (true) {
+      try {
+        worker->Do([] {}).wait();
+        break;
+      } catch (WorkerThreadTooBusy& err) {
+        worker->WaitForRoom(100);
+      }
+    }
+  }
+}
+
+
+VoidFunc DatabaseTest::BlockWorkers() {
+  auto release = std::make_shared<std::promise<void>>();
+  std::shared_future<void> released = release->get_future().share();
+  for (WorkerThread* worker : db->workers) {
+    while (true) {
+      try {
+        worker->Post([released] { released.wait(); });
+        break;
+      } catch (WorkerThreadTooBusy& err) {
+        worker->WaitForRoom(100);
+      }
+    }
+  }
+  return [release] { release->set_value(); };
+}
+
+
+std::shared_ptr<Series> DatabaseTest::MakeSeries(const string& name) {
+  vqro::rpc::Series proto;
+  (*proto.mutable_labels())["name"] = name;
+  return std::make_shared<Series>(db.get(), proto, "name=" + name);
+}
+
+
+} // namespace db
+} // namespace vqro
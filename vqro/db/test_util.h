@@ -0,0 +1,87 @@
+#ifndef VQRO_DB_TEST_UTIL_H
+#define VQRO_DB_TEST_UTIL_H
+
+#include <cstdint>
+#include <memory>
+
+#include "vqro/base/base.h"
+#include "vqro/db/db.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int32(db_worker_threads);
+DECLARE_int32(maintenance_interval);
+
+
+namespace vqro {
+namespace db {
+
+
+// A fresh, empty directory under TEST_TMPDIR for each call, named after name.
+// Throws IOError if it can't be made.
+string MakeTestDir(const string& name);
+
+// Like MakeTestDir(), named after the running test.
+string MakeTestDirForTest();
+
+
+// Tests of a DatapointDirectory with no Series or DB behind it turn off
+// cadence profiles and set when it compacts. A DirectoryFlagSaver takes the
+// flags as they are when it is made and puts them back when it goes, so a
+// fixture holding one may change them freely.
+class DirectoryFlagSaver {
+ public:
+  DirectoryFlagSaver();
+  ~DirectoryFlagSaver();
+
+  DirectoryFlagSaver(const DirectoryFlagSaver& other) = delete;
+  DirectoryFlagSaver& operator=(const DirectoryFlagSaver& other) = delete;
+
+ private:
+  const bool cadence_profiles;
+  const int32_t compaction_min_files;
+};
+
+
+// A fixture holding a small Database of its own in a fresh directory, with
+// two workers, no write ahead log, and a maintenance pass too far off to run
+// during a test.
+class DatabaseTest : public ::testing::Test {
+ protected:
+  void SetUp() override;
+  void TearDown() override;
+
+  // A series of db's that is not in its registry, named name.
+  std::shared_ptr<Series> MakeSeries(const string& name);
+
+  // Destroys db and opens its directory again, as a restart would. Flags
+  // changed since SetUp() apply to the new db.
+  void Reopen();
+
+  // The series named name in db's registry, or null if it isn't there.
+  std::shared_ptr<Series> FindSeries(const string& name);
+
+  // Runs an eviction pass over db's registry, as a maintenance pass does.
+  void EvictIdleSeries();
+
+  // Preloads db's registry from its index, as startup does with
+  // --preload_series, and waits for the workers to finish.
+  void PreloadSeries();
+
+  // Holds up every worker of db until the returned function is called, so
+  // that tasks queue up behind it. It must be called before db goes.
+  VoidFunc BlockWorkers();
+
+  std::unique_ptr<Database> db;
+
+ private:
+  const int32_t db_worker_threads = FLAGS_db_worker_threads;
+  const int32_t maintenance_interval = FLAGS_maintenance_interval;
+  const bool write_ahead_log = FLAGS_write_ahead_log;
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_TEST_UTIL_H
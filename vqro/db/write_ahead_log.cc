@@ -0,0 +1,316 @@
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/write_ahead_log.h"
+
+
+DEFINE_bool(write_ahead_log,
+            true,
+            "Log every write to disk before acknowledging it so buffered "
+            "datapoints survive a crash.");
+DEFINE_int64(wal_segment_size,
+             1 << 26,  // 64MB
+             "Write ahead log segments are rotated once they reach this many "
+             "bytes.");
+DEFINE_int32(wal_group_commit_delay_us,
+             0,
+             "How long (microseconds) the log thread waits for more records "
+             "to show up before writing and fsyncing a batch.");
+
+
+namespace vqro {
+namespace db {
+
+
+constexpr size_t wal_header_size = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+
+WriteAheadLog::WriteAheadLog(string d) : dir(d) {
+  while (!dir.empty() && dir.back() == '/')
+    dir = dir.substr(0, dir.length() - 1);
+  CreateDirectory(dir);
+}
+
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    keep_running = false;
+  }
+  records_pending.notify_all();
+  if (log_thread.joinable())
+    log_thread.join();
+
+  if (active_fd != -1)
+    close(active_fd);
+}
+
+
+string WriteAheadLog::SegmentPath(uint64_t id) const {
+  return dir + "/" + to_string(id) + ".wal";
+}
+
+
+void WriteAheadLog::Replay(WalReplayFunc func) {
+  vector<uint64_t> ids;
+  {
+    DirectoryHandle dir_handle(dir);
+    if (dir_handle.stream == NULL)
+      throw IOErrorFromErrno("WriteAheadLog opendir() failed path=" + dir);
+
+    struct dirent64* entry;
+    char* endptr;
+    while ((entry = readdir64(dir_handle.stream)) != NULL) {
+      uint64_t id = strtoull(entry->d_name, &endptr, 10);
+      if (endptr != entry->d_name && strcmp(endptr, ".wal") == 0)
+        ids.push_back(id);
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+
+  uint64_t replayed = 0;
+  for (uint64_t id : ids) {
+    string path = SegmentPath(id);
+    FileHandle file(path, O_RDONLY);
+    if (file.fd == -1)
+      throw IOErrorFromErrno("WriteAheadLog::Replay open() failed path=" + path);
+
+    std::unique_ptr<vector<char>> data = ReadValues<char>(file,
+                                                          GetFileSize(path));
+    Segment segment {id, next_lsn, next_lsn - 1};
+    const char* pos = data->data();
+    const char* end = pos + data->size();
+
+    while (pos < end) {
+      uint64_t lsn;
+      uint32_t len;
+      uint32_t crc;
+      if (end - pos < static_cast<long>(wal_header_size))
+        break;
+      memcpy(&lsn, pos, sizeof(lsn));
+      memcpy(&len, pos + sizeof(lsn), sizeof(len));
+      memcpy(&crc, pos + sizeof(lsn) + sizeof(len), sizeof(crc));
+      pos += wal_header_size;
+
+      // A torn or corrupt record ends the segment. Anything after it was
+      // never acknowledged as durable.
+      if (end - pos < len || len == 0 ||
+          crc32(0, reinterpret_cast<const Bytef*>(pos), len) != crc ||
+          lsn < next_lsn) {
+        LOG(WARNING) << "WriteAheadLog ignoring " << (end - pos + wal_header_size)
+                     << " trailing bytes of " << path;
+        break;
+      }
+
+      if (segment.last_lsn < segment.first_lsn)
+        segment.first_lsn = lsn;
+      func(static_cast<WalRecordType>(pos[0]), pos + 1, len - 1, lsn);
+      segment.last_lsn = lsn;
+      next_lsn = lsn + 1;
+      pos += len;
+      replayed++;
+    }
+    segments.push_back(segment);
+  }
+  durable_lsn = next_lsn - 1;
+  LOG(INFO) << "WriteAheadLog replayed " << replayed << " records from "
+            << ids.size() << " segments";
+}
+
+
+void WriteAheadLog::Start() {
+  OpenSegment(next_lsn);
+  log_thread = std::thread([this] { WriteRecords(); });
+}
+
+
+void WriteAheadLog::OpenSegment(uint64_t first_lsn) {
+  uint64_t id = segments.empty() ? 1 : segments.back().id + 1;
+  string path = SegmentPath(id);
+
+  int fd = open(path.c_str(), O_WRONLY|O_CREAT|O_TRUNC|O_APPEND, 0644);
+  if (fd == -1)
+    throw IOErrorFromErrno("WriteAheadLog open() failed path=" + path);
+
+  // Make sure the new directory entry itself is durable.
+  FileHandle dir_handle(dir, O_RDONLY);
+  if (dir_handle.fd == -1 || fsync(dir_handle.fd) == -1) {
+    close(fd);
+    throw IOErrorFromErrno("WriteAheadLog fsync() failed on " + dir);
+  }
+
+  if (active_fd != -1)
+    close(active_fd);
+  active_fd = fd;
+  active_size = 0;
+
+  std::lock_guard<std::mutex> guard(mutex);
+  segments.push_back(Segment {id, first_lsn, first_lsn - 1});
+  VLOG(1) << "WriteAheadLog opened segment " << path;
+}
+
+
+uint64_t WriteAheadLog::Append(const vqro::rpc::WriteOperation& op) {
+  return AppendRecord(WAL_WRITE_OPERATION, op);
+}
+
+
+uint64_t WriteAheadLog::Append(const vqro::rpc::WriteBatch& batch) {
+  return AppendRecord(WAL_WRITE_BATCH, batch);
+}
+
+
+uint64_t WriteAheadLog::AppendRecord(WalRecordType type,
+                                     const google::protobuf::Message& message)
+{
+  thread_local static string payload;
+  payload.assign(1, type);
+  if (!message.AppendToString(&payload))
+    throw Error("WriteAheadLog failed to serialize " + message.GetTypeName());
+
+  uint32_t len = payload.size();
+  uint32_t crc = crc32(0, reinterpret_cast<const Bytef*>(payload.data()), len);
+  uint64_t lsn;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (failed)
+      throw IOError(string("WriteAheadLog failed, refusing to accept writes"));
+    lsn = next_lsn++;
+    if (pending.empty())
+      pending_first_lsn = lsn;
+    pending.append(reinterpret_cast<const char*>(&lsn), sizeof(lsn));
+    pending.append(reinterpret_cast<const char*>(&len), sizeof(len));
+    pending.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+    pending.append(payload);
+    unapplied.insert(lsn);
+  }
+  records_pending.notify_one();
+  return lsn;
+}
+
+
+void WriteAheadLog::Applied(uint64_t lsn) {
+  std::lock_guard<std::mutex> guard(mutex);
+  unapplied.erase(lsn);
+}
+
+
+void WriteAheadLog::WaitDurable(uint64_t lsn) {
+  std::unique_lock<std::mutex> lock(mutex);
+  records_durable.wait(lock, [&] { return durable_lsn >= lsn || failed; });
+  if (failed && durable_lsn < lsn)
+    throw IOError(string("WriteAheadLog failed, write is not durable"));
+}
+
+
+uint64_t WriteAheadLog::OldestUnapplied() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return unapplied.empty() ? next_lsn : *unapplied.begin();
+}
+
+
+void WriteAheadLog::Truncate(uint64_t min_lsn, VoidFunc sync_flushed) {
+  // Only we remove segments, so the ones we find stay at the front while we
+  // sync without holding the lock.
+  vector<uint64_t> doomed;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    for (size_t i = 0; i + 1 < segments.size(); i++) {
+      if (segments[i].last_lsn >= min_lsn)
+        break;
+      doomed.push_back(segments[i].id);
+    }
+  }
+  if (doomed.empty())
+    return;
+
+  sync_flushed();
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    segments.erase(segments.begin(), segments.begin() + doomed.size());
+  }
+
+  for (uint64_t id : doomed) {
+    string path = SegmentPath(id);
+    VLOG(1) << "WriteAheadLog deleting segment " << path;
+    if (unlink(path.c_str()) == -1)
+      PLOG(ERROR) << "WriteAheadLog failed to delete segment " << path;
+  }
+}
+
+
+void WriteAheadLog::WriteRecords() {
+  LOG(INFO) << "WriteAheadLog thread reporting for duty.";
+  string batch;
+  uint64_t batch_first_lsn;
+  uint64_t batch_last_lsn;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      records_pending.wait(lock, [&] { return !pending.empty() || !keep_running; });
+      if (pending.empty() && !keep_running)
+        return;
+
+      if (FLAGS_wal_group_commit_delay_us > 0 && keep_running) {
+        lock.unlock();
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(FLAGS_wal_group_commit_delay_us));
+        lock.lock();
+      }
+      batch.swap(pending);
+      pending.clear();
+      batch_first_lsn = pending_first_lsn;
+      batch_last_lsn = next_lsn - 1;
+    }
+
+    try {
+      if (active_size >= FLAGS_wal_segment_size)
+        OpenSegment(batch_first_lsn);
+
+      const char* ptr = batch.data();
+      size_t to_write = batch.size();
+      while (to_write) {
+        ssize_t written = write(active_fd, ptr, to_write);
+        if (written == -1) {
+          if (errno == EINTR) continue;
+          throw IOErrorFromErrno("WriteAheadLog write() failed");
+        }
+        ptr += written;
+        to_write -= written;
+      }
+      if (fdatasync(active_fd) == -1)
+        throw IOErrorFromErrno("WriteAheadLog fdatasync() failed");
+      active_size += batch.size();
+    } catch (IOError& err) {
+      LOG(ERROR) << "WriteAheadLog is no longer durable: " << err.message;
+      std::lock_guard<std::mutex> guard(mutex);
+      failed = true;
+      records_durable.notify_all();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      durable_lsn = batch_last_lsn;
+      segments.back().last_lsn = batch_last_lsn;
+    }
+    records_durable.notify_all();
+    batch.clear();
+  }
+}
+
+
+} // namespace db
+} // namespace vqro
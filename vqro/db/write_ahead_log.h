@@ -0,0 +1,123 @@
+#ifndef VQRO_DB_WRITE_AHEAD_LOG_H
+#define VQRO_DB_WRITE_AHEAD_LOG_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+
+
+DECLARE_bool(write_ahead_log);
+DECLARE_int64(wal_segment_size);
+
+
+namespace vqro {
+namespace db {
+
+
+// What the payload of a write ahead log record holds.
+enum WalRecordType : char {
+  WAL_WRITE_OPERATION = 1,  // A serialized vqro::rpc::WriteOperation
+  WAL_WRITE_BATCH = 2,      // A serialized vqro::rpc::WriteBatch
+};
+
+
+using WalReplayFunc = std::function<void(WalRecordType, const char*, size_t, uint64_t)>;
+
+
+// An append-only log of every write accepted by the database. Since
+// datapoints live only in memory until their series' WriteBuffer gets flushed,
+// the log is what lets us recover them after a crash.
+//
+// Records are assigned increasing log sequence numbers (LSNs). Append() only
+// queues a record; a single log thread writes everything queued since its
+// last fsync in one go and then fsyncs once (group commit). Use WaitDurable()
+// to block until a given LSN is on disk.
+//
+// The log is split into segment files of roughly --wal_segment_size bytes.
+// A segment is deleted by Truncate() once every record in it has been
+// flushed to datapoint files and those have been synced.
+//
+// Segment record format (little endian):
+//   uint64 lsn | uint32 payload length | uint32 crc32(payload) | payload
+// where the payload is a one byte WalRecordType followed by the message.
+class WriteAheadLog {
+ public:
+  WriteAheadLog(string dir);
+  ~WriteAheadLog();
+
+  WriteAheadLog(const WriteAheadLog& other) = delete;
+  WriteAheadLog& operator=(const WriteAheadLog& other) = delete;
+
+  // Feeds every intact record of every existing segment to func, in LSN
+  // order. Must be called before Start().
+  void Replay(WalReplayFunc func);
+
+  // Opens a fresh segment and starts the log thread.
+  void Start();
+
+  uint64_t Append(const vqro::rpc::WriteOperation& op);
+  uint64_t Append(const vqro::rpc::WriteBatch& batch);
+
+  // Called once the record with this LSN has been applied to a WriteBuffer.
+  // Until then the record pins its segment.
+  void Applied(uint64_t lsn);
+
+  // Blocks until the record with this LSN has been fsync'd. Throws IOError if
+  // the log can no longer be written.
+  void WaitDurable(uint64_t lsn);
+
+  // Any record needed later that isn't already reflected in some series'
+  // oldest unflushed LSN will have an LSN >= this value.
+  uint64_t OldestUnapplied();
+
+  // Deletes closed segments containing only records with LSN < min_lsn.
+  // Their records only ever reached datapoint files through the page cache,
+  // so sync_flushed is called first to make those durable. If it throws
+  // nothing is deleted.
+  void Truncate(uint64_t min_lsn, VoidFunc sync_flushed);
+
+ private:
+  struct Segment {
+    uint64_t id;
+    uint64_t first_lsn;
+    uint64_t last_lsn;
+  };
+
+  string dir;
+  std::mutex mutex;
+  std::condition_variable records_pending;
+  std::condition_variable records_durable;
+
+  string pending;                   // Encoded records waiting to be written
+  uint64_t pending_first_lsn = 0;   // LSN of the first record in pending
+  uint64_t next_lsn = 1;
+  uint64_t durable_lsn = 0;
+  std::set<uint64_t> unapplied;
+  bool failed = false;
+
+  std::deque<Segment> segments;     // Oldest first, the last one is active
+  int active_fd = -1;
+  off_t active_size = 0;
+
+  bool keep_running = true;
+  std::thread log_thread;
+
+  uint64_t AppendRecord(WalRecordType type,
+                        const google::protobuf::Message& message);
+  string SegmentPath(uint64_t id) const;
+  void OpenSegment(uint64_t first_lsn);
+  void WriteRecords();
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_WRITE_AHEAD_LOG_H
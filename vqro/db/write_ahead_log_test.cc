@@ -0,0 +1,209 @@
+#include <dirent.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/test_util.h"
+#include "vqro/db/write_ahead_log.h"
+#include "gtest/gtest.h"
+
+
+DECLARE_int32(wal_group_commit_delay_us);
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+struct Record {
+  WalRecordType type;
+  uint64_t lsn;
+  uint64_t handle;  // Of the op, or of the batch's first columns
+};
+
+
+vector<Record> ReplayAll(WriteAheadLog& wal) {
+  vector<Record> records;
+  wal.Replay([&] (WalRecordType type, const char* data, size_t len,
+                  uint64_t lsn) {
+    uint64_t handle = 0;
+    if (type == WAL_WRITE_OPERATION) {
+      vqro::rpc::WriteOperation op;
+      EXPECT_TRUE(op.ParseFromArray(data, len));
+      handle = op.series_handle();
+    } else {
+      vqro::rpc::WriteBatch batch;
+      EXPECT_TRUE(batch.ParseFromArray(data, len));
+      handle = batch.columns(0).series_handle();
+    }
+    records.push_back(Record {type, lsn, handle});
+  });
+  return records;
+}
+
+
+uint64_t AppendOp(WriteAheadLog& wal, uint64_t handle) {
+  vqro::rpc::WriteOperation op;
+  op.set_series_handle(handle);
+  op.add_datapoints()->set_timestamp(handle * 10);
+  return wal.Append(op);
+}
+
+
+// The segment files in dir, oldest first.
+vector<string> Segments(const string& dir) {
+  vector<string> names;
+  DirectoryHandle dir_handle(dir);
+  struct dirent64* entry;
+  while ((entry = readdir64(dir_handle.stream)) != NULL) {
+    if (strstr(entry->d_name, ".wal"))
+      names.push_back(entry->d_name);
+  }
+  std::sort(names.begin(), names.end(), [] (const string& a, const string& b) {
+    return std::stoull(a) < std::stoull(b);
+  });
+  return names;
+}
+
+
+class WriteAheadLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir = MakeTestDirForTest();
+  }
+
+  void TearDown() override {
+    FLAGS_wal_segment_size = wal_segment_size;
+    FLAGS_wal_group_commit_delay_us = wal_group_commit_delay_us;
+  }
+
+  const int64_t wal_segment_size = FLAGS_wal_segment_size;
+  const int32_t wal_group_commit_delay_us = FLAGS_wal_group_commit_delay_us;
+
+  string dir;
+};
+
+
+TEST_F(WriteAheadLogTest, GroupCommitMakesConcurrentAppendsDurable) {
+  // Long enough that appends from every thread share a few fsyncs.
+  FLAGS_wal_group_commit_delay_us = 20000;
+  {
+    WriteAheadLog wal(dir);
+    EXPECT_TRUE(ReplayAll(wal).empty());
+    wal.Start();
+
+    vector<std::thread> threads;
+    vector<uint64_t> last_lsns(4);
+    for (size_t t = 0; t < 4; t++) {
+      threads.emplace_back([&wal, &last_lsns, t] {
+        for (uint64_t i = 0; i < 25; i++)
+          last_lsns[t] = AppendOp(wal, t * 100 + i);
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+
+    uint64_t last_lsn = *std::max_element(last_lsns.begin(), last_lsns.end());
+    EXPECT_EQ(last_lsn, 100);
+    wal.WaitDurable(last_lsn);
+
+    vqro::rpc::WriteBatch batch;
+    batch.add_columns()->set_series_handle(1000);
+    wal.WaitDurable(wal.Append(batch));
+  }
+
+  // Every record is replayed once, in LSN order, each thread's in the order
+  // it appended them.
+  WriteAheadLog wal(dir);
+  vector<Record> records = ReplayAll(wal);
+  ASSERT_EQ(records.size(), 101);
+  vector<uint64_t> next_handle {0, 100, 200, 300};
+  for (size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(records[i].lsn, i + 1);
+    EXPECT_EQ(records[i].type, WAL_WRITE_OPERATION);
+    uint64_t& expected = next_handle[records[i].handle / 100];
+    EXPECT_EQ(records[i].handle, expected);
+    expected++;
+  }
+  EXPECT_EQ(records[100].type, WAL_WRITE_BATCH);
+  EXPECT_EQ(records[100].handle, 1000);
+}
+
+
+TEST_F(WriteAheadLogTest, ReplayStopsAtATornTail) {
+  {
+    WriteAheadLog wal(dir);
+    wal.Start();
+    for (uint64_t handle = 1; handle <= 3; handle++)
+      wal.WaitDurable(AppendOp(wal, handle));
+  }
+
+  // Tear the last record, as a crash mid-write would.
+  vector<string> segments = Segments(dir);
+  ASSERT_EQ(segments.size(), 1);
+  string path = dir + "/" + segments[0];
+  ASSERT_EQ(truncate(path.c_str(), GetFileSize(path) - 3), 0);
+
+  {
+    WriteAheadLog wal(dir);
+    vector<Record> records = ReplayAll(wal);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[1].lsn, 2);
+    EXPECT_EQ(records[1].handle, 2);
+
+    // New records carry on after the last intact one, in a new segment.
+    wal.Start();
+    EXPECT_EQ(AppendOp(wal, 4), 3);
+    wal.WaitDurable(3);
+  }
+
+  WriteAheadLog wal(dir);
+  vector<Record> records = ReplayAll(wal);
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[2].lsn, 3);
+  EXPECT_EQ(records[2].handle, 4);
+}
+
+
+TEST_F(WriteAheadLogTest, TruncateDeletesOnlyFlushedClosedSegments) {
+  // Every batch after the first starts a new segment.
+  FLAGS_wal_segment_size = 1;
+  WriteAheadLog wal(dir);
+  wal.Start();
+  for (uint64_t handle = 1; handle <= 3; handle++) {
+    uint64_t lsn = AppendOp(wal, handle);
+    wal.WaitDurable(lsn);
+    wal.Applied(lsn);
+  }
+  EXPECT_EQ(Segments(dir), vector<string>({"1.wal", "2.wal", "3.wal"}));
+  EXPECT_EQ(wal.OldestUnapplied(), 4);
+
+  // Nothing is deleted if the flushed data can't be synced.
+  EXPECT_THROW(wal.Truncate(3, [] { throw IOError(string("sync failed")); }),
+               IOError);
+  EXPECT_EQ(Segments(dir).size(), 3);
+
+  int syncs = 0;
+  wal.Truncate(1, [&] { syncs++; });
+  EXPECT_EQ(syncs, 0);  // No segment is done with
+  EXPECT_EQ(Segments(dir).size(), 3);
+
+  wal.Truncate(2, [&] { syncs++; });
+  EXPECT_EQ(syncs, 1);
+  EXPECT_EQ(Segments(dir), vector<string>({"2.wal", "3.wal"}));
+
+  // The active segment stays however old its records are.
+  wal.Truncate(100, [&] { syncs++; });
+  EXPECT_EQ(syncs, 2);
+  EXPECT_EQ(Segments(dir), vector<string>({"3.wal"}));
+}
+
+
+} // namespace
@@ -1,68 +1,228 @@
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <exception>
+#include <memory>
 #include <stdlib.h>
 
 #include "vqro/base/base.h"
+#include "vqro/base/sortutil.h"
 #include "vqro/rpc/core.pb.h"
 #include "vqro/rpc/storage.pb.h"
 #include "vqro/db/write_buffer.h"
 #include "vqro/db/datapoint.h"
+#include "vqro/db/datapoint_directory.h"
+#include "vqro/db/write_op.h"
 
 
 DEFINE_int32(write_buffer_pages_per_alloc,
              1,
              "Datapoint write buffers grow by allocating this many "
              "pages each time the buffer fills up.");
+DEFINE_int32(write_buffer_max_merge_runs,
+             16,
+             "Unsorted write buffers holding at most this many sorted runs "
+             "are sorted by merging the runs. Buffers with more runs than "
+             "this are radix sorted on timestamp instead.");
 
 
 namespace vqro {
 namespace db {
 
 
-WriteBuffer::WriteBuffer() {
-  alloc_size = pagesize * FLAGS_write_buffer_pages_per_alloc;
+// Capacities (in datapoints) of the small allocations a buffer passes through
+// before it graduates to full allocs.
+static const size_t small_alloc_capacities[] = {4, 16, 64};
+
+
+static size_t FullAllocSize() {
+  return pagesize * std::max(FLAGS_write_buffer_pages_per_alloc, 1);
+}
+
+
+vector<size_t> WriteBuffer::AllocSizeClasses() {
+  vector<size_t> classes;
+  for (size_t small_capacity : small_alloc_capacities)
+    classes.push_back(small_capacity * datapoint_size);
+  classes.push_back(FullAllocSize());
+  return classes;
+}
+
+
+WriteBuffer::WriteBuffer(SlabAllocator* alloc) : allocator(alloc) {
+  alloc_size = FullAllocSize();
   datapoints_per_alloc = alloc_size / datapoint_size;
 }
 
 
-void WriteBuffer::Append(vqro::rpc::WriteOperation& op) {
-  Datapoint* next;
-  Datapoint* previous = nullptr;
+void WriteBuffer::Clear() {
+  for (auto alloc : allocs)
+    allocator->Free(alloc, std::min(capacity * datapoint_size, alloc_size));
+  allocs.clear();
+  capacity = 0;
+  num_datapoints = 0;
+  run_starts.clear();
+  last_timestamp = INT64_MIN;
+}
+
+
+void WriteBuffer::WriteTo(DatapointDirectory& dir) {
+  if (IsEmpty())
+    return;
 
+  if (!IsSorted())
+    Sort();
+
+  WriteOperation<WriteBuffer> write_op(this);
+  dir.Write(write_op);
+}
+
+
+std::unique_ptr<Iovec[]> WriteBuffer::GetIOVector(size_t pos,
+                                                  size_t count,
+                                                  size_t& iov_count) const
+{
+  size_t end = pos + count;
+  size_t first_alloc = pos / datapoints_per_alloc;
+  iov_count = (end - 1) / datapoints_per_alloc - first_alloc + 1;
+  std::unique_ptr<Iovec[]> iov(new Iovec[iov_count]);
+
+  // Every Iovec but the first starts at the beginning of its alloc, and every
+  // one but the last runs to the end of it.
+  for (size_t i = 0; i < iov_count; i++) {
+    size_t alloc_start = (first_alloc + i) * datapoints_per_alloc;
+    size_t from = std::max(pos, alloc_start);
+    size_t to = std::min(end, alloc_start + datapoints_per_alloc);
+    iov[i].iov_base = allocs[first_alloc + i] + (from - alloc_start);
+    iov[i].iov_len = (to - from) * datapoint_size;
+  }
+  return iov;
+}
+
+
+void WriteBuffer::Append(vqro::rpc::WriteOperation& op) {
   for (int i = 0; i < op.datapoints_size(); i++) {
     const vqro::rpc::Datapoint& op_datapoint = op.datapoints(i);
+    AppendDatapoint(op_datapoint.timestamp(),
+                    op_datapoint.value(),
+                    op_datapoint.duration());
+  }
+}
 
-    if (std::isnan(op_datapoint.value()))  // NANs not allowed
-      continue;
 
-    next = GetNextDatapoint();
-    next->timestamp = op_datapoint.timestamp();
-    next->value = op_datapoint.value();
-    next->duration = op_datapoint.duration();
-    num_datapoints++;
+void WriteBuffer::Append(const vqro::rpc::SeriesColumns& columns) {
+  const bool one_duration = columns.durations_size() <= 1;
+  const int64_t duration = columns.durations_size() ? columns.durations(0) : 0;
+
+  for (int i = 0; i < columns.timestamps_size(); i++) {
+    AppendDatapoint(columns.timestamps(i),
+                    columns.values(i),
+                    one_duration ? duration : columns.durations(i));
+  }
+}
+
+
+void WriteBuffer::AppendDatapoint(int64_t timestamp,
+                                  double value,
+                                  int64_t duration)
+{
+  if (std::isnan(value))  // NANs not allowed
+    return;
+
+  Datapoint* next = GetNextDatapoint();
+  next->timestamp = timestamp;
+  next->value = value;
+  next->duration = duration;
+
+  // A datapoint older than its predecessor starts a new sorted run, whether
+  // or not they came in the same WriteOperation.
+  if (num_datapoints && timestamp < last_timestamp)
+    run_starts.push_back(num_datapoints);
+  last_timestamp = timestamp;
+  num_datapoints++;
+}
 
-    if (sorted && previous != nullptr &&
-        next->timestamp < previous->timestamp)
-      sorted = false;
 
-    previous = next;
+void WriteBuffer::Sort() {
+  if (IsSorted())
+    return;
+
+  // Both sorts want contiguous memory, so unless we fit in one alloc we
+  // gather our datapoints into scratch space and scatter them back after.
+  std::unique_ptr<Datapoint[]> scratch(new Datapoint[num_datapoints]);
+  std::unique_ptr<Datapoint[]> gathered;
+  Datapoint* data = allocs[0];
+  if (allocs.size() > 1) {
+    gathered.reset(new Datapoint[num_datapoints]);
+    data = gathered.get();
+    CopyOut(data);
+  }
+
+  if (run_starts.size() < static_cast<size_t>(
+          std::max(FLAGS_write_buffer_max_merge_runs, 1))) {
+    std::memcpy(scratch.get(), data, num_datapoints * datapoint_size);
+    MergeRuns(scratch.get(), data, num_datapoints, run_starts,
+              std::less<Datapoint>());
+  } else {
+    RadixSortByKey(data, scratch.get(), num_datapoints,
+                   [](const Datapoint& p) { return p.timestamp; });
+  }
+
+  if (data != allocs[0])
+    CopyIn(data);
+
+  vector<size_t>().swap(run_starts);
+  last_timestamp = data[num_datapoints - 1].timestamp;
+}
+
+
+void WriteBuffer::CopyOut(Datapoint* dst) const {
+  for (size_t i = 0; i < num_datapoints; i += datapoints_per_alloc) {
+    size_t n = std::min(num_datapoints - i, datapoints_per_alloc);
+    std::memcpy(dst + i, allocs[i / datapoints_per_alloc], n * datapoint_size);
+  }
+}
+
+
+void WriteBuffer::CopyIn(const Datapoint* src) {
+  for (size_t i = 0; i < num_datapoints; i += datapoints_per_alloc) {
+    size_t n = std::min(num_datapoints - i, datapoints_per_alloc);
+    std::memcpy(allocs[i / datapoints_per_alloc], src + i, n * datapoint_size);
   }
 }
 
 
 Datapoint* WriteBuffer::GetNextDatapoint() {
-  size_t alloc_index = num_datapoints / datapoints_per_alloc;
-  size_t alloc_offset = num_datapoints % datapoints_per_alloc;
+  if (num_datapoints == capacity)
+    Grow();
+
+  return allocs[num_datapoints / datapoints_per_alloc]
+         + (num_datapoints % datapoints_per_alloc);
+}
 
-  if (alloc_index == allocs.size()) {
-    void* ptr = aligned_alloc(pagesize, alloc_size);
-    if (ptr == NULL)
-      throw std::bad_alloc();
 
-    allocs.push_back( static_cast<Datapoint*>(ptr) );
+void WriteBuffer::Grow() {
+  // Once we hold full allocs we simply add another one.
+  if (capacity >= datapoints_per_alloc) {
+    allocs.push_back(static_cast<Datapoint*>(allocator->Allocate(alloc_size)));
+    capacity += datapoints_per_alloc;
+    return;
+  }
+
+  // Otherwise move up to the next size class, copying over what we have.
+  size_t new_size = allocator->SizeClass((capacity + 1) * datapoint_size);
+  new_size = std::min(std::max(new_size, (capacity + 1) * datapoint_size),
+                      alloc_size);
+  Datapoint* bigger = static_cast<Datapoint*>(allocator->Allocate(new_size));
+
+  if (!allocs.empty()) {
+    std::copy(allocs[0], allocs[0] + num_datapoints, bigger);
+    allocator->Free(allocs[0], capacity * datapoint_size);
+    allocs[0] = bigger;
+  } else {
+    allocs.push_back(bigger);
   }
-  return allocs[alloc_index] + alloc_offset;
+  capacity = new_size / datapoint_size;
 }
 
 
@@ -1,9 +1,13 @@
 #ifndef VQRO_DB_WRITE_OP_H
 #define VQRO_DB_WRITE_OP_H
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include "vqro/base/base.h"
+#include "vqro/base/fileutil.h"
+#include "vqro/db/datapoint.h"
+#include "vqro/db/raw_buffer.h"
 #include "vqro/db/write_buffer.h"
 
 
@@ -11,46 +15,60 @@ namespace vqro {
 namespace db {
 
 
+// A WriteOperation walks a sorted buffer of datapoints as they are written
+// out to DatapointFiles. It is templated on the concrete buffer type (a
+// WriteBuffer or RawBuffer) so that the write path indexes the buffer
+// directly instead of going through DatapointBuffer::Iterator. A Buffer must
+// provide Size(), At(i) and GetIOVector(pos, count, iov_count).
+template <typename Buffer>
 struct WriteOperation {
  public:
-  DatapointBuffer* const buffer;
-  DatapointBuffer::Iterator cursor;
+  Buffer* const buffer;
+  size_t cursor = 0;  // Index of the next datapoint to be written
   size_t max_writable_datapoints;
-  int64_t max_writable_timestamp;
+  int64_t max_writable_timestamp;  // Inclusive
 
-  WriteOperation(DatapointBuffer* buf) :
+  explicit WriteOperation(Buffer* buf) :
     buffer(buf),
-    cursor(buf->begin()),
     max_writable_datapoints(-1),
     max_writable_timestamp(INT64_MAX) {}
 
   WriteOperation(const WriteOperation& other) = delete; // no copying
   WriteOperation& operator=(const WriteOperation& other) = delete; // no assignment
 
-  DatapointBuffer::Iterator begin() const { return cursor; }
-  DatapointBuffer::Iterator end() const { return buffer->end(); }
-  bool Complete() { return cursor == buffer->end(); }
+  // The i'th datapoint from the cursor.
+  const Datapoint& At(size_t i) const { return buffer->At(cursor + i); }
+  const Datapoint& Current() const { return At(0); }
+  bool Complete() const { return cursor >= buffer->Size(); }
+  void Advance(size_t datapoints) { cursor += datapoints; }
 
+  // Number of datapoints from the cursor on that fit within both limits.
+  // The buffer is sorted so we can binary search for the timestamp limit.
   size_t WritableDatapoints() const {
-    size_t writable = 0;
-    auto it = cursor;
-    while (it != buffer->end() &&
-           it->timestamp < max_writable_timestamp &&
-           writable < max_writable_datapoints)
-    {
-      writable++;
-      it++;
+    if (Complete())
+      return 0;
+
+    size_t left = 0;
+    size_t right = std::min(buffer->Size() - cursor, max_writable_datapoints);
+    while (left < right) {
+      size_t middle = left + (right - left) / 2;
+      if (At(middle).timestamp > max_writable_timestamp)
+        right = middle;
+      else
+        left = middle + 1;
     }
-    return writable;
+    return left;
   }
 
-  std::unique_ptr<Iovec[]> GetIOVector(size_t& iov_len,
+  std::unique_ptr<Iovec[]> GetIOVector(size_t& iov_count,
                                        size_t& writable_datapoints) const
   {
-    return cursor.GetIOVector(iov_len,
-                              writable_datapoints,
-                              max_writable_datapoints,
-                              max_writable_timestamp);
+    iov_count = 0;
+    writable_datapoints = WritableDatapoints();
+    if (!writable_datapoints)
+      return nullptr;
+
+    return buffer->GetIOVector(cursor, writable_datapoints, iov_count);
   }
 };
 
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+#include "vqro/base/base.h"
+#include "vqro/base/worker.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/db.h"
+#include "vqro/db/series.h"
+#include "vqro/db/write_stream.h"
+
+
+DEFINE_bool(async_writes,
+            true,
+            "Pipeline WriteDatapoints streams instead of waiting for each "
+            "WriteOperation to be applied before reading the next one.");
+DEFINE_int32(write_stream_window,
+             64,
+             "Maximum number of WriteOperations a single write stream may "
+             "have in flight on the worker threads.");
+
+
+namespace vqro {
+namespace db {
+
+
+WriteStream::WriteStream(Database* d, size_t win) :
+    db(d),
+    window(std::max(win, static_cast<size_t>(1))) {}
+
+
+vqro::rpc::WriteOperation* WriteStream::NextOperation() {
+  std::lock_guard<std::mutex> guard(mutex);
+  if (free_ops.empty()) {
+    all_ops.emplace_back(new vqro::rpc::WriteOperation());
+    return all_ops.back().get();
+  }
+  vqro::rpc::WriteOperation* op = free_ops.back();
+  free_ops.pop_back();
+  return op;
+}
+
+
+void WriteStream::Recycle(vqro::rpc::WriteOperation* op) {
+  op->Clear();
+  free_ops.push_back(op);
+}
+
+
+void WriteStream::Write(vqro::rpc::WriteOperation* op) {
+  std::shared_ptr<Series> series;
+  try {
+    db->CheckWriteBudget();
+    series = db->GetSeries(*op);
+  } catch (...) {
+    std::lock_guard<std::mutex> guard(mutex);
+    Recycle(op);
+    throw;
+  }
+  Queue(series, op, 0);
+}
+
+
+void WriteStream::Replay(const char* data, size_t len, uint64_t lsn) {
+  vqro::rpc::WriteOperation* op = NextOperation();
+  std::shared_ptr<Series> series;
+  try {
+    if (!op->ParseFromArray(data, len))
+      throw InvalidSeriesProto("unparseable WriteOperation");
+    series = db->GetSeries(*op);
+  } catch (DatabaseError& err) {  // ie. InvalidSeriesProto
+    LOG(ERROR) << "Skipping write ahead log record lsn=" << lsn << ": "
+               << err.message;
+    std::lock_guard<std::mutex> guard(mutex);
+    Recycle(op);
+    return;
+  }
+  Queue(series, op, lsn);
+}
+
+
+void WriteStream::ReplayBatch(const char* data, size_t len, uint64_t lsn) {
+  // Both are kept alive by the completion callback until every worker is
+  // done with them.
+  std::shared_ptr<vqro::rpc::WriteBatch> batch(new vqro::rpc::WriteBatch());
+  std::shared_ptr<vector<std::shared_ptr<Series>>> series;
+  try {
+    if (!batch->ParseFromArray(data, len))
+      throw InvalidSeriesProto("unparseable WriteBatch");
+    Database::ValidateBatch(*batch);
+    series.reset(new vector<std::shared_ptr<Series>>(db->GetSeries(*batch)));
+  } catch (DatabaseError& err) {  // ie. InvalidSeriesProto
+    LOG(ERROR) << "Skipping write ahead log record lsn=" << lsn << ": "
+               << err.message;
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    op_done.wait(lock, [&] { return in_flight < window; });
+    in_flight++;
+  }
+
+  db->QueueBatch(*batch, *series, lsn, [this, batch, series] (
+      uint64_t, std::exception_ptr) {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      in_flight--;
+    }
+    op_done.notify_all();
+  });
+
+  for (auto& s : *series) {
+    if (!s->is_indexed)
+      db->IndexSeries(s);
+  }
+}
+
+
+void WriteStream::Queue(std::shared_ptr<Series> series,
+                        vqro::rpc::WriteOperation* op,
+                        uint64_t lsn)
+{
+  WorkerThread* worker = db->GetWorker(series.get());
+
+  // The task holds a reference so the series can't be evicted before it runs.
+  // Ops without an lsn are logged only once the worker has taken them, like
+  // Database::Write()'s, so a failed log fails the op rather than the stream.
+  auto apply = [this, series, op, lsn] {
+    std::exception_ptr error;
+    uint64_t op_lsn = lsn;
+    try {
+      if (!op_lsn && db->wal)
+        op_lsn = db->wal->Append(*op);
+      db->ApplyWrite(series.get(), *op, op_lsn);
+    } catch (std::exception& e) {
+      LOG(ERROR) << "WriteStream failed to apply write: " << e.what();
+      error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      if (op_lsn > last_lsn)
+        last_lsn = op_lsn;
+      if (error && !failure)
+        failure = error;
+      Recycle(op);
+      in_flight--;
+    }
+    op_done.notify_all();
+  };
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    op_done.wait(lock, [&] { return in_flight < window; });
+    in_flight++;
+  }
+
+  // The worker may be saturated by other streams. Rather than bounce the
+  // error to the client we wait for it to make room and try again. We must
+  // not move on to the next op until this one is queued or we would break
+  // per-series ordering.
+  while (true) {
+    try {
+      worker->Post(apply);
+      break;
+    } catch (WorkerThreadTooBusy& err) {
+      worker->WaitForRoom(100);
+    }
+  }
+
+  if (!series->is_indexed)
+    db->IndexSeries(series);
+}
+
+
+void WriteStream::Wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  op_done.wait(lock, [&] { return in_flight == 0; });
+}
+
+
+void WriteStream::WaitDurable() {
+  Wait();
+  if (failure)
+    std::rethrow_exception(failure);
+  if (last_lsn)
+    db->wal->WaitDurable(last_lsn);
+}
+
+
+bool WriteStream::Failed() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return failure != nullptr;
+}
+
+
+size_t WriteStream::InFlight() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return in_flight;
+}
+
+
+} // namespace db
+} // namespace vqro
@@ -0,0 +1,99 @@
+#ifndef VQRO_DB_WRITE_STREAM_H
+#define VQRO_DB_WRITE_STREAM_H
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+
+
+DECLARE_bool(async_writes);
+DECLARE_int32(write_stream_window);
+
+
+namespace vqro {
+namespace db {
+
+
+class Database;
+class Series;
+
+
+// A WriteStream pipelines the WriteOperations of a single client stream onto
+// the database's worker threads. Write() hands an op to the worker that owns
+// its series and returns without waiting for it to be applied, so the caller
+// can go back to decoding the next message while earlier ones are still in
+// flight.
+//
+// Ops for the same series always land on the same worker, whose task queue is
+// FIFO, so per-series ordering is preserved. At most 'window' ops may be in
+// flight at once; Write() blocks when the window is full.
+//
+// WriteOperation protos are recycled through a small pool owned by the stream
+// so steady-state writes don't allocate. Use NextOperation() to get an op to
+// decode into, then pass it to Write() which takes it back.
+class WriteStream {
+ public:
+  WriteStream(Database* d, size_t win);
+  ~WriteStream() { Wait(); }
+
+  WriteStream(const WriteStream& other) = delete;
+  WriteStream& operator=(const WriteStream& other) = delete;
+
+  vqro::rpc::WriteOperation* NextOperation();
+
+  // Queues op to be logged to the write ahead log (if enabled) and applied
+  // on its series' worker thread. op is returned to the pool once applied,
+  // or immediately if this throws (ie. InvalidSeriesProto, StaleSeriesHandle,
+  // or WriteBackpressure if the database is over its write buffer memory
+  // budget).
+  void Write(vqro::rpc::WriteOperation* op);
+
+  // Queues a serialized op that was read back from the write ahead log.
+  void Replay(const char* data, size_t len, uint64_t lsn);
+
+  // Queues a serialized WriteBatch read back from the write ahead log. It
+  // counts as a single op against the window.
+  void ReplayBatch(const char* data, size_t len, uint64_t lsn);
+
+  // Blocks until every op passed to Write() has been applied.
+  void Wait();
+
+  // Like Wait() but also blocks until every op is durable in the write ahead
+  // log. Rethrows the error of the first op that failed to be logged or
+  // applied, and throws IOError if the log has failed.
+  void WaitDurable();
+
+  // Whether an op has failed to be logged or applied. Callers should stop
+  // writing once one has and collect the error from WaitDurable().
+  bool Failed();
+
+  size_t InFlight();
+
+ private:
+  Database* const db;
+  const size_t window;
+
+  std::mutex mutex;
+  std::condition_variable op_done;
+  size_t in_flight = 0;
+  uint64_t last_lsn = 0;
+  std::exception_ptr failure;  // Of the first op that failed
+  vector<std::unique_ptr<vqro::rpc::WriteOperation>> all_ops;
+  vector<vqro::rpc::WriteOperation*> free_ops;
+
+  void Recycle(vqro::rpc::WriteOperation* op);
+  void Queue(std::shared_ptr<Series> series,
+             vqro::rpc::WriteOperation* op,
+             uint64_t lsn);
+};
+
+
+} // namespace db
+} // namespace vqro
+
+#endif // VQRO_DB_WRITE_STREAM_H
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "vqro/base/base.h"
+#include "vqro/rpc/storage.pb.h"
+#include "vqro/db/db.h"
+#include "vqro/db/test_util.h"
+#include "vqro/db/write_stream.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using namespace vqro;
+using namespace vqro::db;
+
+
+vqro::rpc::Series MakeProto(const string& name) {
+  vqro::rpc::Series proto;
+  (*proto.mutable_labels())["name"] = name;
+  return proto;
+}
+
+
+vector<Datapoint> ReadAll(Database* db, const string& name) {
+  vector<Datapoint> points;
+  db->Read(MakeProto(name), INT64_MIN, INT64_MAX, -1, false,
+           [&] (Datapoint* batch, size_t n) {
+             points.insert(points.end(), batch, batch + n);
+           });
+  return points;
+}
+
+
+// Writes op i of a series as datapoints at i and i + 1. Reads keep whichever
+// write to a timestamp was applied first, so the datapoint at i + 1 reads as
+// op i's only if op i was applied before op i + 1.
+void WriteOrdered(WriteStream& stream, const string& name, int i) {
+  vqro::rpc::WriteOperation* op = stream.NextOperation();
+  *op->mutable_series() = MakeProto(name);
+  vqro::rpc::Datapoint* point = op->add_datapoints();
+  point->set_timestamp(i);
+  point->set_value(i);
+  point = op->add_datapoints();
+  point->set_timestamp(i + 1);
+  point->set_value(-i);
+  stream.Write(op);
+}
+
+
+// What WriteOrdered() ops 0 to count - 1 read back as if applied in order.
+vector<Datapoint> AppliedInOrder(int count) {
+  vector<Datapoint> points {Datapoint(0, 0, 0)};
+  for (int i = 1; i <= count; i++)
+    points.push_back(Datapoint(i, 1 - i, 0));
+  return points;
+}
+
+
+class WriteStreamTest : public DatabaseTest {};
+
+
+TEST_F(WriteStreamTest, WindowCapsOpsInFlight) {
+  const size_t window = 4;
+  const int count = 20;
+  WriteStream stream(db.get(), window);
+  VoidFunc release = BlockWorkers();
+
+  std::atomic<int> written {0};
+  std::thread writer([&] {
+    for (int i = 0; i < count; i++) {
+      WriteOrdered(stream, "a", i);
+      WriteOrdered(stream, "b", i);
+      written += 2;
+    }
+  });
+
+  // With the workers held up the writer fills the window and blocks.
+  for (int i = 0; i < 5000 && stream.InFlight() < window; i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(stream.InFlight(), window);
+  EXPECT_EQ(written, window);
+
+  release();
+  writer.join();
+  stream.WaitDurable();
+  EXPECT_EQ(stream.InFlight(), 0);
+  EXPECT_FALSE(stream.Failed());
+
+  EXPECT_EQ(ReadAll(db.get(), "a"), AppliedInOrder(count));
+  EXPECT_EQ(ReadAll(db.get(), "b"), AppliedInOrder(count));
+}
+
+
+TEST_F(WriteStreamTest, RefusedOpsAreRecycled) {
+  WriteStream stream(db.get(), 4);
+  vqro::rpc::WriteOperation* op = stream.NextOperation();
+  op->set_series_handle(12345);  // Of no generation
+  vqro::rpc::Datapoint* point = op->add_datapoints();
+  point->set_timestamp(1000);
+  point->set_value(1);
+  EXPECT_THROW(stream.Write(op), StaleSeriesHandle);
+
+  // The op is back in the pool, cleared for the next message.
+  EXPECT_EQ(stream.NextOperation(), op);
+  EXPECT_EQ(op->ByteSizeLong(), 0);
+  EXPECT_EQ(stream.InFlight(), 0);
+
+  // A refusal isn't a failure of the stream.
+  WriteOrdered(stream, "a", 0);
+  stream.WaitDurable();
+  EXPECT_FALSE(stream.Failed());
+  EXPECT_EQ(ReadAll(db.get(), "a"), AppliedInOrder(1));
+}
+
+
+} // namespace
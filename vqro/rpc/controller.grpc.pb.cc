@@ -1,17 +1,24 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: controller.proto
 
 #include "controller.pb.h"
 #include "controller.grpc.pb.h"
 
-#include <grpc++/channel.h>
-#include <grpc++/impl/client_unary_call.h>
-#include <grpc++/impl/rpc_service_method.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/async_stream.h>
-#include <grpc++/support/sync_stream.h>
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace vqro {
 namespace rpc {
 
@@ -20,36 +27,87 @@ static const char* VaqueroController_method_names[] = {
   "/vqro.rpc.VaqueroController/ExchangeState",
 };
 
-std::unique_ptr< VaqueroController::Stub> VaqueroController::NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options) {
-  std::unique_ptr< VaqueroController::Stub> stub(new VaqueroController::Stub(channel));
+std::unique_ptr< VaqueroController::Stub> VaqueroController::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< VaqueroController::Stub> stub(new VaqueroController::Stub(channel, options));
   return stub;
 }
 
-VaqueroController::Stub::Stub(const std::shared_ptr< ::grpc::Channel>& channel)
-  : channel_(channel), rpcmethod_LocateSeries_(VaqueroController_method_names[0], ::grpc::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ExchangeState_(VaqueroController_method_names[1], ::grpc::RpcMethod::NORMAL_RPC, channel)
+VaqueroController::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_LocateSeries_(VaqueroController_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ExchangeState_(VaqueroController_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status VaqueroController::Stub::LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::vqro::rpc::LocateSeriesResults* response) {
-  return ::grpc::BlockingUnaryCall(channel_.get(), rpcmethod_LocateSeries_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_LocateSeries_, context, request, response);
+}
+
+void VaqueroController::Stub::async::LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LocateSeries_, context, request, response, std::move(f));
+}
+
+void VaqueroController::Stub::async::LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LocateSeries_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>* VaqueroController::Stub::PrepareAsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::vqro::rpc::LocateSeriesResults, ::vqro::rpc::SeriesQuery, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_LocateSeries_, context, request);
 }
 
 ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>* VaqueroController::Stub::AsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
-  return new ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>(channel_.get(), cq, rpcmethod_LocateSeries_, context, request);
+  auto* result =
+    this->PrepareAsyncLocateSeriesRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
 ::grpc::Status VaqueroController::Stub::ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::vqro::rpc::ExchangeStateResponse* response) {
-  return ::grpc::BlockingUnaryCall(channel_.get(), rpcmethod_ExchangeState_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ExchangeState_, context, request, response);
+}
+
+void VaqueroController::Stub::async::ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExchangeState_, context, request, response, std::move(f));
+}
+
+void VaqueroController::Stub::async::ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExchangeState_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>* VaqueroController::Stub::PrepareAsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::vqro::rpc::ExchangeStateResponse, ::vqro::rpc::ExchangeStateRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ExchangeState_, context, request);
 }
 
 ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>* VaqueroController::Stub::AsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
-  return new ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>(channel_.get(), cq, rpcmethod_ExchangeState_, context, request);
+  auto* result =
+    this->PrepareAsyncExchangeStateRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
-VaqueroController::AsyncService::AsyncService() : ::grpc::AsynchronousService(VaqueroController_method_names, 2) {}
+VaqueroController::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroController_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< VaqueroController::Service, ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](VaqueroController::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::SeriesQuery* req,
+             ::vqro::rpc::LocateSeriesResults* resp) {
+               return service->LocateSeries(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroController_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< VaqueroController::Service, ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](VaqueroController::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::ExchangeStateRequest* req,
+             ::vqro::rpc::ExchangeStateResponse* resp) {
+               return service->ExchangeState(ctx, req, resp);
+             }, this)));
+}
 
 VaqueroController::Service::~Service() {
-  delete service_;
 }
 
 ::grpc::Status VaqueroController::Service::LocateSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response) {
@@ -59,10 +117,6 @@ VaqueroController::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroController::AsyncService::RequestLocateSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::LocateSeriesResults>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-}
-
 ::grpc::Status VaqueroController::Service::ExchangeState(::grpc::ServerContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response) {
   (void) context;
   (void) request;
@@ -70,28 +124,6 @@ void VaqueroController::AsyncService::RequestLocateSeries(::grpc::ServerContext*
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroController::AsyncService::RequestExchangeState(::grpc::ServerContext* context, ::vqro::rpc::ExchangeStateRequest* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::ExchangeStateResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-}
-
-::grpc::RpcService* VaqueroController::Service::service() {
-  if (service_ != nullptr) {
-    return service_;
-  }
-  service_ = new ::grpc::RpcService();
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroController_method_names[0],
-      ::grpc::RpcMethod::NORMAL_RPC,
-      new ::grpc::RpcMethodHandler< VaqueroController::Service, ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>(
-          std::mem_fn(&VaqueroController::Service::LocateSeries), this)));
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroController_method_names[1],
-      ::grpc::RpcMethod::NORMAL_RPC,
-      new ::grpc::RpcMethodHandler< VaqueroController::Service, ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>(
-          std::mem_fn(&VaqueroController::Service::ExchangeState), this)));
-  return service_;
-}
-
 
 }  // namespace vqro
 }  // namespace rpc
@@ -1,4 +1,4 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: controller.proto
 #ifndef GRPC_controller_2eproto__INCLUDED
@@ -6,28 +6,33 @@
 
 #include "controller.pb.h"
 
-#include <grpc++/support/async_stream.h>
-#include <grpc++/impl/rpc_method.h>
-#include <grpc++/impl/proto_utils.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/status.h>
-#include <grpc++/support/stub_options.h>
-#include <grpc++/support/sync_stream.h>
-
-namespace grpc {
-class CompletionQueue;
-class Channel;
-class RpcService;
-class ServerCompletionQueue;
-class ServerContext;
-}  // namespace grpc
+#include <functional>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace vqro {
 namespace rpc {
 
-class VaqueroController GRPC_FINAL {
+class VaqueroController final {
  public:
+  static constexpr char const* service_full_name() {
+    return "vqro.rpc.VaqueroController";
+  }
   class StubInterface {
    public:
     virtual ~StubInterface() {}
@@ -35,52 +40,356 @@ class VaqueroController GRPC_FINAL {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>> AsyncLocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>>(AsyncLocateSeriesRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>> PrepareAsyncLocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>>(PrepareAsyncLocateSeriesRaw(context, request, cq));
+    }
     virtual ::grpc::Status ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::vqro::rpc::ExchangeStateResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>> AsyncExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>>(AsyncExchangeStateRaw(context, request, cq));
     }
-  private:
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>> PrepareAsyncExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>>(PrepareAsyncExchangeStateRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>* AsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::LocateSeriesResults>* PrepareAsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>* AsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::ExchangeStateResponse>* PrepareAsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
-  class Stub GRPC_FINAL : public StubInterface {
+  class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::Channel>& channel);
-    ::grpc::Status LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::vqro::rpc::LocateSeriesResults* response) GRPC_OVERRIDE;
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::vqro::rpc::LocateSeriesResults* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>> AsyncLocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>>(AsyncLocateSeriesRaw(context, request, cq));
     }
-    ::grpc::Status ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::vqro::rpc::ExchangeStateResponse* response) GRPC_OVERRIDE;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>> PrepareAsyncLocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>>(PrepareAsyncLocateSeriesRaw(context, request, cq));
+    }
+    ::grpc::Status ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::vqro::rpc::ExchangeStateResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>> AsyncExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>>(AsyncExchangeStateRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>> PrepareAsyncExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>>(PrepareAsyncExchangeStateRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, std::function<void(::grpc::Status)>) override;
+      void LocateSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, std::function<void(::grpc::Status)>) override;
+      void ExchangeState(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
 
    private:
-    std::shared_ptr< ::grpc::Channel> channel_;
-    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>* AsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) GRPC_OVERRIDE;
-    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>* AsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) GRPC_OVERRIDE;
-    const ::grpc::RpcMethod rpcmethod_LocateSeries_;
-    const ::grpc::RpcMethod rpcmethod_ExchangeState_;
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>* AsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::LocateSeriesResults>* PrepareAsyncLocateSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>* AsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::ExchangeStateResponse>* PrepareAsyncExchangeStateRaw(::grpc::ClientContext* context, const ::vqro::rpc::ExchangeStateRequest& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_LocateSeries_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExchangeState_;
   };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
-  class Service : public ::grpc::SynchronousService {
+  class Service : public ::grpc::Service {
    public:
-    Service() : service_(nullptr) {}
+    Service();
     virtual ~Service();
     virtual ::grpc::Status LocateSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response);
     virtual ::grpc::Status ExchangeState(::grpc::ServerContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response);
-    ::grpc::RpcService* service() GRPC_OVERRIDE GRPC_FINAL;
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_LocateSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestLocateSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::LocateSeriesResults>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchangeState(::grpc::ServerContext* context, ::vqro::rpc::ExchangeStateRequest* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::ExchangeStateResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_LocateSeries<WithAsyncMethod_ExchangeState<Service > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_LocateSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::SeriesQuery* request, ::vqro::rpc::LocateSeriesResults* response) { return this->LocateSeries(context, request, response); }));}
+    void SetMessageAllocatorFor_LocateSeries(
+        ::grpc::MessageAllocator< ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* LocateSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::ExchangeStateRequest* request, ::vqro::rpc::ExchangeStateResponse* response) { return this->ExchangeState(context, request, response); }));}
+    void SetMessageAllocatorFor_ExchangeState(
+        ::grpc::MessageAllocator< ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ExchangeState(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_LocateSeries<WithCallbackMethod_ExchangeState<Service > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_LocateSeries : public BaseClass {
    private:
-    ::grpc::RpcService* service_;
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
   };
-  class AsyncService GRPC_FINAL : public ::grpc::AsynchronousService {
+  template <class BaseClass>
+  class WithGenericMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    explicit AsyncService();
-    ~AsyncService() {};
-    void RequestLocateSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::LocateSeriesResults>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
-    void RequestExchangeState(::grpc::ServerContext* context, ::vqro::rpc::ExchangeStateRequest* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::ExchangeStateResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
+    WithGenericMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_LocateSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestLocateSeries(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchangeState(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_LocateSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->LocateSeries(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* LocateSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ExchangeState(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ExchangeState(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_LocateSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_LocateSeries() {
+      ::grpc::Service::MarkMethodStreamed(0,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::vqro::rpc::SeriesQuery, ::vqro::rpc::LocateSeriesResults>* streamer) {
+                       return this->StreamedLocateSeries(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_LocateSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status LocateSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::vqro::rpc::LocateSeriesResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedLocateSeries(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::vqro::rpc::SeriesQuery,::vqro::rpc::LocateSeriesResults>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ExchangeState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ExchangeState() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::vqro::rpc::ExchangeStateRequest, ::vqro::rpc::ExchangeStateResponse>* streamer) {
+                       return this->StreamedExchangeState(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ExchangeState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ExchangeState(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ExchangeStateRequest* /*request*/, ::vqro::rpc::ExchangeStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedExchangeState(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::vqro::rpc::ExchangeStateRequest,::vqro::rpc::ExchangeStateResponse>* server_unary_streamer) = 0;
   };
+  typedef WithStreamedUnaryMethod_LocateSeries<WithStreamedUnaryMethod_ExchangeState<Service > > StreamedUnaryService;
+  typedef Service SplitStreamedService;
+  typedef WithStreamedUnaryMethod_LocateSeries<WithStreamedUnaryMethod_ExchangeState<Service > > StreamedService;
 };
 
 }  // namespace rpc
@@ -1,1482 +1,2290 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: controller.proto
 
-#ifndef PROTOBUF_controller_2eproto__INCLUDED
-#define PROTOBUF_controller_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_controller_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_controller_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 #include "core.pb.h"
 #include "search.pb.h"
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_controller_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_controller_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_controller_2eproto;
 namespace vqro {
 namespace rpc {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_controller_2eproto();
-void protobuf_AssignDesc_controller_2eproto();
-void protobuf_ShutdownFile_controller_2eproto();
-
-class LocateSeriesResults;
-class Server;
-class Range;
-class ServerRanges;
-class ExchangeStateRequest;
-class ExchangeStateResponse;
 class CellGlobalState;
+struct CellGlobalStateDefaultTypeInternal;
+extern CellGlobalStateDefaultTypeInternal _CellGlobalState_default_instance_;
 class CellGlobalStateDiff;
+struct CellGlobalStateDiffDefaultTypeInternal;
+extern CellGlobalStateDiffDefaultTypeInternal _CellGlobalStateDiff_default_instance_;
 class CellLocalState;
-class VaqueroState;
+struct CellLocalStateDefaultTypeInternal;
+extern CellLocalStateDefaultTypeInternal _CellLocalState_default_instance_;
+class ExchangeStateRequest;
+struct ExchangeStateRequestDefaultTypeInternal;
+extern ExchangeStateRequestDefaultTypeInternal _ExchangeStateRequest_default_instance_;
+class ExchangeStateResponse;
+struct ExchangeStateResponseDefaultTypeInternal;
+extern ExchangeStateResponseDefaultTypeInternal _ExchangeStateResponse_default_instance_;
+class LocateSeriesResults;
+struct LocateSeriesResultsDefaultTypeInternal;
+extern LocateSeriesResultsDefaultTypeInternal _LocateSeriesResults_default_instance_;
+class Range;
+struct RangeDefaultTypeInternal;
+extern RangeDefaultTypeInternal _Range_default_instance_;
+class Server;
+struct ServerDefaultTypeInternal;
+extern ServerDefaultTypeInternal _Server_default_instance_;
+class ServerRanges;
+struct ServerRangesDefaultTypeInternal;
+extern ServerRangesDefaultTypeInternal _ServerRanges_default_instance_;
 class VaqueroMetrics;
+struct VaqueroMetricsDefaultTypeInternal;
+extern VaqueroMetricsDefaultTypeInternal _VaqueroMetrics_default_instance_;
+class VaqueroState;
+struct VaqueroStateDefaultTypeInternal;
+extern VaqueroStateDefaultTypeInternal _VaqueroState_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> ::vqro::rpc::CellGlobalState* Arena::CreateMaybeMessage<::vqro::rpc::CellGlobalState>(Arena*);
+template<> ::vqro::rpc::CellGlobalStateDiff* Arena::CreateMaybeMessage<::vqro::rpc::CellGlobalStateDiff>(Arena*);
+template<> ::vqro::rpc::CellLocalState* Arena::CreateMaybeMessage<::vqro::rpc::CellLocalState>(Arena*);
+template<> ::vqro::rpc::ExchangeStateRequest* Arena::CreateMaybeMessage<::vqro::rpc::ExchangeStateRequest>(Arena*);
+template<> ::vqro::rpc::ExchangeStateResponse* Arena::CreateMaybeMessage<::vqro::rpc::ExchangeStateResponse>(Arena*);
+template<> ::vqro::rpc::LocateSeriesResults* Arena::CreateMaybeMessage<::vqro::rpc::LocateSeriesResults>(Arena*);
+template<> ::vqro::rpc::Range* Arena::CreateMaybeMessage<::vqro::rpc::Range>(Arena*);
+template<> ::vqro::rpc::Server* Arena::CreateMaybeMessage<::vqro::rpc::Server>(Arena*);
+template<> ::vqro::rpc::ServerRanges* Arena::CreateMaybeMessage<::vqro::rpc::ServerRanges>(Arena*);
+template<> ::vqro::rpc::VaqueroMetrics* Arena::CreateMaybeMessage<::vqro::rpc::VaqueroMetrics>(Arena*);
+template<> ::vqro::rpc::VaqueroState* Arena::CreateMaybeMessage<::vqro::rpc::VaqueroState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace vqro {
+namespace rpc {
 
 // ===================================================================
 
-class LocateSeriesResults : public ::google::protobuf::Message {
+class LocateSeriesResults final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.LocateSeriesResults) */ {
  public:
-  LocateSeriesResults();
-  virtual ~LocateSeriesResults();
+  inline LocateSeriesResults() : LocateSeriesResults(nullptr) {}
+  ~LocateSeriesResults() override;
+  explicit PROTOBUF_CONSTEXPR LocateSeriesResults(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LocateSeriesResults(const LocateSeriesResults& from);
+  LocateSeriesResults(LocateSeriesResults&& from) noexcept
+    : LocateSeriesResults() {
+    *this = ::std::move(from);
+  }
 
   inline LocateSeriesResults& operator=(const LocateSeriesResults& from) {
     CopyFrom(from);
     return *this;
   }
+  inline LocateSeriesResults& operator=(LocateSeriesResults&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LocateSeriesResults& default_instance() {
+    return *internal_default_instance();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LocateSeriesResults& default_instance();
+  static inline const LocateSeriesResults* internal_default_instance() {
+    return reinterpret_cast<const LocateSeriesResults*>(
+               &_LocateSeriesResults_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void UnsafeArenaSwap(LocateSeriesResults* other);
-  void Swap(LocateSeriesResults* other);
+  friend void swap(LocateSeriesResults& a, LocateSeriesResults& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LocateSeriesResults* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LocateSeriesResults* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LocateSeriesResults* New() const { return New(NULL); }
-
-  LocateSeriesResults* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LocateSeriesResults* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LocateSeriesResults>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LocateSeriesResults& from);
-  void MergeFrom(const LocateSeriesResults& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LocateSeriesResults& from) {
+    LocateSeriesResults::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LocateSeriesResults* other);
-  protected:
-  explicit LocateSeriesResults(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.LocateSeriesResults";
   }
+  protected:
+  explicit LocateSeriesResults(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kServersFieldNumber = 1,
+    kStatusFieldNumber = 2,
+  };
   // repeated .vqro.rpc.Server servers = 1;
   int servers_size() const;
+  private:
+  int _internal_servers_size() const;
+  public:
   void clear_servers();
-  static const int kServersFieldNumber = 1;
-  const ::vqro::rpc::Server& servers(int index) const;
   ::vqro::rpc::Server* mutable_servers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >*
+      mutable_servers();
+  private:
+  const ::vqro::rpc::Server& _internal_servers(int index) const;
+  ::vqro::rpc::Server* _internal_add_servers();
+  public:
+  const ::vqro::rpc::Server& servers(int index) const;
   ::vqro::rpc::Server* add_servers();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >&
       servers() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >*
-      mutable_servers();
 
-  // optional .vqro.rpc.StatusMessage status = 2;
+  // .vqro.rpc.StatusMessage status = 2;
   bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 2;
   private:
-  void _slow_mutable_status();
-  void _slow_set_allocated_status(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status);
-  ::vqro::rpc::StatusMessage* _slow_release_status();
+  bool _internal_has_status() const;
   public:
+  void clear_status();
   const ::vqro::rpc::StatusMessage& status() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::StatusMessage* release_status();
   ::vqro::rpc::StatusMessage* mutable_status();
-  ::vqro::rpc::StatusMessage* release_status();
   void set_allocated_status(::vqro::rpc::StatusMessage* status);
-  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
+  private:
+  const ::vqro::rpc::StatusMessage& _internal_status() const;
+  ::vqro::rpc::StatusMessage* _internal_mutable_status();
+  public:
   void unsafe_arena_set_allocated_status(
       ::vqro::rpc::StatusMessage* status);
+  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.LocateSeriesResults)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server > servers_;
-  ::vqro::rpc::StatusMessage* status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static LocateSeriesResults* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server > servers_;
+    ::vqro::rpc::StatusMessage* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Server : public ::google::protobuf::Message {
+class Server final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.Server) */ {
  public:
-  Server();
-  virtual ~Server();
+  inline Server() : Server(nullptr) {}
+  ~Server() override;
+  explicit PROTOBUF_CONSTEXPR Server(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Server(const Server& from);
+  Server(Server&& from) noexcept
+    : Server() {
+    *this = ::std::move(from);
+  }
 
   inline Server& operator=(const Server& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  inline Server& operator=(Server&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Server& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Server& default_instance() {
+    return *internal_default_instance();
+  }
   enum AddressCase {
     kIpv4Address = 2,
     kIpv6Address = 3,
     ADDRESS_NOT_SET = 0,
   };
 
-  void UnsafeArenaSwap(Server* other);
-  void Swap(Server* other);
+  static inline const Server* internal_default_instance() {
+    return reinterpret_cast<const Server*>(
+               &_Server_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Server& a, Server& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Server* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Server* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Server* New() const { return New(NULL); }
-
-  Server* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Server* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Server>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Server& from);
-  void MergeFrom(const Server& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Server& from) {
+    Server::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Server* other);
-  protected:
-  explicit Server(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.Server";
   }
+  protected:
+  explicit Server(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string name = 1;
+  enum : int {
+    kNameFieldNumber = 1,
+    kPortFieldNumber = 4,
+    kIpv4AddressFieldNumber = 2,
+    kIpv6AddressFieldNumber = 3,
+  };
+  // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
-  ::std::string* unsafe_arena_release_name();
-  void unsafe_arena_set_allocated_name(
-      ::std::string* name);
-
-  // optional string ipv4_address = 2;
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
   private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // int32 port = 4;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // string ipv4_address = 2;
   bool has_ipv4_address() const;
+  private:
+  bool _internal_has_ipv4_address() const;
   public:
   void clear_ipv4_address();
-  static const int kIpv4AddressFieldNumber = 2;
-  const ::std::string& ipv4_address() const;
-  void set_ipv4_address(const ::std::string& value);
-  void set_ipv4_address(const char* value);
-  void set_ipv4_address(const char* value, size_t size);
-  ::std::string* mutable_ipv4_address();
-  ::std::string* release_ipv4_address();
-  void set_allocated_ipv4_address(::std::string* ipv4_address);
-  ::std::string* unsafe_arena_release_ipv4_address();
-  void unsafe_arena_set_allocated_ipv4_address(
-      ::std::string* ipv4_address);
-
-  // optional string ipv6_address = 3;
+  const std::string& ipv4_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ipv4_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ipv4_address();
+  PROTOBUF_NODISCARD std::string* release_ipv4_address();
+  void set_allocated_ipv4_address(std::string* ipv4_address);
   private:
+  const std::string& _internal_ipv4_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ipv4_address(const std::string& value);
+  std::string* _internal_mutable_ipv4_address();
+  public:
+
+  // string ipv6_address = 3;
   bool has_ipv6_address() const;
+  private:
+  bool _internal_has_ipv6_address() const;
   public:
   void clear_ipv6_address();
-  static const int kIpv6AddressFieldNumber = 3;
-  const ::std::string& ipv6_address() const;
-  void set_ipv6_address(const ::std::string& value);
-  void set_ipv6_address(const char* value);
-  void set_ipv6_address(const char* value, size_t size);
-  ::std::string* mutable_ipv6_address();
-  ::std::string* release_ipv6_address();
-  void set_allocated_ipv6_address(::std::string* ipv6_address);
-  ::std::string* unsafe_arena_release_ipv6_address();
-  void unsafe_arena_set_allocated_ipv6_address(
-      ::std::string* ipv6_address);
-
-  // optional int32 port = 4;
-  void clear_port();
-  static const int kPortFieldNumber = 4;
-  ::google::protobuf::int32 port() const;
-  void set_port(::google::protobuf::int32 value);
+  const std::string& ipv6_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ipv6_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ipv6_address();
+  PROTOBUF_NODISCARD std::string* release_ipv6_address();
+  void set_allocated_ipv6_address(std::string* ipv6_address);
+  private:
+  const std::string& _internal_ipv6_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ipv6_address(const std::string& value);
+  std::string* _internal_mutable_ipv6_address();
+  public:
 
+  void clear_address();
   AddressCase address_case() const;
   // @@protoc_insertion_point(class_scope:vqro.rpc.Server)
  private:
-  inline void set_has_ipv4_address();
-  inline void set_has_ipv6_address();
+  class _Internal;
+  void set_has_ipv4_address();
+  void set_has_ipv6_address();
 
   inline bool has_address() const;
-  void clear_address();
   inline void clear_has_address();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::int32 port_;
-  union AddressUnion {
-    AddressUnion() {}
-    ::google::protobuf::internal::ArenaStringPtr ipv4_address_;
-    ::google::protobuf::internal::ArenaStringPtr ipv6_address_;
-  } address_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static Server* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t port_;
+    union AddressUnion {
+      constexpr AddressUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ipv4_address_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ipv6_address_;
+    } address_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Range : public ::google::protobuf::Message {
+class Range final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.Range) */ {
  public:
-  Range();
-  virtual ~Range();
+  inline Range() : Range(nullptr) {}
+  ~Range() override;
+  explicit PROTOBUF_CONSTEXPR Range(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Range(const Range& from);
+  Range(Range&& from) noexcept
+    : Range() {
+    *this = ::std::move(from);
+  }
 
   inline Range& operator=(const Range& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Range& operator=(Range&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Range& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Range* internal_default_instance() {
+    return reinterpret_cast<const Range*>(
+               &_Range_default_instance_);
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Range& default_instance();
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void UnsafeArenaSwap(Range* other);
-  void Swap(Range* other);
+  friend void swap(Range& a, Range& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Range* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Range* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Range* New() const { return New(NULL); }
-
-  Range* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Range* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Range>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Range& from);
-  void MergeFrom(const Range& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Range& from) {
+    Range::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Range* other);
-  protected:
-  explicit Range(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.Range";
   }
+  protected:
+  explicit Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 lower_bound = 1;
+  enum : int {
+    kLowerBoundFieldNumber = 1,
+    kUpperBoundFieldNumber = 2,
+    kNotSyncedFieldNumber = 3,
+  };
+  // int32 lower_bound = 1;
   void clear_lower_bound();
-  static const int kLowerBoundFieldNumber = 1;
-  ::google::protobuf::int32 lower_bound() const;
-  void set_lower_bound(::google::protobuf::int32 value);
+  int32_t lower_bound() const;
+  void set_lower_bound(int32_t value);
+  private:
+  int32_t _internal_lower_bound() const;
+  void _internal_set_lower_bound(int32_t value);
+  public:
 
-  // optional int32 upper_bound = 2;
+  // int32 upper_bound = 2;
   void clear_upper_bound();
-  static const int kUpperBoundFieldNumber = 2;
-  ::google::protobuf::int32 upper_bound() const;
-  void set_upper_bound(::google::protobuf::int32 value);
+  int32_t upper_bound() const;
+  void set_upper_bound(int32_t value);
+  private:
+  int32_t _internal_upper_bound() const;
+  void _internal_set_upper_bound(int32_t value);
+  public:
 
-  // optional bool not_synced = 3;
+  // bool not_synced = 3;
   void clear_not_synced();
-  static const int kNotSyncedFieldNumber = 3;
   bool not_synced() const;
   void set_not_synced(bool value);
+  private:
+  bool _internal_not_synced() const;
+  void _internal_set_not_synced(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.Range)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::int32 lower_bound_;
-  ::google::protobuf::int32 upper_bound_;
-  bool not_synced_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static Range* default_instance_;
+  struct Impl_ {
+    int32_t lower_bound_;
+    int32_t upper_bound_;
+    bool not_synced_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerRanges : public ::google::protobuf::Message {
+class ServerRanges final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.ServerRanges) */ {
  public:
-  ServerRanges();
-  virtual ~ServerRanges();
+  inline ServerRanges() : ServerRanges(nullptr) {}
+  ~ServerRanges() override;
+  explicit PROTOBUF_CONSTEXPR ServerRanges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ServerRanges(const ServerRanges& from);
+  ServerRanges(ServerRanges&& from) noexcept
+    : ServerRanges() {
+    *this = ::std::move(from);
+  }
 
   inline ServerRanges& operator=(const ServerRanges& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ServerRanges& operator=(ServerRanges&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ServerRanges& default_instance();
+  static const ServerRanges& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerRanges* internal_default_instance() {
+    return reinterpret_cast<const ServerRanges*>(
+               &_ServerRanges_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void UnsafeArenaSwap(ServerRanges* other);
-  void Swap(ServerRanges* other);
+  friend void swap(ServerRanges& a, ServerRanges& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerRanges* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerRanges* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ServerRanges* New() const { return New(NULL); }
-
-  ServerRanges* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ServerRanges* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerRanges>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ServerRanges& from);
-  void MergeFrom(const ServerRanges& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerRanges& from) {
+    ServerRanges::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ServerRanges* other);
-  protected:
-  explicit ServerRanges(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.ServerRanges";
   }
+  protected:
+  explicit ServerRanges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.Server server = 1;
+  enum : int {
+    kRangeFieldNumber = 2,
+    kServerFieldNumber = 1,
+  };
+  // repeated .vqro.rpc.Range range = 2;
+  int range_size() const;
+  private:
+  int _internal_range_size() const;
+  public:
+  void clear_range();
+  ::vqro::rpc::Range* mutable_range(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Range >*
+      mutable_range();
+  private:
+  const ::vqro::rpc::Range& _internal_range(int index) const;
+  ::vqro::rpc::Range* _internal_add_range();
+  public:
+  const ::vqro::rpc::Range& range(int index) const;
+  ::vqro::rpc::Range* add_range();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Range >&
+      range() const;
+
+  // .vqro.rpc.Server server = 1;
   bool has_server() const;
-  void clear_server();
-  static const int kServerFieldNumber = 1;
   private:
-  void _slow_mutable_server();
-  void _slow_set_allocated_server(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::Server** server);
-  ::vqro::rpc::Server* _slow_release_server();
+  bool _internal_has_server() const;
   public:
+  void clear_server();
   const ::vqro::rpc::Server& server() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::Server* release_server();
   ::vqro::rpc::Server* mutable_server();
-  ::vqro::rpc::Server* release_server();
   void set_allocated_server(::vqro::rpc::Server* server);
-  ::vqro::rpc::Server* unsafe_arena_release_server();
+  private:
+  const ::vqro::rpc::Server& _internal_server() const;
+  ::vqro::rpc::Server* _internal_mutable_server();
+  public:
   void unsafe_arena_set_allocated_server(
       ::vqro::rpc::Server* server);
-
-  // repeated .vqro.rpc.Range range = 2;
-  int range_size() const;
-  void clear_range();
-  static const int kRangeFieldNumber = 2;
-  const ::vqro::rpc::Range& range(int index) const;
-  ::vqro::rpc::Range* mutable_range(int index);
-  ::vqro::rpc::Range* add_range();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Range >&
-      range() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Range >*
-      mutable_range();
+  ::vqro::rpc::Server* unsafe_arena_release_server();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.ServerRanges)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::vqro::rpc::Server* server_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Range > range_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static ServerRanges* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Range > range_;
+    ::vqro::rpc::Server* server_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ExchangeStateRequest : public ::google::protobuf::Message {
+class ExchangeStateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.ExchangeStateRequest) */ {
  public:
-  ExchangeStateRequest();
-  virtual ~ExchangeStateRequest();
+  inline ExchangeStateRequest() : ExchangeStateRequest(nullptr) {}
+  ~ExchangeStateRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExchangeStateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ExchangeStateRequest(const ExchangeStateRequest& from);
+  ExchangeStateRequest(ExchangeStateRequest&& from) noexcept
+    : ExchangeStateRequest() {
+    *this = ::std::move(from);
+  }
 
   inline ExchangeStateRequest& operator=(const ExchangeStateRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ExchangeStateRequest& operator=(ExchangeStateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExchangeStateRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ExchangeStateRequest& default_instance();
+  static inline const ExchangeStateRequest* internal_default_instance() {
+    return reinterpret_cast<const ExchangeStateRequest*>(
+               &_ExchangeStateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void UnsafeArenaSwap(ExchangeStateRequest* other);
-  void Swap(ExchangeStateRequest* other);
+  friend void swap(ExchangeStateRequest& a, ExchangeStateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExchangeStateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExchangeStateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ExchangeStateRequest* New() const { return New(NULL); }
-
-  ExchangeStateRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ExchangeStateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExchangeStateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ExchangeStateRequest& from);
-  void MergeFrom(const ExchangeStateRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExchangeStateRequest& from) {
+    ExchangeStateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ExchangeStateRequest* other);
-  protected:
-  explicit ExchangeStateRequest(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.ExchangeStateRequest";
   }
+  protected:
+  explicit ExchangeStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.CellLocalState local_state = 1;
+  enum : int {
+    kLocalStateFieldNumber = 1,
+    kOnlyDiffSinceRevisionFieldNumber = 2,
+  };
+  // .vqro.rpc.CellLocalState local_state = 1;
   bool has_local_state() const;
-  void clear_local_state();
-  static const int kLocalStateFieldNumber = 1;
   private:
-  void _slow_mutable_local_state();
-  void _slow_set_allocated_local_state(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::CellLocalState** local_state);
-  ::vqro::rpc::CellLocalState* _slow_release_local_state();
+  bool _internal_has_local_state() const;
   public:
+  void clear_local_state();
   const ::vqro::rpc::CellLocalState& local_state() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::CellLocalState* release_local_state();
   ::vqro::rpc::CellLocalState* mutable_local_state();
-  ::vqro::rpc::CellLocalState* release_local_state();
   void set_allocated_local_state(::vqro::rpc::CellLocalState* local_state);
-  ::vqro::rpc::CellLocalState* unsafe_arena_release_local_state();
+  private:
+  const ::vqro::rpc::CellLocalState& _internal_local_state() const;
+  ::vqro::rpc::CellLocalState* _internal_mutable_local_state();
+  public:
   void unsafe_arena_set_allocated_local_state(
       ::vqro::rpc::CellLocalState* local_state);
+  ::vqro::rpc::CellLocalState* unsafe_arena_release_local_state();
 
-  // optional int64 only_diff_since_revision = 2;
+  // int64 only_diff_since_revision = 2;
   void clear_only_diff_since_revision();
-  static const int kOnlyDiffSinceRevisionFieldNumber = 2;
-  ::google::protobuf::int64 only_diff_since_revision() const;
-  void set_only_diff_since_revision(::google::protobuf::int64 value);
+  int64_t only_diff_since_revision() const;
+  void set_only_diff_since_revision(int64_t value);
+  private:
+  int64_t _internal_only_diff_since_revision() const;
+  void _internal_set_only_diff_since_revision(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.ExchangeStateRequest)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::vqro::rpc::CellLocalState* local_state_;
-  ::google::protobuf::int64 only_diff_since_revision_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static ExchangeStateRequest* default_instance_;
+  struct Impl_ {
+    ::vqro::rpc::CellLocalState* local_state_;
+    int64_t only_diff_since_revision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ExchangeStateResponse : public ::google::protobuf::Message {
+class ExchangeStateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.ExchangeStateResponse) */ {
  public:
-  ExchangeStateResponse();
-  virtual ~ExchangeStateResponse();
+  inline ExchangeStateResponse() : ExchangeStateResponse(nullptr) {}
+  ~ExchangeStateResponse() override;
+  explicit PROTOBUF_CONSTEXPR ExchangeStateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ExchangeStateResponse(const ExchangeStateResponse& from);
+  ExchangeStateResponse(ExchangeStateResponse&& from) noexcept
+    : ExchangeStateResponse() {
+    *this = ::std::move(from);
+  }
 
   inline ExchangeStateResponse& operator=(const ExchangeStateResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  inline ExchangeStateResponse& operator=(ExchangeStateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ExchangeStateResponse& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExchangeStateResponse& default_instance() {
+    return *internal_default_instance();
+  }
   enum StateCase {
     kFull = 1,
     kDiff = 2,
     STATE_NOT_SET = 0,
   };
 
-  void UnsafeArenaSwap(ExchangeStateResponse* other);
-  void Swap(ExchangeStateResponse* other);
+  static inline const ExchangeStateResponse* internal_default_instance() {
+    return reinterpret_cast<const ExchangeStateResponse*>(
+               &_ExchangeStateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ExchangeStateResponse& a, ExchangeStateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExchangeStateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExchangeStateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ExchangeStateResponse* New() const { return New(NULL); }
-
-  ExchangeStateResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ExchangeStateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExchangeStateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ExchangeStateResponse& from);
-  void MergeFrom(const ExchangeStateResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExchangeStateResponse& from) {
+    ExchangeStateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ExchangeStateResponse* other);
-  protected:
-  explicit ExchangeStateResponse(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.ExchangeStateResponse";
   }
+  protected:
+  explicit ExchangeStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.CellGlobalState full = 1;
+  enum : int {
+    kFullFieldNumber = 1,
+    kDiffFieldNumber = 2,
+  };
+  // .vqro.rpc.CellGlobalState full = 1;
   bool has_full() const;
-  void clear_full();
-  static const int kFullFieldNumber = 1;
   private:
-  void _slow_mutable_full();
-  void _slow_set_allocated_full(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::CellGlobalState** full);
-  ::vqro::rpc::CellGlobalState* _slow_release_full();
+  bool _internal_has_full() const;
   public:
+  void clear_full();
   const ::vqro::rpc::CellGlobalState& full() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::CellGlobalState* release_full();
   ::vqro::rpc::CellGlobalState* mutable_full();
-  ::vqro::rpc::CellGlobalState* release_full();
   void set_allocated_full(::vqro::rpc::CellGlobalState* full);
-  ::vqro::rpc::CellGlobalState* unsafe_arena_release_full();
+  private:
+  const ::vqro::rpc::CellGlobalState& _internal_full() const;
+  ::vqro::rpc::CellGlobalState* _internal_mutable_full();
+  public:
   void unsafe_arena_set_allocated_full(
       ::vqro::rpc::CellGlobalState* full);
+  ::vqro::rpc::CellGlobalState* unsafe_arena_release_full();
 
-  // optional .vqro.rpc.CellGlobalStateDiff diff = 2;
+  // .vqro.rpc.CellGlobalStateDiff diff = 2;
   bool has_diff() const;
-  void clear_diff();
-  static const int kDiffFieldNumber = 2;
   private:
-  void _slow_mutable_diff();
-  void _slow_set_allocated_diff(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::CellGlobalStateDiff** diff);
-  ::vqro::rpc::CellGlobalStateDiff* _slow_release_diff();
+  bool _internal_has_diff() const;
   public:
+  void clear_diff();
   const ::vqro::rpc::CellGlobalStateDiff& diff() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::CellGlobalStateDiff* release_diff();
   ::vqro::rpc::CellGlobalStateDiff* mutable_diff();
-  ::vqro::rpc::CellGlobalStateDiff* release_diff();
   void set_allocated_diff(::vqro::rpc::CellGlobalStateDiff* diff);
-  ::vqro::rpc::CellGlobalStateDiff* unsafe_arena_release_diff();
+  private:
+  const ::vqro::rpc::CellGlobalStateDiff& _internal_diff() const;
+  ::vqro::rpc::CellGlobalStateDiff* _internal_mutable_diff();
+  public:
   void unsafe_arena_set_allocated_diff(
       ::vqro::rpc::CellGlobalStateDiff* diff);
+  ::vqro::rpc::CellGlobalStateDiff* unsafe_arena_release_diff();
 
+  void clear_state();
   StateCase state_case() const;
   // @@protoc_insertion_point(class_scope:vqro.rpc.ExchangeStateResponse)
  private:
-  inline void set_has_full();
-  inline void set_has_diff();
+  class _Internal;
+  void set_has_full();
+  void set_has_diff();
 
   inline bool has_state() const;
-  void clear_state();
   inline void clear_has_state();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  union StateUnion {
-    StateUnion() {}
-    ::vqro::rpc::CellGlobalState* full_;
-    ::vqro::rpc::CellGlobalStateDiff* diff_;
-  } state_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static ExchangeStateResponse* default_instance_;
+  struct Impl_ {
+    union StateUnion {
+      constexpr StateUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::vqro::rpc::CellGlobalState* full_;
+      ::vqro::rpc::CellGlobalStateDiff* diff_;
+    } state_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CellGlobalState : public ::google::protobuf::Message {
+class CellGlobalState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.CellGlobalState) */ {
  public:
-  CellGlobalState();
-  virtual ~CellGlobalState();
+  inline CellGlobalState() : CellGlobalState(nullptr) {}
+  ~CellGlobalState() override;
+  explicit PROTOBUF_CONSTEXPR CellGlobalState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CellGlobalState(const CellGlobalState& from);
+  CellGlobalState(CellGlobalState&& from) noexcept
+    : CellGlobalState() {
+    *this = ::std::move(from);
+  }
 
   inline CellGlobalState& operator=(const CellGlobalState& from) {
     CopyFrom(from);
     return *this;
   }
+  inline CellGlobalState& operator=(CellGlobalState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CellGlobalState& default_instance();
+  static const CellGlobalState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellGlobalState* internal_default_instance() {
+    return reinterpret_cast<const CellGlobalState*>(
+               &_CellGlobalState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void UnsafeArenaSwap(CellGlobalState* other);
-  void Swap(CellGlobalState* other);
+  friend void swap(CellGlobalState& a, CellGlobalState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellGlobalState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellGlobalState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CellGlobalState* New() const { return New(NULL); }
-
-  CellGlobalState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  CellGlobalState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellGlobalState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CellGlobalState& from);
-  void MergeFrom(const CellGlobalState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellGlobalState& from) {
+    CellGlobalState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(CellGlobalState* other);
-  protected:
-  explicit CellGlobalState(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.CellGlobalState";
   }
+  protected:
+  explicit CellGlobalState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 revision = 1;
-  void clear_revision();
-  static const int kRevisionFieldNumber = 1;
-  ::google::protobuf::int64 revision() const;
-  void set_revision(::google::protobuf::int64 value);
-
+  enum : int {
+    kControllersFieldNumber = 2,
+    kRangeAssignmentsFieldNumber = 3,
+    kRevisionFieldNumber = 1,
+  };
   // repeated .vqro.rpc.Server controllers = 2;
   int controllers_size() const;
+  private:
+  int _internal_controllers_size() const;
+  public:
   void clear_controllers();
-  static const int kControllersFieldNumber = 2;
-  const ::vqro::rpc::Server& controllers(int index) const;
   ::vqro::rpc::Server* mutable_controllers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >*
+      mutable_controllers();
+  private:
+  const ::vqro::rpc::Server& _internal_controllers(int index) const;
+  ::vqro::rpc::Server* _internal_add_controllers();
+  public:
+  const ::vqro::rpc::Server& controllers(int index) const;
   ::vqro::rpc::Server* add_controllers();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >&
       controllers() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >*
-      mutable_controllers();
 
   // repeated .vqro.rpc.ServerRanges range_assignments = 3;
   int range_assignments_size() const;
+  private:
+  int _internal_range_assignments_size() const;
+  public:
   void clear_range_assignments();
-  static const int kRangeAssignmentsFieldNumber = 3;
-  const ::vqro::rpc::ServerRanges& range_assignments(int index) const;
   ::vqro::rpc::ServerRanges* mutable_range_assignments(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+      mutable_range_assignments();
+  private:
+  const ::vqro::rpc::ServerRanges& _internal_range_assignments(int index) const;
+  ::vqro::rpc::ServerRanges* _internal_add_range_assignments();
+  public:
+  const ::vqro::rpc::ServerRanges& range_assignments(int index) const;
   ::vqro::rpc::ServerRanges* add_range_assignments();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
       range_assignments() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-      mutable_range_assignments();
+
+  // int64 revision = 1;
+  void clear_revision();
+  int64_t revision() const;
+  void set_revision(int64_t value);
+  private:
+  int64_t _internal_revision() const;
+  void _internal_set_revision(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.CellGlobalState)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 revision_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server > controllers_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges > range_assignments_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static CellGlobalState* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server > controllers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges > range_assignments_;
+    int64_t revision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CellGlobalStateDiff : public ::google::protobuf::Message {
+class CellGlobalStateDiff final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.CellGlobalStateDiff) */ {
  public:
-  CellGlobalStateDiff();
-  virtual ~CellGlobalStateDiff();
+  inline CellGlobalStateDiff() : CellGlobalStateDiff(nullptr) {}
+  ~CellGlobalStateDiff() override;
+  explicit PROTOBUF_CONSTEXPR CellGlobalStateDiff(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CellGlobalStateDiff(const CellGlobalStateDiff& from);
+  CellGlobalStateDiff(CellGlobalStateDiff&& from) noexcept
+    : CellGlobalStateDiff() {
+    *this = ::std::move(from);
+  }
 
   inline CellGlobalStateDiff& operator=(const CellGlobalStateDiff& from) {
     CopyFrom(from);
     return *this;
   }
+  inline CellGlobalStateDiff& operator=(CellGlobalStateDiff&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CellGlobalStateDiff& default_instance() {
+    return *internal_default_instance();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CellGlobalStateDiff& default_instance();
+  static inline const CellGlobalStateDiff* internal_default_instance() {
+    return reinterpret_cast<const CellGlobalStateDiff*>(
+               &_CellGlobalStateDiff_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void UnsafeArenaSwap(CellGlobalStateDiff* other);
-  void Swap(CellGlobalStateDiff* other);
+  friend void swap(CellGlobalStateDiff& a, CellGlobalStateDiff& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellGlobalStateDiff* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellGlobalStateDiff* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CellGlobalStateDiff* New() const { return New(NULL); }
-
-  CellGlobalStateDiff* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  CellGlobalStateDiff* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellGlobalStateDiff>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CellGlobalStateDiff& from);
-  void MergeFrom(const CellGlobalStateDiff& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellGlobalStateDiff& from) {
+    CellGlobalStateDiff::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(CellGlobalStateDiff* other);
-  protected:
-  explicit CellGlobalStateDiff(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.CellGlobalStateDiff";
   }
+  protected:
+  explicit CellGlobalStateDiff(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 from_revision = 1;
-  void clear_from_revision();
-  static const int kFromRevisionFieldNumber = 1;
-  ::google::protobuf::int64 from_revision() const;
-  void set_from_revision(::google::protobuf::int64 value);
-
-  // optional int64 to_revision = 2;
-  void clear_to_revision();
-  static const int kToRevisionFieldNumber = 2;
-  ::google::protobuf::int64 to_revision() const;
-  void set_to_revision(::google::protobuf::int64 value);
-
+  enum : int {
+    kAdditionsFieldNumber = 3,
+    kRemovalsFieldNumber = 4,
+    kFromRevisionFieldNumber = 1,
+    kToRevisionFieldNumber = 2,
+  };
   // repeated .vqro.rpc.ServerRanges additions = 3;
   int additions_size() const;
+  private:
+  int _internal_additions_size() const;
+  public:
   void clear_additions();
-  static const int kAdditionsFieldNumber = 3;
-  const ::vqro::rpc::ServerRanges& additions(int index) const;
   ::vqro::rpc::ServerRanges* mutable_additions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+      mutable_additions();
+  private:
+  const ::vqro::rpc::ServerRanges& _internal_additions(int index) const;
+  ::vqro::rpc::ServerRanges* _internal_add_additions();
+  public:
+  const ::vqro::rpc::ServerRanges& additions(int index) const;
   ::vqro::rpc::ServerRanges* add_additions();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
       additions() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-      mutable_additions();
 
   // repeated .vqro.rpc.ServerRanges removals = 4;
   int removals_size() const;
+  private:
+  int _internal_removals_size() const;
+  public:
   void clear_removals();
-  static const int kRemovalsFieldNumber = 4;
-  const ::vqro::rpc::ServerRanges& removals(int index) const;
   ::vqro::rpc::ServerRanges* mutable_removals(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+      mutable_removals();
+  private:
+  const ::vqro::rpc::ServerRanges& _internal_removals(int index) const;
+  ::vqro::rpc::ServerRanges* _internal_add_removals();
+  public:
+  const ::vqro::rpc::ServerRanges& removals(int index) const;
   ::vqro::rpc::ServerRanges* add_removals();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
       removals() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-      mutable_removals();
+
+  // int64 from_revision = 1;
+  void clear_from_revision();
+  int64_t from_revision() const;
+  void set_from_revision(int64_t value);
+  private:
+  int64_t _internal_from_revision() const;
+  void _internal_set_from_revision(int64_t value);
+  public:
+
+  // int64 to_revision = 2;
+  void clear_to_revision();
+  int64_t to_revision() const;
+  void set_to_revision(int64_t value);
+  private:
+  int64_t _internal_to_revision() const;
+  void _internal_set_to_revision(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.CellGlobalStateDiff)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 from_revision_;
-  ::google::protobuf::int64 to_revision_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges > additions_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges > removals_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static CellGlobalStateDiff* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges > additions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges > removals_;
+    int64_t from_revision_;
+    int64_t to_revision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CellLocalState : public ::google::protobuf::Message {
+class CellLocalState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.CellLocalState) */ {
  public:
-  CellLocalState();
-  virtual ~CellLocalState();
+  inline CellLocalState() : CellLocalState(nullptr) {}
+  ~CellLocalState() override;
+  explicit PROTOBUF_CONSTEXPR CellLocalState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CellLocalState(const CellLocalState& from);
+  CellLocalState(CellLocalState&& from) noexcept
+    : CellLocalState() {
+    *this = ::std::move(from);
+  }
 
   inline CellLocalState& operator=(const CellLocalState& from) {
     CopyFrom(from);
     return *this;
   }
+  inline CellLocalState& operator=(CellLocalState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CellLocalState& default_instance();
+  static const CellLocalState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CellLocalState* internal_default_instance() {
+    return reinterpret_cast<const CellLocalState*>(
+               &_CellLocalState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void UnsafeArenaSwap(CellLocalState* other);
-  void Swap(CellLocalState* other);
+  friend void swap(CellLocalState& a, CellLocalState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CellLocalState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CellLocalState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CellLocalState* New() const { return New(NULL); }
-
-  CellLocalState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  CellLocalState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CellLocalState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CellLocalState& from);
-  void MergeFrom(const CellLocalState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CellLocalState& from) {
+    CellLocalState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(CellLocalState* other);
-  protected:
-  explicit CellLocalState(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.CellLocalState";
   }
+  protected:
+  explicit CellLocalState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kVaquerosFieldNumber = 1,
+  };
   // repeated .vqro.rpc.VaqueroState vaqueros = 1;
   int vaqueros_size() const;
+  private:
+  int _internal_vaqueros_size() const;
+  public:
   void clear_vaqueros();
-  static const int kVaquerosFieldNumber = 1;
-  const ::vqro::rpc::VaqueroState& vaqueros(int index) const;
   ::vqro::rpc::VaqueroState* mutable_vaqueros(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::VaqueroState >*
+      mutable_vaqueros();
+  private:
+  const ::vqro::rpc::VaqueroState& _internal_vaqueros(int index) const;
+  ::vqro::rpc::VaqueroState* _internal_add_vaqueros();
+  public:
+  const ::vqro::rpc::VaqueroState& vaqueros(int index) const;
   ::vqro::rpc::VaqueroState* add_vaqueros();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::VaqueroState >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::VaqueroState >&
       vaqueros() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::VaqueroState >*
-      mutable_vaqueros();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.CellLocalState)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::VaqueroState > vaqueros_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static CellLocalState* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::VaqueroState > vaqueros_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VaqueroState : public ::google::protobuf::Message {
+class VaqueroState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.VaqueroState) */ {
  public:
-  VaqueroState();
-  virtual ~VaqueroState();
+  inline VaqueroState() : VaqueroState(nullptr) {}
+  ~VaqueroState() override;
+  explicit PROTOBUF_CONSTEXPR VaqueroState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VaqueroState(const VaqueroState& from);
+  VaqueroState(VaqueroState&& from) noexcept
+    : VaqueroState() {
+    *this = ::std::move(from);
+  }
 
   inline VaqueroState& operator=(const VaqueroState& from) {
     CopyFrom(from);
     return *this;
   }
+  inline VaqueroState& operator=(VaqueroState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const VaqueroState& default_instance();
+  static const VaqueroState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VaqueroState* internal_default_instance() {
+    return reinterpret_cast<const VaqueroState*>(
+               &_VaqueroState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void UnsafeArenaSwap(VaqueroState* other);
-  void Swap(VaqueroState* other);
+  friend void swap(VaqueroState& a, VaqueroState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VaqueroState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VaqueroState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VaqueroState* New() const { return New(NULL); }
-
-  VaqueroState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  VaqueroState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VaqueroState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const VaqueroState& from);
-  void MergeFrom(const VaqueroState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VaqueroState& from) {
+    VaqueroState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(VaqueroState* other);
-  protected:
-  explicit VaqueroState(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.VaqueroState";
   }
+  protected:
+  explicit VaqueroState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.Server server = 1;
+  enum : int {
+    kNewSeriesFieldNumber = 3,
+    kExpiredSeriesFieldNumber = 4,
+    kServerFieldNumber = 1,
+    kMetricsFieldNumber = 2,
+  };
+  // repeated .vqro.rpc.Series new_series = 3;
+  int new_series_size() const;
+  private:
+  int _internal_new_series_size() const;
+  public:
+  void clear_new_series();
+  ::vqro::rpc::Series* mutable_new_series(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+      mutable_new_series();
+  private:
+  const ::vqro::rpc::Series& _internal_new_series(int index) const;
+  ::vqro::rpc::Series* _internal_add_new_series();
+  public:
+  const ::vqro::rpc::Series& new_series(int index) const;
+  ::vqro::rpc::Series* add_new_series();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
+      new_series() const;
+
+  // repeated .vqro.rpc.Series expired_series = 4;
+  int expired_series_size() const;
+  private:
+  int _internal_expired_series_size() const;
+  public:
+  void clear_expired_series();
+  ::vqro::rpc::Series* mutable_expired_series(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+      mutable_expired_series();
+  private:
+  const ::vqro::rpc::Series& _internal_expired_series(int index) const;
+  ::vqro::rpc::Series* _internal_add_expired_series();
+  public:
+  const ::vqro::rpc::Series& expired_series(int index) const;
+  ::vqro::rpc::Series* add_expired_series();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
+      expired_series() const;
+
+  // .vqro.rpc.Server server = 1;
   bool has_server() const;
-  void clear_server();
-  static const int kServerFieldNumber = 1;
   private:
-  void _slow_mutable_server();
-  void _slow_set_allocated_server(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::Server** server);
-  ::vqro::rpc::Server* _slow_release_server();
+  bool _internal_has_server() const;
   public:
+  void clear_server();
   const ::vqro::rpc::Server& server() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::Server* release_server();
   ::vqro::rpc::Server* mutable_server();
-  ::vqro::rpc::Server* release_server();
   void set_allocated_server(::vqro::rpc::Server* server);
-  ::vqro::rpc::Server* unsafe_arena_release_server();
+  private:
+  const ::vqro::rpc::Server& _internal_server() const;
+  ::vqro::rpc::Server* _internal_mutable_server();
+  public:
   void unsafe_arena_set_allocated_server(
       ::vqro::rpc::Server* server);
+  ::vqro::rpc::Server* unsafe_arena_release_server();
 
-  // optional .vqro.rpc.VaqueroMetrics metrics = 2;
+  // .vqro.rpc.VaqueroMetrics metrics = 2;
   bool has_metrics() const;
-  void clear_metrics();
-  static const int kMetricsFieldNumber = 2;
   private:
-  void _slow_mutable_metrics();
-  void _slow_set_allocated_metrics(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::VaqueroMetrics** metrics);
-  ::vqro::rpc::VaqueroMetrics* _slow_release_metrics();
+  bool _internal_has_metrics() const;
   public:
+  void clear_metrics();
   const ::vqro::rpc::VaqueroMetrics& metrics() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::VaqueroMetrics* release_metrics();
   ::vqro::rpc::VaqueroMetrics* mutable_metrics();
-  ::vqro::rpc::VaqueroMetrics* release_metrics();
   void set_allocated_metrics(::vqro::rpc::VaqueroMetrics* metrics);
-  ::vqro::rpc::VaqueroMetrics* unsafe_arena_release_metrics();
+  private:
+  const ::vqro::rpc::VaqueroMetrics& _internal_metrics() const;
+  ::vqro::rpc::VaqueroMetrics* _internal_mutable_metrics();
+  public:
   void unsafe_arena_set_allocated_metrics(
       ::vqro::rpc::VaqueroMetrics* metrics);
-
-  // repeated .vqro.rpc.Series new_series = 3;
-  int new_series_size() const;
-  void clear_new_series();
-  static const int kNewSeriesFieldNumber = 3;
-  const ::vqro::rpc::Series& new_series(int index) const;
-  ::vqro::rpc::Series* mutable_new_series(int index);
-  ::vqro::rpc::Series* add_new_series();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
-      new_series() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-      mutable_new_series();
-
-  // repeated .vqro.rpc.Series expired_series = 4;
-  int expired_series_size() const;
-  void clear_expired_series();
-  static const int kExpiredSeriesFieldNumber = 4;
-  const ::vqro::rpc::Series& expired_series(int index) const;
-  ::vqro::rpc::Series* mutable_expired_series(int index);
-  ::vqro::rpc::Series* add_expired_series();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
-      expired_series() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-      mutable_expired_series();
+  ::vqro::rpc::VaqueroMetrics* unsafe_arena_release_metrics();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.VaqueroState)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::vqro::rpc::Server* server_;
-  ::vqro::rpc::VaqueroMetrics* metrics_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series > new_series_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series > expired_series_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static VaqueroState* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series > new_series_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series > expired_series_;
+    ::vqro::rpc::Server* server_;
+    ::vqro::rpc::VaqueroMetrics* metrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VaqueroMetrics : public ::google::protobuf::Message {
+class VaqueroMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.VaqueroMetrics) */ {
  public:
-  VaqueroMetrics();
-  virtual ~VaqueroMetrics();
+  inline VaqueroMetrics() : VaqueroMetrics(nullptr) {}
+  ~VaqueroMetrics() override;
+  explicit PROTOBUF_CONSTEXPR VaqueroMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VaqueroMetrics(const VaqueroMetrics& from);
+  VaqueroMetrics(VaqueroMetrics&& from) noexcept
+    : VaqueroMetrics() {
+    *this = ::std::move(from);
+  }
 
   inline VaqueroMetrics& operator=(const VaqueroMetrics& from) {
     CopyFrom(from);
     return *this;
   }
+  inline VaqueroMetrics& operator=(VaqueroMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VaqueroMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VaqueroMetrics* internal_default_instance() {
+    return reinterpret_cast<const VaqueroMetrics*>(
+               &_VaqueroMetrics_default_instance_);
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const VaqueroMetrics& default_instance();
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void UnsafeArenaSwap(VaqueroMetrics* other);
-  void Swap(VaqueroMetrics* other);
+  friend void swap(VaqueroMetrics& a, VaqueroMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VaqueroMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VaqueroMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VaqueroMetrics* New() const { return New(NULL); }
-
-  VaqueroMetrics* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  VaqueroMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VaqueroMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const VaqueroMetrics& from);
-  void MergeFrom(const VaqueroMetrics& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VaqueroMetrics& from) {
+    VaqueroMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(VaqueroMetrics* other);
-  protected:
-  explicit VaqueroMetrics(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.VaqueroMetrics";
   }
+  protected:
+  explicit VaqueroMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional double cpu_usage = 1;
+  enum : int {
+    kCpuUsageFieldNumber = 1,
+    kNumSeriesWrittenToFieldNumber = 2,
+    kNumDatapointsWrittenFieldNumber = 3,
+    kStorageBytesChangeFieldNumber = 4,
+  };
+  // double cpu_usage = 1;
   void clear_cpu_usage();
-  static const int kCpuUsageFieldNumber = 1;
   double cpu_usage() const;
   void set_cpu_usage(double value);
+  private:
+  double _internal_cpu_usage() const;
+  void _internal_set_cpu_usage(double value);
+  public:
 
-  // optional int32 num_series_written_to = 2;
+  // int32 num_series_written_to = 2;
   void clear_num_series_written_to();
-  static const int kNumSeriesWrittenToFieldNumber = 2;
-  ::google::protobuf::int32 num_series_written_to() const;
-  void set_num_series_written_to(::google::protobuf::int32 value);
+  int32_t num_series_written_to() const;
+  void set_num_series_written_to(int32_t value);
+  private:
+  int32_t _internal_num_series_written_to() const;
+  void _internal_set_num_series_written_to(int32_t value);
+  public:
 
-  // optional int32 num_datapoints_written = 3;
+  // int32 num_datapoints_written = 3;
   void clear_num_datapoints_written();
-  static const int kNumDatapointsWrittenFieldNumber = 3;
-  ::google::protobuf::int32 num_datapoints_written() const;
-  void set_num_datapoints_written(::google::protobuf::int32 value);
+  int32_t num_datapoints_written() const;
+  void set_num_datapoints_written(int32_t value);
+  private:
+  int32_t _internal_num_datapoints_written() const;
+  void _internal_set_num_datapoints_written(int32_t value);
+  public:
 
-  // optional int32 storage_bytes_change = 4;
+  // int32 storage_bytes_change = 4;
   void clear_storage_bytes_change();
-  static const int kStorageBytesChangeFieldNumber = 4;
-  ::google::protobuf::int32 storage_bytes_change() const;
-  void set_storage_bytes_change(::google::protobuf::int32 value);
+  int32_t storage_bytes_change() const;
+  void set_storage_bytes_change(int32_t value);
+  private:
+  int32_t _internal_storage_bytes_change() const;
+  void _internal_set_storage_bytes_change(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.VaqueroMetrics)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  double cpu_usage_;
-  ::google::protobuf::int32 num_series_written_to_;
-  ::google::protobuf::int32 num_datapoints_written_;
-  ::google::protobuf::int32 storage_bytes_change_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_controller_2eproto();
-  friend void protobuf_AssignDesc_controller_2eproto();
-  friend void protobuf_ShutdownFile_controller_2eproto();
-
-  void InitAsDefaultInstance();
-  static VaqueroMetrics* default_instance_;
+  struct Impl_ {
+    double cpu_usage_;
+    int32_t num_series_written_to_;
+    int32_t num_datapoints_written_;
+    int32_t storage_bytes_change_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_controller_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // LocateSeriesResults
 
 // repeated .vqro.rpc.Server servers = 1;
+inline int LocateSeriesResults::_internal_servers_size() const {
+  return _impl_.servers_.size();
+}
 inline int LocateSeriesResults::servers_size() const {
-  return servers_.size();
+  return _internal_servers_size();
 }
 inline void LocateSeriesResults::clear_servers() {
-  servers_.Clear();
+  _impl_.servers_.Clear();
+}
+inline ::vqro::rpc::Server* LocateSeriesResults::mutable_servers(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LocateSeriesResults.servers)
+  return _impl_.servers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >*
+LocateSeriesResults::mutable_servers() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.LocateSeriesResults.servers)
+  return &_impl_.servers_;
+}
+inline const ::vqro::rpc::Server& LocateSeriesResults::_internal_servers(int index) const {
+  return _impl_.servers_.Get(index);
 }
 inline const ::vqro::rpc::Server& LocateSeriesResults::servers(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LocateSeriesResults.servers)
-  return servers_.Get(index);
+  return _internal_servers(index);
 }
-inline ::vqro::rpc::Server* LocateSeriesResults::mutable_servers(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LocateSeriesResults.servers)
-  return servers_.Mutable(index);
+inline ::vqro::rpc::Server* LocateSeriesResults::_internal_add_servers() {
+  return _impl_.servers_.Add();
 }
 inline ::vqro::rpc::Server* LocateSeriesResults::add_servers() {
+  ::vqro::rpc::Server* _add = _internal_add_servers();
   // @@protoc_insertion_point(field_add:vqro.rpc.LocateSeriesResults.servers)
-  return servers_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >&
 LocateSeriesResults::servers() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.LocateSeriesResults.servers)
-  return servers_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >*
-LocateSeriesResults::mutable_servers() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.LocateSeriesResults.servers)
-  return &servers_;
+  return _impl_.servers_;
 }
 
-// optional .vqro.rpc.StatusMessage status = 2;
+// .vqro.rpc.StatusMessage status = 2;
+inline bool LocateSeriesResults::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
+}
 inline bool LocateSeriesResults::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+  return _internal_has_status();
 }
-inline void LocateSeriesResults::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
+inline const ::vqro::rpc::StatusMessage& LocateSeriesResults::_internal_status() const {
+  const ::vqro::rpc::StatusMessage* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::StatusMessage&>(
+      ::vqro::rpc::_StatusMessage_default_instance_);
 }
 inline const ::vqro::rpc::StatusMessage& LocateSeriesResults::status() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LocateSeriesResults.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+  return _internal_status();
 }
-inline ::vqro::rpc::StatusMessage* LocateSeriesResults::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LocateSeriesResults.status)
-  return status_;
+inline void LocateSeriesResults::unsafe_arena_set_allocated_status(
+    ::vqro::rpc::StatusMessage* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.LocateSeriesResults.status)
 }
 inline ::vqro::rpc::StatusMessage* LocateSeriesResults::release_status() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::StatusMessage* LocateSeriesResults::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.LocateSeriesResults.status)
+  
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::StatusMessage* LocateSeriesResults::_internal_mutable_status() {
+  
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::StatusMessage>(GetArenaForAllocation());
+    _impl_.status_ = p;
   }
+  return _impl_.status_;
+}
+inline ::vqro::rpc::StatusMessage* LocateSeriesResults::mutable_status() {
+  ::vqro::rpc::StatusMessage* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LocateSeriesResults.status)
+  return _msg;
 }
 inline void LocateSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
   }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
-  }
-  status_ = status;
   if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(status));
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.status_ = status;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LocateSeriesResults.status)
 }
 
@@ -1484,296 +2292,227 @@ inline void LocateSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage
 
 // Server
 
-// optional string name = 1;
+// string name = 1;
 inline void Server::clear_name() {
-  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Server::name() const {
+inline const std::string& Server::name() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Server.name)
-  return name_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_name();
 }
-inline void Server::set_name(const ::std::string& value) {
-  
-  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Server::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.Server.name)
 }
-inline void Server::set_name(const char* value) {
-  
-  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.Server.name)
+inline std::string* Server::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.name)
+  return _s;
 }
-inline void Server::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.Server.name)
+inline const std::string& Server::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline ::std::string* Server::mutable_name() {
+inline void Server::_internal_set_name(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.name)
-  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Server::release_name() {
+inline std::string* Server::_internal_mutable_name() {
   
-  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Server::unsafe_arena_release_name() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
+inline std::string* Server::release_name() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.Server.name)
+  return _impl_.name_.Release();
 }
-inline void Server::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Server::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.name)
-}
-inline void Server::unsafe_arena_set_allocated_name(
-    ::std::string* name) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (name != NULL) {
-    
-  } else {
-    
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  
-  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      name, GetArenaNoVirtual());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.name)
 }
 
-// optional string ipv4_address = 2;
-inline bool Server::has_ipv4_address() const {
+// string ipv4_address = 2;
+inline bool Server::_internal_has_ipv4_address() const {
   return address_case() == kIpv4Address;
 }
+inline bool Server::has_ipv4_address() const {
+  return _internal_has_ipv4_address();
+}
 inline void Server::set_has_ipv4_address() {
-  _oneof_case_[0] = kIpv4Address;
+  _impl_._oneof_case_[0] = kIpv4Address;
 }
 inline void Server::clear_ipv4_address() {
-  if (has_ipv4_address()) {
-    address_.ipv4_address_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
+  if (_internal_has_ipv4_address()) {
+    _impl_.address_.ipv4_address_.Destroy();
     clear_has_address();
   }
 }
-inline const ::std::string& Server::ipv4_address() const {
+inline const std::string& Server::ipv4_address() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Server.ipv4_address)
-  if (has_ipv4_address()) {
-    return address_.ipv4_address_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_ipv4_address();
 }
-inline void Server::set_ipv4_address(const ::std::string& value) {
-  if (!has_ipv4_address()) {
+template <typename ArgT0, typename... ArgT>
+inline void Server::set_ipv4_address(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_ipv4_address()) {
     clear_address();
     set_has_ipv4_address();
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.address_.ipv4_address_.InitDefault();
   }
-  address_.ipv4_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
+  _impl_.address_.ipv4_address_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.Server.ipv4_address)
 }
-inline void Server::set_ipv4_address(const char* value) {
-  if (!has_ipv4_address()) {
-    clear_address();
-    set_has_ipv4_address();
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* Server::mutable_ipv4_address() {
+  std::string* _s = _internal_mutable_ipv4_address();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.ipv4_address)
+  return _s;
+}
+inline const std::string& Server::_internal_ipv4_address() const {
+  if (_internal_has_ipv4_address()) {
+    return _impl_.address_.ipv4_address_.Get();
   }
-  address_.ipv4_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.Server.ipv4_address)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void Server::set_ipv4_address(const char* value,
-                             size_t size) {
-  if (!has_ipv4_address()) {
+inline void Server::_internal_set_ipv4_address(const std::string& value) {
+  if (!_internal_has_ipv4_address()) {
     clear_address();
     set_has_ipv4_address();
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.address_.ipv4_address_.InitDefault();
   }
-  address_.ipv4_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.Server.ipv4_address)
+  _impl_.address_.ipv4_address_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Server::mutable_ipv4_address() {
-  if (!has_ipv4_address()) {
+inline std::string* Server::_internal_mutable_ipv4_address() {
+  if (!_internal_has_ipv4_address()) {
     clear_address();
     set_has_ipv4_address();
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return address_.ipv4_address_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.ipv4_address)
-}
-inline ::std::string* Server::release_ipv4_address() {
-  if (has_ipv4_address()) {
-    clear_has_address();
-    return address_.ipv4_address_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-  } else {
-    return NULL;
+    _impl_.address_.ipv4_address_.InitDefault();
   }
+  return _impl_.address_.ipv4_address_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* Server::unsafe_arena_release_ipv4_address() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_ipv4_address()) {
+inline std::string* Server::release_ipv4_address() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.Server.ipv4_address)
+  if (_internal_has_ipv4_address()) {
     clear_has_address();
-    return address_.ipv4_address_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+    return _impl_.address_.ipv4_address_.Release();
   } else {
-    return NULL;
-  }
-}
-inline void Server::set_allocated_ipv4_address(::std::string* ipv4_address) {
-  if (!has_ipv4_address()) {
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_address();
-  if (ipv4_address != NULL) {
-    set_has_ipv4_address();
-    address_.ipv4_address_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ipv4_address,
-        GetArenaNoVirtual());
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.ipv4_address)
 }
-inline void Server::unsafe_arena_set_allocated_ipv4_address(::std::string* ipv4_address) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_ipv4_address()) {
-    address_.ipv4_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Server::set_allocated_ipv4_address(std::string* ipv4_address) {
+  if (has_address()) {
+    clear_address();
   }
-  clear_address();
-  if (ipv4_address) {
+  if (ipv4_address != nullptr) {
     set_has_ipv4_address();
-    address_.ipv4_address_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ipv4_address, GetArenaNoVirtual());
+    _impl_.address_.ipv4_address_.InitAllocated(ipv4_address, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.ipv4_address)
 }
 
-// optional string ipv6_address = 3;
-inline bool Server::has_ipv6_address() const {
+// string ipv6_address = 3;
+inline bool Server::_internal_has_ipv6_address() const {
   return address_case() == kIpv6Address;
 }
+inline bool Server::has_ipv6_address() const {
+  return _internal_has_ipv6_address();
+}
 inline void Server::set_has_ipv6_address() {
-  _oneof_case_[0] = kIpv6Address;
+  _impl_._oneof_case_[0] = kIpv6Address;
 }
 inline void Server::clear_ipv6_address() {
-  if (has_ipv6_address()) {
-    address_.ipv6_address_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
+  if (_internal_has_ipv6_address()) {
+    _impl_.address_.ipv6_address_.Destroy();
     clear_has_address();
   }
 }
-inline const ::std::string& Server::ipv6_address() const {
+inline const std::string& Server::ipv6_address() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Server.ipv6_address)
-  if (has_ipv6_address()) {
-    return address_.ipv6_address_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_ipv6_address();
 }
-inline void Server::set_ipv6_address(const ::std::string& value) {
-  if (!has_ipv6_address()) {
+template <typename ArgT0, typename... ArgT>
+inline void Server::set_ipv6_address(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_ipv6_address()) {
     clear_address();
     set_has_ipv6_address();
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.address_.ipv6_address_.InitDefault();
   }
-  address_.ipv6_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
+  _impl_.address_.ipv6_address_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.Server.ipv6_address)
 }
-inline void Server::set_ipv6_address(const char* value) {
-  if (!has_ipv6_address()) {
-    clear_address();
-    set_has_ipv6_address();
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* Server::mutable_ipv6_address() {
+  std::string* _s = _internal_mutable_ipv6_address();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.ipv6_address)
+  return _s;
+}
+inline const std::string& Server::_internal_ipv6_address() const {
+  if (_internal_has_ipv6_address()) {
+    return _impl_.address_.ipv6_address_.Get();
   }
-  address_.ipv6_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.Server.ipv6_address)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void Server::set_ipv6_address(const char* value,
-                             size_t size) {
-  if (!has_ipv6_address()) {
+inline void Server::_internal_set_ipv6_address(const std::string& value) {
+  if (!_internal_has_ipv6_address()) {
     clear_address();
     set_has_ipv6_address();
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.address_.ipv6_address_.InitDefault();
   }
-  address_.ipv6_address_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.Server.ipv6_address)
+  _impl_.address_.ipv6_address_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Server::mutable_ipv6_address() {
-  if (!has_ipv6_address()) {
+inline std::string* Server::_internal_mutable_ipv6_address() {
+  if (!_internal_has_ipv6_address()) {
     clear_address();
     set_has_ipv6_address();
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return address_.ipv6_address_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.Server.ipv6_address)
-}
-inline ::std::string* Server::release_ipv6_address() {
-  if (has_ipv6_address()) {
-    clear_has_address();
-    return address_.ipv6_address_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-  } else {
-    return NULL;
+    _impl_.address_.ipv6_address_.InitDefault();
   }
+  return _impl_.address_.ipv6_address_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* Server::unsafe_arena_release_ipv6_address() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_ipv6_address()) {
+inline std::string* Server::release_ipv6_address() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.Server.ipv6_address)
+  if (_internal_has_ipv6_address()) {
     clear_has_address();
-    return address_.ipv6_address_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+    return _impl_.address_.ipv6_address_.Release();
   } else {
-    return NULL;
-  }
-}
-inline void Server::set_allocated_ipv6_address(::std::string* ipv6_address) {
-  if (!has_ipv6_address()) {
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return nullptr;
   }
-  clear_address();
-  if (ipv6_address != NULL) {
-    set_has_ipv6_address();
-    address_.ipv6_address_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ipv6_address,
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.ipv6_address)
 }
-inline void Server::unsafe_arena_set_allocated_ipv6_address(::std::string* ipv6_address) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_ipv6_address()) {
-    address_.ipv6_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Server::set_allocated_ipv6_address(std::string* ipv6_address) {
+  if (has_address()) {
+    clear_address();
   }
-  clear_address();
-  if (ipv6_address) {
+  if (ipv6_address != nullptr) {
     set_has_ipv6_address();
-    address_.ipv6_address_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ipv6_address, GetArenaNoVirtual());
+    _impl_.address_.ipv6_address_.InitAllocated(ipv6_address, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.Server.ipv6_address)
 }
 
-// optional int32 port = 4;
+// int32 port = 4;
 inline void Server::clear_port() {
-  port_ = 0;
+  _impl_.port_ = 0;
 }
-inline ::google::protobuf::int32 Server::port() const {
+inline int32_t Server::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t Server::port() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Server.port)
-  return port_;
+  return _internal_port();
 }
-inline void Server::set_port(::google::protobuf::int32 value) {
+inline void Server::_internal_set_port(int32_t value) {
   
-  port_ = value;
+  _impl_.port_ = value;
+}
+inline void Server::set_port(int32_t value) {
+  _internal_set_port(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Server.port)
 }
 
@@ -1781,54 +2520,72 @@ inline bool Server::has_address() const {
   return address_case() != ADDRESS_NOT_SET;
 }
 inline void Server::clear_has_address() {
-  _oneof_case_[0] = ADDRESS_NOT_SET;
+  _impl_._oneof_case_[0] = ADDRESS_NOT_SET;
 }
 inline Server::AddressCase Server::address_case() const {
-  return Server::AddressCase(_oneof_case_[0]);
+  return Server::AddressCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // Range
 
-// optional int32 lower_bound = 1;
+// int32 lower_bound = 1;
 inline void Range::clear_lower_bound() {
-  lower_bound_ = 0;
+  _impl_.lower_bound_ = 0;
 }
-inline ::google::protobuf::int32 Range::lower_bound() const {
+inline int32_t Range::_internal_lower_bound() const {
+  return _impl_.lower_bound_;
+}
+inline int32_t Range::lower_bound() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Range.lower_bound)
-  return lower_bound_;
+  return _internal_lower_bound();
 }
-inline void Range::set_lower_bound(::google::protobuf::int32 value) {
+inline void Range::_internal_set_lower_bound(int32_t value) {
   
-  lower_bound_ = value;
+  _impl_.lower_bound_ = value;
+}
+inline void Range::set_lower_bound(int32_t value) {
+  _internal_set_lower_bound(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Range.lower_bound)
 }
 
-// optional int32 upper_bound = 2;
+// int32 upper_bound = 2;
 inline void Range::clear_upper_bound() {
-  upper_bound_ = 0;
+  _impl_.upper_bound_ = 0;
 }
-inline ::google::protobuf::int32 Range::upper_bound() const {
+inline int32_t Range::_internal_upper_bound() const {
+  return _impl_.upper_bound_;
+}
+inline int32_t Range::upper_bound() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Range.upper_bound)
-  return upper_bound_;
+  return _internal_upper_bound();
 }
-inline void Range::set_upper_bound(::google::protobuf::int32 value) {
+inline void Range::_internal_set_upper_bound(int32_t value) {
   
-  upper_bound_ = value;
+  _impl_.upper_bound_ = value;
+}
+inline void Range::set_upper_bound(int32_t value) {
+  _internal_set_upper_bound(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Range.upper_bound)
 }
 
-// optional bool not_synced = 3;
+// bool not_synced = 3;
 inline void Range::clear_not_synced() {
-  not_synced_ = false;
+  _impl_.not_synced_ = false;
+}
+inline bool Range::_internal_not_synced() const {
+  return _impl_.not_synced_;
 }
 inline bool Range::not_synced() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Range.not_synced)
-  return not_synced_;
+  return _internal_not_synced();
 }
-inline void Range::set_not_synced(bool value) {
+inline void Range::_internal_set_not_synced(bool value) {
   
-  not_synced_ = value;
+  _impl_.not_synced_ = value;
+}
+inline void Range::set_not_synced(bool value) {
+  _internal_set_not_synced(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Range.not_synced)
 }
 
@@ -1836,143 +2593,247 @@ inline void Range::set_not_synced(bool value) {
 
 // ServerRanges
 
-// optional .vqro.rpc.Server server = 1;
+// .vqro.rpc.Server server = 1;
+inline bool ServerRanges::_internal_has_server() const {
+  return this != internal_default_instance() && _impl_.server_ != nullptr;
+}
 inline bool ServerRanges::has_server() const {
-  return !_is_default_instance_ && server_ != NULL;
+  return _internal_has_server();
 }
 inline void ServerRanges::clear_server() {
-  if (server_ != NULL) delete server_;
-  server_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.server_ != nullptr) {
+    delete _impl_.server_;
+  }
+  _impl_.server_ = nullptr;
+}
+inline const ::vqro::rpc::Server& ServerRanges::_internal_server() const {
+  const ::vqro::rpc::Server* p = _impl_.server_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::Server&>(
+      ::vqro::rpc::_Server_default_instance_);
 }
 inline const ::vqro::rpc::Server& ServerRanges::server() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ServerRanges.server)
-  return server_ != NULL ? *server_ : *default_instance_->server_;
+  return _internal_server();
 }
-inline ::vqro::rpc::Server* ServerRanges::mutable_server() {
-  
-  if (server_ == NULL) {
-    _slow_mutable_server();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ServerRanges.server)
-  return server_;
+inline void ServerRanges::unsafe_arena_set_allocated_server(
+    ::vqro::rpc::Server* server) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_);
+  }
+  _impl_.server_ = server;
+  if (server) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ServerRanges.server)
 }
 inline ::vqro::rpc::Server* ServerRanges::release_server() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_server();
-  } else {
-    ::vqro::rpc::Server* temp = server_;
-    server_ = NULL;
-    return temp;
+  ::vqro::rpc::Server* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::Server* ServerRanges::unsafe_arena_release_server() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ServerRanges.server)
+  
+  ::vqro::rpc::Server* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::Server* ServerRanges::_internal_mutable_server() {
+  
+  if (_impl_.server_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::Server>(GetArenaForAllocation());
+    _impl_.server_ = p;
   }
+  return _impl_.server_;
+}
+inline ::vqro::rpc::Server* ServerRanges::mutable_server() {
+  ::vqro::rpc::Server* _msg = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ServerRanges.server)
+  return _msg;
 }
 inline void ServerRanges::set_allocated_server(::vqro::rpc::Server* server) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete server_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_;
   }
-  if (server != NULL) {
-    _slow_set_allocated_server(message_arena, &server);
-  }
-  server_ = server;
   if (server) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server);
+    if (message_arena != submessage_arena) {
+      server = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.server_ = server;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ServerRanges.server)
 }
 
 // repeated .vqro.rpc.Range range = 2;
+inline int ServerRanges::_internal_range_size() const {
+  return _impl_.range_.size();
+}
 inline int ServerRanges::range_size() const {
-  return range_.size();
+  return _internal_range_size();
 }
 inline void ServerRanges::clear_range() {
-  range_.Clear();
+  _impl_.range_.Clear();
+}
+inline ::vqro::rpc::Range* ServerRanges::mutable_range(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ServerRanges.range)
+  return _impl_.range_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Range >*
+ServerRanges::mutable_range() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.ServerRanges.range)
+  return &_impl_.range_;
+}
+inline const ::vqro::rpc::Range& ServerRanges::_internal_range(int index) const {
+  return _impl_.range_.Get(index);
 }
 inline const ::vqro::rpc::Range& ServerRanges::range(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ServerRanges.range)
-  return range_.Get(index);
+  return _internal_range(index);
 }
-inline ::vqro::rpc::Range* ServerRanges::mutable_range(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ServerRanges.range)
-  return range_.Mutable(index);
+inline ::vqro::rpc::Range* ServerRanges::_internal_add_range() {
+  return _impl_.range_.Add();
 }
 inline ::vqro::rpc::Range* ServerRanges::add_range() {
+  ::vqro::rpc::Range* _add = _internal_add_range();
   // @@protoc_insertion_point(field_add:vqro.rpc.ServerRanges.range)
-  return range_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Range >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Range >&
 ServerRanges::range() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.ServerRanges.range)
-  return range_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Range >*
-ServerRanges::mutable_range() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.ServerRanges.range)
-  return &range_;
+  return _impl_.range_;
 }
 
 // -------------------------------------------------------------------
 
 // ExchangeStateRequest
 
-// optional .vqro.rpc.CellLocalState local_state = 1;
+// .vqro.rpc.CellLocalState local_state = 1;
+inline bool ExchangeStateRequest::_internal_has_local_state() const {
+  return this != internal_default_instance() && _impl_.local_state_ != nullptr;
+}
 inline bool ExchangeStateRequest::has_local_state() const {
-  return !_is_default_instance_ && local_state_ != NULL;
+  return _internal_has_local_state();
 }
 inline void ExchangeStateRequest::clear_local_state() {
-  if (local_state_ != NULL) delete local_state_;
-  local_state_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.local_state_ != nullptr) {
+    delete _impl_.local_state_;
+  }
+  _impl_.local_state_ = nullptr;
+}
+inline const ::vqro::rpc::CellLocalState& ExchangeStateRequest::_internal_local_state() const {
+  const ::vqro::rpc::CellLocalState* p = _impl_.local_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::CellLocalState&>(
+      ::vqro::rpc::_CellLocalState_default_instance_);
 }
 inline const ::vqro::rpc::CellLocalState& ExchangeStateRequest::local_state() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateRequest.local_state)
-  return local_state_ != NULL ? *local_state_ : *default_instance_->local_state_;
+  return _internal_local_state();
 }
-inline ::vqro::rpc::CellLocalState* ExchangeStateRequest::mutable_local_state() {
-  
-  if (local_state_ == NULL) {
-    _slow_mutable_local_state();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateRequest.local_state)
-  return local_state_;
+inline void ExchangeStateRequest::unsafe_arena_set_allocated_local_state(
+    ::vqro::rpc::CellLocalState* local_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.local_state_);
+  }
+  _impl_.local_state_ = local_state;
+  if (local_state) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ExchangeStateRequest.local_state)
 }
 inline ::vqro::rpc::CellLocalState* ExchangeStateRequest::release_local_state() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_local_state();
-  } else {
-    ::vqro::rpc::CellLocalState* temp = local_state_;
-    local_state_ = NULL;
-    return temp;
+  ::vqro::rpc::CellLocalState* temp = _impl_.local_state_;
+  _impl_.local_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::CellLocalState* ExchangeStateRequest::unsafe_arena_release_local_state() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ExchangeStateRequest.local_state)
+  
+  ::vqro::rpc::CellLocalState* temp = _impl_.local_state_;
+  _impl_.local_state_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::CellLocalState* ExchangeStateRequest::_internal_mutable_local_state() {
+  
+  if (_impl_.local_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::CellLocalState>(GetArenaForAllocation());
+    _impl_.local_state_ = p;
   }
+  return _impl_.local_state_;
+}
+inline ::vqro::rpc::CellLocalState* ExchangeStateRequest::mutable_local_state() {
+  ::vqro::rpc::CellLocalState* _msg = _internal_mutable_local_state();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateRequest.local_state)
+  return _msg;
 }
 inline void ExchangeStateRequest::set_allocated_local_state(::vqro::rpc::CellLocalState* local_state) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete local_state_;
-  }
-  if (local_state != NULL) {
-    _slow_set_allocated_local_state(message_arena, &local_state);
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.local_state_;
   }
-  local_state_ = local_state;
   if (local_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(local_state);
+    if (message_arena != submessage_arena) {
+      local_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, local_state, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.local_state_ = local_state;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ExchangeStateRequest.local_state)
 }
 
-// optional int64 only_diff_since_revision = 2;
+// int64 only_diff_since_revision = 2;
 inline void ExchangeStateRequest::clear_only_diff_since_revision() {
-  only_diff_since_revision_ = GOOGLE_LONGLONG(0);
+  _impl_.only_diff_since_revision_ = int64_t{0};
+}
+inline int64_t ExchangeStateRequest::_internal_only_diff_since_revision() const {
+  return _impl_.only_diff_since_revision_;
 }
-inline ::google::protobuf::int64 ExchangeStateRequest::only_diff_since_revision() const {
+inline int64_t ExchangeStateRequest::only_diff_since_revision() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateRequest.only_diff_since_revision)
-  return only_diff_since_revision_;
+  return _internal_only_diff_since_revision();
 }
-inline void ExchangeStateRequest::set_only_diff_since_revision(::google::protobuf::int64 value) {
+inline void ExchangeStateRequest::_internal_set_only_diff_since_revision(int64_t value) {
   
-  only_diff_since_revision_ = value;
+  _impl_.only_diff_since_revision_ = value;
+}
+inline void ExchangeStateRequest::set_only_diff_since_revision(int64_t value) {
+  _internal_set_only_diff_since_revision(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.ExchangeStateRequest.only_diff_since_revision)
 }
 
@@ -1980,355 +2841,389 @@ inline void ExchangeStateRequest::set_only_diff_since_revision(::google::protobu
 
 // ExchangeStateResponse
 
-// optional .vqro.rpc.CellGlobalState full = 1;
-inline bool ExchangeStateResponse::has_full() const {
+// .vqro.rpc.CellGlobalState full = 1;
+inline bool ExchangeStateResponse::_internal_has_full() const {
   return state_case() == kFull;
 }
+inline bool ExchangeStateResponse::has_full() const {
+  return _internal_has_full();
+}
 inline void ExchangeStateResponse::set_has_full() {
-  _oneof_case_[0] = kFull;
+  _impl_._oneof_case_[0] = kFull;
 }
 inline void ExchangeStateResponse::clear_full() {
-  if (has_full()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete state_.full_;
+  if (_internal_has_full()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.state_.full_;
     }
     clear_has_state();
   }
 }
-inline const ::vqro::rpc::CellGlobalState& ExchangeStateResponse::full() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateResponse.full)
-  return has_full() ? *state_.full_
-                      : ::vqro::rpc::CellGlobalState::default_instance();
-}
-inline ::vqro::rpc::CellGlobalState* ExchangeStateResponse::mutable_full() {
-  if (!has_full()) {
-    clear_state();
-    set_has_full();
-    state_.full_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::CellGlobalState >(
-      GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateResponse.full)
-  return state_.full_;
-}
 inline ::vqro::rpc::CellGlobalState* ExchangeStateResponse::release_full() {
-  if (has_full()) {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ExchangeStateResponse.full)
+  if (_internal_has_full()) {
     clear_has_state();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::CellGlobalState* temp = new ::vqro::rpc::CellGlobalState;
-      temp->MergeFrom(*state_.full_);
-      state_.full_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::CellGlobalState* temp = state_.full_;
-      state_.full_ = NULL;
-      return temp;
+    ::vqro::rpc::CellGlobalState* temp = _impl_.state_.full_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
+    _impl_.state_.full_ = nullptr;
+    return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::vqro::rpc::CellGlobalState& ExchangeStateResponse::_internal_full() const {
+  return _internal_has_full()
+      ? *_impl_.state_.full_
+      : reinterpret_cast< ::vqro::rpc::CellGlobalState&>(::vqro::rpc::_CellGlobalState_default_instance_);
+}
+inline const ::vqro::rpc::CellGlobalState& ExchangeStateResponse::full() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateResponse.full)
+  return _internal_full();
+}
 inline ::vqro::rpc::CellGlobalState* ExchangeStateResponse::unsafe_arena_release_full() {
-  if (has_full()) {
+  // @@protoc_insertion_point(field_unsafe_arena_release:vqro.rpc.ExchangeStateResponse.full)
+  if (_internal_has_full()) {
     clear_has_state();
-    ::vqro::rpc::CellGlobalState* temp = state_.full_;
-    state_.full_ = NULL;
+    ::vqro::rpc::CellGlobalState* temp = _impl_.state_.full_;
+    _impl_.state_.full_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void ExchangeStateResponse::set_allocated_full(::vqro::rpc::CellGlobalState* full) {
+inline void ExchangeStateResponse::unsafe_arena_set_allocated_full(::vqro::rpc::CellGlobalState* full) {
   clear_state();
   if (full) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(full) == NULL) {
-      GetArenaNoVirtual()->Own(full);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(full)) {
-      ::vqro::rpc::CellGlobalState* new_full = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::CellGlobalState >(
-          GetArenaNoVirtual());
-      new_full->CopyFrom(*full);
-      full = new_full;
-    }
     set_has_full();
-    state_.full_ = full;
+    _impl_.state_.full_ = full;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ExchangeStateResponse.full)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ExchangeStateResponse.full)
 }
-inline void ExchangeStateResponse::unsafe_arena_set_allocated_full(::vqro::rpc::CellGlobalState* full) {
-  clear_state();
-  if (full) {
+inline ::vqro::rpc::CellGlobalState* ExchangeStateResponse::_internal_mutable_full() {
+  if (!_internal_has_full()) {
+    clear_state();
     set_has_full();
-    state_.full_ = full;
+    _impl_.state_.full_ = CreateMaybeMessage< ::vqro::rpc::CellGlobalState >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ExchangeStateResponse.full)
+  return _impl_.state_.full_;
+}
+inline ::vqro::rpc::CellGlobalState* ExchangeStateResponse::mutable_full() {
+  ::vqro::rpc::CellGlobalState* _msg = _internal_mutable_full();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateResponse.full)
+  return _msg;
 }
 
-// optional .vqro.rpc.CellGlobalStateDiff diff = 2;
-inline bool ExchangeStateResponse::has_diff() const {
+// .vqro.rpc.CellGlobalStateDiff diff = 2;
+inline bool ExchangeStateResponse::_internal_has_diff() const {
   return state_case() == kDiff;
 }
+inline bool ExchangeStateResponse::has_diff() const {
+  return _internal_has_diff();
+}
 inline void ExchangeStateResponse::set_has_diff() {
-  _oneof_case_[0] = kDiff;
+  _impl_._oneof_case_[0] = kDiff;
 }
 inline void ExchangeStateResponse::clear_diff() {
-  if (has_diff()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete state_.diff_;
+  if (_internal_has_diff()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.state_.diff_;
     }
     clear_has_state();
   }
 }
-inline const ::vqro::rpc::CellGlobalStateDiff& ExchangeStateResponse::diff() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateResponse.diff)
-  return has_diff() ? *state_.diff_
-                      : ::vqro::rpc::CellGlobalStateDiff::default_instance();
-}
-inline ::vqro::rpc::CellGlobalStateDiff* ExchangeStateResponse::mutable_diff() {
-  if (!has_diff()) {
-    clear_state();
-    set_has_diff();
-    state_.diff_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::CellGlobalStateDiff >(
-      GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateResponse.diff)
-  return state_.diff_;
-}
 inline ::vqro::rpc::CellGlobalStateDiff* ExchangeStateResponse::release_diff() {
-  if (has_diff()) {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ExchangeStateResponse.diff)
+  if (_internal_has_diff()) {
     clear_has_state();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::CellGlobalStateDiff* temp = new ::vqro::rpc::CellGlobalStateDiff;
-      temp->MergeFrom(*state_.diff_);
-      state_.diff_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::CellGlobalStateDiff* temp = state_.diff_;
-      state_.diff_ = NULL;
-      return temp;
+    ::vqro::rpc::CellGlobalStateDiff* temp = _impl_.state_.diff_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
+    _impl_.state_.diff_ = nullptr;
+    return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::vqro::rpc::CellGlobalStateDiff& ExchangeStateResponse::_internal_diff() const {
+  return _internal_has_diff()
+      ? *_impl_.state_.diff_
+      : reinterpret_cast< ::vqro::rpc::CellGlobalStateDiff&>(::vqro::rpc::_CellGlobalStateDiff_default_instance_);
+}
+inline const ::vqro::rpc::CellGlobalStateDiff& ExchangeStateResponse::diff() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ExchangeStateResponse.diff)
+  return _internal_diff();
+}
 inline ::vqro::rpc::CellGlobalStateDiff* ExchangeStateResponse::unsafe_arena_release_diff() {
-  if (has_diff()) {
+  // @@protoc_insertion_point(field_unsafe_arena_release:vqro.rpc.ExchangeStateResponse.diff)
+  if (_internal_has_diff()) {
     clear_has_state();
-    ::vqro::rpc::CellGlobalStateDiff* temp = state_.diff_;
-    state_.diff_ = NULL;
+    ::vqro::rpc::CellGlobalStateDiff* temp = _impl_.state_.diff_;
+    _impl_.state_.diff_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void ExchangeStateResponse::set_allocated_diff(::vqro::rpc::CellGlobalStateDiff* diff) {
+inline void ExchangeStateResponse::unsafe_arena_set_allocated_diff(::vqro::rpc::CellGlobalStateDiff* diff) {
   clear_state();
   if (diff) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(diff) == NULL) {
-      GetArenaNoVirtual()->Own(diff);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(diff)) {
-      ::vqro::rpc::CellGlobalStateDiff* new_diff = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::CellGlobalStateDiff >(
-          GetArenaNoVirtual());
-      new_diff->CopyFrom(*diff);
-      diff = new_diff;
-    }
     set_has_diff();
-    state_.diff_ = diff;
+    _impl_.state_.diff_ = diff;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ExchangeStateResponse.diff)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ExchangeStateResponse.diff)
 }
-inline void ExchangeStateResponse::unsafe_arena_set_allocated_diff(::vqro::rpc::CellGlobalStateDiff* diff) {
-  clear_state();
-  if (diff) {
+inline ::vqro::rpc::CellGlobalStateDiff* ExchangeStateResponse::_internal_mutable_diff() {
+  if (!_internal_has_diff()) {
+    clear_state();
     set_has_diff();
-    state_.diff_ = diff;
+    _impl_.state_.diff_ = CreateMaybeMessage< ::vqro::rpc::CellGlobalStateDiff >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ExchangeStateResponse.diff)
+  return _impl_.state_.diff_;
+}
+inline ::vqro::rpc::CellGlobalStateDiff* ExchangeStateResponse::mutable_diff() {
+  ::vqro::rpc::CellGlobalStateDiff* _msg = _internal_mutable_diff();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ExchangeStateResponse.diff)
+  return _msg;
 }
 
 inline bool ExchangeStateResponse::has_state() const {
   return state_case() != STATE_NOT_SET;
 }
 inline void ExchangeStateResponse::clear_has_state() {
-  _oneof_case_[0] = STATE_NOT_SET;
+  _impl_._oneof_case_[0] = STATE_NOT_SET;
 }
 inline ExchangeStateResponse::StateCase ExchangeStateResponse::state_case() const {
-  return ExchangeStateResponse::StateCase(_oneof_case_[0]);
+  return ExchangeStateResponse::StateCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // CellGlobalState
 
-// optional int64 revision = 1;
+// int64 revision = 1;
 inline void CellGlobalState::clear_revision() {
-  revision_ = GOOGLE_LONGLONG(0);
+  _impl_.revision_ = int64_t{0};
+}
+inline int64_t CellGlobalState::_internal_revision() const {
+  return _impl_.revision_;
 }
-inline ::google::protobuf::int64 CellGlobalState::revision() const {
+inline int64_t CellGlobalState::revision() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalState.revision)
-  return revision_;
+  return _internal_revision();
 }
-inline void CellGlobalState::set_revision(::google::protobuf::int64 value) {
+inline void CellGlobalState::_internal_set_revision(int64_t value) {
   
-  revision_ = value;
+  _impl_.revision_ = value;
+}
+inline void CellGlobalState::set_revision(int64_t value) {
+  _internal_set_revision(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.CellGlobalState.revision)
 }
 
 // repeated .vqro.rpc.Server controllers = 2;
+inline int CellGlobalState::_internal_controllers_size() const {
+  return _impl_.controllers_.size();
+}
 inline int CellGlobalState::controllers_size() const {
-  return controllers_.size();
+  return _internal_controllers_size();
 }
 inline void CellGlobalState::clear_controllers() {
-  controllers_.Clear();
+  _impl_.controllers_.Clear();
+}
+inline ::vqro::rpc::Server* CellGlobalState::mutable_controllers(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalState.controllers)
+  return _impl_.controllers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >*
+CellGlobalState::mutable_controllers() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalState.controllers)
+  return &_impl_.controllers_;
+}
+inline const ::vqro::rpc::Server& CellGlobalState::_internal_controllers(int index) const {
+  return _impl_.controllers_.Get(index);
 }
 inline const ::vqro::rpc::Server& CellGlobalState::controllers(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalState.controllers)
-  return controllers_.Get(index);
+  return _internal_controllers(index);
 }
-inline ::vqro::rpc::Server* CellGlobalState::mutable_controllers(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalState.controllers)
-  return controllers_.Mutable(index);
+inline ::vqro::rpc::Server* CellGlobalState::_internal_add_controllers() {
+  return _impl_.controllers_.Add();
 }
 inline ::vqro::rpc::Server* CellGlobalState::add_controllers() {
+  ::vqro::rpc::Server* _add = _internal_add_controllers();
   // @@protoc_insertion_point(field_add:vqro.rpc.CellGlobalState.controllers)
-  return controllers_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Server >&
 CellGlobalState::controllers() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.CellGlobalState.controllers)
-  return controllers_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Server >*
-CellGlobalState::mutable_controllers() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalState.controllers)
-  return &controllers_;
+  return _impl_.controllers_;
 }
 
 // repeated .vqro.rpc.ServerRanges range_assignments = 3;
+inline int CellGlobalState::_internal_range_assignments_size() const {
+  return _impl_.range_assignments_.size();
+}
 inline int CellGlobalState::range_assignments_size() const {
-  return range_assignments_.size();
+  return _internal_range_assignments_size();
 }
 inline void CellGlobalState::clear_range_assignments() {
-  range_assignments_.Clear();
+  _impl_.range_assignments_.Clear();
+}
+inline ::vqro::rpc::ServerRanges* CellGlobalState::mutable_range_assignments(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalState.range_assignments)
+  return _impl_.range_assignments_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+CellGlobalState::mutable_range_assignments() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalState.range_assignments)
+  return &_impl_.range_assignments_;
+}
+inline const ::vqro::rpc::ServerRanges& CellGlobalState::_internal_range_assignments(int index) const {
+  return _impl_.range_assignments_.Get(index);
 }
 inline const ::vqro::rpc::ServerRanges& CellGlobalState::range_assignments(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalState.range_assignments)
-  return range_assignments_.Get(index);
+  return _internal_range_assignments(index);
 }
-inline ::vqro::rpc::ServerRanges* CellGlobalState::mutable_range_assignments(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalState.range_assignments)
-  return range_assignments_.Mutable(index);
+inline ::vqro::rpc::ServerRanges* CellGlobalState::_internal_add_range_assignments() {
+  return _impl_.range_assignments_.Add();
 }
 inline ::vqro::rpc::ServerRanges* CellGlobalState::add_range_assignments() {
+  ::vqro::rpc::ServerRanges* _add = _internal_add_range_assignments();
   // @@protoc_insertion_point(field_add:vqro.rpc.CellGlobalState.range_assignments)
-  return range_assignments_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
 CellGlobalState::range_assignments() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.CellGlobalState.range_assignments)
-  return range_assignments_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-CellGlobalState::mutable_range_assignments() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalState.range_assignments)
-  return &range_assignments_;
+  return _impl_.range_assignments_;
 }
 
 // -------------------------------------------------------------------
 
 // CellGlobalStateDiff
 
-// optional int64 from_revision = 1;
+// int64 from_revision = 1;
 inline void CellGlobalStateDiff::clear_from_revision() {
-  from_revision_ = GOOGLE_LONGLONG(0);
+  _impl_.from_revision_ = int64_t{0};
+}
+inline int64_t CellGlobalStateDiff::_internal_from_revision() const {
+  return _impl_.from_revision_;
 }
-inline ::google::protobuf::int64 CellGlobalStateDiff::from_revision() const {
+inline int64_t CellGlobalStateDiff::from_revision() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalStateDiff.from_revision)
-  return from_revision_;
+  return _internal_from_revision();
 }
-inline void CellGlobalStateDiff::set_from_revision(::google::protobuf::int64 value) {
+inline void CellGlobalStateDiff::_internal_set_from_revision(int64_t value) {
   
-  from_revision_ = value;
+  _impl_.from_revision_ = value;
+}
+inline void CellGlobalStateDiff::set_from_revision(int64_t value) {
+  _internal_set_from_revision(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.CellGlobalStateDiff.from_revision)
 }
 
-// optional int64 to_revision = 2;
+// int64 to_revision = 2;
 inline void CellGlobalStateDiff::clear_to_revision() {
-  to_revision_ = GOOGLE_LONGLONG(0);
+  _impl_.to_revision_ = int64_t{0};
+}
+inline int64_t CellGlobalStateDiff::_internal_to_revision() const {
+  return _impl_.to_revision_;
 }
-inline ::google::protobuf::int64 CellGlobalStateDiff::to_revision() const {
+inline int64_t CellGlobalStateDiff::to_revision() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalStateDiff.to_revision)
-  return to_revision_;
+  return _internal_to_revision();
 }
-inline void CellGlobalStateDiff::set_to_revision(::google::protobuf::int64 value) {
+inline void CellGlobalStateDiff::_internal_set_to_revision(int64_t value) {
   
-  to_revision_ = value;
+  _impl_.to_revision_ = value;
+}
+inline void CellGlobalStateDiff::set_to_revision(int64_t value) {
+  _internal_set_to_revision(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.CellGlobalStateDiff.to_revision)
 }
 
 // repeated .vqro.rpc.ServerRanges additions = 3;
+inline int CellGlobalStateDiff::_internal_additions_size() const {
+  return _impl_.additions_.size();
+}
 inline int CellGlobalStateDiff::additions_size() const {
-  return additions_.size();
+  return _internal_additions_size();
 }
 inline void CellGlobalStateDiff::clear_additions() {
-  additions_.Clear();
+  _impl_.additions_.Clear();
+}
+inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::mutable_additions(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalStateDiff.additions)
+  return _impl_.additions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+CellGlobalStateDiff::mutable_additions() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalStateDiff.additions)
+  return &_impl_.additions_;
+}
+inline const ::vqro::rpc::ServerRanges& CellGlobalStateDiff::_internal_additions(int index) const {
+  return _impl_.additions_.Get(index);
 }
 inline const ::vqro::rpc::ServerRanges& CellGlobalStateDiff::additions(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalStateDiff.additions)
-  return additions_.Get(index);
+  return _internal_additions(index);
 }
-inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::mutable_additions(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalStateDiff.additions)
-  return additions_.Mutable(index);
+inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::_internal_add_additions() {
+  return _impl_.additions_.Add();
 }
 inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::add_additions() {
+  ::vqro::rpc::ServerRanges* _add = _internal_add_additions();
   // @@protoc_insertion_point(field_add:vqro.rpc.CellGlobalStateDiff.additions)
-  return additions_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
 CellGlobalStateDiff::additions() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.CellGlobalStateDiff.additions)
-  return additions_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-CellGlobalStateDiff::mutable_additions() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalStateDiff.additions)
-  return &additions_;
+  return _impl_.additions_;
 }
 
 // repeated .vqro.rpc.ServerRanges removals = 4;
+inline int CellGlobalStateDiff::_internal_removals_size() const {
+  return _impl_.removals_.size();
+}
 inline int CellGlobalStateDiff::removals_size() const {
-  return removals_.size();
+  return _internal_removals_size();
 }
 inline void CellGlobalStateDiff::clear_removals() {
-  removals_.Clear();
+  _impl_.removals_.Clear();
+}
+inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::mutable_removals(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalStateDiff.removals)
+  return _impl_.removals_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
+CellGlobalStateDiff::mutable_removals() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalStateDiff.removals)
+  return &_impl_.removals_;
+}
+inline const ::vqro::rpc::ServerRanges& CellGlobalStateDiff::_internal_removals(int index) const {
+  return _impl_.removals_.Get(index);
 }
 inline const ::vqro::rpc::ServerRanges& CellGlobalStateDiff::removals(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellGlobalStateDiff.removals)
-  return removals_.Get(index);
+  return _internal_removals(index);
 }
-inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::mutable_removals(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellGlobalStateDiff.removals)
-  return removals_.Mutable(index);
+inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::_internal_add_removals() {
+  return _impl_.removals_.Add();
 }
 inline ::vqro::rpc::ServerRanges* CellGlobalStateDiff::add_removals() {
+  ::vqro::rpc::ServerRanges* _add = _internal_add_removals();
   // @@protoc_insertion_point(field_add:vqro.rpc.CellGlobalStateDiff.removals)
-  return removals_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::ServerRanges >&
 CellGlobalStateDiff::removals() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.CellGlobalStateDiff.removals)
-  return removals_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::ServerRanges >*
-CellGlobalStateDiff::mutable_removals() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellGlobalStateDiff.removals)
-  return &removals_;
+  return _impl_.removals_;
 }
 
 // -------------------------------------------------------------------
@@ -2336,252 +3231,410 @@ CellGlobalStateDiff::mutable_removals() {
 // CellLocalState
 
 // repeated .vqro.rpc.VaqueroState vaqueros = 1;
+inline int CellLocalState::_internal_vaqueros_size() const {
+  return _impl_.vaqueros_.size();
+}
 inline int CellLocalState::vaqueros_size() const {
-  return vaqueros_.size();
+  return _internal_vaqueros_size();
 }
 inline void CellLocalState::clear_vaqueros() {
-  vaqueros_.Clear();
+  _impl_.vaqueros_.Clear();
+}
+inline ::vqro::rpc::VaqueroState* CellLocalState::mutable_vaqueros(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellLocalState.vaqueros)
+  return _impl_.vaqueros_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::VaqueroState >*
+CellLocalState::mutable_vaqueros() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellLocalState.vaqueros)
+  return &_impl_.vaqueros_;
+}
+inline const ::vqro::rpc::VaqueroState& CellLocalState::_internal_vaqueros(int index) const {
+  return _impl_.vaqueros_.Get(index);
 }
 inline const ::vqro::rpc::VaqueroState& CellLocalState::vaqueros(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.CellLocalState.vaqueros)
-  return vaqueros_.Get(index);
+  return _internal_vaqueros(index);
 }
-inline ::vqro::rpc::VaqueroState* CellLocalState::mutable_vaqueros(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.CellLocalState.vaqueros)
-  return vaqueros_.Mutable(index);
+inline ::vqro::rpc::VaqueroState* CellLocalState::_internal_add_vaqueros() {
+  return _impl_.vaqueros_.Add();
 }
 inline ::vqro::rpc::VaqueroState* CellLocalState::add_vaqueros() {
+  ::vqro::rpc::VaqueroState* _add = _internal_add_vaqueros();
   // @@protoc_insertion_point(field_add:vqro.rpc.CellLocalState.vaqueros)
-  return vaqueros_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::VaqueroState >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::VaqueroState >&
 CellLocalState::vaqueros() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.CellLocalState.vaqueros)
-  return vaqueros_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::VaqueroState >*
-CellLocalState::mutable_vaqueros() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.CellLocalState.vaqueros)
-  return &vaqueros_;
+  return _impl_.vaqueros_;
 }
 
 // -------------------------------------------------------------------
 
 // VaqueroState
 
-// optional .vqro.rpc.Server server = 1;
+// .vqro.rpc.Server server = 1;
+inline bool VaqueroState::_internal_has_server() const {
+  return this != internal_default_instance() && _impl_.server_ != nullptr;
+}
 inline bool VaqueroState::has_server() const {
-  return !_is_default_instance_ && server_ != NULL;
+  return _internal_has_server();
 }
 inline void VaqueroState::clear_server() {
-  if (server_ != NULL) delete server_;
-  server_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.server_ != nullptr) {
+    delete _impl_.server_;
+  }
+  _impl_.server_ = nullptr;
+}
+inline const ::vqro::rpc::Server& VaqueroState::_internal_server() const {
+  const ::vqro::rpc::Server* p = _impl_.server_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::Server&>(
+      ::vqro::rpc::_Server_default_instance_);
 }
 inline const ::vqro::rpc::Server& VaqueroState::server() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroState.server)
-  return server_ != NULL ? *server_ : *default_instance_->server_;
+  return _internal_server();
 }
-inline ::vqro::rpc::Server* VaqueroState::mutable_server() {
-  
-  if (server_ == NULL) {
-    _slow_mutable_server();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.server)
-  return server_;
+inline void VaqueroState::unsafe_arena_set_allocated_server(
+    ::vqro::rpc::Server* server) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_);
+  }
+  _impl_.server_ = server;
+  if (server) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.VaqueroState.server)
 }
 inline ::vqro::rpc::Server* VaqueroState::release_server() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_server();
-  } else {
-    ::vqro::rpc::Server* temp = server_;
-    server_ = NULL;
-    return temp;
+  ::vqro::rpc::Server* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::Server* VaqueroState::unsafe_arena_release_server() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.VaqueroState.server)
+  
+  ::vqro::rpc::Server* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::Server* VaqueroState::_internal_mutable_server() {
+  
+  if (_impl_.server_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::Server>(GetArenaForAllocation());
+    _impl_.server_ = p;
   }
+  return _impl_.server_;
+}
+inline ::vqro::rpc::Server* VaqueroState::mutable_server() {
+  ::vqro::rpc::Server* _msg = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.server)
+  return _msg;
 }
 inline void VaqueroState::set_allocated_server(::vqro::rpc::Server* server) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete server_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_;
   }
-  if (server != NULL) {
-    _slow_set_allocated_server(message_arena, &server);
-  }
-  server_ = server;
   if (server) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server);
+    if (message_arena != submessage_arena) {
+      server = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.server_ = server;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.VaqueroState.server)
 }
 
-// optional .vqro.rpc.VaqueroMetrics metrics = 2;
+// .vqro.rpc.VaqueroMetrics metrics = 2;
+inline bool VaqueroState::_internal_has_metrics() const {
+  return this != internal_default_instance() && _impl_.metrics_ != nullptr;
+}
 inline bool VaqueroState::has_metrics() const {
-  return !_is_default_instance_ && metrics_ != NULL;
+  return _internal_has_metrics();
 }
 inline void VaqueroState::clear_metrics() {
-  if (metrics_ != NULL) delete metrics_;
-  metrics_ = NULL;
+  if (GetArenaForAllocation() == nullptr && _impl_.metrics_ != nullptr) {
+    delete _impl_.metrics_;
+  }
+  _impl_.metrics_ = nullptr;
+}
+inline const ::vqro::rpc::VaqueroMetrics& VaqueroState::_internal_metrics() const {
+  const ::vqro::rpc::VaqueroMetrics* p = _impl_.metrics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::VaqueroMetrics&>(
+      ::vqro::rpc::_VaqueroMetrics_default_instance_);
 }
 inline const ::vqro::rpc::VaqueroMetrics& VaqueroState::metrics() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroState.metrics)
-  return metrics_ != NULL ? *metrics_ : *default_instance_->metrics_;
+  return _internal_metrics();
 }
-inline ::vqro::rpc::VaqueroMetrics* VaqueroState::mutable_metrics() {
-  
-  if (metrics_ == NULL) {
-    _slow_mutable_metrics();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.metrics)
-  return metrics_;
+inline void VaqueroState::unsafe_arena_set_allocated_metrics(
+    ::vqro::rpc::VaqueroMetrics* metrics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.metrics_);
+  }
+  _impl_.metrics_ = metrics;
+  if (metrics) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.VaqueroState.metrics)
 }
 inline ::vqro::rpc::VaqueroMetrics* VaqueroState::release_metrics() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_metrics();
-  } else {
-    ::vqro::rpc::VaqueroMetrics* temp = metrics_;
-    metrics_ = NULL;
-    return temp;
+  ::vqro::rpc::VaqueroMetrics* temp = _impl_.metrics_;
+  _impl_.metrics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::VaqueroMetrics* VaqueroState::unsafe_arena_release_metrics() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.VaqueroState.metrics)
+  
+  ::vqro::rpc::VaqueroMetrics* temp = _impl_.metrics_;
+  _impl_.metrics_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::VaqueroMetrics* VaqueroState::_internal_mutable_metrics() {
+  
+  if (_impl_.metrics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::VaqueroMetrics>(GetArenaForAllocation());
+    _impl_.metrics_ = p;
   }
+  return _impl_.metrics_;
+}
+inline ::vqro::rpc::VaqueroMetrics* VaqueroState::mutable_metrics() {
+  ::vqro::rpc::VaqueroMetrics* _msg = _internal_mutable_metrics();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.metrics)
+  return _msg;
 }
 inline void VaqueroState::set_allocated_metrics(::vqro::rpc::VaqueroMetrics* metrics) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete metrics_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.metrics_;
   }
-  if (metrics != NULL) {
-    _slow_set_allocated_metrics(message_arena, &metrics);
-  }
-  metrics_ = metrics;
   if (metrics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(metrics);
+    if (message_arena != submessage_arena) {
+      metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, metrics, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.metrics_ = metrics;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.VaqueroState.metrics)
 }
 
 // repeated .vqro.rpc.Series new_series = 3;
+inline int VaqueroState::_internal_new_series_size() const {
+  return _impl_.new_series_.size();
+}
 inline int VaqueroState::new_series_size() const {
-  return new_series_.size();
+  return _internal_new_series_size();
+}
+inline ::vqro::rpc::Series* VaqueroState::mutable_new_series(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.new_series)
+  return _impl_.new_series_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+VaqueroState::mutable_new_series() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.VaqueroState.new_series)
+  return &_impl_.new_series_;
 }
-inline void VaqueroState::clear_new_series() {
-  new_series_.Clear();
+inline const ::vqro::rpc::Series& VaqueroState::_internal_new_series(int index) const {
+  return _impl_.new_series_.Get(index);
 }
 inline const ::vqro::rpc::Series& VaqueroState::new_series(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroState.new_series)
-  return new_series_.Get(index);
+  return _internal_new_series(index);
 }
-inline ::vqro::rpc::Series* VaqueroState::mutable_new_series(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.new_series)
-  return new_series_.Mutable(index);
+inline ::vqro::rpc::Series* VaqueroState::_internal_add_new_series() {
+  return _impl_.new_series_.Add();
 }
 inline ::vqro::rpc::Series* VaqueroState::add_new_series() {
+  ::vqro::rpc::Series* _add = _internal_add_new_series();
   // @@protoc_insertion_point(field_add:vqro.rpc.VaqueroState.new_series)
-  return new_series_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
 VaqueroState::new_series() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.VaqueroState.new_series)
-  return new_series_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-VaqueroState::mutable_new_series() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.VaqueroState.new_series)
-  return &new_series_;
+  return _impl_.new_series_;
 }
 
 // repeated .vqro.rpc.Series expired_series = 4;
+inline int VaqueroState::_internal_expired_series_size() const {
+  return _impl_.expired_series_.size();
+}
 inline int VaqueroState::expired_series_size() const {
-  return expired_series_.size();
+  return _internal_expired_series_size();
+}
+inline ::vqro::rpc::Series* VaqueroState::mutable_expired_series(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.expired_series)
+  return _impl_.expired_series_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+VaqueroState::mutable_expired_series() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.VaqueroState.expired_series)
+  return &_impl_.expired_series_;
 }
-inline void VaqueroState::clear_expired_series() {
-  expired_series_.Clear();
+inline const ::vqro::rpc::Series& VaqueroState::_internal_expired_series(int index) const {
+  return _impl_.expired_series_.Get(index);
 }
 inline const ::vqro::rpc::Series& VaqueroState::expired_series(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroState.expired_series)
-  return expired_series_.Get(index);
+  return _internal_expired_series(index);
 }
-inline ::vqro::rpc::Series* VaqueroState::mutable_expired_series(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.VaqueroState.expired_series)
-  return expired_series_.Mutable(index);
+inline ::vqro::rpc::Series* VaqueroState::_internal_add_expired_series() {
+  return _impl_.expired_series_.Add();
 }
 inline ::vqro::rpc::Series* VaqueroState::add_expired_series() {
+  ::vqro::rpc::Series* _add = _internal_add_expired_series();
   // @@protoc_insertion_point(field_add:vqro.rpc.VaqueroState.expired_series)
-  return expired_series_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
 VaqueroState::expired_series() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.VaqueroState.expired_series)
-  return expired_series_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-VaqueroState::mutable_expired_series() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.VaqueroState.expired_series)
-  return &expired_series_;
+  return _impl_.expired_series_;
 }
 
 // -------------------------------------------------------------------
 
 // VaqueroMetrics
 
-// optional double cpu_usage = 1;
+// double cpu_usage = 1;
 inline void VaqueroMetrics::clear_cpu_usage() {
-  cpu_usage_ = 0;
+  _impl_.cpu_usage_ = 0;
+}
+inline double VaqueroMetrics::_internal_cpu_usage() const {
+  return _impl_.cpu_usage_;
 }
 inline double VaqueroMetrics::cpu_usage() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroMetrics.cpu_usage)
-  return cpu_usage_;
+  return _internal_cpu_usage();
 }
-inline void VaqueroMetrics::set_cpu_usage(double value) {
+inline void VaqueroMetrics::_internal_set_cpu_usage(double value) {
   
-  cpu_usage_ = value;
+  _impl_.cpu_usage_ = value;
+}
+inline void VaqueroMetrics::set_cpu_usage(double value) {
+  _internal_set_cpu_usage(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.VaqueroMetrics.cpu_usage)
 }
 
-// optional int32 num_series_written_to = 2;
+// int32 num_series_written_to = 2;
 inline void VaqueroMetrics::clear_num_series_written_to() {
-  num_series_written_to_ = 0;
+  _impl_.num_series_written_to_ = 0;
 }
-inline ::google::protobuf::int32 VaqueroMetrics::num_series_written_to() const {
+inline int32_t VaqueroMetrics::_internal_num_series_written_to() const {
+  return _impl_.num_series_written_to_;
+}
+inline int32_t VaqueroMetrics::num_series_written_to() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroMetrics.num_series_written_to)
-  return num_series_written_to_;
+  return _internal_num_series_written_to();
 }
-inline void VaqueroMetrics::set_num_series_written_to(::google::protobuf::int32 value) {
+inline void VaqueroMetrics::_internal_set_num_series_written_to(int32_t value) {
   
-  num_series_written_to_ = value;
+  _impl_.num_series_written_to_ = value;
+}
+inline void VaqueroMetrics::set_num_series_written_to(int32_t value) {
+  _internal_set_num_series_written_to(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.VaqueroMetrics.num_series_written_to)
 }
 
-// optional int32 num_datapoints_written = 3;
+// int32 num_datapoints_written = 3;
 inline void VaqueroMetrics::clear_num_datapoints_written() {
-  num_datapoints_written_ = 0;
+  _impl_.num_datapoints_written_ = 0;
 }
-inline ::google::protobuf::int32 VaqueroMetrics::num_datapoints_written() const {
+inline int32_t VaqueroMetrics::_internal_num_datapoints_written() const {
+  return _impl_.num_datapoints_written_;
+}
+inline int32_t VaqueroMetrics::num_datapoints_written() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroMetrics.num_datapoints_written)
-  return num_datapoints_written_;
+  return _internal_num_datapoints_written();
 }
-inline void VaqueroMetrics::set_num_datapoints_written(::google::protobuf::int32 value) {
+inline void VaqueroMetrics::_internal_set_num_datapoints_written(int32_t value) {
   
-  num_datapoints_written_ = value;
+  _impl_.num_datapoints_written_ = value;
+}
+inline void VaqueroMetrics::set_num_datapoints_written(int32_t value) {
+  _internal_set_num_datapoints_written(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.VaqueroMetrics.num_datapoints_written)
 }
 
-// optional int32 storage_bytes_change = 4;
+// int32 storage_bytes_change = 4;
 inline void VaqueroMetrics::clear_storage_bytes_change() {
-  storage_bytes_change_ = 0;
+  _impl_.storage_bytes_change_ = 0;
 }
-inline ::google::protobuf::int32 VaqueroMetrics::storage_bytes_change() const {
+inline int32_t VaqueroMetrics::_internal_storage_bytes_change() const {
+  return _impl_.storage_bytes_change_;
+}
+inline int32_t VaqueroMetrics::storage_bytes_change() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.VaqueroMetrics.storage_bytes_change)
-  return storage_bytes_change_;
+  return _internal_storage_bytes_change();
 }
-inline void VaqueroMetrics::set_storage_bytes_change(::google::protobuf::int32 value) {
+inline void VaqueroMetrics::_internal_set_storage_bytes_change(int32_t value) {
   
-  storage_bytes_change_ = value;
+  _impl_.storage_bytes_change_ = value;
+}
+inline void VaqueroMetrics::set_storage_bytes_change(int32_t value) {
+  _internal_set_storage_bytes_change(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.VaqueroMetrics.storage_bytes_change)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -2590,4 +3643,5 @@ inline void VaqueroMetrics::set_storage_bytes_change(::google::protobuf::int32 v
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_controller_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_controller_2eproto
@@ -1,1275 +1,956 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: core.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "core.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace vqro {
 namespace rpc {
-
-namespace {
-
-const ::google::protobuf::Descriptor* Series_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Series_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Series_LabelsEntry_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Datapoint_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Datapoint_reflection_ = NULL;
-const ::google::protobuf::Descriptor* StatusMessage_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  StatusMessage_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_core_2eproto() {
-  protobuf_AddDesc_core_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "core.proto");
-  GOOGLE_CHECK(file != NULL);
-  Series_descriptor_ = file->message_type(0);
-  static const int Series_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Series, labels_),
+PROTOBUF_CONSTEXPR Series_LabelsEntry_DoNotUse::Series_LabelsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Series_LabelsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Series_LabelsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Series_LabelsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Series_LabelsEntry_DoNotUse _instance;
   };
-  Series_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Series_descriptor_,
-      Series::default_instance_,
-      Series_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Series),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Series, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Series, _is_default_instance_));
-  Series_LabelsEntry_descriptor_ = Series_descriptor_->nested_type(0);
-  Datapoint_descriptor_ = file->message_type(1);
-  static const int Datapoint_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Datapoint, timestamp_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Datapoint, duration_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Datapoint, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Series_LabelsEntry_DoNotUseDefaultTypeInternal _Series_LabelsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Series::Series(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.labels_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeriesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeriesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeriesDefaultTypeInternal() {}
+  union {
+    Series _instance;
   };
-  Datapoint_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Datapoint_descriptor_,
-      Datapoint::default_instance_,
-      Datapoint_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(Datapoint),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Datapoint, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Datapoint, _is_default_instance_));
-  StatusMessage_descriptor_ = file->message_type(2);
-  static const int StatusMessage_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusMessage, text_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusMessage, error_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusMessage, go_away_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeriesDefaultTypeInternal _Series_default_instance_;
+PROTOBUF_CONSTEXPR Datapoint::Datapoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.duration_)*/int64_t{0}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatapointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatapointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatapointDefaultTypeInternal() {}
+  union {
+    Datapoint _instance;
   };
-  StatusMessage_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      StatusMessage_descriptor_,
-      StatusMessage::default_instance_,
-      StatusMessage_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(StatusMessage),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusMessage, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StatusMessage, _is_default_instance_));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_core_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Series_descriptor_, &Series::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-        Series_LabelsEntry_descriptor_,
-        ::google::protobuf::internal::MapEntry<
-            ::std::string,
-            ::std::string,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-            0>::CreateDefaultInstance(
-                Series_LabelsEntry_descriptor_));
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Datapoint_descriptor_, &Datapoint::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      StatusMessage_descriptor_, &StatusMessage::default_instance());
-}
-
-}  // namespace
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatapointDefaultTypeInternal _Datapoint_default_instance_;
+PROTOBUF_CONSTEXPR StatusMessage::StatusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/false
+  , /*decltype(_impl_.go_away_)*/false
+  , /*decltype(_impl_.retry_after_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatusMessageDefaultTypeInternal() {}
+  union {
+    StatusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusMessageDefaultTypeInternal _StatusMessage_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+static ::_pb::Metadata file_level_metadata_core_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_core_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_core_2eproto = nullptr;
+
+const uint32_t TableStruct_core_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series_LabelsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series_LabelsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series_LabelsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series_LabelsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Series, _impl_.labels_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Datapoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Datapoint, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Datapoint, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::Datapoint, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::StatusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::StatusMessage, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::StatusMessage, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::StatusMessage, _impl_.go_away_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::StatusMessage, _impl_.retry_after_ms_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::vqro::rpc::Series_LabelsEntry_DoNotUse)},
+  { 10, -1, -1, sizeof(::vqro::rpc::Series)},
+  { 17, -1, -1, sizeof(::vqro::rpc::Datapoint)},
+  { 26, -1, -1, sizeof(::vqro::rpc::StatusMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::vqro::rpc::_Series_LabelsEntry_DoNotUse_default_instance_._instance,
+  &::vqro::rpc::_Series_default_instance_._instance,
+  &::vqro::rpc::_Datapoint_default_instance_._instance,
+  &::vqro::rpc::_StatusMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_core_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ncore.proto\022\010vqro.rpc\"e\n\006Series\022,\n\006labe"
+  "ls\030\001 \003(\0132\034.vqro.rpc.Series.LabelsEntry\032-"
+  "\n\013LabelsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001("
+  "\t:\0028\001\"\?\n\tDatapoint\022\021\n\ttimestamp\030\001 \001(\003\022\020\n"
+  "\010duration\030\002 \001(\003\022\r\n\005value\030\003 \001(\001\"U\n\rStatus"
+  "Message\022\014\n\004text\030\001 \001(\t\022\r\n\005error\030\002 \001(\010\022\017\n\007"
+  "go_away\030\003 \001(\010\022\026\n\016retry_after_ms\030\004 \001(\005B\003\370"
+  "\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_core_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_core_2eproto = {
+    false, false, 290, descriptor_table_protodef_core_2eproto,
+    "core.proto",
+    &descriptor_table_core_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_core_2eproto::offsets,
+    file_level_metadata_core_2eproto, file_level_enum_descriptors_core_2eproto,
+    file_level_service_descriptors_core_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_core_2eproto_getter() {
+  return &descriptor_table_core_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_core_2eproto(&descriptor_table_core_2eproto);
+namespace vqro {
+namespace rpc {
 
-void protobuf_ShutdownFile_core_2eproto() {
-  delete Series::default_instance_;
-  delete Series_reflection_;
-  delete Datapoint::default_instance_;
-  delete Datapoint_reflection_;
-  delete StatusMessage::default_instance_;
-  delete StatusMessage_reflection_;
-}
+// ===================================================================
 
-void protobuf_AddDesc_core_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\ncore.proto\022\010vqro.rpc\"e\n\006Series\022,\n\006labe"
-    "ls\030\001 \003(\0132\034.vqro.rpc.Series.LabelsEntry\032-"
-    "\n\013LabelsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001("
-    "\t:\0028\001\"\?\n\tDatapoint\022\021\n\ttimestamp\030\001 \001(\003\022\020\n"
-    "\010duration\030\002 \001(\003\022\r\n\005value\030\003 \001(\001\"=\n\rStatus"
-    "Message\022\014\n\004text\030\001 \001(\t\022\r\n\005error\030\002 \001(\010\022\017\n\007"
-    "go_away\030\003 \001(\010B\003\370\001\001b\006proto3", 266);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "core.proto", &protobuf_RegisterTypes);
-  Series::default_instance_ = new Series();
-  Datapoint::default_instance_ = new Datapoint();
-  StatusMessage::default_instance_ = new StatusMessage();
-  Series::default_instance_->InitAsDefaultInstance();
-  Datapoint::default_instance_->InitAsDefaultInstance();
-  StatusMessage::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_core_2eproto);
+Series_LabelsEntry_DoNotUse::Series_LabelsEntry_DoNotUse() {}
+Series_LabelsEntry_DoNotUse::Series_LabelsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Series_LabelsEntry_DoNotUse::MergeFrom(const Series_LabelsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
 }
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_core_2eproto {
-  StaticDescriptorInitializer_core_2eproto() {
-    protobuf_AddDesc_core_2eproto();
-  }
-} static_descriptor_initializer_core_2eproto_;
-
-namespace {
-
-static void MergeFromFail(int line) GOOGLE_ATTRIBUTE_COLD;
-static void MergeFromFail(int line) {
-  GOOGLE_CHECK(false) << __FILE__ << ":" << line;
+::PROTOBUF_NAMESPACE_ID::Metadata Series_LabelsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_core_2eproto_getter, &descriptor_table_core_2eproto_once,
+      file_level_metadata_core_2eproto[0]);
 }
 
-}  // namespace
-
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Series::kLabelsFieldNumber;
-#endif  // !_MSC_VER
-
-Series::Series()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.Series)
-}
+class Series::_Internal {
+ public:
+};
 
-Series::Series(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  labels_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Series::Series(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &Series::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.Series)
 }
-
-void Series::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 Series::Series(const Series& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Series* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.labels_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.Series)
 }
 
-void Series::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  labels_.SetAssignDescriptorCallback(
-      protobuf_AssignDescriptorsOnce);
-  labels_.SetEntryDescriptor(
-      &::vqro::rpc::Series_LabelsEntry_descriptor_);
+inline void Series::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.labels_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Series::~Series() {
   // @@protoc_insertion_point(destructor:vqro.rpc.Series)
-  SharedDtor();
-}
-
-void Series::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
     return;
   }
+  SharedDtor();
+}
 
-  if (this != default_instance_) {
-  }
+inline void Series::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.labels_.Destruct();
+  _impl_.labels_.~MapField();
 }
 
 void Series::ArenaDtor(void* object) {
   Series* _this = reinterpret_cast< Series* >(object);
-  (void)_this;
-}
-void Series::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+  _this->_impl_.labels_.Destruct();
 }
 void Series::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Series::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Series_descriptor_;
-}
-
-const Series& Series::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_core_2eproto();
-  return *default_instance_;
-}
-
-Series* Series::default_instance_ = NULL;
-
-Series* Series::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Series>(arena);
+  _impl_._cached_size_.Set(size);
 }
 
 void Series::Clear() {
-  labels_.Clear();
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.Series)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.labels_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Series::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.Series)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Series::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // map<string, string> labels = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_labels:
-          ::google::protobuf::scoped_ptr<Series_LabelsEntry> entry(labels_.NewEntry());
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-              input, entry.get()));
-          (*mutable_labels())[entry->key()] = *entry->mutable_value();
-          if (entry->GetArena() != NULL) entry.release();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.labels_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_labels;
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.Series)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.Series)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Series::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.Series)
-  // map<string, string> labels = 1;
-  {
-    ::google::protobuf::scoped_ptr<Series_LabelsEntry> entry;
-    for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-        it = labels().begin(); it != labels().end(); ++it) {
-      if (entry.get() != NULL && entry->GetArena() != NULL) {
-        entry.release();
-      }
-      entry.reset(labels_.NewEntryWrapper(it->first, it->second));
-      ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-          1, *entry, output);
-    }
-    if (entry.get() != NULL && entry->GetArena() != NULL) {
-      entry.release();
-    }
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.Series)
-}
-
-::google::protobuf::uint8* Series::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* Series::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.Series)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // map<string, string> labels = 1;
-  {
-    ::google::protobuf::scoped_ptr<Series_LabelsEntry> entry;
-    for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-        it = labels().begin(); it != labels().end(); ++it) {
-      if (entry.get() != NULL && entry->GetArena() != NULL) {
-        entry.release();
+  if (!this->_internal_labels().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = Series_LabelsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_labels();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "vqro.rpc.Series.LabelsEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "vqro.rpc.Series.LabelsEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
-      entry.reset(labels_.NewEntryWrapper(it->first, it->second));
-      target = ::google::protobuf::internal::WireFormatLite::
-          WriteMessageNoVirtualToArray(
-              1, *entry, target);
-    }
-    if (entry.get() != NULL && entry->GetArena() != NULL) {
-      entry.release();
     }
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.Series)
   return target;
 }
 
-int Series::ByteSize() const {
-  int total_size = 0;
+size_t Series::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.Series)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // map<string, string> labels = 1;
-  total_size += 1 * this->labels_size();
-  {
-    ::google::protobuf::scoped_ptr<Series_LabelsEntry> entry;
-    for (::google::protobuf::Map< ::std::string, ::std::string >::const_iterator
-        it = labels().begin(); it != labels().end(); ++it) {
-      if (entry.get() != NULL && entry->GetArena() != NULL) {
-        entry.release();
-      }
-      entry.reset(labels_.NewEntryWrapper(it->first, it->second));
-      total_size += ::google::protobuf::internal::WireFormatLite::
-          MessageSizeNoVirtual(*entry);
-    }
-    if (entry.get() != NULL && entry->GetArena() != NULL) {
-      entry.release();
-    }
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_labels_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_labels().begin();
+      it != this->_internal_labels().end(); ++it) {
+    total_size += Series_LabelsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Series::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const Series* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Series*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Series::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Series::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Series::GetClassData() const { return &_class_data_; }
 
-void Series::MergeFrom(const Series& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  labels_.MergeFrom(from.labels_);
-}
 
-void Series::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Series::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Series*>(&to_msg);
+  auto& from = static_cast<const Series&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.Series)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Series::CopyFrom(const Series& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.Series)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Series::IsInitialized() const {
-
   return true;
 }
 
-void Series::Swap(Series* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Series temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void Series::UnsafeArenaSwap(Series* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void Series::InternalSwap(Series* other) {
-  labels_.Swap(&other->labels_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Series::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Series_descriptor_;
-  metadata.reflection = Series_reflection_;
-  return metadata;
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Series
-
-// map<string, string> labels = 1;
- int Series::labels_size() const {
-  return labels_.size();
-}
- void Series::clear_labels() {
-  labels_.Clear();
-}
- const ::google::protobuf::Map< ::std::string, ::std::string >&
-Series::labels() const {
-  // @@protoc_insertion_point(field_map:vqro.rpc.Series.labels)
-  return labels_.GetMap();
-}
- ::google::protobuf::Map< ::std::string, ::std::string >*
-Series::mutable_labels() {
-  // @@protoc_insertion_point(field_mutable_map:vqro.rpc.Series.labels)
-  return labels_.MutableMap();
+::PROTOBUF_NAMESPACE_ID::Metadata Series::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_core_2eproto_getter, &descriptor_table_core_2eproto_once,
+      file_level_metadata_core_2eproto[1]);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Datapoint::kTimestampFieldNumber;
-const int Datapoint::kDurationFieldNumber;
-const int Datapoint::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-Datapoint::Datapoint()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.Datapoint)
-}
+class Datapoint::_Internal {
+ public:
+};
 
-Datapoint::Datapoint(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Datapoint::Datapoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.Datapoint)
 }
-
-void Datapoint::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 Datapoint::Datapoint(const Datapoint& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Datapoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.value_));
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.Datapoint)
 }
 
-void Datapoint::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  timestamp_ = GOOGLE_LONGLONG(0);
-  duration_ = GOOGLE_LONGLONG(0);
-  value_ = 0;
+inline void Datapoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.duration_){int64_t{0}}
+    , decltype(_impl_.value_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Datapoint::~Datapoint() {
   // @@protoc_insertion_point(destructor:vqro.rpc.Datapoint)
-  SharedDtor();
-}
-
-void Datapoint::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-  }
-}
-
-void Datapoint::ArenaDtor(void* object) {
-  Datapoint* _this = reinterpret_cast< Datapoint* >(object);
-  (void)_this;
-}
-void Datapoint::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void Datapoint::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Datapoint::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Datapoint_descriptor_;
+  SharedDtor();
 }
 
-const Datapoint& Datapoint::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_core_2eproto();
-  return *default_instance_;
+inline void Datapoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-Datapoint* Datapoint::default_instance_ = NULL;
-
-Datapoint* Datapoint::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<Datapoint>(arena);
+void Datapoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Datapoint::Clear() {
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<Datapoint*>(16)->f)
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(timestamp_, value_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-}
-
-bool Datapoint::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.Datapoint)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int64 timestamp = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &timestamp_)));
-
-        } else {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.Datapoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.value_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.value_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Datapoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_duration;
-        break;
-      }
-
-      // optional int64 duration = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_duration:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &duration_)));
-
-        } else {
+        continue;
+      // int64 duration = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(25)) goto parse_value;
-        break;
-      }
-
-      // optional double value = 3;
-      case 3: {
-        if (tag == 25) {
-         parse_value:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &value_)));
-
-        } else {
+        continue;
+      // double value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.Datapoint)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.Datapoint)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Datapoint::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.Datapoint)
-  // optional int64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->timestamp(), output);
-  }
-
-  // optional int64 duration = 2;
-  if (this->duration() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->duration(), output);
-  }
+uint8_t* Datapoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.Datapoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional double value = 3;
-  if (this->value() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->value(), output);
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_timestamp(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.Datapoint)
-}
-
-::google::protobuf::uint8* Datapoint::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.Datapoint)
-  // optional int64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->timestamp(), target);
+  // int64 duration = 2;
+  if (this->_internal_duration() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_duration(), target);
   }
 
-  // optional int64 duration = 2;
-  if (this->duration() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->duration(), target);
+  // double value = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_value(), target);
   }
 
-  // optional double value = 3;
-  if (this->value() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->value(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.Datapoint)
   return target;
 }
 
-int Datapoint::ByteSize() const {
-  int total_size = 0;
+size_t Datapoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.Datapoint)
+  size_t total_size = 0;
 
-  // optional int64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->timestamp());
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
-  // optional int64 duration = 2;
-  if (this->duration() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->duration());
+  // int64 duration = 2;
+  if (this->_internal_duration() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_duration());
   }
 
-  // optional double value = 3;
-  if (this->value() != 0) {
+  // double value = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
     total_size += 1 + 8;
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Datapoint::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const Datapoint* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Datapoint*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Datapoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Datapoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Datapoint::GetClassData() const { return &_class_data_; }
+
 
-void Datapoint::MergeFrom(const Datapoint& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+void Datapoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Datapoint*>(&to_msg);
+  auto& from = static_cast<const Datapoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.Datapoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
-  if (from.duration() != 0) {
-    set_duration(from.duration());
+  if (from._internal_duration() != 0) {
+    _this->_internal_set_duration(from._internal_duration());
   }
-  if (from.value() != 0) {
-    set_value(from.value());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
   }
-}
-
-void Datapoint::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Datapoint::CopyFrom(const Datapoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.Datapoint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Datapoint::IsInitialized() const {
-
   return true;
 }
 
-void Datapoint::Swap(Datapoint* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    Datapoint temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void Datapoint::UnsafeArenaSwap(Datapoint* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void Datapoint::InternalSwap(Datapoint* other) {
-  std::swap(timestamp_, other->timestamp_);
-  std::swap(duration_, other->duration_);
-  std::swap(value_, other->value_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Datapoint::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Datapoint_descriptor_;
-  metadata.reflection = Datapoint_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Datapoint
-
-// optional int64 timestamp = 1;
- void Datapoint::clear_timestamp() {
-  timestamp_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 Datapoint::timestamp() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.timestamp)
-  return timestamp_;
-}
- void Datapoint::set_timestamp(::google::protobuf::int64 value) {
-  
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.timestamp)
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Datapoint, _impl_.value_)
+      + sizeof(Datapoint::_impl_.value_)
+      - PROTOBUF_FIELD_OFFSET(Datapoint, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
-// optional int64 duration = 2;
- void Datapoint::clear_duration() {
-  duration_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 Datapoint::duration() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.duration)
-  return duration_;
-}
- void Datapoint::set_duration(::google::protobuf::int64 value) {
-  
-  duration_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.duration)
+::PROTOBUF_NAMESPACE_ID::Metadata Datapoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_core_2eproto_getter, &descriptor_table_core_2eproto_once,
+      file_level_metadata_core_2eproto[2]);
 }
 
-// optional double value = 3;
- void Datapoint::clear_value() {
-  value_ = 0;
-}
- double Datapoint::value() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.value)
-  return value_;
-}
- void Datapoint::set_value(double value) {
-  
-  value_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.value)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int StatusMessage::kTextFieldNumber;
-const int StatusMessage::kErrorFieldNumber;
-const int StatusMessage::kGoAwayFieldNumber;
-#endif  // !_MSC_VER
-
-StatusMessage::StatusMessage()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.StatusMessage)
-}
+class StatusMessage::_Internal {
+ public:
+};
 
-StatusMessage::StatusMessage(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+StatusMessage::StatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.StatusMessage)
 }
-
-void StatusMessage::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 StatusMessage::StatusMessage(const StatusMessage& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.go_away_){}
+    , decltype(_impl_.retry_after_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.error_, &from._impl_.error_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retry_after_ms_) -
+    reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.retry_after_ms_));
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.StatusMessage)
 }
 
-void StatusMessage::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  text_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  error_ = false;
-  go_away_ = false;
+inline void StatusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.error_){false}
+    , decltype(_impl_.go_away_){false}
+    , decltype(_impl_.retry_after_ms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StatusMessage::~StatusMessage() {
   // @@protoc_insertion_point(destructor:vqro.rpc.StatusMessage)
-  SharedDtor();
-}
-
-void StatusMessage::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  text_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  if (this != default_instance_) {
-  }
-}
-
-void StatusMessage::ArenaDtor(void* object) {
-  StatusMessage* _this = reinterpret_cast< StatusMessage* >(object);
-  (void)_this;
-}
-void StatusMessage::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void StatusMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* StatusMessage::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return StatusMessage_descriptor_;
+  SharedDtor();
 }
 
-const StatusMessage& StatusMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_core_2eproto();
-  return *default_instance_;
+inline void StatusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
 }
 
-StatusMessage* StatusMessage::default_instance_ = NULL;
-
-StatusMessage* StatusMessage::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<StatusMessage>(arena);
+void StatusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void StatusMessage::Clear() {
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<StatusMessage*>(16)->f)
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(error_, go_away_);
-  text_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-
-#undef ZR_HELPER_
-#undef ZR_
-
-}
-
-bool StatusMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.StatusMessage)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string text = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_text()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->text().data(), this->text().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.StatusMessage.text");
-        } else {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.StatusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.text_.ClearToEmpty();
+  ::memset(&_impl_.error_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retry_after_ms_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.retry_after_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.StatusMessage.text"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_error;
-        break;
-      }
-
-      // optional bool error = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_error:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &error_)));
-
-        } else {
+        continue;
+      // bool error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.error_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_go_away;
-        break;
-      }
-
-      // optional bool go_away = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_go_away:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &go_away_)));
-
-        } else {
+        continue;
+      // bool go_away = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.go_away_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // int32 retry_after_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.retry_after_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.StatusMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.StatusMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void StatusMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.StatusMessage)
-  // optional string text = 1;
-  if (this->text().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->text().data(), this->text().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+uint8_t* StatusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.StatusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.StatusMessage.text");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->text(), output);
-  }
-
-  // optional bool error = 2;
-  if (this->error() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->error(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
   }
 
-  // optional bool go_away = 3;
-  if (this->go_away() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->go_away(), output);
+  // bool error = 2;
+  if (this->_internal_error() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_error(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.StatusMessage)
-}
-
-::google::protobuf::uint8* StatusMessage::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.StatusMessage)
-  // optional string text = 1;
-  if (this->text().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->text().data(), this->text().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "vqro.rpc.StatusMessage.text");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->text(), target);
+  // bool go_away = 3;
+  if (this->_internal_go_away() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_go_away(), target);
   }
 
-  // optional bool error = 2;
-  if (this->error() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->error(), target);
+  // int32 retry_after_ms = 4;
+  if (this->_internal_retry_after_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_retry_after_ms(), target);
   }
 
-  // optional bool go_away = 3;
-  if (this->go_away() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->go_away(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.StatusMessage)
   return target;
 }
 
-int StatusMessage::ByteSize() const {
-  int total_size = 0;
+size_t StatusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.StatusMessage)
+  size_t total_size = 0;
 
-  // optional string text = 1;
-  if (this->text().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string text = 1;
+  if (!this->_internal_text().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->text());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
   }
 
-  // optional bool error = 2;
-  if (this->error() != 0) {
+  // bool error = 2;
+  if (this->_internal_error() != 0) {
     total_size += 1 + 1;
   }
 
-  // optional bool go_away = 3;
-  if (this->go_away() != 0) {
+  // bool go_away = 3;
+  if (this->_internal_go_away() != 0) {
     total_size += 1 + 1;
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void StatusMessage::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const StatusMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const StatusMessage*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // int32 retry_after_ms = 4;
+  if (this->_internal_retry_after_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_retry_after_ms());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StatusMessage::MergeFrom(const StatusMessage& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  if (from.text().size() > 0) {
-    set_text(from.text());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatusMessage::GetClassData() const { return &_class_data_; }
+
+
+void StatusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatusMessage*>(&to_msg);
+  auto& from = static_cast<const StatusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.StatusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
   }
-  if (from.error() != 0) {
-    set_error(from.error());
+  if (from._internal_error() != 0) {
+    _this->_internal_set_error(from._internal_error());
   }
-  if (from.go_away() != 0) {
-    set_go_away(from.go_away());
+  if (from._internal_go_away() != 0) {
+    _this->_internal_set_go_away(from._internal_go_away());
   }
-}
-
-void StatusMessage::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_retry_after_ms() != 0) {
+    _this->_internal_set_retry_after_ms(from._internal_retry_after_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StatusMessage::CopyFrom(const StatusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.StatusMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool StatusMessage::IsInitialized() const {
-
   return true;
 }
 
-void StatusMessage::Swap(StatusMessage* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    StatusMessage temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void StatusMessage::UnsafeArenaSwap(StatusMessage* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void StatusMessage::InternalSwap(StatusMessage* other) {
-  text_.Swap(&other->text_);
-  std::swap(error_, other->error_);
-  std::swap(go_away_, other->go_away_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata StatusMessage::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = StatusMessage_descriptor_;
-  metadata.reflection = StatusMessage_reflection_;
-  return metadata;
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StatusMessage, _impl_.retry_after_ms_)
+      + sizeof(StatusMessage::_impl_.retry_after_ms_)
+      - PROTOBUF_FIELD_OFFSET(StatusMessage, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_core_2eproto_getter, &descriptor_table_core_2eproto_once,
+      file_level_metadata_core_2eproto[3]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// StatusMessage
-
-// optional string text = 1;
- void StatusMessage::clear_text() {
-  text_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- const ::std::string& StatusMessage::text() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.text)
-  return text_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void StatusMessage::set_text(const ::std::string& value) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.text)
-}
- void StatusMessage::set_text(const char* value) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.StatusMessage.text)
-}
- void StatusMessage::set_text(const char* value,
-    size_t size) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.StatusMessage.text)
-}
- ::std::string* StatusMessage::mutable_text() {
-  
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.StatusMessage.text)
-  return text_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* StatusMessage::release_text() {
-  
-  return text_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* StatusMessage::unsafe_arena_release_text() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return text_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-}
- void StatusMessage::set_allocated_text(::std::string* text) {
-  if (text != NULL) {
-    
-  } else {
-    
-  }
-  text_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), text,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.StatusMessage.text)
-}
- void StatusMessage::unsafe_arena_set_allocated_text(
-    ::std::string* text) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (text != NULL) {
-    
-  } else {
-    
-  }
-  
-  text_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      text, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.StatusMessage.text)
-}
-
-// optional bool error = 2;
- void StatusMessage::clear_error() {
-  error_ = false;
-}
- bool StatusMessage::error() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.error)
-  return error_;
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::vqro::rpc::Series_LabelsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::vqro::rpc::Series_LabelsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::Series_LabelsEntry_DoNotUse >(arena);
 }
- void StatusMessage::set_error(bool value) {
-  
-  error_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.error)
+template<> PROTOBUF_NOINLINE ::vqro::rpc::Series*
+Arena::CreateMaybeMessage< ::vqro::rpc::Series >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::Series >(arena);
 }
-
-// optional bool go_away = 3;
- void StatusMessage::clear_go_away() {
-  go_away_ = false;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::Datapoint*
+Arena::CreateMaybeMessage< ::vqro::rpc::Datapoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::Datapoint >(arena);
 }
- bool StatusMessage::go_away() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.go_away)
-  return go_away_;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::StatusMessage*
+Arena::CreateMaybeMessage< ::vqro::rpc::StatusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::StatusMessage >(arena);
 }
- void StatusMessage::set_go_away(bool value) {
-  
-  go_away_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.go_away)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace rpc
-}  // namespace vqro
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
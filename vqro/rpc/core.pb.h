@@ -1,440 +1,727 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: core.proto
 
-#ifndef PROTOBUF_core_2eproto__INCLUDED
-#define PROTOBUF_core_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_core_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_core_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/map.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_core_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_core_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_core_2eproto;
 namespace vqro {
 namespace rpc {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_core_2eproto();
-void protobuf_AssignDesc_core_2eproto();
-void protobuf_ShutdownFile_core_2eproto();
-
-class Series;
 class Datapoint;
+struct DatapointDefaultTypeInternal;
+extern DatapointDefaultTypeInternal _Datapoint_default_instance_;
+class Series;
+struct SeriesDefaultTypeInternal;
+extern SeriesDefaultTypeInternal _Series_default_instance_;
+class Series_LabelsEntry_DoNotUse;
+struct Series_LabelsEntry_DoNotUseDefaultTypeInternal;
+extern Series_LabelsEntry_DoNotUseDefaultTypeInternal _Series_LabelsEntry_DoNotUse_default_instance_;
 class StatusMessage;
+struct StatusMessageDefaultTypeInternal;
+extern StatusMessageDefaultTypeInternal _StatusMessage_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> ::vqro::rpc::Datapoint* Arena::CreateMaybeMessage<::vqro::rpc::Datapoint>(Arena*);
+template<> ::vqro::rpc::Series* Arena::CreateMaybeMessage<::vqro::rpc::Series>(Arena*);
+template<> ::vqro::rpc::Series_LabelsEntry_DoNotUse* Arena::CreateMaybeMessage<::vqro::rpc::Series_LabelsEntry_DoNotUse>(Arena*);
+template<> ::vqro::rpc::StatusMessage* Arena::CreateMaybeMessage<::vqro::rpc::StatusMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace vqro {
+namespace rpc {
 
 // ===================================================================
 
-class Series : public ::google::protobuf::Message {
+class Series_LabelsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Series_LabelsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Series_LabelsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  Series_LabelsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Series_LabelsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Series_LabelsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Series_LabelsEntry_DoNotUse& other);
+  static const Series_LabelsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Series_LabelsEntry_DoNotUse*>(&_Series_LabelsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "vqro.rpc.Series.LabelsEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "vqro.rpc.Series.LabelsEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_core_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Series final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.Series) */ {
  public:
-  Series();
-  virtual ~Series();
+  inline Series() : Series(nullptr) {}
+  ~Series() override;
+  explicit PROTOBUF_CONSTEXPR Series(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Series(const Series& from);
+  Series(Series&& from) noexcept
+    : Series() {
+    *this = ::std::move(from);
+  }
 
   inline Series& operator=(const Series& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Series& operator=(Series&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Series& default_instance();
+  static const Series& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Series* internal_default_instance() {
+    return reinterpret_cast<const Series*>(
+               &_Series_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void UnsafeArenaSwap(Series* other);
-  void Swap(Series* other);
+  friend void swap(Series& a, Series& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Series* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Series* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Series* New() const { return New(NULL); }
-
-  Series* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Series* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Series>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Series& from);
-  void MergeFrom(const Series& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Series& from) {
+    Series::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Series* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.Series";
+  }
   protected:
-  explicit Series(::google::protobuf::Arena* arena);
+  explicit Series(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
-  }
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLabelsFieldNumber = 1,
+  };
   // map<string, string> labels = 1;
   int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
   void clear_labels();
-  static const int kLabelsFieldNumber = 1;
-  const ::google::protobuf::Map< ::std::string, ::std::string >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_labels() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_labels();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
       labels() const;
-  ::google::protobuf::Map< ::std::string, ::std::string >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
       mutable_labels();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.Series)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  typedef ::google::protobuf::internal::MapEntryLite<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 >
-      Series_LabelsEntry;
-  ::google::protobuf::internal::MapField<
-      ::std::string, ::std::string,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      ::google::protobuf::internal::WireFormatLite::TYPE_STRING,
-      0 > labels_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_core_2eproto();
-  friend void protobuf_AssignDesc_core_2eproto();
-  friend void protobuf_ShutdownFile_core_2eproto();
-
-  void InitAsDefaultInstance();
-  static Series* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Series_LabelsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> labels_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_core_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Datapoint : public ::google::protobuf::Message {
+class Datapoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.Datapoint) */ {
  public:
-  Datapoint();
-  virtual ~Datapoint();
+  inline Datapoint() : Datapoint(nullptr) {}
+  ~Datapoint() override;
+  explicit PROTOBUF_CONSTEXPR Datapoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Datapoint(const Datapoint& from);
+  Datapoint(Datapoint&& from) noexcept
+    : Datapoint() {
+    *this = ::std::move(from);
+  }
 
   inline Datapoint& operator=(const Datapoint& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Datapoint& operator=(Datapoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Datapoint& default_instance() {
+    return *internal_default_instance();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Datapoint& default_instance();
+  static inline const Datapoint* internal_default_instance() {
+    return reinterpret_cast<const Datapoint*>(
+               &_Datapoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void UnsafeArenaSwap(Datapoint* other);
-  void Swap(Datapoint* other);
+  friend void swap(Datapoint& a, Datapoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Datapoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Datapoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Datapoint* New() const { return New(NULL); }
-
-  Datapoint* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Datapoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Datapoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Datapoint& from);
-  void MergeFrom(const Datapoint& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Datapoint& from) {
+    Datapoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Datapoint* other);
-  protected:
-  explicit Datapoint(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.Datapoint";
   }
+  protected:
+  explicit Datapoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 timestamp = 1;
+  enum : int {
+    kTimestampFieldNumber = 1,
+    kDurationFieldNumber = 2,
+    kValueFieldNumber = 3,
+  };
+  // int64 timestamp = 1;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 1;
-  ::google::protobuf::int64 timestamp() const;
-  void set_timestamp(::google::protobuf::int64 value);
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
 
-  // optional int64 duration = 2;
+  // int64 duration = 2;
   void clear_duration();
-  static const int kDurationFieldNumber = 2;
-  ::google::protobuf::int64 duration() const;
-  void set_duration(::google::protobuf::int64 value);
+  int64_t duration() const;
+  void set_duration(int64_t value);
+  private:
+  int64_t _internal_duration() const;
+  void _internal_set_duration(int64_t value);
+  public:
 
-  // optional double value = 3;
+  // double value = 3;
   void clear_value();
-  static const int kValueFieldNumber = 3;
   double value() const;
   void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.Datapoint)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 timestamp_;
-  ::google::protobuf::int64 duration_;
-  double value_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_core_2eproto();
-  friend void protobuf_AssignDesc_core_2eproto();
-  friend void protobuf_ShutdownFile_core_2eproto();
-
-  void InitAsDefaultInstance();
-  static Datapoint* default_instance_;
+  struct Impl_ {
+    int64_t timestamp_;
+    int64_t duration_;
+    double value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_core_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StatusMessage : public ::google::protobuf::Message {
+class StatusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.StatusMessage) */ {
  public:
-  StatusMessage();
-  virtual ~StatusMessage();
+  inline StatusMessage() : StatusMessage(nullptr) {}
+  ~StatusMessage() override;
+  explicit PROTOBUF_CONSTEXPR StatusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StatusMessage(const StatusMessage& from);
+  StatusMessage(StatusMessage&& from) noexcept
+    : StatusMessage() {
+    *this = ::std::move(from);
+  }
 
   inline StatusMessage& operator=(const StatusMessage& from) {
     CopyFrom(from);
     return *this;
   }
+  inline StatusMessage& operator=(StatusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const StatusMessage& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatusMessage* internal_default_instance() {
+    return reinterpret_cast<const StatusMessage*>(
+               &_StatusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void UnsafeArenaSwap(StatusMessage* other);
-  void Swap(StatusMessage* other);
+  friend void swap(StatusMessage& a, StatusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline StatusMessage* New() const { return New(NULL); }
-
-  StatusMessage* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  StatusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StatusMessage& from);
-  void MergeFrom(const StatusMessage& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatusMessage& from) {
+    StatusMessage::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(StatusMessage* other);
-  protected:
-  explicit StatusMessage(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.StatusMessage";
   }
+  protected:
+  explicit StatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string text = 1;
+  enum : int {
+    kTextFieldNumber = 1,
+    kErrorFieldNumber = 2,
+    kGoAwayFieldNumber = 3,
+    kRetryAfterMsFieldNumber = 4,
+  };
+  // string text = 1;
   void clear_text();
-  static const int kTextFieldNumber = 1;
-  const ::std::string& text() const;
-  void set_text(const ::std::string& value);
-  void set_text(const char* value);
-  void set_text(const char* value, size_t size);
-  ::std::string* mutable_text();
-  ::std::string* release_text();
-  void set_allocated_text(::std::string* text);
-  ::std::string* unsafe_arena_release_text();
-  void unsafe_arena_set_allocated_text(
-      ::std::string* text);
-
-  // optional bool error = 2;
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // bool error = 2;
   void clear_error();
-  static const int kErrorFieldNumber = 2;
   bool error() const;
   void set_error(bool value);
+  private:
+  bool _internal_error() const;
+  void _internal_set_error(bool value);
+  public:
 
-  // optional bool go_away = 3;
+  // bool go_away = 3;
   void clear_go_away();
-  static const int kGoAwayFieldNumber = 3;
   bool go_away() const;
   void set_go_away(bool value);
+  private:
+  bool _internal_go_away() const;
+  void _internal_set_go_away(bool value);
+  public:
+
+  // int32 retry_after_ms = 4;
+  void clear_retry_after_ms();
+  int32_t retry_after_ms() const;
+  void set_retry_after_ms(int32_t value);
+  private:
+  int32_t _internal_retry_after_ms() const;
+  void _internal_set_retry_after_ms(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.StatusMessage)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr text_;
-  bool error_;
-  bool go_away_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_core_2eproto();
-  friend void protobuf_AssignDesc_core_2eproto();
-  friend void protobuf_ShutdownFile_core_2eproto();
-
-  void InitAsDefaultInstance();
-  static StatusMessage* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    bool error_;
+    bool go_away_;
+    int32_t retry_after_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_core_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
 // Series
 
 // map<string, string> labels = 1;
+inline int Series::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
 inline int Series::labels_size() const {
-  return labels_.size();
+  return _internal_labels_size();
 }
 inline void Series::clear_labels() {
-  labels_.Clear();
+  _impl_.labels_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Series::_internal_labels() const {
+  return _impl_.labels_.GetMap();
 }
-inline const ::google::protobuf::Map< ::std::string, ::std::string >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
 Series::labels() const {
   // @@protoc_insertion_point(field_map:vqro.rpc.Series.labels)
-  return labels_.GetMap();
+  return _internal_labels();
 }
-inline ::google::protobuf::Map< ::std::string, ::std::string >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Series::_internal_mutable_labels() {
+  return _impl_.labels_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
 Series::mutable_labels() {
   // @@protoc_insertion_point(field_mutable_map:vqro.rpc.Series.labels)
-  return labels_.MutableMap();
+  return _internal_mutable_labels();
 }
 
 // -------------------------------------------------------------------
 
 // Datapoint
 
-// optional int64 timestamp = 1;
+// int64 timestamp = 1;
 inline void Datapoint::clear_timestamp() {
-  timestamp_ = GOOGLE_LONGLONG(0);
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t Datapoint::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline ::google::protobuf::int64 Datapoint::timestamp() const {
+inline int64_t Datapoint::timestamp() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
 }
-inline void Datapoint::set_timestamp(::google::protobuf::int64 value) {
+inline void Datapoint::_internal_set_timestamp(int64_t value) {
   
-  timestamp_ = value;
+  _impl_.timestamp_ = value;
+}
+inline void Datapoint::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.timestamp)
 }
 
-// optional int64 duration = 2;
+// int64 duration = 2;
 inline void Datapoint::clear_duration() {
-  duration_ = GOOGLE_LONGLONG(0);
+  _impl_.duration_ = int64_t{0};
+}
+inline int64_t Datapoint::_internal_duration() const {
+  return _impl_.duration_;
 }
-inline ::google::protobuf::int64 Datapoint::duration() const {
+inline int64_t Datapoint::duration() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.duration)
-  return duration_;
+  return _internal_duration();
 }
-inline void Datapoint::set_duration(::google::protobuf::int64 value) {
+inline void Datapoint::_internal_set_duration(int64_t value) {
   
-  duration_ = value;
+  _impl_.duration_ = value;
+}
+inline void Datapoint::set_duration(int64_t value) {
+  _internal_set_duration(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.duration)
 }
 
-// optional double value = 3;
+// double value = 3;
 inline void Datapoint::clear_value() {
-  value_ = 0;
+  _impl_.value_ = 0;
+}
+inline double Datapoint::_internal_value() const {
+  return _impl_.value_;
 }
 inline double Datapoint::value() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.Datapoint.value)
-  return value_;
+  return _internal_value();
 }
-inline void Datapoint::set_value(double value) {
+inline void Datapoint::_internal_set_value(double value) {
   
-  value_ = value;
+  _impl_.value_ = value;
+}
+inline void Datapoint::set_value(double value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.Datapoint.value)
 }
 
@@ -442,100 +729,125 @@ inline void Datapoint::set_value(double value) {
 
 // StatusMessage
 
-// optional string text = 1;
+// string text = 1;
 inline void StatusMessage::clear_text() {
-  text_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.text_.ClearToEmpty();
 }
-inline const ::std::string& StatusMessage::text() const {
+inline const std::string& StatusMessage::text() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.text)
-  return text_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_text();
 }
-inline void StatusMessage::set_text(const ::std::string& value) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatusMessage::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.text)
 }
-inline void StatusMessage::set_text(const char* value) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.StatusMessage.text)
+inline std::string* StatusMessage::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.StatusMessage.text)
+  return _s;
 }
-inline void StatusMessage::set_text(const char* value,
-    size_t size) {
-  
-  text_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.StatusMessage.text)
+inline const std::string& StatusMessage::_internal_text() const {
+  return _impl_.text_.Get();
 }
-inline ::std::string* StatusMessage::mutable_text() {
+inline void StatusMessage::_internal_set_text(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.StatusMessage.text)
-  return text_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.text_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* StatusMessage::release_text() {
+inline std::string* StatusMessage::_internal_mutable_text() {
   
-  return text_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  return _impl_.text_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* StatusMessage::unsafe_arena_release_text() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return text_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
+inline std::string* StatusMessage::release_text() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.StatusMessage.text)
+  return _impl_.text_.Release();
 }
-inline void StatusMessage::set_allocated_text(::std::string* text) {
-  if (text != NULL) {
+inline void StatusMessage::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
     
   } else {
     
   }
-  text_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), text,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.StatusMessage.text)
-}
-inline void StatusMessage::unsafe_arena_set_allocated_text(
-    ::std::string* text) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (text != NULL) {
-    
-  } else {
-    
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
   }
-  
-  text_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      text, GetArenaNoVirtual());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.StatusMessage.text)
 }
 
-// optional bool error = 2;
+// bool error = 2;
 inline void StatusMessage::clear_error() {
-  error_ = false;
+  _impl_.error_ = false;
+}
+inline bool StatusMessage::_internal_error() const {
+  return _impl_.error_;
 }
 inline bool StatusMessage::error() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.error)
-  return error_;
+  return _internal_error();
 }
-inline void StatusMessage::set_error(bool value) {
+inline void StatusMessage::_internal_set_error(bool value) {
   
-  error_ = value;
+  _impl_.error_ = value;
+}
+inline void StatusMessage::set_error(bool value) {
+  _internal_set_error(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.error)
 }
 
-// optional bool go_away = 3;
+// bool go_away = 3;
 inline void StatusMessage::clear_go_away() {
-  go_away_ = false;
+  _impl_.go_away_ = false;
+}
+inline bool StatusMessage::_internal_go_away() const {
+  return _impl_.go_away_;
 }
 inline bool StatusMessage::go_away() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.go_away)
-  return go_away_;
+  return _internal_go_away();
 }
-inline void StatusMessage::set_go_away(bool value) {
+inline void StatusMessage::_internal_set_go_away(bool value) {
   
-  go_away_ = value;
+  _impl_.go_away_ = value;
+}
+inline void StatusMessage::set_go_away(bool value) {
+  _internal_set_go_away(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.go_away)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// int32 retry_after_ms = 4;
+inline void StatusMessage::clear_retry_after_ms() {
+  _impl_.retry_after_ms_ = 0;
+}
+inline int32_t StatusMessage::_internal_retry_after_ms() const {
+  return _impl_.retry_after_ms_;
+}
+inline int32_t StatusMessage::retry_after_ms() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.StatusMessage.retry_after_ms)
+  return _internal_retry_after_ms();
+}
+inline void StatusMessage::_internal_set_retry_after_ms(int32_t value) {
+  
+  _impl_.retry_after_ms_ = value;
+}
+inline void StatusMessage::set_retry_after_ms(int32_t value) {
+  _internal_set_retry_after_ms(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.StatusMessage.retry_after_ms)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -544,4 +856,5 @@ inline void StatusMessage::set_go_away(bool value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_core_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_core_2eproto
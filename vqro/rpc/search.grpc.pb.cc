@@ -1,17 +1,24 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: search.proto
 
 #include "search.pb.h"
 #include "search.grpc.pb.h"
 
-#include <grpc++/channel.h>
-#include <grpc++/impl/client_unary_call.h>
-#include <grpc++/impl/rpc_service_method.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/async_stream.h>
-#include <grpc++/support/sync_stream.h>
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace vqro {
 namespace rpc {
 
@@ -20,36 +27,73 @@ static const char* VaqueroSearch_method_names[] = {
   "/vqro.rpc.VaqueroSearch/SearchLabels",
 };
 
-std::unique_ptr< VaqueroSearch::Stub> VaqueroSearch::NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options) {
-  std::unique_ptr< VaqueroSearch::Stub> stub(new VaqueroSearch::Stub(channel));
+std::unique_ptr< VaqueroSearch::Stub> VaqueroSearch::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< VaqueroSearch::Stub> stub(new VaqueroSearch::Stub(channel, options));
   return stub;
 }
 
-VaqueroSearch::Stub::Stub(const std::shared_ptr< ::grpc::Channel>& channel)
-  : channel_(channel), rpcmethod_SearchSeries_(VaqueroSearch_method_names[0], ::grpc::RpcMethod::SERVER_STREAMING, channel)
-  , rpcmethod_SearchLabels_(VaqueroSearch_method_names[1], ::grpc::RpcMethod::SERVER_STREAMING, channel)
+VaqueroSearch::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_SearchSeries_(VaqueroSearch_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SearchLabels_(VaqueroSearch_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>* VaqueroSearch::Stub::SearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request) {
-  return new ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>(channel_.get(), rpcmethod_SearchSeries_, context, request);
+  return ::grpc::internal::ClientReaderFactory< ::vqro::rpc::SearchSeriesResults>::Create(channel_.get(), rpcmethod_SearchSeries_, context, request);
+}
+
+void VaqueroSearch::Stub::async::SearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchSeriesResults>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::vqro::rpc::SearchSeriesResults>::Create(stub_->channel_.get(), stub_->rpcmethod_SearchSeries_, context, request, reactor);
 }
 
 ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>* VaqueroSearch::Stub::AsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return new ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>(channel_.get(), cq, rpcmethod_SearchSeries_, context, request, tag);
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::SearchSeriesResults>::Create(channel_.get(), cq, rpcmethod_SearchSeries_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>* VaqueroSearch::Stub::PrepareAsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::SearchSeriesResults>::Create(channel_.get(), cq, rpcmethod_SearchSeries_, context, request, false, nullptr);
 }
 
 ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>* VaqueroSearch::Stub::SearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) {
-  return new ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>(channel_.get(), rpcmethod_SearchLabels_, context, request);
+  return ::grpc::internal::ClientReaderFactory< ::vqro::rpc::SearchLabelsResults>::Create(channel_.get(), rpcmethod_SearchLabels_, context, request);
+}
+
+void VaqueroSearch::Stub::async::SearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchLabelsResults>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::vqro::rpc::SearchLabelsResults>::Create(stub_->channel_.get(), stub_->rpcmethod_SearchLabels_, context, request, reactor);
 }
 
 ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>* VaqueroSearch::Stub::AsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return new ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>(channel_.get(), cq, rpcmethod_SearchLabels_, context, request, tag);
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::SearchLabelsResults>::Create(channel_.get(), cq, rpcmethod_SearchLabels_, context, request, true, tag);
 }
 
-VaqueroSearch::AsyncService::AsyncService() : ::grpc::AsynchronousService(VaqueroSearch_method_names, 2) {}
+::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>* VaqueroSearch::Stub::PrepareAsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::SearchLabelsResults>::Create(channel_.get(), cq, rpcmethod_SearchLabels_, context, request, false, nullptr);
+}
+
+VaqueroSearch::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroSearch_method_names[0],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< VaqueroSearch::Service, ::vqro::rpc::SeriesQuery, ::vqro::rpc::SearchSeriesResults>(
+          [](VaqueroSearch::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::SeriesQuery* req,
+             ::grpc::ServerWriter<::vqro::rpc::SearchSeriesResults>* writer) {
+               return service->SearchSeries(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroSearch_method_names[1],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< VaqueroSearch::Service, ::vqro::rpc::LabelsQuery, ::vqro::rpc::SearchLabelsResults>(
+          [](VaqueroSearch::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::LabelsQuery* req,
+             ::grpc::ServerWriter<::vqro::rpc::SearchLabelsResults>* writer) {
+               return service->SearchLabels(ctx, req, writer);
+             }, this)));
+}
 
 VaqueroSearch::Service::~Service() {
-  delete service_;
 }
 
 ::grpc::Status VaqueroSearch::Service::SearchSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesQuery* request, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* writer) {
@@ -59,10 +103,6 @@ VaqueroSearch::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroSearch::AsyncService::RequestSearchSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchSeriesResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-}
-
 ::grpc::Status VaqueroSearch::Service::SearchLabels(::grpc::ServerContext* context, const ::vqro::rpc::LabelsQuery* request, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* writer) {
   (void) context;
   (void) request;
@@ -70,28 +110,6 @@ void VaqueroSearch::AsyncService::RequestSearchSeries(::grpc::ServerContext* con
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroSearch::AsyncService::RequestSearchLabels(::grpc::ServerContext* context, ::vqro::rpc::LabelsQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchLabelsResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
-}
-
-::grpc::RpcService* VaqueroSearch::Service::service() {
-  if (service_ != nullptr) {
-    return service_;
-  }
-  service_ = new ::grpc::RpcService();
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroSearch_method_names[0],
-      ::grpc::RpcMethod::SERVER_STREAMING,
-      new ::grpc::ServerStreamingHandler< VaqueroSearch::Service, ::vqro::rpc::SeriesQuery, ::vqro::rpc::SearchSeriesResults>(
-          std::mem_fn(&VaqueroSearch::Service::SearchSeries), this)));
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroSearch_method_names[1],
-      ::grpc::RpcMethod::SERVER_STREAMING,
-      new ::grpc::ServerStreamingHandler< VaqueroSearch::Service, ::vqro::rpc::LabelsQuery, ::vqro::rpc::SearchLabelsResults>(
-          std::mem_fn(&VaqueroSearch::Service::SearchLabels), this)));
-  return service_;
-}
-
 
 }  // namespace vqro
 }  // namespace rpc
@@ -1,4 +1,4 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: search.proto
 #ifndef GRPC_search_2eproto__INCLUDED
@@ -6,28 +6,33 @@
 
 #include "search.pb.h"
 
-#include <grpc++/support/async_stream.h>
-#include <grpc++/impl/rpc_method.h>
-#include <grpc++/impl/proto_utils.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/status.h>
-#include <grpc++/support/stub_options.h>
-#include <grpc++/support/sync_stream.h>
-
-namespace grpc {
-class CompletionQueue;
-class Channel;
-class RpcService;
-class ServerCompletionQueue;
-class ServerContext;
-}  // namespace grpc
+#include <functional>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace vqro {
 namespace rpc {
 
-class VaqueroSearch GRPC_FINAL {
+class VaqueroSearch final {
  public:
+  static constexpr char const* service_full_name() {
+    return "vqro.rpc.VaqueroSearch";
+  }
   class StubInterface {
    public:
     virtual ~StubInterface() {}
@@ -37,62 +42,352 @@ class VaqueroSearch GRPC_FINAL {
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>> AsyncSearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>>(AsyncSearchSeriesRaw(context, request, cq, tag));
     }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>> PrepareAsyncSearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>>(PrepareAsyncSearchSeriesRaw(context, request, cq));
+    }
     std::unique_ptr< ::grpc::ClientReaderInterface< ::vqro::rpc::SearchLabelsResults>> SearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) {
       return std::unique_ptr< ::grpc::ClientReaderInterface< ::vqro::rpc::SearchLabelsResults>>(SearchLabelsRaw(context, request));
     }
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>> AsyncSearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>>(AsyncSearchLabelsRaw(context, request, cq, tag));
     }
-  private:
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>> PrepareAsyncSearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>>(PrepareAsyncSearchLabelsRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void SearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchSeriesResults>* reactor) = 0;
+      virtual void SearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchLabelsResults>* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientReaderInterface< ::vqro::rpc::SearchSeriesResults>* SearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>* AsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchSeriesResults>* PrepareAsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientReaderInterface< ::vqro::rpc::SearchLabelsResults>* SearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>* AsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::SearchLabelsResults>* PrepareAsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq) = 0;
   };
-  class Stub GRPC_FINAL : public StubInterface {
+  class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::Channel>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>> SearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request) {
       return std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>>(SearchSeriesRaw(context, request));
     }
     std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>> AsyncSearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>>(AsyncSearchSeriesRaw(context, request, cq, tag));
     }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>> PrepareAsyncSearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>>(PrepareAsyncSearchSeriesRaw(context, request, cq));
+    }
     std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>> SearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) {
       return std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>>(SearchLabelsRaw(context, request));
     }
     std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>> AsyncSearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>>(AsyncSearchLabelsRaw(context, request, cq, tag));
     }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>> PrepareAsyncSearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>>(PrepareAsyncSearchLabelsRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void SearchSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchSeriesResults>* reactor) override;
+      void SearchLabels(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery* request, ::grpc::ClientReadReactor< ::vqro::rpc::SearchLabelsResults>* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
 
    private:
-    std::shared_ptr< ::grpc::Channel> channel_;
-    ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>* SearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request) GRPC_OVERRIDE;
-    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>* AsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) GRPC_OVERRIDE;
-    ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>* SearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) GRPC_OVERRIDE;
-    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>* AsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) GRPC_OVERRIDE;
-    const ::grpc::RpcMethod rpcmethod_SearchSeries_;
-    const ::grpc::RpcMethod rpcmethod_SearchLabels_;
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientReader< ::vqro::rpc::SearchSeriesResults>* SearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>* AsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchSeriesResults>* PrepareAsyncSearchSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::vqro::rpc::SearchLabelsResults>* SearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>* AsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::SearchLabelsResults>* PrepareAsyncSearchLabelsRaw(::grpc::ClientContext* context, const ::vqro::rpc::LabelsQuery& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_SearchSeries_;
+    const ::grpc::internal::RpcMethod rpcmethod_SearchLabels_;
   };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
-  class Service : public ::grpc::SynchronousService {
+  class Service : public ::grpc::Service {
    public:
-    Service() : service_(nullptr) {}
+    Service();
     virtual ~Service();
     virtual ::grpc::Status SearchSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesQuery* request, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* writer);
     virtual ::grpc::Status SearchLabels(::grpc::ServerContext* context, const ::vqro::rpc::LabelsQuery* request, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* writer);
-    ::grpc::RpcService* service() GRPC_OVERRIDE GRPC_FINAL;
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SearchSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSearchSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchSeriesResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSearchLabels(::grpc::ServerContext* context, ::vqro::rpc::LabelsQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchLabelsResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_SearchSeries<WithAsyncMethod_SearchLabels<Service > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_SearchSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::vqro::rpc::SeriesQuery, ::vqro::rpc::SearchSeriesResults>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::SeriesQuery* request) { return this->SearchSeries(context, request); }));
+    }
+    ~WithCallbackMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::vqro::rpc::SearchSeriesResults>* SearchSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::vqro::rpc::LabelsQuery, ::vqro::rpc::SearchLabelsResults>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::LabelsQuery* request) { return this->SearchLabels(context, request); }));
+    }
+    ~WithCallbackMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::vqro::rpc::SearchLabelsResults>* SearchLabels(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_SearchSeries<WithCallbackMethod_SearchLabels<Service > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_SearchSeries : public BaseClass {
    private:
-    ::grpc::RpcService* service_;
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
   };
-  class AsyncService GRPC_FINAL : public ::grpc::AsynchronousService {
+  template <class BaseClass>
+  class WithGenericMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    explicit AsyncService();
-    ~AsyncService() {};
-    void RequestSearchSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchSeriesResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
-    void RequestSearchLabels(::grpc::ServerContext* context, ::vqro::rpc::LabelsQuery* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::SearchLabelsResults>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
+    WithGenericMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SearchSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSearchSeries(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSearchLabels(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SearchSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SearchSeries(context, request); }));
+    }
+    ~WithRawCallbackMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SearchSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SearchLabels(context, request); }));
+    }
+    ~WithRawCallbackMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SearchLabels(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  typedef Service StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SearchSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SearchSeries() {
+      ::grpc::Service::MarkMethodStreamed(0,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::vqro::rpc::SeriesQuery, ::vqro::rpc::SearchSeriesResults>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::vqro::rpc::SeriesQuery, ::vqro::rpc::SearchSeriesResults>* streamer) {
+                       return this->StreamedSearchSeries(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SearchSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SearchSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchSeriesResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSearchSeries(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::vqro::rpc::SeriesQuery,::vqro::rpc::SearchSeriesResults>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SearchLabels : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SearchLabels() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::vqro::rpc::LabelsQuery, ::vqro::rpc::SearchLabelsResults>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::vqro::rpc::LabelsQuery, ::vqro::rpc::SearchLabelsResults>* streamer) {
+                       return this->StreamedSearchLabels(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SearchLabels() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SearchLabels(::grpc::ServerContext* /*context*/, const ::vqro::rpc::LabelsQuery* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::SearchLabelsResults>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSearchLabels(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::vqro::rpc::LabelsQuery,::vqro::rpc::SearchLabelsResults>* server_split_streamer) = 0;
   };
+  typedef WithSplitStreamingMethod_SearchSeries<WithSplitStreamingMethod_SearchLabels<Service > > SplitStreamedService;
+  typedef WithSplitStreamingMethod_SearchSeries<WithSplitStreamingMethod_SearchLabels<Service > > StreamedService;
 };
 
 }  // namespace rpc
@@ -1,2592 +1,1534 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: search.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "search.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace vqro {
 namespace rpc {
-
-namespace {
-
-const ::google::protobuf::Descriptor* SeriesQuery_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SeriesQuery_reflection_ = NULL;
-const ::google::protobuf::Descriptor* LabelConstraint_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  LabelConstraint_reflection_ = NULL;
-struct LabelConstraintOneofInstance {
-  ::google::protobuf::internal::ArenaStringPtr exact_value_;
-  ::google::protobuf::internal::ArenaStringPtr regex_;
-}* LabelConstraint_default_oneof_instance_ = NULL;
-const ::google::protobuf::Descriptor* SearchSeriesResults_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SearchSeriesResults_reflection_ = NULL;
-const ::google::protobuf::Descriptor* LabelsQuery_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  LabelsQuery_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SearchLabelsResults_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SearchLabelsResults_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_search_2eproto() {
-  protobuf_AddDesc_search_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "search.proto");
-  GOOGLE_CHECK(file != NULL);
-  SeriesQuery_descriptor_ = file->message_type(0);
-  static const int SeriesQuery_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesQuery, constraints_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesQuery, result_offset_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesQuery, result_limit_),
+PROTOBUF_CONSTEXPR SeriesQuery::SeriesQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.constraints_)*/{}
+  , /*decltype(_impl_.result_offset_)*/int64_t{0}
+  , /*decltype(_impl_.result_limit_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeriesQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeriesQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeriesQueryDefaultTypeInternal() {}
+  union {
+    SeriesQuery _instance;
   };
-  SeriesQuery_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SeriesQuery_descriptor_,
-      SeriesQuery::default_instance_,
-      SeriesQuery_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(SeriesQuery),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesQuery, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesQuery, _is_default_instance_));
-  LabelConstraint_descriptor_ = file->message_type(1);
-  static const int LabelConstraint_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelConstraint, label_name_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(LabelConstraint_default_oneof_instance_, exact_value_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(LabelConstraint_default_oneof_instance_, regex_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelConstraint, predicate_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeriesQueryDefaultTypeInternal _SeriesQuery_default_instance_;
+PROTOBUF_CONSTEXPR LabelConstraint::LabelConstraint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.label_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.predicate_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct LabelConstraintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LabelConstraintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LabelConstraintDefaultTypeInternal() {}
+  union {
+    LabelConstraint _instance;
   };
-  LabelConstraint_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      LabelConstraint_descriptor_,
-      LabelConstraint::default_instance_,
-      LabelConstraint_offsets_,
-      -1,
-      -1,
-      -1,
-      LabelConstraint_default_oneof_instance_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelConstraint, _oneof_case_[0]),
-      sizeof(LabelConstraint),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelConstraint, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelConstraint, _is_default_instance_));
-  SearchSeriesResults_descriptor_ = file->message_type(2);
-  static const int SearchSeriesResults_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchSeriesResults, matches_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchSeriesResults, status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LabelConstraintDefaultTypeInternal _LabelConstraint_default_instance_;
+PROTOBUF_CONSTEXPR SearchSeriesResults::SearchSeriesResults(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.matches_)*/{}
+  , /*decltype(_impl_.status_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchSeriesResultsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchSeriesResultsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchSeriesResultsDefaultTypeInternal() {}
+  union {
+    SearchSeriesResults _instance;
   };
-  SearchSeriesResults_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SearchSeriesResults_descriptor_,
-      SearchSeriesResults::default_instance_,
-      SearchSeriesResults_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(SearchSeriesResults),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchSeriesResults, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchSeriesResults, _is_default_instance_));
-  LabelsQuery_descriptor_ = file->message_type(3);
-  static const int LabelsQuery_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelsQuery, regex_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelsQuery, result_offset_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelsQuery, result_limit_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchSeriesResultsDefaultTypeInternal _SearchSeriesResults_default_instance_;
+PROTOBUF_CONSTEXPR LabelsQuery::LabelsQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.regex_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_offset_)*/int64_t{0}
+  , /*decltype(_impl_.result_limit_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LabelsQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LabelsQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LabelsQueryDefaultTypeInternal() {}
+  union {
+    LabelsQuery _instance;
   };
-  LabelsQuery_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      LabelsQuery_descriptor_,
-      LabelsQuery::default_instance_,
-      LabelsQuery_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(LabelsQuery),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelsQuery, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LabelsQuery, _is_default_instance_));
-  SearchLabelsResults_descriptor_ = file->message_type(4);
-  static const int SearchLabelsResults_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchLabelsResults, labels_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchLabelsResults, status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LabelsQueryDefaultTypeInternal _LabelsQuery_default_instance_;
+PROTOBUF_CONSTEXPR SearchLabelsResults::SearchLabelsResults(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.labels_)*/{}
+  , /*decltype(_impl_.status_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchLabelsResultsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchLabelsResultsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchLabelsResultsDefaultTypeInternal() {}
+  union {
+    SearchLabelsResults _instance;
   };
-  SearchLabelsResults_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SearchLabelsResults_descriptor_,
-      SearchLabelsResults::default_instance_,
-      SearchLabelsResults_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(SearchLabelsResults),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchLabelsResults, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SearchLabelsResults, _is_default_instance_));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_search_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SeriesQuery_descriptor_, &SeriesQuery::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      LabelConstraint_descriptor_, &LabelConstraint::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SearchSeriesResults_descriptor_, &SearchSeriesResults::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      LabelsQuery_descriptor_, &LabelsQuery::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SearchLabelsResults_descriptor_, &SearchLabelsResults::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_search_2eproto() {
-  delete SeriesQuery::default_instance_;
-  delete SeriesQuery_reflection_;
-  delete LabelConstraint::default_instance_;
-  delete LabelConstraint_default_oneof_instance_;
-  delete LabelConstraint_reflection_;
-  delete SearchSeriesResults::default_instance_;
-  delete SearchSeriesResults_reflection_;
-  delete LabelsQuery::default_instance_;
-  delete LabelsQuery_reflection_;
-  delete SearchLabelsResults::default_instance_;
-  delete SearchLabelsResults_reflection_;
-}
-
-void protobuf_AddDesc_search_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::vqro::rpc::protobuf_AddDesc_core_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\014search.proto\022\010vqro.rpc\032\ncore.proto\"j\n\013"
-    "SeriesQuery\022.\n\013constraints\030\001 \003(\0132\031.vqro."
-    "rpc.LabelConstraint\022\025\n\rresult_offset\030\002 \001"
-    "(\003\022\024\n\014result_limit\030\003 \001(\003\"Z\n\017LabelConstra"
-    "int\022\022\n\nlabel_name\030\001 \001(\t\022\025\n\013exact_value\030\002"
-    " \001(\tH\000\022\017\n\005regex\030\003 \001(\tH\000B\013\n\tpredicate\"a\n\023"
-    "SearchSeriesResults\022!\n\007matches\030\001 \003(\0132\020.v"
-    "qro.rpc.Series\022\'\n\006status\030\002 \001(\0132\027.vqro.rp"
-    "c.StatusMessage\"I\n\013LabelsQuery\022\r\n\005regex\030"
-    "\001 \001(\t\022\025\n\rresult_offset\030\002 \001(\003\022\024\n\014result_l"
-    "imit\030\003 \001(\003\"N\n\023SearchLabelsResults\022\016\n\006lab"
-    "els\030\001 \003(\t\022\'\n\006status\030\002 \001(\0132\027.vqro.rpc.Sta"
-    "tusMessage2\237\001\n\rVaqueroSearch\022F\n\014SearchSe"
-    "ries\022\025.vqro.rpc.SeriesQuery\032\035.vqro.rpc.S"
-    "earchSeriesResults0\001\022F\n\014SearchLabels\022\025.v"
-    "qro.rpc.LabelsQuery\032\035.vqro.rpc.SearchLab"
-    "elsResults0\001B\003\370\001\001b\006proto3", 665);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "search.proto", &protobuf_RegisterTypes);
-  SeriesQuery::default_instance_ = new SeriesQuery();
-  LabelConstraint::default_instance_ = new LabelConstraint();
-  LabelConstraint_default_oneof_instance_ = new LabelConstraintOneofInstance();
-  SearchSeriesResults::default_instance_ = new SearchSeriesResults();
-  LabelsQuery::default_instance_ = new LabelsQuery();
-  SearchLabelsResults::default_instance_ = new SearchLabelsResults();
-  SeriesQuery::default_instance_->InitAsDefaultInstance();
-  LabelConstraint::default_instance_->InitAsDefaultInstance();
-  SearchSeriesResults::default_instance_->InitAsDefaultInstance();
-  LabelsQuery::default_instance_->InitAsDefaultInstance();
-  SearchLabelsResults::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_search_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_search_2eproto {
-  StaticDescriptorInitializer_search_2eproto() {
-    protobuf_AddDesc_search_2eproto();
-  }
-} static_descriptor_initializer_search_2eproto_;
-
-namespace {
-
-static void MergeFromFail(int line) GOOGLE_ATTRIBUTE_COLD;
-static void MergeFromFail(int line) {
-  GOOGLE_CHECK(false) << __FILE__ << ":" << line;
-}
-
-}  // namespace
-
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchLabelsResultsDefaultTypeInternal _SearchLabelsResults_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+static ::_pb::Metadata file_level_metadata_search_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_search_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_search_2eproto = nullptr;
+
+const uint32_t TableStruct_search_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesQuery, _impl_.constraints_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesQuery, _impl_.result_offset_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesQuery, _impl_.result_limit_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelConstraint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelConstraint, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelConstraint, _impl_.label_name_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelConstraint, _impl_.predicate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchSeriesResults, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchSeriesResults, _impl_.matches_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchSeriesResults, _impl_.status_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelsQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelsQuery, _impl_.regex_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelsQuery, _impl_.result_offset_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::LabelsQuery, _impl_.result_limit_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchLabelsResults, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchLabelsResults, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SearchLabelsResults, _impl_.status_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::vqro::rpc::SeriesQuery)},
+  { 9, -1, -1, sizeof(::vqro::rpc::LabelConstraint)},
+  { 19, -1, -1, sizeof(::vqro::rpc::SearchSeriesResults)},
+  { 27, -1, -1, sizeof(::vqro::rpc::LabelsQuery)},
+  { 36, -1, -1, sizeof(::vqro::rpc::SearchLabelsResults)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::vqro::rpc::_SeriesQuery_default_instance_._instance,
+  &::vqro::rpc::_LabelConstraint_default_instance_._instance,
+  &::vqro::rpc::_SearchSeriesResults_default_instance_._instance,
+  &::vqro::rpc::_LabelsQuery_default_instance_._instance,
+  &::vqro::rpc::_SearchLabelsResults_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_search_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014search.proto\022\010vqro.rpc\032\ncore.proto\"j\n\013"
+  "SeriesQuery\022.\n\013constraints\030\001 \003(\0132\031.vqro."
+  "rpc.LabelConstraint\022\025\n\rresult_offset\030\002 \001"
+  "(\003\022\024\n\014result_limit\030\003 \001(\003\"Z\n\017LabelConstra"
+  "int\022\022\n\nlabel_name\030\001 \001(\t\022\025\n\013exact_value\030\002"
+  " \001(\tH\000\022\017\n\005regex\030\003 \001(\tH\000B\013\n\tpredicate\"a\n\023"
+  "SearchSeriesResults\022!\n\007matches\030\001 \003(\0132\020.v"
+  "qro.rpc.Series\022\'\n\006status\030\002 \001(\0132\027.vqro.rp"
+  "c.StatusMessage\"I\n\013LabelsQuery\022\r\n\005regex\030"
+  "\001 \001(\t\022\025\n\rresult_offset\030\002 \001(\003\022\024\n\014result_l"
+  "imit\030\003 \001(\003\"N\n\023SearchLabelsResults\022\016\n\006lab"
+  "els\030\001 \003(\t\022\'\n\006status\030\002 \001(\0132\027.vqro.rpc.Sta"
+  "tusMessage2\237\001\n\rVaqueroSearch\022F\n\014SearchSe"
+  "ries\022\025.vqro.rpc.SeriesQuery\032\035.vqro.rpc.S"
+  "earchSeriesResults0\001\022F\n\014SearchLabels\022\025.v"
+  "qro.rpc.LabelsQuery\032\035.vqro.rpc.SearchLab"
+  "elsResults0\001B\003\370\001\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_search_2eproto_deps[1] = {
+  &::descriptor_table_core_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_search_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_search_2eproto = {
+    false, false, 665, descriptor_table_protodef_search_2eproto,
+    "search.proto",
+    &descriptor_table_search_2eproto_once, descriptor_table_search_2eproto_deps, 1, 5,
+    schemas, file_default_instances, TableStruct_search_2eproto::offsets,
+    file_level_metadata_search_2eproto, file_level_enum_descriptors_search_2eproto,
+    file_level_service_descriptors_search_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_search_2eproto_getter() {
+  return &descriptor_table_search_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_search_2eproto(&descriptor_table_search_2eproto);
+namespace vqro {
+namespace rpc {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SeriesQuery::kConstraintsFieldNumber;
-const int SeriesQuery::kResultOffsetFieldNumber;
-const int SeriesQuery::kResultLimitFieldNumber;
-#endif  // !_MSC_VER
+class SeriesQuery::_Internal {
+ public:
+};
 
-SeriesQuery::SeriesQuery()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.SeriesQuery)
-}
-
-SeriesQuery::SeriesQuery(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  constraints_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SeriesQuery::SeriesQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.SeriesQuery)
 }
-
-void SeriesQuery::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 SeriesQuery::SeriesQuery(const SeriesQuery& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SeriesQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraints_){from._impl_.constraints_}
+    , decltype(_impl_.result_offset_){}
+    , decltype(_impl_.result_limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.result_offset_, &from._impl_.result_offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.result_limit_) -
+    reinterpret_cast<char*>(&_impl_.result_offset_)) + sizeof(_impl_.result_limit_));
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.SeriesQuery)
 }
 
-void SeriesQuery::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  result_offset_ = GOOGLE_LONGLONG(0);
-  result_limit_ = GOOGLE_LONGLONG(0);
+inline void SeriesQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraints_){arena}
+    , decltype(_impl_.result_offset_){int64_t{0}}
+    , decltype(_impl_.result_limit_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SeriesQuery::~SeriesQuery() {
   // @@protoc_insertion_point(destructor:vqro.rpc.SeriesQuery)
-  SharedDtor();
-}
-
-void SeriesQuery::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-  }
-}
-
-void SeriesQuery::ArenaDtor(void* object) {
-  SeriesQuery* _this = reinterpret_cast< SeriesQuery* >(object);
-  (void)_this;
-}
-void SeriesQuery::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void SeriesQuery::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SeriesQuery::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SeriesQuery_descriptor_;
+  SharedDtor();
 }
 
-const SeriesQuery& SeriesQuery::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_search_2eproto();
-  return *default_instance_;
+inline void SeriesQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.constraints_.~RepeatedPtrField();
 }
 
-SeriesQuery* SeriesQuery::default_instance_ = NULL;
-
-SeriesQuery* SeriesQuery::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<SeriesQuery>(arena);
+void SeriesQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void SeriesQuery::Clear() {
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<SeriesQuery*>(16)->f)
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(result_offset_, result_limit_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  constraints_.Clear();
-}
-
-bool SeriesQuery::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.SeriesQuery)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SeriesQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.constraints_.Clear();
+  ::memset(&_impl_.result_offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.result_limit_) -
+      reinterpret_cast<char*>(&_impl_.result_offset_)) + sizeof(_impl_.result_limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SeriesQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .vqro.rpc.LabelConstraint constraints = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_constraints:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_constraints()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_constraints(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_constraints;
-        if (input->ExpectTag(16)) goto parse_result_offset;
-        break;
-      }
-
-      // optional int64 result_offset = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_result_offset:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &result_offset_)));
-
-        } else {
+        continue;
+      // int64 result_offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.result_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_result_limit;
-        break;
-      }
-
-      // optional int64 result_limit = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_result_limit:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &result_limit_)));
-
-        } else {
+        continue;
+      // int64 result_limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.result_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.SeriesQuery)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.SeriesQuery)
-  return false;
-#undef DO_
-}
-
-void SeriesQuery::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.SeriesQuery)
-  // repeated .vqro.rpc.LabelConstraint constraints = 1;
-  for (unsigned int i = 0, n = this->constraints_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->constraints(i), output);
-  }
-
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->result_offset(), output);
-  }
-
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->result_limit(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.SeriesQuery)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SeriesQuery::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SeriesQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SeriesQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated .vqro.rpc.LabelConstraint constraints = 1;
-  for (unsigned int i = 0, n = this->constraints_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->constraints(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_constraints_size()); i < n; i++) {
+    const auto& repfield = this->_internal_constraints(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->result_offset(), target);
+  // int64 result_offset = 2;
+  if (this->_internal_result_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_result_offset(), target);
   }
 
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->result_limit(), target);
+  // int64 result_limit = 3;
+  if (this->_internal_result_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_result_limit(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SeriesQuery)
   return target;
 }
 
-int SeriesQuery::ByteSize() const {
-  int total_size = 0;
+size_t SeriesQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SeriesQuery)
+  size_t total_size = 0;
 
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->result_offset());
-  }
-
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->result_limit());
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .vqro.rpc.LabelConstraint constraints = 1;
-  total_size += 1 * this->constraints_size();
-  for (int i = 0; i < this->constraints_size(); i++) {
+  total_size += 1UL * this->_internal_constraints_size();
+  for (const auto& msg : this->_impl_.constraints_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->constraints(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void SeriesQuery::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const SeriesQuery* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SeriesQuery*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // int64 result_offset = 2;
+  if (this->_internal_result_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_result_offset());
   }
-}
 
-void SeriesQuery::MergeFrom(const SeriesQuery& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  constraints_.MergeFrom(from.constraints_);
-  if (from.result_offset() != 0) {
-    set_result_offset(from.result_offset());
-  }
-  if (from.result_limit() != 0) {
-    set_result_limit(from.result_limit());
+  // int64 result_limit = 3;
+  if (this->_internal_result_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_result_limit());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SeriesQuery::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeriesQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SeriesQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeriesQuery::GetClassData() const { return &_class_data_; }
+
+
+void SeriesQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeriesQuery*>(&to_msg);
+  auto& from = static_cast<const SeriesQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SeriesQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.constraints_.MergeFrom(from._impl_.constraints_);
+  if (from._internal_result_offset() != 0) {
+    _this->_internal_set_result_offset(from._internal_result_offset());
+  }
+  if (from._internal_result_limit() != 0) {
+    _this->_internal_set_result_limit(from._internal_result_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SeriesQuery::CopyFrom(const SeriesQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SeriesQuery)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SeriesQuery::IsInitialized() const {
-
   return true;
 }
 
-void SeriesQuery::Swap(SeriesQuery* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    SeriesQuery temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void SeriesQuery::UnsafeArenaSwap(SeriesQuery* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void SeriesQuery::InternalSwap(SeriesQuery* other) {
-  constraints_.UnsafeArenaSwap(&other->constraints_);
-  std::swap(result_offset_, other->result_offset_);
-  std::swap(result_limit_, other->result_limit_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.constraints_.InternalSwap(&other->_impl_.constraints_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SeriesQuery, _impl_.result_limit_)
+      + sizeof(SeriesQuery::_impl_.result_limit_)
+      - PROTOBUF_FIELD_OFFSET(SeriesQuery, _impl_.result_offset_)>(
+          reinterpret_cast<char*>(&_impl_.result_offset_),
+          reinterpret_cast<char*>(&other->_impl_.result_offset_));
 }
 
-::google::protobuf::Metadata SeriesQuery::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SeriesQuery_descriptor_;
-  metadata.reflection = SeriesQuery_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SeriesQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_search_2eproto_getter, &descriptor_table_search_2eproto_once,
+      file_level_metadata_search_2eproto[0]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SeriesQuery
-
-// repeated .vqro.rpc.LabelConstraint constraints = 1;
- int SeriesQuery::constraints_size() const {
-  return constraints_.size();
-}
- void SeriesQuery::clear_constraints() {
-  constraints_.Clear();
-}
- const ::vqro::rpc::LabelConstraint& SeriesQuery::constraints(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Get(index);
-}
- ::vqro::rpc::LabelConstraint* SeriesQuery::mutable_constraints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Mutable(index);
-}
- ::vqro::rpc::LabelConstraint* SeriesQuery::add_constraints() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Add();
-}
- const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >&
-SeriesQuery::constraints() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesQuery.constraints)
-  return constraints_;
-}
- ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >*
-SeriesQuery::mutable_constraints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesQuery.constraints)
-  return &constraints_;
-}
-
-// optional int64 result_offset = 2;
- void SeriesQuery::clear_result_offset() {
-  result_offset_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 SeriesQuery::result_offset() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.result_offset)
-  return result_offset_;
-}
- void SeriesQuery::set_result_offset(::google::protobuf::int64 value) {
-  
-  result_offset_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesQuery.result_offset)
-}
-
-// optional int64 result_limit = 3;
- void SeriesQuery::clear_result_limit() {
-  result_limit_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 SeriesQuery::result_limit() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.result_limit)
-  return result_limit_;
-}
- void SeriesQuery::set_result_limit(::google::protobuf::int64 value) {
-  
-  result_limit_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesQuery.result_limit)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int LabelConstraint::kLabelNameFieldNumber;
-const int LabelConstraint::kExactValueFieldNumber;
-const int LabelConstraint::kRegexFieldNumber;
-#endif  // !_MSC_VER
-
-LabelConstraint::LabelConstraint()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.LabelConstraint)
-}
+class LabelConstraint::_Internal {
+ public:
+};
 
-LabelConstraint::LabelConstraint(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+LabelConstraint::LabelConstraint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.LabelConstraint)
 }
-
-void LabelConstraint::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  LabelConstraint_default_oneof_instance_->exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  LabelConstraint_default_oneof_instance_->regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-
 LabelConstraint::LabelConstraint(const LabelConstraint& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LabelConstraint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.label_name_){}
+    , decltype(_impl_.predicate_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_label_name().empty()) {
+    _this->_impl_.label_name_.Set(from._internal_label_name(), 
+      _this->GetArenaForAllocation());
+  }
+  clear_has_predicate();
+  switch (from.predicate_case()) {
+    case kExactValue: {
+      _this->_internal_set_exact_value(from._internal_exact_value());
+      break;
+    }
+    case kRegex: {
+      _this->_internal_set_regex(from._internal_regex());
+      break;
+    }
+    case PREDICATE_NOT_SET: {
+      break;
+    }
+  }
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.LabelConstraint)
 }
 
-void LabelConstraint::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  label_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LabelConstraint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.label_name_){}
+    , decltype(_impl_.predicate_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.label_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_predicate();
 }
 
 LabelConstraint::~LabelConstraint() {
   // @@protoc_insertion_point(destructor:vqro.rpc.LabelConstraint)
-  SharedDtor();
-}
-
-void LabelConstraint::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
+  SharedDtor();
+}
 
-  label_name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+inline void LabelConstraint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.label_name_.Destroy();
   if (has_predicate()) {
     clear_predicate();
   }
-  if (this != default_instance_) {
-  }
 }
 
-void LabelConstraint::ArenaDtor(void* object) {
-  LabelConstraint* _this = reinterpret_cast< LabelConstraint* >(object);
-  (void)_this;
-}
-void LabelConstraint::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
 void LabelConstraint::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* LabelConstraint::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return LabelConstraint_descriptor_;
-}
-
-const LabelConstraint& LabelConstraint::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_search_2eproto();
-  return *default_instance_;
-}
-
-LabelConstraint* LabelConstraint::default_instance_ = NULL;
-
-LabelConstraint* LabelConstraint::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<LabelConstraint>(arena);
+  _impl_._cached_size_.Set(size);
 }
 
 void LabelConstraint::clear_predicate() {
-  switch(predicate_case()) {
+// @@protoc_insertion_point(one_of_clear_start:vqro.rpc.LabelConstraint)
+  switch (predicate_case()) {
     case kExactValue: {
-      predicate_.exact_value_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-          GetArenaNoVirtual());
+      _impl_.predicate_.exact_value_.Destroy();
       break;
     }
     case kRegex: {
-      predicate_.regex_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-          GetArenaNoVirtual());
+      _impl_.predicate_.regex_.Destroy();
       break;
     }
     case PREDICATE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = PREDICATE_NOT_SET;
+  _impl_._oneof_case_[0] = PREDICATE_NOT_SET;
 }
 
 
 void LabelConstraint::Clear() {
-  label_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  clear_predicate();
-}
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.LabelConstraint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool LabelConstraint::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.LabelConstraint)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string label_name = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_label_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->label_name().data(), this->label_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.LabelConstraint.label_name");
-        } else {
+  _impl_.label_name_.ClearToEmpty();
+  clear_predicate();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LabelConstraint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string label_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_label_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.LabelConstraint.label_name"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_exact_value;
-        break;
-      }
-
-      // optional string exact_value = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_exact_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_exact_value()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->exact_value().data(), this->exact_value().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.LabelConstraint.exact_value");
-        } else {
+        continue;
+      // string exact_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_exact_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.LabelConstraint.exact_value"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_regex;
-        break;
-      }
-
-      // optional string regex = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_regex:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_regex()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->regex().data(), this->regex().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.LabelConstraint.regex");
-        } else {
+        continue;
+      // string regex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_regex();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.LabelConstraint.regex"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.LabelConstraint)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.LabelConstraint)
-  return false;
-#undef DO_
-}
-
-void LabelConstraint::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.LabelConstraint)
-  // optional string label_name = 1;
-  if (this->label_name().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->label_name().data(), this->label_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "vqro.rpc.LabelConstraint.label_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->label_name(), output);
-  }
-
-  // optional string exact_value = 2;
-  if (has_exact_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->exact_value().data(), this->exact_value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "vqro.rpc.LabelConstraint.exact_value");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->exact_value(), output);
-  }
-
-  // optional string regex = 3;
-  if (has_regex()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->regex().data(), this->regex().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "vqro.rpc.LabelConstraint.regex");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->regex(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.LabelConstraint)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* LabelConstraint::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* LabelConstraint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.LabelConstraint)
-  // optional string label_name = 1;
-  if (this->label_name().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->label_name().data(), this->label_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string label_name = 1;
+  if (!this->_internal_label_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_label_name().data(), static_cast<int>(this->_internal_label_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.LabelConstraint.label_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->label_name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_label_name(), target);
   }
 
-  // optional string exact_value = 2;
-  if (has_exact_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->exact_value().data(), this->exact_value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  // string exact_value = 2;
+  if (_internal_has_exact_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_exact_value().data(), static_cast<int>(this->_internal_exact_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.LabelConstraint.exact_value");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->exact_value(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_exact_value(), target);
   }
 
-  // optional string regex = 3;
-  if (has_regex()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->regex().data(), this->regex().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  // string regex = 3;
+  if (_internal_has_regex()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_regex().data(), static_cast<int>(this->_internal_regex().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.LabelConstraint.regex");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->regex(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_regex(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.LabelConstraint)
   return target;
 }
 
-int LabelConstraint::ByteSize() const {
-  int total_size = 0;
+size_t LabelConstraint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.LabelConstraint)
+  size_t total_size = 0;
 
-  // optional string label_name = 1;
-  if (this->label_name().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string label_name = 1;
+  if (!this->_internal_label_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->label_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_label_name());
   }
 
   switch (predicate_case()) {
-    // optional string exact_value = 2;
+    // string exact_value = 2;
     case kExactValue: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->exact_value());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_exact_value());
       break;
     }
-    // optional string regex = 3;
+    // string regex = 3;
     case kRegex: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->regex());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_regex());
       break;
     }
     case PREDICATE_NOT_SET: {
       break;
     }
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void LabelConstraint::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const LabelConstraint* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LabelConstraint*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LabelConstraint::MergeFrom(const LabelConstraint& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LabelConstraint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LabelConstraint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LabelConstraint::GetClassData() const { return &_class_data_; }
+
+
+void LabelConstraint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LabelConstraint*>(&to_msg);
+  auto& from = static_cast<const LabelConstraint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.LabelConstraint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_label_name().empty()) {
+    _this->_internal_set_label_name(from._internal_label_name());
+  }
   switch (from.predicate_case()) {
     case kExactValue: {
-      set_exact_value(from.exact_value());
+      _this->_internal_set_exact_value(from._internal_exact_value());
       break;
     }
     case kRegex: {
-      set_regex(from.regex());
+      _this->_internal_set_regex(from._internal_regex());
       break;
     }
     case PREDICATE_NOT_SET: {
       break;
     }
   }
-  if (from.label_name().size() > 0) {
-    set_label_name(from.label_name());
-  }
-}
-
-void LabelConstraint::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LabelConstraint::CopyFrom(const LabelConstraint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.LabelConstraint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool LabelConstraint::IsInitialized() const {
-
   return true;
 }
 
-void LabelConstraint::Swap(LabelConstraint* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    LabelConstraint temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void LabelConstraint::UnsafeArenaSwap(LabelConstraint* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void LabelConstraint::InternalSwap(LabelConstraint* other) {
-  label_name_.Swap(&other->label_name_);
-  std::swap(predicate_, other->predicate_);
-  std::swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata LabelConstraint::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LabelConstraint_descriptor_;
-  metadata.reflection = LabelConstraint_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LabelConstraint
-
-// optional string label_name = 1;
- void LabelConstraint::clear_label_name() {
-  label_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- const ::std::string& LabelConstraint::label_name() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.label_name)
-  return label_name_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void LabelConstraint::set_label_name(const ::std::string& value) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.label_name)
-}
- void LabelConstraint::set_label_name(const char* value) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.label_name)
-}
- void LabelConstraint::set_label_name(const char* value,
-    size_t size) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.label_name)
-}
- ::std::string* LabelConstraint::mutable_label_name() {
-  
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.label_name)
-  return label_name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* LabelConstraint::release_label_name() {
-  
-  return label_name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* LabelConstraint::unsafe_arena_release_label_name() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return label_name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-}
- void LabelConstraint::set_allocated_label_name(::std::string* label_name) {
-  if (label_name != NULL) {
-    
-  } else {
-    
-  }
-  label_name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), label_name,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.label_name)
-}
- void LabelConstraint::unsafe_arena_set_allocated_label_name(
-    ::std::string* label_name) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (label_name != NULL) {
-    
-  } else {
-    
-  }
-  
-  label_name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      label_name, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.label_name)
-}
-
-// optional string exact_value = 2;
- bool LabelConstraint::has_exact_value() const {
-  return predicate_case() == kExactValue;
-}
- void LabelConstraint::set_has_exact_value() {
-  _oneof_case_[0] = kExactValue;
-}
- void LabelConstraint::clear_exact_value() {
-  if (has_exact_value()) {
-    predicate_.exact_value_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-    clear_has_predicate();
-  }
-}
- const ::std::string& LabelConstraint::exact_value() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.exact_value)
-  if (has_exact_value()) {
-    return predicate_.exact_value_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
-}
- void LabelConstraint::set_exact_value(const ::std::string& value) {
-  if (!has_exact_value()) {
-    clear_predicate();
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.exact_value)
-}
- void LabelConstraint::set_exact_value(const char* value) {
-  if (!has_exact_value()) {
-    clear_predicate();
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.exact_value)
-}
- void LabelConstraint::set_exact_value(const char* value,
-                             size_t size) {
-  if (!has_exact_value()) {
-    clear_predicate();
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.exact_value)
-}
- ::std::string* LabelConstraint::mutable_exact_value() {
-  if (!has_exact_value()) {
-    clear_predicate();
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return predicate_.exact_value_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.exact_value)
-}
- ::std::string* LabelConstraint::release_exact_value() {
-  if (has_exact_value()) {
-    clear_has_predicate();
-    return predicate_.exact_value_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-  } else {
-    return NULL;
-  }
-}
- ::std::string* LabelConstraint::unsafe_arena_release_exact_value() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_exact_value()) {
-    clear_has_predicate();
-    return predicate_.exact_value_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  } else {
-    return NULL;
-  }
-}
- void LabelConstraint::set_allocated_exact_value(::std::string* exact_value) {
-  if (!has_exact_value()) {
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (exact_value != NULL) {
-    set_has_exact_value();
-    predicate_.exact_value_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exact_value,
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.exact_value)
-}
- void LabelConstraint::unsafe_arena_set_allocated_exact_value(::std::string* exact_value) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_exact_value()) {
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (exact_value) {
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exact_value, GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.exact_value)
-}
-
-// optional string regex = 3;
- bool LabelConstraint::has_regex() const {
-  return predicate_case() == kRegex;
-}
- void LabelConstraint::set_has_regex() {
-  _oneof_case_[0] = kRegex;
-}
- void LabelConstraint::clear_regex() {
-  if (has_regex()) {
-    predicate_.regex_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-    clear_has_predicate();
-  }
-}
- const ::std::string& LabelConstraint::regex() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.regex)
-  if (has_regex()) {
-    return predicate_.regex_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
-}
- void LabelConstraint::set_regex(const ::std::string& value) {
-  if (!has_regex()) {
-    clear_predicate();
-    set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.regex)
-}
- void LabelConstraint::set_regex(const char* value) {
-  if (!has_regex()) {
-    clear_predicate();
-    set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.regex)
-}
- void LabelConstraint::set_regex(const char* value,
-                             size_t size) {
-  if (!has_regex()) {
-    clear_predicate();
-    set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.regex)
-}
- ::std::string* LabelConstraint::mutable_regex() {
-  if (!has_regex()) {
-    clear_predicate();
-    set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return predicate_.regex_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.regex)
-}
- ::std::string* LabelConstraint::release_regex() {
-  if (has_regex()) {
-    clear_has_predicate();
-    return predicate_.regex_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-  } else {
-    return NULL;
-  }
-}
- ::std::string* LabelConstraint::unsafe_arena_release_regex() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_regex()) {
-    clear_has_predicate();
-    return predicate_.regex_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  } else {
-    return NULL;
-  }
-}
- void LabelConstraint::set_allocated_regex(::std::string* regex) {
-  if (!has_regex()) {
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (regex != NULL) {
-    set_has_regex();
-    predicate_.regex_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex,
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.regex)
-}
- void LabelConstraint::unsafe_arena_set_allocated_regex(::std::string* regex) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_regex()) {
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (regex) {
-    set_has_regex();
-    predicate_.regex_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex, GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.regex)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_name_, lhs_arena,
+      &other->_impl_.label_name_, rhs_arena
+  );
+  swap(_impl_.predicate_, other->_impl_.predicate_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
- bool LabelConstraint::has_predicate() const {
-  return predicate_case() != PREDICATE_NOT_SET;
-}
- void LabelConstraint::clear_has_predicate() {
-  _oneof_case_[0] = PREDICATE_NOT_SET;
-}
-LabelConstraint::PredicateCase LabelConstraint::predicate_case() const {
-  return LabelConstraint::PredicateCase(_oneof_case_[0]);
+::PROTOBUF_NAMESPACE_ID::Metadata LabelConstraint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_search_2eproto_getter, &descriptor_table_search_2eproto_once,
+      file_level_metadata_search_2eproto[1]);
 }
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-void SearchSeriesResults::_slow_mutable_status() {
-  status_ = ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-        GetArenaNoVirtual());
-}
-::vqro::rpc::StatusMessage* SearchSeriesResults::_slow_release_status() {
-  if (status_ == NULL) {
-    return NULL;
-  } else {
-    ::vqro::rpc::StatusMessage* temp = new ::vqro::rpc::StatusMessage;
-    temp->MergeFrom(*status_);
-    status_ = NULL;
-    return temp;
-  }
+class SearchSeriesResults::_Internal {
+ public:
+  static const ::vqro::rpc::StatusMessage& status(const SearchSeriesResults* msg);
+};
+
+const ::vqro::rpc::StatusMessage&
+SearchSeriesResults::_Internal::status(const SearchSeriesResults* msg) {
+  return *msg->_impl_.status_;
 }
-::vqro::rpc::StatusMessage* SearchSeriesResults::unsafe_arena_release_status() {
-  
-  ::vqro::rpc::StatusMessage* temp = status_;
-  status_ = NULL;
-  return temp;
-}
-void SearchSeriesResults::_slow_set_allocated_status(
-    ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status) {
-    if (message_arena != NULL && 
-        ::google::protobuf::Arena::GetArena(*status) == NULL) {
-      message_arena->Own(*status);
-    } else if (message_arena !=
-               ::google::protobuf::Arena::GetArena(*status)) {
-      ::vqro::rpc::StatusMessage* new_status = 
-            ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-            message_arena);
-      new_status->CopyFrom(**status);
-      *status = new_status;
-    }
+void SearchSeriesResults::clear_matches() {
+  _impl_.matches_.Clear();
 }
-void SearchSeriesResults::unsafe_arena_set_allocated_status(
-    ::vqro::rpc::StatusMessage* status) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete status_;
+void SearchSeriesResults::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
   }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.SearchSeriesResults.status)
-}
-#ifndef _MSC_VER
-const int SearchSeriesResults::kMatchesFieldNumber;
-const int SearchSeriesResults::kStatusFieldNumber;
-#endif  // !_MSC_VER
-
-SearchSeriesResults::SearchSeriesResults()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.SearchSeriesResults)
+  _impl_.status_ = nullptr;
 }
-
-SearchSeriesResults::SearchSeriesResults(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  matches_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SearchSeriesResults::SearchSeriesResults(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.SearchSeriesResults)
 }
-
-void SearchSeriesResults::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  status_ = const_cast< ::vqro::rpc::StatusMessage*>(&::vqro::rpc::StatusMessage::default_instance());
-}
-
 SearchSeriesResults::SearchSeriesResults(const SearchSeriesResults& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchSeriesResults* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.matches_){from._impl_.matches_}
+    , decltype(_impl_.status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_status()) {
+    _this->_impl_.status_ = new ::vqro::rpc::StatusMessage(*from._impl_.status_);
+  }
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.SearchSeriesResults)
 }
 
-void SearchSeriesResults::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  status_ = NULL;
+inline void SearchSeriesResults::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.matches_){arena}
+    , decltype(_impl_.status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SearchSeriesResults::~SearchSeriesResults() {
   // @@protoc_insertion_point(destructor:vqro.rpc.SearchSeriesResults)
-  SharedDtor();
-}
-
-void SearchSeriesResults::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-    delete status_;
-  }
+  SharedDtor();
 }
 
-void SearchSeriesResults::ArenaDtor(void* object) {
-  SearchSeriesResults* _this = reinterpret_cast< SearchSeriesResults* >(object);
-  (void)_this;
-}
-void SearchSeriesResults::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void SearchSeriesResults::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SearchSeriesResults::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SearchSeriesResults_descriptor_;
+inline void SearchSeriesResults::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.matches_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.status_;
 }
 
-const SearchSeriesResults& SearchSeriesResults::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_search_2eproto();
-  return *default_instance_;
+void SearchSeriesResults::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-SearchSeriesResults* SearchSeriesResults::default_instance_ = NULL;
+void SearchSeriesResults::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SearchSeriesResults)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-SearchSeriesResults* SearchSeriesResults::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<SearchSeriesResults>(arena);
+  _impl_.matches_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SearchSeriesResults::Clear() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
-  matches_.Clear();
-}
-
-bool SearchSeriesResults::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.SearchSeriesResults)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SearchSeriesResults::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .vqro.rpc.Series matches = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_matches:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_matches()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_matches(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_matches;
-        if (input->ExpectTag(18)) goto parse_status;
-        break;
-      }
-
-      // optional .vqro.rpc.StatusMessage status = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_status:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_status()));
-        } else {
+        continue;
+      // .vqro.rpc.StatusMessage status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_status(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.SearchSeriesResults)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.SearchSeriesResults)
-  return false;
-#undef DO_
-}
-
-void SearchSeriesResults::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.SearchSeriesResults)
-  // repeated .vqro.rpc.Series matches = 1;
-  for (unsigned int i = 0, n = this->matches_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->matches(i), output);
-  }
-
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->status_, output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.SearchSeriesResults)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SearchSeriesResults::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SearchSeriesResults::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SearchSeriesResults)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated .vqro.rpc.Series matches = 1;
-  for (unsigned int i = 0, n = this->matches_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->matches(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_matches_size()); i < n; i++) {
+    const auto& repfield = this->_internal_matches(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, *this->status_, target);
+  // .vqro.rpc.StatusMessage status = 2;
+  if (this->_internal_has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::status(this),
+        _Internal::status(this).GetCachedSize(), target, stream);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SearchSeriesResults)
   return target;
 }
 
-int SearchSeriesResults::ByteSize() const {
-  int total_size = 0;
+size_t SearchSeriesResults::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SearchSeriesResults)
+  size_t total_size = 0;
 
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->status_);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .vqro.rpc.Series matches = 1;
-  total_size += 1 * this->matches_size();
-  for (int i = 0; i < this->matches_size(); i++) {
+  total_size += 1UL * this->_internal_matches_size();
+  for (const auto& msg : this->_impl_.matches_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->matches(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void SearchSeriesResults::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const SearchSeriesResults* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SearchSeriesResults*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // .vqro.rpc.StatusMessage status = 2;
+  if (this->_internal_has_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.status_);
   }
-}
 
-void SearchSeriesResults::MergeFrom(const SearchSeriesResults& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  matches_.MergeFrom(from.matches_);
-  if (from.has_status()) {
-    mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(from.status());
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SearchSeriesResults::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchSeriesResults::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchSeriesResults::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchSeriesResults::GetClassData() const { return &_class_data_; }
+
+
+void SearchSeriesResults::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchSeriesResults*>(&to_msg);
+  auto& from = static_cast<const SearchSeriesResults&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SearchSeriesResults)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.matches_.MergeFrom(from._impl_.matches_);
+  if (from._internal_has_status()) {
+    _this->_internal_mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(
+        from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SearchSeriesResults::CopyFrom(const SearchSeriesResults& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SearchSeriesResults)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SearchSeriesResults::IsInitialized() const {
-
   return true;
 }
 
-void SearchSeriesResults::Swap(SearchSeriesResults* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    SearchSeriesResults temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void SearchSeriesResults::UnsafeArenaSwap(SearchSeriesResults* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void SearchSeriesResults::InternalSwap(SearchSeriesResults* other) {
-  matches_.UnsafeArenaSwap(&other->matches_);
-  std::swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata SearchSeriesResults::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SearchSeriesResults_descriptor_;
-  metadata.reflection = SearchSeriesResults_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SearchSeriesResults
-
-// repeated .vqro.rpc.Series matches = 1;
- int SearchSeriesResults::matches_size() const {
-  return matches_.size();
-}
- void SearchSeriesResults::clear_matches() {
-  matches_.Clear();
-}
- const ::vqro::rpc::Series& SearchSeriesResults::matches(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Get(index);
-}
- ::vqro::rpc::Series* SearchSeriesResults::mutable_matches(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Mutable(index);
-}
- ::vqro::rpc::Series* SearchSeriesResults::add_matches() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Add();
-}
- const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
-SearchSeriesResults::matches() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.SearchSeriesResults.matches)
-  return matches_;
-}
- ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-SearchSeriesResults::mutable_matches() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SearchSeriesResults.matches)
-  return &matches_;
-}
-
-// optional .vqro.rpc.StatusMessage status = 2;
- bool SearchSeriesResults::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
-}
- void SearchSeriesResults::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
-}
- const ::vqro::rpc::StatusMessage& SearchSeriesResults::status() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SearchSeriesResults.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
-}
- ::vqro::rpc::StatusMessage* SearchSeriesResults::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.status)
-  return status_;
-}
- ::vqro::rpc::StatusMessage* SearchSeriesResults::release_status() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
-  }
-}
- void SearchSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
-  }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
-  }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.SearchSeriesResults.status)
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.matches_.InternalSwap(&other->_impl_.matches_);
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+::PROTOBUF_NAMESPACE_ID::Metadata SearchSeriesResults::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_search_2eproto_getter, &descriptor_table_search_2eproto_once,
+      file_level_metadata_search_2eproto[2]);
+}
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int LabelsQuery::kRegexFieldNumber;
-const int LabelsQuery::kResultOffsetFieldNumber;
-const int LabelsQuery::kResultLimitFieldNumber;
-#endif  // !_MSC_VER
-
-LabelsQuery::LabelsQuery()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.LabelsQuery)
-}
+class LabelsQuery::_Internal {
+ public:
+};
 
-LabelsQuery::LabelsQuery(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+LabelsQuery::LabelsQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.LabelsQuery)
 }
-
-void LabelsQuery::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 LabelsQuery::LabelsQuery(const LabelsQuery& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LabelsQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.regex_){}
+    , decltype(_impl_.result_offset_){}
+    , decltype(_impl_.result_limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.regex_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.regex_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_regex().empty()) {
+    _this->_impl_.regex_.Set(from._internal_regex(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.result_offset_, &from._impl_.result_offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.result_limit_) -
+    reinterpret_cast<char*>(&_impl_.result_offset_)) + sizeof(_impl_.result_limit_));
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.LabelsQuery)
 }
 
-void LabelsQuery::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  result_offset_ = GOOGLE_LONGLONG(0);
-  result_limit_ = GOOGLE_LONGLONG(0);
+inline void LabelsQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.regex_){}
+    , decltype(_impl_.result_offset_){int64_t{0}}
+    , decltype(_impl_.result_limit_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.regex_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.regex_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LabelsQuery::~LabelsQuery() {
   // @@protoc_insertion_point(destructor:vqro.rpc.LabelsQuery)
-  SharedDtor();
-}
-
-void LabelsQuery::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  regex_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  if (this != default_instance_) {
-  }
-}
-
-void LabelsQuery::ArenaDtor(void* object) {
-  LabelsQuery* _this = reinterpret_cast< LabelsQuery* >(object);
-  (void)_this;
-}
-void LabelsQuery::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void LabelsQuery::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* LabelsQuery::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return LabelsQuery_descriptor_;
+  SharedDtor();
 }
 
-const LabelsQuery& LabelsQuery::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_search_2eproto();
-  return *default_instance_;
+inline void LabelsQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.regex_.Destroy();
 }
 
-LabelsQuery* LabelsQuery::default_instance_ = NULL;
-
-LabelsQuery* LabelsQuery::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<LabelsQuery>(arena);
+void LabelsQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void LabelsQuery::Clear() {
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<LabelsQuery*>(16)->f)
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(result_offset_, result_limit_);
-  regex_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-
-#undef ZR_HELPER_
-#undef ZR_
-
-}
-
-bool LabelsQuery::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.LabelsQuery)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string regex = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_regex()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->regex().data(), this->regex().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.LabelsQuery.regex");
-        } else {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.LabelsQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.regex_.ClearToEmpty();
+  ::memset(&_impl_.result_offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.result_limit_) -
+      reinterpret_cast<char*>(&_impl_.result_offset_)) + sizeof(_impl_.result_limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LabelsQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string regex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_regex();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.LabelsQuery.regex"));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_result_offset;
-        break;
-      }
-
-      // optional int64 result_offset = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_result_offset:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &result_offset_)));
-
-        } else {
+        continue;
+      // int64 result_offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.result_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_result_limit;
-        break;
-      }
-
-      // optional int64 result_limit = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_result_limit:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &result_limit_)));
-
-        } else {
+        continue;
+      // int64 result_limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.result_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.LabelsQuery)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.LabelsQuery)
-  return false;
-#undef DO_
-}
-
-void LabelsQuery::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.LabelsQuery)
-  // optional string regex = 1;
-  if (this->regex().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->regex().data(), this->regex().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "vqro.rpc.LabelsQuery.regex");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->regex(), output);
-  }
-
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->result_offset(), output);
-  }
-
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->result_limit(), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.LabelsQuery)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* LabelsQuery::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* LabelsQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.LabelsQuery)
-  // optional string regex = 1;
-  if (this->regex().size() > 0) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->regex().data(), this->regex().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string regex = 1;
+  if (!this->_internal_regex().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_regex().data(), static_cast<int>(this->_internal_regex().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.LabelsQuery.regex");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->regex(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_regex(), target);
   }
 
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->result_offset(), target);
+  // int64 result_offset = 2;
+  if (this->_internal_result_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_result_offset(), target);
   }
 
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->result_limit(), target);
+  // int64 result_limit = 3;
+  if (this->_internal_result_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_result_limit(), target);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.LabelsQuery)
   return target;
 }
 
-int LabelsQuery::ByteSize() const {
-  int total_size = 0;
+size_t LabelsQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.LabelsQuery)
+  size_t total_size = 0;
 
-  // optional string regex = 1;
-  if (this->regex().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->regex());
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int64 result_offset = 2;
-  if (this->result_offset() != 0) {
+  // string regex = 1;
+  if (!this->_internal_regex().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->result_offset());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_regex());
   }
 
-  // optional int64 result_limit = 3;
-  if (this->result_limit() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->result_limit());
+  // int64 result_offset = 2;
+  if (this->_internal_result_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_result_offset());
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void LabelsQuery::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const LabelsQuery* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LabelsQuery*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // int64 result_limit = 3;
+  if (this->_internal_result_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_result_limit());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LabelsQuery::MergeFrom(const LabelsQuery& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  if (from.regex().size() > 0) {
-    set_regex(from.regex());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LabelsQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LabelsQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LabelsQuery::GetClassData() const { return &_class_data_; }
+
+
+void LabelsQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LabelsQuery*>(&to_msg);
+  auto& from = static_cast<const LabelsQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.LabelsQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_regex().empty()) {
+    _this->_internal_set_regex(from._internal_regex());
   }
-  if (from.result_offset() != 0) {
-    set_result_offset(from.result_offset());
+  if (from._internal_result_offset() != 0) {
+    _this->_internal_set_result_offset(from._internal_result_offset());
   }
-  if (from.result_limit() != 0) {
-    set_result_limit(from.result_limit());
+  if (from._internal_result_limit() != 0) {
+    _this->_internal_set_result_limit(from._internal_result_limit());
   }
-}
-
-void LabelsQuery::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LabelsQuery::CopyFrom(const LabelsQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.LabelsQuery)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool LabelsQuery::IsInitialized() const {
-
   return true;
 }
 
-void LabelsQuery::Swap(LabelsQuery* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    LabelsQuery temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void LabelsQuery::UnsafeArenaSwap(LabelsQuery* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void LabelsQuery::InternalSwap(LabelsQuery* other) {
-  regex_.Swap(&other->regex_);
-  std::swap(result_offset_, other->result_offset_);
-  std::swap(result_limit_, other->result_limit_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata LabelsQuery::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LabelsQuery_descriptor_;
-  metadata.reflection = LabelsQuery_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LabelsQuery
-
-// optional string regex = 1;
- void LabelsQuery::clear_regex() {
-  regex_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- const ::std::string& LabelsQuery::regex() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.regex)
-  return regex_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void LabelsQuery::set_regex(const ::std::string& value) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.regex)
-}
- void LabelsQuery::set_regex(const char* value) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelsQuery.regex)
-}
- void LabelsQuery::set_regex(const char* value,
-    size_t size) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelsQuery.regex)
-}
- ::std::string* LabelsQuery::mutable_regex() {
-  
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelsQuery.regex)
-  return regex_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* LabelsQuery::release_regex() {
-  
-  return regex_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-}
- ::std::string* LabelsQuery::unsafe_arena_release_regex() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return regex_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-}
- void LabelsQuery::set_allocated_regex(::std::string* regex) {
-  if (regex != NULL) {
-    
-  } else {
-    
-  }
-  regex_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelsQuery.regex)
-}
- void LabelsQuery::unsafe_arena_set_allocated_regex(
-    ::std::string* regex) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (regex != NULL) {
-    
-  } else {
-    
-  }
-  
-  regex_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      regex, GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelsQuery.regex)
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.regex_, lhs_arena,
+      &other->_impl_.regex_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LabelsQuery, _impl_.result_limit_)
+      + sizeof(LabelsQuery::_impl_.result_limit_)
+      - PROTOBUF_FIELD_OFFSET(LabelsQuery, _impl_.result_offset_)>(
+          reinterpret_cast<char*>(&_impl_.result_offset_),
+          reinterpret_cast<char*>(&other->_impl_.result_offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LabelsQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_search_2eproto_getter, &descriptor_table_search_2eproto_once,
+      file_level_metadata_search_2eproto[3]);
 }
 
-// optional int64 result_offset = 2;
- void LabelsQuery::clear_result_offset() {
-  result_offset_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 LabelsQuery::result_offset() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.result_offset)
-  return result_offset_;
-}
- void LabelsQuery::set_result_offset(::google::protobuf::int64 value) {
-  
-  result_offset_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.result_offset)
-}
-
-// optional int64 result_limit = 3;
- void LabelsQuery::clear_result_limit() {
-  result_limit_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 LabelsQuery::result_limit() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.result_limit)
-  return result_limit_;
-}
- void LabelsQuery::set_result_limit(::google::protobuf::int64 value) {
-  
-  result_limit_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.result_limit)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-void SearchLabelsResults::_slow_mutable_status() {
-  status_ = ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-        GetArenaNoVirtual());
-}
-::vqro::rpc::StatusMessage* SearchLabelsResults::_slow_release_status() {
-  if (status_ == NULL) {
-    return NULL;
-  } else {
-    ::vqro::rpc::StatusMessage* temp = new ::vqro::rpc::StatusMessage;
-    temp->MergeFrom(*status_);
-    status_ = NULL;
-    return temp;
-  }
-}
-::vqro::rpc::StatusMessage* SearchLabelsResults::unsafe_arena_release_status() {
-  
-  ::vqro::rpc::StatusMessage* temp = status_;
-  status_ = NULL;
-  return temp;
-}
-void SearchLabelsResults::_slow_set_allocated_status(
-    ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status) {
-    if (message_arena != NULL && 
-        ::google::protobuf::Arena::GetArena(*status) == NULL) {
-      message_arena->Own(*status);
-    } else if (message_arena !=
-               ::google::protobuf::Arena::GetArena(*status)) {
-      ::vqro::rpc::StatusMessage* new_status = 
-            ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-            message_arena);
-      new_status->CopyFrom(**status);
-      *status = new_status;
-    }
+class SearchLabelsResults::_Internal {
+ public:
+  static const ::vqro::rpc::StatusMessage& status(const SearchLabelsResults* msg);
+};
+
+const ::vqro::rpc::StatusMessage&
+SearchLabelsResults::_Internal::status(const SearchLabelsResults* msg) {
+  return *msg->_impl_.status_;
 }
-void SearchLabelsResults::unsafe_arena_set_allocated_status(
-    ::vqro::rpc::StatusMessage* status) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete status_;
-  }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
+void SearchLabelsResults::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.SearchLabelsResults.status)
+  _impl_.status_ = nullptr;
 }
-#ifndef _MSC_VER
-const int SearchLabelsResults::kLabelsFieldNumber;
-const int SearchLabelsResults::kStatusFieldNumber;
-#endif  // !_MSC_VER
-
-SearchLabelsResults::SearchLabelsResults()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.SearchLabelsResults)
-}
-
-SearchLabelsResults::SearchLabelsResults(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  labels_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SearchLabelsResults::SearchLabelsResults(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.SearchLabelsResults)
 }
-
-void SearchLabelsResults::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  status_ = const_cast< ::vqro::rpc::StatusMessage*>(&::vqro::rpc::StatusMessage::default_instance());
-}
-
 SearchLabelsResults::SearchLabelsResults(const SearchLabelsResults& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchLabelsResults* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.labels_){from._impl_.labels_}
+    , decltype(_impl_.status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_status()) {
+    _this->_impl_.status_ = new ::vqro::rpc::StatusMessage(*from._impl_.status_);
+  }
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.SearchLabelsResults)
 }
 
-void SearchLabelsResults::SharedCtor() {
-    _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  status_ = NULL;
+inline void SearchLabelsResults::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.labels_){arena}
+    , decltype(_impl_.status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SearchLabelsResults::~SearchLabelsResults() {
   // @@protoc_insertion_point(destructor:vqro.rpc.SearchLabelsResults)
-  SharedDtor();
-}
-
-void SearchLabelsResults::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-    delete status_;
-  }
+  SharedDtor();
 }
 
-void SearchLabelsResults::ArenaDtor(void* object) {
-  SearchLabelsResults* _this = reinterpret_cast< SearchLabelsResults* >(object);
-  (void)_this;
-}
-void SearchLabelsResults::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void SearchLabelsResults::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SearchLabelsResults::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SearchLabelsResults_descriptor_;
+inline void SearchLabelsResults::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.labels_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.status_;
 }
 
-const SearchLabelsResults& SearchLabelsResults::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_search_2eproto();
-  return *default_instance_;
+void SearchLabelsResults::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-SearchLabelsResults* SearchLabelsResults::default_instance_ = NULL;
+void SearchLabelsResults::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SearchLabelsResults)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-SearchLabelsResults* SearchLabelsResults::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<SearchLabelsResults>(arena);
+  _impl_.labels_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SearchLabelsResults::Clear() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
-  labels_.Clear();
-}
-
-bool SearchLabelsResults::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.SearchLabelsResults)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SearchLabelsResults::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated string labels = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_labels:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_labels()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->labels(this->labels_size() - 1).data(),
-            this->labels(this->labels_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "vqro.rpc.SearchLabelsResults.labels");
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_labels();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "vqro.rpc.SearchLabelsResults.labels"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_labels;
-        if (input->ExpectTag(18)) goto parse_status;
-        break;
-      }
-
-      // optional .vqro.rpc.StatusMessage status = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_status:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_status()));
-        } else {
+        continue;
+      // .vqro.rpc.StatusMessage status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_status(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.SearchLabelsResults)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.SearchLabelsResults)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SearchLabelsResults::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.SearchLabelsResults)
-  // repeated string labels = 1;
-  for (int i = 0; i < this->labels_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-    this->labels(i).data(), this->labels(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE,
-    "vqro.rpc.SearchLabelsResults.labels");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->labels(i), output);
-  }
-
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->status_, output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.SearchLabelsResults)
-}
-
-::google::protobuf::uint8* SearchLabelsResults::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SearchLabelsResults::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SearchLabelsResults)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated string labels = 1;
-  for (int i = 0; i < this->labels_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->labels(i).data(), this->labels(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
+  for (int i = 0, n = this->_internal_labels_size(); i < n; i++) {
+    const auto& s = this->_internal_labels(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "vqro.rpc.SearchLabelsResults.labels");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->labels(i), target);
+    target = stream->WriteString(1, s, target);
   }
 
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, *this->status_, target);
+  // .vqro.rpc.StatusMessage status = 2;
+  if (this->_internal_has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::status(this),
+        _Internal::status(this).GetCachedSize(), target, stream);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SearchLabelsResults)
   return target;
 }
 
-int SearchLabelsResults::ByteSize() const {
-  int total_size = 0;
+size_t SearchLabelsResults::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SearchLabelsResults)
+  size_t total_size = 0;
 
-  // optional .vqro.rpc.StatusMessage status = 2;
-  if (this->has_status()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->status_);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated string labels = 1;
-  total_size += 1 * this->labels_size();
-  for (int i = 0; i < this->labels_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->labels(i));
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.labels_.size());
+  for (int i = 0, n = _impl_.labels_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.labels_.Get(i));
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void SearchLabelsResults::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const SearchLabelsResults* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SearchLabelsResults*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // .vqro.rpc.StatusMessage status = 2;
+  if (this->_internal_has_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.status_);
   }
-}
 
-void SearchLabelsResults::MergeFrom(const SearchLabelsResults& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  labels_.MergeFrom(from.labels_);
-  if (from.has_status()) {
-    mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(from.status());
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SearchLabelsResults::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchLabelsResults::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchLabelsResults::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchLabelsResults::GetClassData() const { return &_class_data_; }
+
+
+void SearchLabelsResults::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchLabelsResults*>(&to_msg);
+  auto& from = static_cast<const SearchLabelsResults&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SearchLabelsResults)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  if (from._internal_has_status()) {
+    _this->_internal_mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(
+        from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SearchLabelsResults::CopyFrom(const SearchLabelsResults& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SearchLabelsResults)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SearchLabelsResults::IsInitialized() const {
-
   return true;
 }
 
-void SearchLabelsResults::Swap(SearchLabelsResults* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    SearchLabelsResults temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void SearchLabelsResults::UnsafeArenaSwap(SearchLabelsResults* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void SearchLabelsResults::InternalSwap(SearchLabelsResults* other) {
-  labels_.UnsafeArenaSwap(&other->labels_);
-  std::swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata SearchLabelsResults::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SearchLabelsResults_descriptor_;
-  metadata.reflection = SearchLabelsResults_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SearchLabelsResults
-
-// repeated string labels = 1;
- int SearchLabelsResults::labels_size() const {
-  return labels_.size();
-}
- void SearchLabelsResults::clear_labels() {
-  labels_.Clear();
-}
- const ::std::string& SearchLabelsResults::labels(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SearchLabelsResults.labels)
-  return labels_.Get(index);
-}
- ::std::string* SearchLabelsResults::mutable_labels(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchLabelsResults.labels)
-  return labels_.Mutable(index);
-}
- void SearchLabelsResults::set_labels(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:vqro.rpc.SearchLabelsResults.labels)
-  labels_.Mutable(index)->assign(value);
-}
- void SearchLabelsResults::set_labels(int index, const char* value) {
-  labels_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.SearchLabelsResults.labels)
-}
- void SearchLabelsResults::set_labels(int index, const char* value, size_t size) {
-  labels_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.SearchLabelsResults.labels)
-}
- ::std::string* SearchLabelsResults::add_labels() {
-  return labels_.Add();
-}
- void SearchLabelsResults::add_labels(const ::std::string& value) {
-  labels_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:vqro.rpc.SearchLabelsResults.labels)
-}
- void SearchLabelsResults::add_labels(const char* value) {
-  labels_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:vqro.rpc.SearchLabelsResults.labels)
-}
- void SearchLabelsResults::add_labels(const char* value, size_t size) {
-  labels_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:vqro.rpc.SearchLabelsResults.labels)
-}
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-SearchLabelsResults::labels() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.SearchLabelsResults.labels)
-  return labels_;
-}
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-SearchLabelsResults::mutable_labels() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SearchLabelsResults.labels)
-  return &labels_;
-}
-
-// optional .vqro.rpc.StatusMessage status = 2;
- bool SearchLabelsResults::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
-}
- void SearchLabelsResults::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
-}
- const ::vqro::rpc::StatusMessage& SearchLabelsResults::status() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SearchLabelsResults.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
-}
- ::vqro::rpc::StatusMessage* SearchLabelsResults::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchLabelsResults.status)
-  return status_;
-}
- ::vqro::rpc::StatusMessage* SearchLabelsResults::release_status() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
-  }
-}
- void SearchLabelsResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
-  }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
-  }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.SearchLabelsResults.status)
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+::PROTOBUF_NAMESPACE_ID::Metadata SearchLabelsResults::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_search_2eproto_getter, &descriptor_table_search_2eproto_once,
+      file_level_metadata_search_2eproto[4]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace rpc
 }  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SeriesQuery*
+Arena::CreateMaybeMessage< ::vqro::rpc::SeriesQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SeriesQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::vqro::rpc::LabelConstraint*
+Arena::CreateMaybeMessage< ::vqro::rpc::LabelConstraint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::LabelConstraint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SearchSeriesResults*
+Arena::CreateMaybeMessage< ::vqro::rpc::SearchSeriesResults >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SearchSeriesResults >(arena);
+}
+template<> PROTOBUF_NOINLINE ::vqro::rpc::LabelsQuery*
+Arena::CreateMaybeMessage< ::vqro::rpc::LabelsQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::LabelsQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SearchLabelsResults*
+Arena::CreateMaybeMessage< ::vqro::rpc::SearchLabelsResults >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SearchLabelsResults >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,725 +1,1093 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: search.proto
 
-#ifndef PROTOBUF_search_2eproto__INCLUDED
-#define PROTOBUF_search_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_search_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_search_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 #include "core.pb.h"
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_search_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_search_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_search_2eproto;
 namespace vqro {
 namespace rpc {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_search_2eproto();
-void protobuf_AssignDesc_search_2eproto();
-void protobuf_ShutdownFile_search_2eproto();
-
-class SeriesQuery;
 class LabelConstraint;
-class SearchSeriesResults;
+struct LabelConstraintDefaultTypeInternal;
+extern LabelConstraintDefaultTypeInternal _LabelConstraint_default_instance_;
 class LabelsQuery;
+struct LabelsQueryDefaultTypeInternal;
+extern LabelsQueryDefaultTypeInternal _LabelsQuery_default_instance_;
 class SearchLabelsResults;
+struct SearchLabelsResultsDefaultTypeInternal;
+extern SearchLabelsResultsDefaultTypeInternal _SearchLabelsResults_default_instance_;
+class SearchSeriesResults;
+struct SearchSeriesResultsDefaultTypeInternal;
+extern SearchSeriesResultsDefaultTypeInternal _SearchSeriesResults_default_instance_;
+class SeriesQuery;
+struct SeriesQueryDefaultTypeInternal;
+extern SeriesQueryDefaultTypeInternal _SeriesQuery_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> ::vqro::rpc::LabelConstraint* Arena::CreateMaybeMessage<::vqro::rpc::LabelConstraint>(Arena*);
+template<> ::vqro::rpc::LabelsQuery* Arena::CreateMaybeMessage<::vqro::rpc::LabelsQuery>(Arena*);
+template<> ::vqro::rpc::SearchLabelsResults* Arena::CreateMaybeMessage<::vqro::rpc::SearchLabelsResults>(Arena*);
+template<> ::vqro::rpc::SearchSeriesResults* Arena::CreateMaybeMessage<::vqro::rpc::SearchSeriesResults>(Arena*);
+template<> ::vqro::rpc::SeriesQuery* Arena::CreateMaybeMessage<::vqro::rpc::SeriesQuery>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace vqro {
+namespace rpc {
 
 // ===================================================================
 
-class SeriesQuery : public ::google::protobuf::Message {
+class SeriesQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SeriesQuery) */ {
  public:
-  SeriesQuery();
-  virtual ~SeriesQuery();
+  inline SeriesQuery() : SeriesQuery(nullptr) {}
+  ~SeriesQuery() override;
+  explicit PROTOBUF_CONSTEXPR SeriesQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SeriesQuery(const SeriesQuery& from);
+  SeriesQuery(SeriesQuery&& from) noexcept
+    : SeriesQuery() {
+    *this = ::std::move(from);
+  }
 
   inline SeriesQuery& operator=(const SeriesQuery& from) {
     CopyFrom(from);
     return *this;
   }
+  inline SeriesQuery& operator=(SeriesQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SeriesQuery& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeriesQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SeriesQuery* internal_default_instance() {
+    return reinterpret_cast<const SeriesQuery*>(
+               &_SeriesQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void UnsafeArenaSwap(SeriesQuery* other);
-  void Swap(SeriesQuery* other);
+  friend void swap(SeriesQuery& a, SeriesQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeriesQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeriesQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SeriesQuery* New() const { return New(NULL); }
-
-  SeriesQuery* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SeriesQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeriesQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SeriesQuery& from);
-  void MergeFrom(const SeriesQuery& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeriesQuery& from) {
+    SeriesQuery::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SeriesQuery* other);
-  protected:
-  explicit SeriesQuery(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SeriesQuery";
   }
+  protected:
+  explicit SeriesQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kConstraintsFieldNumber = 1,
+    kResultOffsetFieldNumber = 2,
+    kResultLimitFieldNumber = 3,
+  };
   // repeated .vqro.rpc.LabelConstraint constraints = 1;
   int constraints_size() const;
+  private:
+  int _internal_constraints_size() const;
+  public:
   void clear_constraints();
-  static const int kConstraintsFieldNumber = 1;
-  const ::vqro::rpc::LabelConstraint& constraints(int index) const;
   ::vqro::rpc::LabelConstraint* mutable_constraints(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::LabelConstraint >*
+      mutable_constraints();
+  private:
+  const ::vqro::rpc::LabelConstraint& _internal_constraints(int index) const;
+  ::vqro::rpc::LabelConstraint* _internal_add_constraints();
+  public:
+  const ::vqro::rpc::LabelConstraint& constraints(int index) const;
   ::vqro::rpc::LabelConstraint* add_constraints();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::LabelConstraint >&
       constraints() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >*
-      mutable_constraints();
 
-  // optional int64 result_offset = 2;
+  // int64 result_offset = 2;
   void clear_result_offset();
-  static const int kResultOffsetFieldNumber = 2;
-  ::google::protobuf::int64 result_offset() const;
-  void set_result_offset(::google::protobuf::int64 value);
+  int64_t result_offset() const;
+  void set_result_offset(int64_t value);
+  private:
+  int64_t _internal_result_offset() const;
+  void _internal_set_result_offset(int64_t value);
+  public:
 
-  // optional int64 result_limit = 3;
+  // int64 result_limit = 3;
   void clear_result_limit();
-  static const int kResultLimitFieldNumber = 3;
-  ::google::protobuf::int64 result_limit() const;
-  void set_result_limit(::google::protobuf::int64 value);
+  int64_t result_limit() const;
+  void set_result_limit(int64_t value);
+  private:
+  int64_t _internal_result_limit() const;
+  void _internal_set_result_limit(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.SeriesQuery)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint > constraints_;
-  ::google::protobuf::int64 result_offset_;
-  ::google::protobuf::int64 result_limit_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_search_2eproto();
-  friend void protobuf_AssignDesc_search_2eproto();
-  friend void protobuf_ShutdownFile_search_2eproto();
-
-  void InitAsDefaultInstance();
-  static SeriesQuery* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::LabelConstraint > constraints_;
+    int64_t result_offset_;
+    int64_t result_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_search_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LabelConstraint : public ::google::protobuf::Message {
+class LabelConstraint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.LabelConstraint) */ {
  public:
-  LabelConstraint();
-  virtual ~LabelConstraint();
+  inline LabelConstraint() : LabelConstraint(nullptr) {}
+  ~LabelConstraint() override;
+  explicit PROTOBUF_CONSTEXPR LabelConstraint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LabelConstraint(const LabelConstraint& from);
+  LabelConstraint(LabelConstraint&& from) noexcept
+    : LabelConstraint() {
+    *this = ::std::move(from);
+  }
 
   inline LabelConstraint& operator=(const LabelConstraint& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  inline LabelConstraint& operator=(LabelConstraint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LabelConstraint& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LabelConstraint& default_instance() {
+    return *internal_default_instance();
+  }
   enum PredicateCase {
     kExactValue = 2,
     kRegex = 3,
     PREDICATE_NOT_SET = 0,
   };
 
-  void UnsafeArenaSwap(LabelConstraint* other);
-  void Swap(LabelConstraint* other);
+  static inline const LabelConstraint* internal_default_instance() {
+    return reinterpret_cast<const LabelConstraint*>(
+               &_LabelConstraint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  // implements Message ----------------------------------------------
+  friend void swap(LabelConstraint& a, LabelConstraint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LabelConstraint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LabelConstraint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  inline LabelConstraint* New() const { return New(NULL); }
+  // implements Message ----------------------------------------------
 
-  LabelConstraint* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LabelConstraint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LabelConstraint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LabelConstraint& from);
-  void MergeFrom(const LabelConstraint& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LabelConstraint& from) {
+    LabelConstraint::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LabelConstraint* other);
-  protected:
-  explicit LabelConstraint(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.LabelConstraint";
   }
+  protected:
+  explicit LabelConstraint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string label_name = 1;
+  enum : int {
+    kLabelNameFieldNumber = 1,
+    kExactValueFieldNumber = 2,
+    kRegexFieldNumber = 3,
+  };
+  // string label_name = 1;
   void clear_label_name();
-  static const int kLabelNameFieldNumber = 1;
-  const ::std::string& label_name() const;
-  void set_label_name(const ::std::string& value);
-  void set_label_name(const char* value);
-  void set_label_name(const char* value, size_t size);
-  ::std::string* mutable_label_name();
-  ::std::string* release_label_name();
-  void set_allocated_label_name(::std::string* label_name);
-  ::std::string* unsafe_arena_release_label_name();
-  void unsafe_arena_set_allocated_label_name(
-      ::std::string* label_name);
-
-  // optional string exact_value = 2;
+  const std::string& label_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label_name();
+  PROTOBUF_NODISCARD std::string* release_label_name();
+  void set_allocated_label_name(std::string* label_name);
   private:
+  const std::string& _internal_label_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label_name(const std::string& value);
+  std::string* _internal_mutable_label_name();
+  public:
+
+  // string exact_value = 2;
   bool has_exact_value() const;
+  private:
+  bool _internal_has_exact_value() const;
   public:
   void clear_exact_value();
-  static const int kExactValueFieldNumber = 2;
-  const ::std::string& exact_value() const;
-  void set_exact_value(const ::std::string& value);
-  void set_exact_value(const char* value);
-  void set_exact_value(const char* value, size_t size);
-  ::std::string* mutable_exact_value();
-  ::std::string* release_exact_value();
-  void set_allocated_exact_value(::std::string* exact_value);
-  ::std::string* unsafe_arena_release_exact_value();
-  void unsafe_arena_set_allocated_exact_value(
-      ::std::string* exact_value);
-
-  // optional string regex = 3;
+  const std::string& exact_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_exact_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_exact_value();
+  PROTOBUF_NODISCARD std::string* release_exact_value();
+  void set_allocated_exact_value(std::string* exact_value);
   private:
+  const std::string& _internal_exact_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_exact_value(const std::string& value);
+  std::string* _internal_mutable_exact_value();
+  public:
+
+  // string regex = 3;
   bool has_regex() const;
+  private:
+  bool _internal_has_regex() const;
   public:
   void clear_regex();
-  static const int kRegexFieldNumber = 3;
-  const ::std::string& regex() const;
-  void set_regex(const ::std::string& value);
-  void set_regex(const char* value);
-  void set_regex(const char* value, size_t size);
-  ::std::string* mutable_regex();
-  ::std::string* release_regex();
-  void set_allocated_regex(::std::string* regex);
-  ::std::string* unsafe_arena_release_regex();
-  void unsafe_arena_set_allocated_regex(
-      ::std::string* regex);
+  const std::string& regex() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_regex(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_regex();
+  PROTOBUF_NODISCARD std::string* release_regex();
+  void set_allocated_regex(std::string* regex);
+  private:
+  const std::string& _internal_regex() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_regex(const std::string& value);
+  std::string* _internal_mutable_regex();
+  public:
 
+  void clear_predicate();
   PredicateCase predicate_case() const;
   // @@protoc_insertion_point(class_scope:vqro.rpc.LabelConstraint)
  private:
-  inline void set_has_exact_value();
-  inline void set_has_regex();
+  class _Internal;
+  void set_has_exact_value();
+  void set_has_regex();
 
   inline bool has_predicate() const;
-  void clear_predicate();
   inline void clear_has_predicate();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr label_name_;
-  union PredicateUnion {
-    PredicateUnion() {}
-    ::google::protobuf::internal::ArenaStringPtr exact_value_;
-    ::google::protobuf::internal::ArenaStringPtr regex_;
-  } predicate_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_search_2eproto();
-  friend void protobuf_AssignDesc_search_2eproto();
-  friend void protobuf_ShutdownFile_search_2eproto();
-
-  void InitAsDefaultInstance();
-  static LabelConstraint* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_name_;
+    union PredicateUnion {
+      constexpr PredicateUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exact_value_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr regex_;
+    } predicate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_search_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SearchSeriesResults : public ::google::protobuf::Message {
+class SearchSeriesResults final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SearchSeriesResults) */ {
  public:
-  SearchSeriesResults();
-  virtual ~SearchSeriesResults();
+  inline SearchSeriesResults() : SearchSeriesResults(nullptr) {}
+  ~SearchSeriesResults() override;
+  explicit PROTOBUF_CONSTEXPR SearchSeriesResults(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SearchSeriesResults(const SearchSeriesResults& from);
+  SearchSeriesResults(SearchSeriesResults&& from) noexcept
+    : SearchSeriesResults() {
+    *this = ::std::move(from);
+  }
 
   inline SearchSeriesResults& operator=(const SearchSeriesResults& from) {
     CopyFrom(from);
     return *this;
   }
+  inline SearchSeriesResults& operator=(SearchSeriesResults&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SearchSeriesResults& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchSeriesResults& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchSeriesResults* internal_default_instance() {
+    return reinterpret_cast<const SearchSeriesResults*>(
+               &_SearchSeriesResults_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void UnsafeArenaSwap(SearchSeriesResults* other);
-  void Swap(SearchSeriesResults* other);
+  friend void swap(SearchSeriesResults& a, SearchSeriesResults& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchSeriesResults* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchSeriesResults* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SearchSeriesResults* New() const { return New(NULL); }
-
-  SearchSeriesResults* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SearchSeriesResults* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchSeriesResults>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SearchSeriesResults& from);
-  void MergeFrom(const SearchSeriesResults& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchSeriesResults& from) {
+    SearchSeriesResults::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SearchSeriesResults* other);
-  protected:
-  explicit SearchSeriesResults(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SearchSeriesResults";
   }
+  protected:
+  explicit SearchSeriesResults(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMatchesFieldNumber = 1,
+    kStatusFieldNumber = 2,
+  };
   // repeated .vqro.rpc.Series matches = 1;
   int matches_size() const;
+  private:
+  int _internal_matches_size() const;
+  public:
   void clear_matches();
-  static const int kMatchesFieldNumber = 1;
-  const ::vqro::rpc::Series& matches(int index) const;
   ::vqro::rpc::Series* mutable_matches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+      mutable_matches();
+  private:
+  const ::vqro::rpc::Series& _internal_matches(int index) const;
+  ::vqro::rpc::Series* _internal_add_matches();
+  public:
+  const ::vqro::rpc::Series& matches(int index) const;
   ::vqro::rpc::Series* add_matches();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
       matches() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-      mutable_matches();
 
-  // optional .vqro.rpc.StatusMessage status = 2;
+  // .vqro.rpc.StatusMessage status = 2;
   bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 2;
   private:
-  void _slow_mutable_status();
-  void _slow_set_allocated_status(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status);
-  ::vqro::rpc::StatusMessage* _slow_release_status();
+  bool _internal_has_status() const;
   public:
+  void clear_status();
   const ::vqro::rpc::StatusMessage& status() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::StatusMessage* release_status();
   ::vqro::rpc::StatusMessage* mutable_status();
-  ::vqro::rpc::StatusMessage* release_status();
   void set_allocated_status(::vqro::rpc::StatusMessage* status);
-  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
+  private:
+  const ::vqro::rpc::StatusMessage& _internal_status() const;
+  ::vqro::rpc::StatusMessage* _internal_mutable_status();
+  public:
   void unsafe_arena_set_allocated_status(
       ::vqro::rpc::StatusMessage* status);
+  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.SearchSeriesResults)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series > matches_;
-  ::vqro::rpc::StatusMessage* status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_search_2eproto();
-  friend void protobuf_AssignDesc_search_2eproto();
-  friend void protobuf_ShutdownFile_search_2eproto();
-
-  void InitAsDefaultInstance();
-  static SearchSeriesResults* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series > matches_;
+    ::vqro::rpc::StatusMessage* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_search_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LabelsQuery : public ::google::protobuf::Message {
+class LabelsQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.LabelsQuery) */ {
  public:
-  LabelsQuery();
-  virtual ~LabelsQuery();
+  inline LabelsQuery() : LabelsQuery(nullptr) {}
+  ~LabelsQuery() override;
+  explicit PROTOBUF_CONSTEXPR LabelsQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LabelsQuery(const LabelsQuery& from);
+  LabelsQuery(LabelsQuery&& from) noexcept
+    : LabelsQuery() {
+    *this = ::std::move(from);
+  }
 
   inline LabelsQuery& operator=(const LabelsQuery& from) {
     CopyFrom(from);
     return *this;
   }
+  inline LabelsQuery& operator=(LabelsQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LabelsQuery& default_instance();
+  static const LabelsQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LabelsQuery* internal_default_instance() {
+    return reinterpret_cast<const LabelsQuery*>(
+               &_LabelsQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void UnsafeArenaSwap(LabelsQuery* other);
-  void Swap(LabelsQuery* other);
+  friend void swap(LabelsQuery& a, LabelsQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LabelsQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LabelsQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LabelsQuery* New() const { return New(NULL); }
-
-  LabelsQuery* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LabelsQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LabelsQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LabelsQuery& from);
-  void MergeFrom(const LabelsQuery& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LabelsQuery& from) {
+    LabelsQuery::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LabelsQuery* other);
-  protected:
-  explicit LabelsQuery(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.LabelsQuery";
   }
+  protected:
+  explicit LabelsQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string regex = 1;
+  enum : int {
+    kRegexFieldNumber = 1,
+    kResultOffsetFieldNumber = 2,
+    kResultLimitFieldNumber = 3,
+  };
+  // string regex = 1;
   void clear_regex();
-  static const int kRegexFieldNumber = 1;
-  const ::std::string& regex() const;
-  void set_regex(const ::std::string& value);
-  void set_regex(const char* value);
-  void set_regex(const char* value, size_t size);
-  ::std::string* mutable_regex();
-  ::std::string* release_regex();
-  void set_allocated_regex(::std::string* regex);
-  ::std::string* unsafe_arena_release_regex();
-  void unsafe_arena_set_allocated_regex(
-      ::std::string* regex);
-
-  // optional int64 result_offset = 2;
+  const std::string& regex() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_regex(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_regex();
+  PROTOBUF_NODISCARD std::string* release_regex();
+  void set_allocated_regex(std::string* regex);
+  private:
+  const std::string& _internal_regex() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_regex(const std::string& value);
+  std::string* _internal_mutable_regex();
+  public:
+
+  // int64 result_offset = 2;
   void clear_result_offset();
-  static const int kResultOffsetFieldNumber = 2;
-  ::google::protobuf::int64 result_offset() const;
-  void set_result_offset(::google::protobuf::int64 value);
+  int64_t result_offset() const;
+  void set_result_offset(int64_t value);
+  private:
+  int64_t _internal_result_offset() const;
+  void _internal_set_result_offset(int64_t value);
+  public:
 
-  // optional int64 result_limit = 3;
+  // int64 result_limit = 3;
   void clear_result_limit();
-  static const int kResultLimitFieldNumber = 3;
-  ::google::protobuf::int64 result_limit() const;
-  void set_result_limit(::google::protobuf::int64 value);
+  int64_t result_limit() const;
+  void set_result_limit(int64_t value);
+  private:
+  int64_t _internal_result_limit() const;
+  void _internal_set_result_limit(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.LabelsQuery)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr regex_;
-  ::google::protobuf::int64 result_offset_;
-  ::google::protobuf::int64 result_limit_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_search_2eproto();
-  friend void protobuf_AssignDesc_search_2eproto();
-  friend void protobuf_ShutdownFile_search_2eproto();
-
-  void InitAsDefaultInstance();
-  static LabelsQuery* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr regex_;
+    int64_t result_offset_;
+    int64_t result_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_search_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SearchLabelsResults : public ::google::protobuf::Message {
+class SearchLabelsResults final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SearchLabelsResults) */ {
  public:
-  SearchLabelsResults();
-  virtual ~SearchLabelsResults();
+  inline SearchLabelsResults() : SearchLabelsResults(nullptr) {}
+  ~SearchLabelsResults() override;
+  explicit PROTOBUF_CONSTEXPR SearchLabelsResults(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SearchLabelsResults(const SearchLabelsResults& from);
+  SearchLabelsResults(SearchLabelsResults&& from) noexcept
+    : SearchLabelsResults() {
+    *this = ::std::move(from);
+  }
 
   inline SearchLabelsResults& operator=(const SearchLabelsResults& from) {
     CopyFrom(from);
     return *this;
   }
+  inline SearchLabelsResults& operator=(SearchLabelsResults&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SearchLabelsResults& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchLabelsResults& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchLabelsResults* internal_default_instance() {
+    return reinterpret_cast<const SearchLabelsResults*>(
+               &_SearchLabelsResults_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void UnsafeArenaSwap(SearchLabelsResults* other);
-  void Swap(SearchLabelsResults* other);
+  friend void swap(SearchLabelsResults& a, SearchLabelsResults& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchLabelsResults* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchLabelsResults* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SearchLabelsResults* New() const { return New(NULL); }
-
-  SearchLabelsResults* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SearchLabelsResults* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchLabelsResults>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SearchLabelsResults& from);
-  void MergeFrom(const SearchLabelsResults& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchLabelsResults& from) {
+    SearchLabelsResults::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SearchLabelsResults* other);
-  protected:
-  explicit SearchLabelsResults(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SearchLabelsResults";
   }
+  protected:
+  explicit SearchLabelsResults(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLabelsFieldNumber = 1,
+    kStatusFieldNumber = 2,
+  };
   // repeated string labels = 1;
   int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
   void clear_labels();
-  static const int kLabelsFieldNumber = 1;
-  const ::std::string& labels(int index) const;
-  ::std::string* mutable_labels(int index);
-  void set_labels(int index, const ::std::string& value);
+  const std::string& labels(int index) const;
+  std::string* mutable_labels(int index);
+  void set_labels(int index, const std::string& value);
+  void set_labels(int index, std::string&& value);
   void set_labels(int index, const char* value);
   void set_labels(int index, const char* value, size_t size);
-  ::std::string* add_labels();
-  void add_labels(const ::std::string& value);
+  std::string* add_labels();
+  void add_labels(const std::string& value);
+  void add_labels(std::string&& value);
   void add_labels(const char* value);
   void add_labels(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& labels() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_labels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& labels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_labels();
+  private:
+  const std::string& _internal_labels(int index) const;
+  std::string* _internal_add_labels();
+  public:
 
-  // optional .vqro.rpc.StatusMessage status = 2;
+  // .vqro.rpc.StatusMessage status = 2;
   bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 2;
   private:
-  void _slow_mutable_status();
-  void _slow_set_allocated_status(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status);
-  ::vqro::rpc::StatusMessage* _slow_release_status();
+  bool _internal_has_status() const;
   public:
+  void clear_status();
   const ::vqro::rpc::StatusMessage& status() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::StatusMessage* release_status();
   ::vqro::rpc::StatusMessage* mutable_status();
-  ::vqro::rpc::StatusMessage* release_status();
   void set_allocated_status(::vqro::rpc::StatusMessage* status);
-  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
+  private:
+  const ::vqro::rpc::StatusMessage& _internal_status() const;
+  ::vqro::rpc::StatusMessage* _internal_mutable_status();
+  public:
   void unsafe_arena_set_allocated_status(
       ::vqro::rpc::StatusMessage* status);
+  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.SearchLabelsResults)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> labels_;
-  ::vqro::rpc::StatusMessage* status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_search_2eproto();
-  friend void protobuf_AssignDesc_search_2eproto();
-  friend void protobuf_ShutdownFile_search_2eproto();
-
-  void InitAsDefaultInstance();
-  static SearchLabelsResults* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> labels_;
+    ::vqro::rpc::StatusMessage* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_search_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // SeriesQuery
 
 // repeated .vqro.rpc.LabelConstraint constraints = 1;
+inline int SeriesQuery::_internal_constraints_size() const {
+  return _impl_.constraints_.size();
+}
 inline int SeriesQuery::constraints_size() const {
-  return constraints_.size();
+  return _internal_constraints_size();
 }
 inline void SeriesQuery::clear_constraints() {
-  constraints_.Clear();
+  _impl_.constraints_.Clear();
+}
+inline ::vqro::rpc::LabelConstraint* SeriesQuery::mutable_constraints(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesQuery.constraints)
+  return _impl_.constraints_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::LabelConstraint >*
+SeriesQuery::mutable_constraints() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesQuery.constraints)
+  return &_impl_.constraints_;
+}
+inline const ::vqro::rpc::LabelConstraint& SeriesQuery::_internal_constraints(int index) const {
+  return _impl_.constraints_.Get(index);
 }
 inline const ::vqro::rpc::LabelConstraint& SeriesQuery::constraints(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Get(index);
+  return _internal_constraints(index);
 }
-inline ::vqro::rpc::LabelConstraint* SeriesQuery::mutable_constraints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Mutable(index);
+inline ::vqro::rpc::LabelConstraint* SeriesQuery::_internal_add_constraints() {
+  return _impl_.constraints_.Add();
 }
 inline ::vqro::rpc::LabelConstraint* SeriesQuery::add_constraints() {
+  ::vqro::rpc::LabelConstraint* _add = _internal_add_constraints();
   // @@protoc_insertion_point(field_add:vqro.rpc.SeriesQuery.constraints)
-  return constraints_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::LabelConstraint >&
 SeriesQuery::constraints() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.SeriesQuery.constraints)
-  return constraints_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::LabelConstraint >*
-SeriesQuery::mutable_constraints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesQuery.constraints)
-  return &constraints_;
+  return _impl_.constraints_;
 }
 
-// optional int64 result_offset = 2;
+// int64 result_offset = 2;
 inline void SeriesQuery::clear_result_offset() {
-  result_offset_ = GOOGLE_LONGLONG(0);
+  _impl_.result_offset_ = int64_t{0};
+}
+inline int64_t SeriesQuery::_internal_result_offset() const {
+  return _impl_.result_offset_;
 }
-inline ::google::protobuf::int64 SeriesQuery::result_offset() const {
+inline int64_t SeriesQuery::result_offset() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.result_offset)
-  return result_offset_;
+  return _internal_result_offset();
 }
-inline void SeriesQuery::set_result_offset(::google::protobuf::int64 value) {
+inline void SeriesQuery::_internal_set_result_offset(int64_t value) {
   
-  result_offset_ = value;
+  _impl_.result_offset_ = value;
+}
+inline void SeriesQuery::set_result_offset(int64_t value) {
+  _internal_set_result_offset(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.SeriesQuery.result_offset)
 }
 
-// optional int64 result_limit = 3;
+// int64 result_limit = 3;
 inline void SeriesQuery::clear_result_limit() {
-  result_limit_ = GOOGLE_LONGLONG(0);
+  _impl_.result_limit_ = int64_t{0};
+}
+inline int64_t SeriesQuery::_internal_result_limit() const {
+  return _impl_.result_limit_;
 }
-inline ::google::protobuf::int64 SeriesQuery::result_limit() const {
+inline int64_t SeriesQuery::result_limit() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SeriesQuery.result_limit)
-  return result_limit_;
+  return _internal_result_limit();
 }
-inline void SeriesQuery::set_result_limit(::google::protobuf::int64 value) {
+inline void SeriesQuery::_internal_set_result_limit(int64_t value) {
   
-  result_limit_ = value;
+  _impl_.result_limit_ = value;
+}
+inline void SeriesQuery::set_result_limit(int64_t value) {
+  _internal_set_result_limit(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.SeriesQuery.result_limit)
 }
 
@@ -727,281 +1095,206 @@ inline void SeriesQuery::set_result_limit(::google::protobuf::int64 value) {
 
 // LabelConstraint
 
-// optional string label_name = 1;
+// string label_name = 1;
 inline void LabelConstraint::clear_label_name() {
-  label_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.label_name_.ClearToEmpty();
 }
-inline const ::std::string& LabelConstraint::label_name() const {
+inline const std::string& LabelConstraint::label_name() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.label_name)
-  return label_name_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_label_name();
 }
-inline void LabelConstraint::set_label_name(const ::std::string& value) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LabelConstraint::set_label_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.label_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.label_name)
 }
-inline void LabelConstraint::set_label_name(const char* value) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.label_name)
+inline std::string* LabelConstraint::mutable_label_name() {
+  std::string* _s = _internal_mutable_label_name();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.label_name)
+  return _s;
 }
-inline void LabelConstraint::set_label_name(const char* value,
-    size_t size) {
-  
-  label_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.label_name)
+inline const std::string& LabelConstraint::_internal_label_name() const {
+  return _impl_.label_name_.Get();
 }
-inline ::std::string* LabelConstraint::mutable_label_name() {
+inline void LabelConstraint::_internal_set_label_name(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.label_name)
-  return label_name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.label_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::release_label_name() {
+inline std::string* LabelConstraint::_internal_mutable_label_name() {
   
-  return label_name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  return _impl_.label_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::unsafe_arena_release_label_name() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return label_name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
+inline std::string* LabelConstraint::release_label_name() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.LabelConstraint.label_name)
+  return _impl_.label_name_.Release();
 }
-inline void LabelConstraint::set_allocated_label_name(::std::string* label_name) {
-  if (label_name != NULL) {
+inline void LabelConstraint::set_allocated_label_name(std::string* label_name) {
+  if (label_name != nullptr) {
     
   } else {
     
   }
-  label_name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), label_name,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.label_name)
-}
-inline void LabelConstraint::unsafe_arena_set_allocated_label_name(
-    ::std::string* label_name) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (label_name != NULL) {
-    
-  } else {
-    
+  _impl_.label_name_.SetAllocated(label_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_name_.IsDefault()) {
+    _impl_.label_name_.Set("", GetArenaForAllocation());
   }
-  
-  label_name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      label_name, GetArenaNoVirtual());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.label_name)
 }
 
-// optional string exact_value = 2;
-inline bool LabelConstraint::has_exact_value() const {
+// string exact_value = 2;
+inline bool LabelConstraint::_internal_has_exact_value() const {
   return predicate_case() == kExactValue;
 }
+inline bool LabelConstraint::has_exact_value() const {
+  return _internal_has_exact_value();
+}
 inline void LabelConstraint::set_has_exact_value() {
-  _oneof_case_[0] = kExactValue;
+  _impl_._oneof_case_[0] = kExactValue;
 }
 inline void LabelConstraint::clear_exact_value() {
-  if (has_exact_value()) {
-    predicate_.exact_value_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
+  if (_internal_has_exact_value()) {
+    _impl_.predicate_.exact_value_.Destroy();
     clear_has_predicate();
   }
 }
-inline const ::std::string& LabelConstraint::exact_value() const {
+inline const std::string& LabelConstraint::exact_value() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.exact_value)
-  if (has_exact_value()) {
-    return predicate_.exact_value_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_exact_value();
 }
-inline void LabelConstraint::set_exact_value(const ::std::string& value) {
-  if (!has_exact_value()) {
+template <typename ArgT0, typename... ArgT>
+inline void LabelConstraint::set_exact_value(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_exact_value()) {
     clear_predicate();
     set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.predicate_.exact_value_.InitDefault();
   }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
+  _impl_.predicate_.exact_value_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.exact_value)
 }
-inline void LabelConstraint::set_exact_value(const char* value) {
-  if (!has_exact_value()) {
-    clear_predicate();
-    set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* LabelConstraint::mutable_exact_value() {
+  std::string* _s = _internal_mutable_exact_value();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.exact_value)
+  return _s;
+}
+inline const std::string& LabelConstraint::_internal_exact_value() const {
+  if (_internal_has_exact_value()) {
+    return _impl_.predicate_.exact_value_.Get();
   }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.exact_value)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void LabelConstraint::set_exact_value(const char* value,
-                             size_t size) {
-  if (!has_exact_value()) {
+inline void LabelConstraint::_internal_set_exact_value(const std::string& value) {
+  if (!_internal_has_exact_value()) {
     clear_predicate();
     set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.predicate_.exact_value_.InitDefault();
   }
-  predicate_.exact_value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.exact_value)
+  _impl_.predicate_.exact_value_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::mutable_exact_value() {
-  if (!has_exact_value()) {
+inline std::string* LabelConstraint::_internal_mutable_exact_value() {
+  if (!_internal_has_exact_value()) {
     clear_predicate();
     set_has_exact_value();
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.predicate_.exact_value_.InitDefault();
   }
-  return predicate_.exact_value_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.exact_value)
+  return _impl_.predicate_.exact_value_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::release_exact_value() {
-  if (has_exact_value()) {
+inline std::string* LabelConstraint::release_exact_value() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.LabelConstraint.exact_value)
+  if (_internal_has_exact_value()) {
     clear_has_predicate();
-    return predicate_.exact_value_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
+    return _impl_.predicate_.exact_value_.Release();
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline ::std::string* LabelConstraint::unsafe_arena_release_exact_value() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_exact_value()) {
-    clear_has_predicate();
-    return predicate_.exact_value_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
-  } else {
-    return NULL;
-  }
-}
-inline void LabelConstraint::set_allocated_exact_value(::std::string* exact_value) {
-  if (!has_exact_value()) {
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (exact_value != NULL) {
-    set_has_exact_value();
-    predicate_.exact_value_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exact_value,
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.exact_value)
-}
-inline void LabelConstraint::unsafe_arena_set_allocated_exact_value(::std::string* exact_value) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_exact_value()) {
-    predicate_.exact_value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LabelConstraint::set_allocated_exact_value(std::string* exact_value) {
+  if (has_predicate()) {
+    clear_predicate();
   }
-  clear_predicate();
-  if (exact_value) {
+  if (exact_value != nullptr) {
     set_has_exact_value();
-    predicate_.exact_value_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exact_value, GetArenaNoVirtual());
+    _impl_.predicate_.exact_value_.InitAllocated(exact_value, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.exact_value)
 }
 
-// optional string regex = 3;
-inline bool LabelConstraint::has_regex() const {
+// string regex = 3;
+inline bool LabelConstraint::_internal_has_regex() const {
   return predicate_case() == kRegex;
 }
+inline bool LabelConstraint::has_regex() const {
+  return _internal_has_regex();
+}
 inline void LabelConstraint::set_has_regex() {
-  _oneof_case_[0] = kRegex;
+  _impl_._oneof_case_[0] = kRegex;
 }
 inline void LabelConstraint::clear_regex() {
-  if (has_regex()) {
-    predicate_.regex_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
+  if (_internal_has_regex()) {
+    _impl_.predicate_.regex_.Destroy();
     clear_has_predicate();
   }
 }
-inline const ::std::string& LabelConstraint::regex() const {
+inline const std::string& LabelConstraint::regex() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelConstraint.regex)
-  if (has_regex()) {
-    return predicate_.regex_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_regex();
 }
-inline void LabelConstraint::set_regex(const ::std::string& value) {
-  if (!has_regex()) {
+template <typename ArgT0, typename... ArgT>
+inline void LabelConstraint::set_regex(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_regex()) {
     clear_predicate();
     set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.predicate_.regex_.InitDefault();
   }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
-      GetArenaNoVirtual());
+  _impl_.predicate_.regex_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelConstraint.regex)
 }
-inline void LabelConstraint::set_regex(const char* value) {
-  if (!has_regex()) {
-    clear_predicate();
-    set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* LabelConstraint::mutable_regex() {
+  std::string* _s = _internal_mutable_regex();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.regex)
+  return _s;
+}
+inline const std::string& LabelConstraint::_internal_regex() const {
+  if (_internal_has_regex()) {
+    return _impl_.predicate_.regex_.Get();
   }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelConstraint.regex)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void LabelConstraint::set_regex(const char* value,
-                             size_t size) {
-  if (!has_regex()) {
+inline void LabelConstraint::_internal_set_regex(const std::string& value) {
+  if (!_internal_has_regex()) {
     clear_predicate();
     set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.predicate_.regex_.InitDefault();
   }
-  predicate_.regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelConstraint.regex)
+  _impl_.predicate_.regex_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::mutable_regex() {
-  if (!has_regex()) {
+inline std::string* LabelConstraint::_internal_mutable_regex() {
+  if (!_internal_has_regex()) {
     clear_predicate();
     set_has_regex();
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  return predicate_.regex_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelConstraint.regex)
-}
-inline ::std::string* LabelConstraint::release_regex() {
-  if (has_regex()) {
-    clear_has_predicate();
-    return predicate_.regex_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-        GetArenaNoVirtual());
-  } else {
-    return NULL;
+    _impl_.predicate_.regex_.InitDefault();
   }
+  return _impl_.predicate_.regex_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* LabelConstraint::unsafe_arena_release_regex() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (has_regex()) {
+inline std::string* LabelConstraint::release_regex() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.LabelConstraint.regex)
+  if (_internal_has_regex()) {
     clear_has_predicate();
-    return predicate_.regex_.UnsafeArenaRelease(
-        &::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+    return _impl_.predicate_.regex_.Release();
   } else {
-    return NULL;
-  }
-}
-inline void LabelConstraint::set_allocated_regex(::std::string* regex) {
-  if (!has_regex()) {
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  clear_predicate();
-  if (regex != NULL) {
-    set_has_regex();
-    predicate_.regex_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex,
-        GetArenaNoVirtual());
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.regex)
 }
-inline void LabelConstraint::unsafe_arena_set_allocated_regex(::std::string* regex) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (!has_regex()) {
-    predicate_.regex_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LabelConstraint::set_allocated_regex(std::string* regex) {
+  if (has_predicate()) {
+    clear_predicate();
   }
-  clear_predicate();
-  if (regex) {
+  if (regex != nullptr) {
     set_has_regex();
-    predicate_.regex_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex, GetArenaNoVirtual());
+    _impl_.predicate_.regex_.InitAllocated(regex, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelConstraint.regex)
 }
@@ -1010,88 +1303,134 @@ inline bool LabelConstraint::has_predicate() const {
   return predicate_case() != PREDICATE_NOT_SET;
 }
 inline void LabelConstraint::clear_has_predicate() {
-  _oneof_case_[0] = PREDICATE_NOT_SET;
+  _impl_._oneof_case_[0] = PREDICATE_NOT_SET;
 }
 inline LabelConstraint::PredicateCase LabelConstraint::predicate_case() const {
-  return LabelConstraint::PredicateCase(_oneof_case_[0]);
+  return LabelConstraint::PredicateCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // SearchSeriesResults
 
 // repeated .vqro.rpc.Series matches = 1;
+inline int SearchSeriesResults::_internal_matches_size() const {
+  return _impl_.matches_.size();
+}
 inline int SearchSeriesResults::matches_size() const {
-  return matches_.size();
+  return _internal_matches_size();
 }
-inline void SearchSeriesResults::clear_matches() {
-  matches_.Clear();
+inline ::vqro::rpc::Series* SearchSeriesResults::mutable_matches(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.matches)
+  return _impl_.matches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+SearchSeriesResults::mutable_matches() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SearchSeriesResults.matches)
+  return &_impl_.matches_;
+}
+inline const ::vqro::rpc::Series& SearchSeriesResults::_internal_matches(int index) const {
+  return _impl_.matches_.Get(index);
 }
 inline const ::vqro::rpc::Series& SearchSeriesResults::matches(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Get(index);
+  return _internal_matches(index);
 }
-inline ::vqro::rpc::Series* SearchSeriesResults::mutable_matches(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Mutable(index);
+inline ::vqro::rpc::Series* SearchSeriesResults::_internal_add_matches() {
+  return _impl_.matches_.Add();
 }
 inline ::vqro::rpc::Series* SearchSeriesResults::add_matches() {
+  ::vqro::rpc::Series* _add = _internal_add_matches();
   // @@protoc_insertion_point(field_add:vqro.rpc.SearchSeriesResults.matches)
-  return matches_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
 SearchSeriesResults::matches() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.SearchSeriesResults.matches)
-  return matches_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-SearchSeriesResults::mutable_matches() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SearchSeriesResults.matches)
-  return &matches_;
+  return _impl_.matches_;
 }
 
-// optional .vqro.rpc.StatusMessage status = 2;
+// .vqro.rpc.StatusMessage status = 2;
+inline bool SearchSeriesResults::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
+}
 inline bool SearchSeriesResults::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+  return _internal_has_status();
 }
-inline void SearchSeriesResults::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
+inline const ::vqro::rpc::StatusMessage& SearchSeriesResults::_internal_status() const {
+  const ::vqro::rpc::StatusMessage* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::StatusMessage&>(
+      ::vqro::rpc::_StatusMessage_default_instance_);
 }
 inline const ::vqro::rpc::StatusMessage& SearchSeriesResults::status() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SearchSeriesResults.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+  return _internal_status();
 }
-inline ::vqro::rpc::StatusMessage* SearchSeriesResults::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.status)
-  return status_;
+inline void SearchSeriesResults::unsafe_arena_set_allocated_status(
+    ::vqro::rpc::StatusMessage* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.SearchSeriesResults.status)
 }
 inline ::vqro::rpc::StatusMessage* SearchSeriesResults::release_status() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void SearchSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
+inline ::vqro::rpc::StatusMessage* SearchSeriesResults::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.SearchSeriesResults.status)
+  
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::StatusMessage* SearchSeriesResults::_internal_mutable_status() {
+  
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::StatusMessage>(GetArenaForAllocation());
+    _impl_.status_ = p;
   }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
+  return _impl_.status_;
+}
+inline ::vqro::rpc::StatusMessage* SearchSeriesResults::mutable_status() {
+  ::vqro::rpc::StatusMessage* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchSeriesResults.status)
+  return _msg;
+}
+inline void SearchSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
   }
-  status_ = status;
   if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(status));
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.status_ = status;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.SearchSeriesResults.status)
 }
 
@@ -1099,96 +1438,93 @@ inline void SearchSeriesResults::set_allocated_status(::vqro::rpc::StatusMessage
 
 // LabelsQuery
 
-// optional string regex = 1;
+// string regex = 1;
 inline void LabelsQuery::clear_regex() {
-  regex_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.regex_.ClearToEmpty();
 }
-inline const ::std::string& LabelsQuery::regex() const {
+inline const std::string& LabelsQuery::regex() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.regex)
-  return regex_.Get(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_regex();
 }
-inline void LabelsQuery::set_regex(const ::std::string& value) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LabelsQuery::set_regex(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.regex_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.regex)
 }
-inline void LabelsQuery::set_regex(const char* value) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_char:vqro.rpc.LabelsQuery.regex)
+inline std::string* LabelsQuery::mutable_regex() {
+  std::string* _s = _internal_mutable_regex();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelsQuery.regex)
+  return _s;
 }
-inline void LabelsQuery::set_regex(const char* value,
-    size_t size) {
-  
-  regex_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_pointer:vqro.rpc.LabelsQuery.regex)
+inline const std::string& LabelsQuery::_internal_regex() const {
+  return _impl_.regex_.Get();
 }
-inline ::std::string* LabelsQuery::mutable_regex() {
+inline void LabelsQuery::_internal_set_regex(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.LabelsQuery.regex)
-  return regex_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  _impl_.regex_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LabelsQuery::release_regex() {
+inline std::string* LabelsQuery::_internal_mutable_regex() {
   
-  return regex_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  return _impl_.regex_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LabelsQuery::unsafe_arena_release_regex() {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  
-  return regex_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      GetArenaNoVirtual());
+inline std::string* LabelsQuery::release_regex() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.LabelsQuery.regex)
+  return _impl_.regex_.Release();
 }
-inline void LabelsQuery::set_allocated_regex(::std::string* regex) {
-  if (regex != NULL) {
+inline void LabelsQuery::set_allocated_regex(std::string* regex) {
+  if (regex != nullptr) {
     
   } else {
     
   }
-  regex_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), regex,
-      GetArenaNoVirtual());
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelsQuery.regex)
-}
-inline void LabelsQuery::unsafe_arena_set_allocated_regex(
-    ::std::string* regex) {
-  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
-  if (regex != NULL) {
-    
-  } else {
-    
+  _impl_.regex_.SetAllocated(regex, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.regex_.IsDefault()) {
+    _impl_.regex_.Set("", GetArenaForAllocation());
   }
-  
-  regex_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      regex, GetArenaNoVirtual());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.LabelsQuery.regex)
 }
 
-// optional int64 result_offset = 2;
+// int64 result_offset = 2;
 inline void LabelsQuery::clear_result_offset() {
-  result_offset_ = GOOGLE_LONGLONG(0);
+  _impl_.result_offset_ = int64_t{0};
+}
+inline int64_t LabelsQuery::_internal_result_offset() const {
+  return _impl_.result_offset_;
 }
-inline ::google::protobuf::int64 LabelsQuery::result_offset() const {
+inline int64_t LabelsQuery::result_offset() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.result_offset)
-  return result_offset_;
+  return _internal_result_offset();
 }
-inline void LabelsQuery::set_result_offset(::google::protobuf::int64 value) {
+inline void LabelsQuery::_internal_set_result_offset(int64_t value) {
   
-  result_offset_ = value;
+  _impl_.result_offset_ = value;
+}
+inline void LabelsQuery::set_result_offset(int64_t value) {
+  _internal_set_result_offset(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.result_offset)
 }
 
-// optional int64 result_limit = 3;
+// int64 result_limit = 3;
 inline void LabelsQuery::clear_result_limit() {
-  result_limit_ = GOOGLE_LONGLONG(0);
+  _impl_.result_limit_ = int64_t{0};
 }
-inline ::google::protobuf::int64 LabelsQuery::result_limit() const {
+inline int64_t LabelsQuery::_internal_result_limit() const {
+  return _impl_.result_limit_;
+}
+inline int64_t LabelsQuery::result_limit() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.LabelsQuery.result_limit)
-  return result_limit_;
+  return _internal_result_limit();
 }
-inline void LabelsQuery::set_result_limit(::google::protobuf::int64 value) {
+inline void LabelsQuery::_internal_set_result_limit(int64_t value) {
   
-  result_limit_ = value;
+  _impl_.result_limit_ = value;
+}
+inline void LabelsQuery::set_result_limit(int64_t value) {
+  _internal_set_result_limit(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.LabelsQuery.result_limit)
 }
 
@@ -1197,106 +1533,176 @@ inline void LabelsQuery::set_result_limit(::google::protobuf::int64 value) {
 // SearchLabelsResults
 
 // repeated string labels = 1;
+inline int SearchLabelsResults::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
 inline int SearchLabelsResults::labels_size() const {
-  return labels_.size();
+  return _internal_labels_size();
 }
 inline void SearchLabelsResults::clear_labels() {
-  labels_.Clear();
+  _impl_.labels_.Clear();
+}
+inline std::string* SearchLabelsResults::add_labels() {
+  std::string* _s = _internal_add_labels();
+  // @@protoc_insertion_point(field_add_mutable:vqro.rpc.SearchLabelsResults.labels)
+  return _s;
+}
+inline const std::string& SearchLabelsResults::_internal_labels(int index) const {
+  return _impl_.labels_.Get(index);
 }
-inline const ::std::string& SearchLabelsResults::labels(int index) const {
+inline const std::string& SearchLabelsResults::labels(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SearchLabelsResults.labels)
-  return labels_.Get(index);
+  return _internal_labels(index);
 }
-inline ::std::string* SearchLabelsResults::mutable_labels(int index) {
+inline std::string* SearchLabelsResults::mutable_labels(int index) {
   // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchLabelsResults.labels)
-  return labels_.Mutable(index);
+  return _impl_.labels_.Mutable(index);
 }
-inline void SearchLabelsResults::set_labels(int index, const ::std::string& value) {
+inline void SearchLabelsResults::set_labels(int index, const std::string& value) {
+  _impl_.labels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SearchLabelsResults.labels)
+}
+inline void SearchLabelsResults::set_labels(int index, std::string&& value) {
+  _impl_.labels_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:vqro.rpc.SearchLabelsResults.labels)
-  labels_.Mutable(index)->assign(value);
 }
 inline void SearchLabelsResults::set_labels(int index, const char* value) {
-  labels_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.labels_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:vqro.rpc.SearchLabelsResults.labels)
 }
 inline void SearchLabelsResults::set_labels(int index, const char* value, size_t size) {
-  labels_.Mutable(index)->assign(
+  _impl_.labels_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:vqro.rpc.SearchLabelsResults.labels)
 }
-inline ::std::string* SearchLabelsResults::add_labels() {
-  return labels_.Add();
+inline std::string* SearchLabelsResults::_internal_add_labels() {
+  return _impl_.labels_.Add();
+}
+inline void SearchLabelsResults::add_labels(const std::string& value) {
+  _impl_.labels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:vqro.rpc.SearchLabelsResults.labels)
 }
-inline void SearchLabelsResults::add_labels(const ::std::string& value) {
-  labels_.Add()->assign(value);
+inline void SearchLabelsResults::add_labels(std::string&& value) {
+  _impl_.labels_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:vqro.rpc.SearchLabelsResults.labels)
 }
 inline void SearchLabelsResults::add_labels(const char* value) {
-  labels_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.labels_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:vqro.rpc.SearchLabelsResults.labels)
 }
 inline void SearchLabelsResults::add_labels(const char* value, size_t size) {
-  labels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.labels_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:vqro.rpc.SearchLabelsResults.labels)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 SearchLabelsResults::labels() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.SearchLabelsResults.labels)
-  return labels_;
+  return _impl_.labels_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 SearchLabelsResults::mutable_labels() {
   // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SearchLabelsResults.labels)
-  return &labels_;
+  return &_impl_.labels_;
 }
 
-// optional .vqro.rpc.StatusMessage status = 2;
+// .vqro.rpc.StatusMessage status = 2;
+inline bool SearchLabelsResults::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
+}
 inline bool SearchLabelsResults::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+  return _internal_has_status();
 }
-inline void SearchLabelsResults::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
+inline const ::vqro::rpc::StatusMessage& SearchLabelsResults::_internal_status() const {
+  const ::vqro::rpc::StatusMessage* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::StatusMessage&>(
+      ::vqro::rpc::_StatusMessage_default_instance_);
 }
 inline const ::vqro::rpc::StatusMessage& SearchLabelsResults::status() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SearchLabelsResults.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+  return _internal_status();
 }
-inline ::vqro::rpc::StatusMessage* SearchLabelsResults::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchLabelsResults.status)
-  return status_;
+inline void SearchLabelsResults::unsafe_arena_set_allocated_status(
+    ::vqro::rpc::StatusMessage* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.SearchLabelsResults.status)
 }
 inline ::vqro::rpc::StatusMessage* SearchLabelsResults::release_status() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void SearchLabelsResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
+inline ::vqro::rpc::StatusMessage* SearchLabelsResults::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.SearchLabelsResults.status)
+  
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::StatusMessage* SearchLabelsResults::_internal_mutable_status() {
+  
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::StatusMessage>(GetArenaForAllocation());
+    _impl_.status_ = p;
   }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
+  return _impl_.status_;
+}
+inline ::vqro::rpc::StatusMessage* SearchLabelsResults::mutable_status() {
+  ::vqro::rpc::StatusMessage* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.SearchLabelsResults.status)
+  return _msg;
+}
+inline void SearchLabelsResults::set_allocated_status(::vqro::rpc::StatusMessage* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
   }
-  status_ = status;
   if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(status));
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.status_ = status;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.SearchLabelsResults.status)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1305,4 +1711,5 @@ inline void SearchLabelsResults::set_allocated_status(::vqro::rpc::StatusMessage
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_search_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_search_2eproto
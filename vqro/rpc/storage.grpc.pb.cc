@@ -1,55 +1,162 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: storage.proto
 
 #include "storage.pb.h"
 #include "storage.grpc.pb.h"
 
-#include <grpc++/channel.h>
-#include <grpc++/impl/client_unary_call.h>
-#include <grpc++/impl/rpc_service_method.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/async_stream.h>
-#include <grpc++/support/sync_stream.h>
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace vqro {
 namespace rpc {
 
 static const char* VaqueroStorage_method_names[] = {
   "/vqro.rpc.VaqueroStorage/WriteDatapoints",
+  "/vqro.rpc.VaqueroStorage/WriteBatches",
   "/vqro.rpc.VaqueroStorage/ReadDatapoints",
+  "/vqro.rpc.VaqueroStorage/ResolveSeries",
 };
 
-std::unique_ptr< VaqueroStorage::Stub> VaqueroStorage::NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options) {
-  std::unique_ptr< VaqueroStorage::Stub> stub(new VaqueroStorage::Stub(channel));
+std::unique_ptr< VaqueroStorage::Stub> VaqueroStorage::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< VaqueroStorage::Stub> stub(new VaqueroStorage::Stub(channel, options));
   return stub;
 }
 
-VaqueroStorage::Stub::Stub(const std::shared_ptr< ::grpc::Channel>& channel)
-  : channel_(channel), rpcmethod_WriteDatapoints_(VaqueroStorage_method_names[0], ::grpc::RpcMethod::BIDI_STREAMING, channel)
-  , rpcmethod_ReadDatapoints_(VaqueroStorage_method_names[1], ::grpc::RpcMethod::SERVER_STREAMING, channel)
+VaqueroStorage::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_WriteDatapoints_(VaqueroStorage_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_WriteBatches_(VaqueroStorage_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_ReadDatapoints_(VaqueroStorage_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ResolveSeries_(VaqueroStorage_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::WriteDatapointsRaw(::grpc::ClientContext* context) {
-  return new ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>(channel_.get(), rpcmethod_WriteDatapoints_, context);
+  return ::grpc::internal::ClientReaderWriterFactory< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>::Create(channel_.get(), rpcmethod_WriteDatapoints_, context);
+}
+
+void VaqueroStorage::Stub::async::WriteDatapoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteOperation,::vqro::rpc::StatusMessage>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::vqro::rpc::WriteOperation,::vqro::rpc::StatusMessage>::Create(stub_->channel_.get(), stub_->rpcmethod_WriteDatapoints_, context, reactor);
 }
 
 ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::AsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
-  return new ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>(channel_.get(), cq, rpcmethod_WriteDatapoints_, context, tag);
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>::Create(channel_.get(), cq, rpcmethod_WriteDatapoints_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::PrepareAsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>::Create(channel_.get(), cq, rpcmethod_WriteDatapoints_, context, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::WriteBatchesRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>::Create(channel_.get(), rpcmethod_WriteBatches_, context);
+}
+
+void VaqueroStorage::Stub::async::WriteBatches(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteBatch,::vqro::rpc::StatusMessage>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::vqro::rpc::WriteBatch,::vqro::rpc::StatusMessage>::Create(stub_->channel_.get(), stub_->rpcmethod_WriteBatches_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::AsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>::Create(channel_.get(), cq, rpcmethod_WriteBatches_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* VaqueroStorage::Stub::PrepareAsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>::Create(channel_.get(), cq, rpcmethod_WriteBatches_, context, false, nullptr);
 }
 
 ::grpc::ClientReader< ::vqro::rpc::ReadResult>* VaqueroStorage::Stub::ReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) {
-  return new ::grpc::ClientReader< ::vqro::rpc::ReadResult>(channel_.get(), rpcmethod_ReadDatapoints_, context, request);
+  return ::grpc::internal::ClientReaderFactory< ::vqro::rpc::ReadResult>::Create(channel_.get(), rpcmethod_ReadDatapoints_, context, request);
+}
+
+void VaqueroStorage::Stub::async::ReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation* request, ::grpc::ClientReadReactor< ::vqro::rpc::ReadResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::vqro::rpc::ReadResult>::Create(stub_->channel_.get(), stub_->rpcmethod_ReadDatapoints_, context, request, reactor);
 }
 
 ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>* VaqueroStorage::Stub::AsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return new ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>(channel_.get(), cq, rpcmethod_ReadDatapoints_, context, request, tag);
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::ReadResult>::Create(channel_.get(), cq, rpcmethod_ReadDatapoints_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>* VaqueroStorage::Stub::PrepareAsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::vqro::rpc::ReadResult>::Create(channel_.get(), cq, rpcmethod_ReadDatapoints_, context, request, false, nullptr);
 }
 
-VaqueroStorage::AsyncService::AsyncService() : ::grpc::AsynchronousService(VaqueroStorage_method_names, 2) {}
+::grpc::Status VaqueroStorage::Stub::ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::vqro::rpc::SeriesHandles* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ResolveSeries_, context, request, response);
+}
+
+void VaqueroStorage::Stub::async::ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ResolveSeries_, context, request, response, std::move(f));
+}
+
+void VaqueroStorage::Stub::async::ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ResolveSeries_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>* VaqueroStorage::Stub::PrepareAsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::vqro::rpc::SeriesHandles, ::vqro::rpc::SeriesList, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ResolveSeries_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>* VaqueroStorage::Stub::AsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncResolveSeriesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+VaqueroStorage::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroStorage_method_names[0],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< VaqueroStorage::Service, ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>(
+          [](VaqueroStorage::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::vqro::rpc::StatusMessage,
+             ::vqro::rpc::WriteOperation>* stream) {
+               return service->WriteDatapoints(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroStorage_method_names[1],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< VaqueroStorage::Service, ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>(
+          [](VaqueroStorage::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::vqro::rpc::StatusMessage,
+             ::vqro::rpc::WriteBatch>* stream) {
+               return service->WriteBatches(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroStorage_method_names[2],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< VaqueroStorage::Service, ::vqro::rpc::ReadOperation, ::vqro::rpc::ReadResult>(
+          [](VaqueroStorage::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::ReadOperation* req,
+             ::grpc::ServerWriter<::vqro::rpc::ReadResult>* writer) {
+               return service->ReadDatapoints(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      VaqueroStorage_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< VaqueroStorage::Service, ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](VaqueroStorage::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::vqro::rpc::SeriesList* req,
+             ::vqro::rpc::SeriesHandles* resp) {
+               return service->ResolveSeries(ctx, req, resp);
+             }, this)));
+}
 
 VaqueroStorage::Service::~Service() {
-  delete service_;
 }
 
 ::grpc::Status VaqueroStorage::Service::WriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* stream) {
@@ -58,8 +165,10 @@ VaqueroStorage::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroStorage::AsyncService::RequestWriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+::grpc::Status VaqueroStorage::Service::WriteBatches(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
 ::grpc::Status VaqueroStorage::Service::ReadDatapoints(::grpc::ServerContext* context, const ::vqro::rpc::ReadOperation* request, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* writer) {
@@ -69,26 +178,11 @@ void VaqueroStorage::AsyncService::RequestWriteDatapoints(::grpc::ServerContext*
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-void VaqueroStorage::AsyncService::RequestReadDatapoints(::grpc::ServerContext* context, ::vqro::rpc::ReadOperation* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::ReadResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-  AsynchronousService::RequestServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
-}
-
-::grpc::RpcService* VaqueroStorage::Service::service() {
-  if (service_ != nullptr) {
-    return service_;
-  }
-  service_ = new ::grpc::RpcService();
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroStorage_method_names[0],
-      ::grpc::RpcMethod::BIDI_STREAMING,
-      new ::grpc::BidiStreamingHandler< VaqueroStorage::Service, ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>(
-          std::mem_fn(&VaqueroStorage::Service::WriteDatapoints), this)));
-  service_->AddMethod(new ::grpc::RpcServiceMethod(
-      VaqueroStorage_method_names[1],
-      ::grpc::RpcMethod::SERVER_STREAMING,
-      new ::grpc::ServerStreamingHandler< VaqueroStorage::Service, ::vqro::rpc::ReadOperation, ::vqro::rpc::ReadResult>(
-          std::mem_fn(&VaqueroStorage::Service::ReadDatapoints), this)));
-  return service_;
+::grpc::Status VaqueroStorage::Service::ResolveSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
 
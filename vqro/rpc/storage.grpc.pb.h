@@ -1,4 +1,4 @@
-// Generated by the gRPC protobuf plugin.
+// Generated by the gRPC C++ plugin.
 // If you make any local change, they will be lost.
 // source: storage.proto
 #ifndef GRPC_storage_2eproto__INCLUDED
@@ -6,28 +6,33 @@
 
 #include "storage.pb.h"
 
-#include <grpc++/support/async_stream.h>
-#include <grpc++/impl/rpc_method.h>
-#include <grpc++/impl/proto_utils.h>
-#include <grpc++/impl/service_type.h>
-#include <grpc++/support/async_unary_call.h>
-#include <grpc++/support/status.h>
-#include <grpc++/support/stub_options.h>
-#include <grpc++/support/sync_stream.h>
-
-namespace grpc {
-class CompletionQueue;
-class Channel;
-class RpcService;
-class ServerCompletionQueue;
-class ServerContext;
-}  // namespace grpc
+#include <functional>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace vqro {
 namespace rpc {
 
-class VaqueroStorage GRPC_FINAL {
+class VaqueroStorage final {
  public:
+  static constexpr char const* service_full_name() {
+    return "vqro.rpc.VaqueroStorage";
+  }
   class StubInterface {
    public:
     virtual ~StubInterface() {}
@@ -37,62 +42,615 @@ class VaqueroStorage GRPC_FINAL {
     std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>> AsyncWriteDatapoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>>(AsyncWriteDatapointsRaw(context, cq, tag));
     }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>> PrepareAsyncWriteDatapoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>>(PrepareAsyncWriteDatapointsRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> WriteBatches(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(WriteBatchesRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> AsyncWriteBatches(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(AsyncWriteBatchesRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> PrepareAsyncWriteBatches(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(PrepareAsyncWriteBatchesRaw(context, cq));
+    }
     std::unique_ptr< ::grpc::ClientReaderInterface< ::vqro::rpc::ReadResult>> ReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) {
       return std::unique_ptr< ::grpc::ClientReaderInterface< ::vqro::rpc::ReadResult>>(ReadDatapointsRaw(context, request));
     }
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>> AsyncReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>>(AsyncReadDatapointsRaw(context, request, cq, tag));
     }
-  private:
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>> PrepareAsyncReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>>(PrepareAsyncReadDatapointsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::vqro::rpc::SeriesHandles* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>> AsyncResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>>(AsyncResolveSeriesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>> PrepareAsyncResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>>(PrepareAsyncResolveSeriesRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void WriteDatapoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteOperation,::vqro::rpc::StatusMessage>* reactor) = 0;
+      virtual void WriteBatches(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteBatch,::vqro::rpc::StatusMessage>* reactor) = 0;
+      virtual void ReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation* request, ::grpc::ClientReadReactor< ::vqro::rpc::ReadResult>* reactor) = 0;
+      virtual void ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* WriteDatapointsRaw(::grpc::ClientContext* context) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* AsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* PrepareAsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* WriteBatchesRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* AsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* PrepareAsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientReaderInterface< ::vqro::rpc::ReadResult>* ReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>* AsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::vqro::rpc::ReadResult>* PrepareAsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>* AsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::vqro::rpc::SeriesHandles>* PrepareAsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) = 0;
   };
-  class Stub GRPC_FINAL : public StubInterface {
+  class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::Channel>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     std::unique_ptr< ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>> WriteDatapoints(::grpc::ClientContext* context) {
       return std::unique_ptr< ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>>(WriteDatapointsRaw(context));
     }
     std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>> AsyncWriteDatapoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>>(AsyncWriteDatapointsRaw(context, cq, tag));
     }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>> PrepareAsyncWriteDatapoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>>(PrepareAsyncWriteDatapointsRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> WriteBatches(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(WriteBatchesRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> AsyncWriteBatches(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(AsyncWriteBatchesRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>> PrepareAsyncWriteBatches(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>>(PrepareAsyncWriteBatchesRaw(context, cq));
+    }
     std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::ReadResult>> ReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) {
       return std::unique_ptr< ::grpc::ClientReader< ::vqro::rpc::ReadResult>>(ReadDatapointsRaw(context, request));
     }
     std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>> AsyncReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>>(AsyncReadDatapointsRaw(context, request, cq, tag));
     }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>> PrepareAsyncReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>>(PrepareAsyncReadDatapointsRaw(context, request, cq));
+    }
+    ::grpc::Status ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::vqro::rpc::SeriesHandles* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>> AsyncResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>>(AsyncResolveSeriesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>> PrepareAsyncResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>>(PrepareAsyncResolveSeriesRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void WriteDatapoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteOperation,::vqro::rpc::StatusMessage>* reactor) override;
+      void WriteBatches(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::vqro::rpc::WriteBatch,::vqro::rpc::StatusMessage>* reactor) override;
+      void ReadDatapoints(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation* request, ::grpc::ClientReadReactor< ::vqro::rpc::ReadResult>* reactor) override;
+      void ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, std::function<void(::grpc::Status)>) override;
+      void ResolveSeries(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
 
    private:
-    std::shared_ptr< ::grpc::Channel> channel_;
-    ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* WriteDatapointsRaw(::grpc::ClientContext* context) GRPC_OVERRIDE;
-    ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* AsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) GRPC_OVERRIDE;
-    ::grpc::ClientReader< ::vqro::rpc::ReadResult>* ReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) GRPC_OVERRIDE;
-    ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>* AsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) GRPC_OVERRIDE;
-    const ::grpc::RpcMethod rpcmethod_WriteDatapoints_;
-    const ::grpc::RpcMethod rpcmethod_ReadDatapoints_;
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* WriteDatapointsRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* AsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* PrepareAsyncWriteDatapointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* WriteBatchesRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* AsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* PrepareAsyncWriteBatchesRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::vqro::rpc::ReadResult>* ReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>* AsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::vqro::rpc::ReadResult>* PrepareAsyncReadDatapointsRaw(::grpc::ClientContext* context, const ::vqro::rpc::ReadOperation& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>* AsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::vqro::rpc::SeriesHandles>* PrepareAsyncResolveSeriesRaw(::grpc::ClientContext* context, const ::vqro::rpc::SeriesList& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteDatapoints_;
+    const ::grpc::internal::RpcMethod rpcmethod_WriteBatches_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReadDatapoints_;
+    const ::grpc::internal::RpcMethod rpcmethod_ResolveSeries_;
   };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::Channel>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
-  class Service : public ::grpc::SynchronousService {
+  class Service : public ::grpc::Service {
    public:
-    Service() : service_(nullptr) {}
+    Service();
     virtual ~Service();
     virtual ::grpc::Status WriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* stream);
+    virtual ::grpc::Status WriteBatches(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* stream);
     virtual ::grpc::Status ReadDatapoints(::grpc::ServerContext* context, const ::vqro::rpc::ReadOperation* request, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* writer);
-    ::grpc::RpcService* service() GRPC_OVERRIDE GRPC_FINAL;
+    virtual ::grpc::Status ResolveSeries(::grpc::ServerContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteDatapoints : public BaseClass {
    private:
-    ::grpc::RpcService* service_;
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteDatapoints() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_WriteDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteDatapoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_WriteBatches : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_WriteBatches() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_WriteBatches() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatches(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteBatches(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
-  class AsyncService GRPC_FINAL : public ::grpc::AsynchronousService {
+  template <class BaseClass>
+  class WithAsyncMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    explicit AsyncService();
-    ~AsyncService() {};
-    void RequestWriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
-    void RequestReadDatapoints(::grpc::ServerContext* context, ::vqro::rpc::ReadOperation* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::ReadResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag);
+    WithAsyncMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadDatapoints(::grpc::ServerContext* context, ::vqro::rpc::ReadOperation* request, ::grpc::ServerAsyncWriter< ::vqro::rpc::ReadResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResolveSeries(::grpc::ServerContext* context, ::vqro::rpc::SeriesList* request, ::grpc::ServerAsyncResponseWriter< ::vqro::rpc::SeriesHandles>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_WriteDatapoints<WithAsyncMethod_WriteBatches<WithAsyncMethod_ReadDatapoints<WithAsyncMethod_ResolveSeries<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_WriteDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteDatapoints() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->WriteDatapoints(context); }));
+    }
+    ~WithCallbackMethod_WriteDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteDatapoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::vqro::rpc::WriteOperation, ::vqro::rpc::StatusMessage>* WriteDatapoints(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_WriteBatches : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_WriteBatches() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->WriteBatches(context); }));
+    }
+    ~WithCallbackMethod_WriteBatches() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatches(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::vqro::rpc::WriteBatch, ::vqro::rpc::StatusMessage>* WriteBatches(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::vqro::rpc::ReadOperation, ::vqro::rpc::ReadResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::ReadOperation* request) { return this->ReadDatapoints(context, request); }));
+    }
+    ~WithCallbackMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::vqro::rpc::ReadResult>* ReadDatapoints(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::vqro::rpc::SeriesList* request, ::vqro::rpc::SeriesHandles* response) { return this->ResolveSeries(context, request, response); }));}
+    void SetMessageAllocatorFor_ResolveSeries(
+        ::grpc::MessageAllocator< ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ResolveSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_WriteDatapoints<WithCallbackMethod_WriteBatches<WithCallbackMethod_ReadDatapoints<WithCallbackMethod_ResolveSeries<Service > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_WriteDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteDatapoints() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_WriteDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteDatapoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_WriteBatches : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_WriteBatches() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_WriteBatches() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatches(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteDatapoints() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_WriteDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteDatapoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteDatapoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_WriteBatches : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_WriteBatches() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_WriteBatches() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatches(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWriteBatches(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReadDatapoints(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResolveSeries(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteDatapoints() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->WriteDatapoints(context); }));
+    }
+    ~WithRawCallbackMethod_WriteDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteDatapoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteOperation>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* WriteDatapoints(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_WriteBatches : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_WriteBatches() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->WriteBatches(context); }));
+    }
+    ~WithRawCallbackMethod_WriteBatches() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status WriteBatches(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::vqro::rpc::StatusMessage, ::vqro::rpc::WriteBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* WriteBatches(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->ReadDatapoints(context, request); }));
+    }
+    ~WithRawCallbackMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ReadDatapoints(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ResolveSeries(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ResolveSeries(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ResolveSeries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ResolveSeries() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::vqro::rpc::SeriesList, ::vqro::rpc::SeriesHandles>* streamer) {
+                       return this->StreamedResolveSeries(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ResolveSeries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ResolveSeries(::grpc::ServerContext* /*context*/, const ::vqro::rpc::SeriesList* /*request*/, ::vqro::rpc::SeriesHandles* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedResolveSeries(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::vqro::rpc::SeriesList,::vqro::rpc::SeriesHandles>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_ResolveSeries<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ReadDatapoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ReadDatapoints() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::vqro::rpc::ReadOperation, ::vqro::rpc::ReadResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::vqro::rpc::ReadOperation, ::vqro::rpc::ReadResult>* streamer) {
+                       return this->StreamedReadDatapoints(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ReadDatapoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReadDatapoints(::grpc::ServerContext* /*context*/, const ::vqro::rpc::ReadOperation* /*request*/, ::grpc::ServerWriter< ::vqro::rpc::ReadResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedReadDatapoints(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::vqro::rpc::ReadOperation,::vqro::rpc::ReadResult>* server_split_streamer) = 0;
   };
+  typedef WithSplitStreamingMethod_ReadDatapoints<Service > SplitStreamedService;
+  typedef WithSplitStreamingMethod_ReadDatapoints<WithStreamedUnaryMethod_ResolveSeries<Service > > StreamedService;
 };
 
 }  // namespace rpc
@@ -1,726 +1,1496 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: storage.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "storage.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace vqro {
 namespace rpc {
-
-namespace {
-
-const ::google::protobuf::Descriptor* WriteOperation_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  WriteOperation_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ReadOperation_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ReadOperation_reflection_ = NULL;
-struct ReadOperationOneofInstance {
-  const ::vqro::rpc::SeriesQuery* query_;
-  const ::vqro::rpc::SeriesList* list_;
-}* ReadOperation_default_oneof_instance_ = NULL;
-const ::google::protobuf::Descriptor* SeriesList_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SeriesList_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ReadResult_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ReadResult_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_storage_2eproto() {
-  protobuf_AddDesc_storage_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "storage.proto");
-  GOOGLE_CHECK(file != NULL);
-  WriteOperation_descriptor_ = file->message_type(0);
-  static const int WriteOperation_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteOperation, series_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteOperation, datapoints_),
+PROTOBUF_CONSTEXPR SeriesHandles::SeriesHandles(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.handles_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeriesHandlesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeriesHandlesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeriesHandlesDefaultTypeInternal() {}
+  union {
+    SeriesHandles _instance;
   };
-  WriteOperation_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      WriteOperation_descriptor_,
-      WriteOperation::default_instance_,
-      WriteOperation_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(WriteOperation),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteOperation, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WriteOperation, _is_default_instance_));
-  ReadOperation_descriptor_ = file->message_type(1);
-  static const int ReadOperation_offsets_[7] = {
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(ReadOperation_default_oneof_instance_, query_),
-    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(ReadOperation_default_oneof_instance_, list_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, start_time_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, end_time_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, datapoint_limit_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, prefer_latest_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, selector_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeriesHandlesDefaultTypeInternal _SeriesHandles_default_instance_;
+PROTOBUF_CONSTEXPR WriteOperation::WriteOperation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.datapoints_)*/{}
+  , /*decltype(_impl_.series_)*/nullptr
+  , /*decltype(_impl_.series_handle_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteOperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteOperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteOperationDefaultTypeInternal() {}
+  union {
+    WriteOperation _instance;
   };
-  ReadOperation_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      ReadOperation_descriptor_,
-      ReadOperation::default_instance_,
-      ReadOperation_offsets_,
-      -1,
-      -1,
-      -1,
-      ReadOperation_default_oneof_instance_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, _oneof_case_[0]),
-      sizeof(ReadOperation),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadOperation, _is_default_instance_));
-  SeriesList_descriptor_ = file->message_type(2);
-  static const int SeriesList_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesList, series_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteOperationDefaultTypeInternal _WriteOperation_default_instance_;
+PROTOBUF_CONSTEXPR WriteBatch::WriteBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.series_)*/{}
+  , /*decltype(_impl_.columns_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteBatchDefaultTypeInternal() {}
+  union {
+    WriteBatch _instance;
   };
-  SeriesList_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SeriesList_descriptor_,
-      SeriesList::default_instance_,
-      SeriesList_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(SeriesList),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesList, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SeriesList, _is_default_instance_));
-  ReadResult_descriptor_ = file->message_type(3);
-  static const int ReadResult_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadResult, series_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadResult, datapoints_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadResult, status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteBatchDefaultTypeInternal _WriteBatch_default_instance_;
+PROTOBUF_CONSTEXPR SeriesColumns::SeriesColumns(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamps_)*/{}
+  , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.durations_)*/{}
+  , /*decltype(_impl_._durations_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.series_handle_)*/uint64_t{0u}
+  , /*decltype(_impl_.series_index_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeriesColumnsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeriesColumnsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeriesColumnsDefaultTypeInternal() {}
+  union {
+    SeriesColumns _instance;
   };
-  ReadResult_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      ReadResult_descriptor_,
-      ReadResult::default_instance_,
-      ReadResult_offsets_,
-      -1,
-      -1,
-      -1,
-      sizeof(ReadResult),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadResult, _internal_metadata_),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ReadResult, _is_default_instance_));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_storage_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      WriteOperation_descriptor_, &WriteOperation::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      ReadOperation_descriptor_, &ReadOperation::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SeriesList_descriptor_, &SeriesList::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      ReadResult_descriptor_, &ReadResult::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_storage_2eproto() {
-  delete WriteOperation::default_instance_;
-  delete WriteOperation_reflection_;
-  delete ReadOperation::default_instance_;
-  delete ReadOperation_default_oneof_instance_;
-  delete ReadOperation_reflection_;
-  delete SeriesList::default_instance_;
-  delete SeriesList_reflection_;
-  delete ReadResult::default_instance_;
-  delete ReadResult_reflection_;
-}
-
-void protobuf_AddDesc_storage_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::vqro::rpc::protobuf_AddDesc_core_2eproto();
-  ::vqro::rpc::protobuf_AddDesc_search_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\rstorage.proto\022\010vqro.rpc\032\ncore.proto\032\014s"
-    "earch.proto\"[\n\016WriteOperation\022 \n\006series\030"
-    "\001 \001(\0132\020.vqro.rpc.Series\022\'\n\ndatapoints\030\002 "
-    "\003(\0132\023.vqro.rpc.Datapoint\"\277\001\n\rReadOperati"
-    "on\022&\n\005query\030\001 \001(\0132\025.vqro.rpc.SeriesQuery"
-    "H\000\022$\n\004list\030\002 \001(\0132\024.vqro.rpc.SeriesListH\000"
-    "\022\022\n\nstart_time\030\003 \001(\003\022\020\n\010end_time\030\004 \001(\003\022\027"
-    "\n\017datapoint_limit\030\005 \001(\003\022\025\n\rprefer_latest"
-    "\030\006 \001(\010B\n\n\010selector\".\n\nSeriesList\022 \n\006seri"
-    "es\030\001 \003(\0132\020.vqro.rpc.Series\"\200\001\n\nReadResul"
-    "t\022 \n\006series\030\001 \001(\0132\020.vqro.rpc.Series\022\'\n\nd"
-    "atapoints\030\002 \003(\0132\023.vqro.rpc.Datapoint\022\'\n\006"
-    "status\030\003 \001(\0132\027.vqro.rpc.StatusMessage2\235\001"
-    "\n\016VaqueroStorage\022H\n\017WriteDatapoints\022\030.vq"
-    "ro.rpc.WriteOperation\032\027.vqro.rpc.StatusM"
-    "essage(\0010\001\022A\n\016ReadDatapoints\022\027.vqro.rpc."
-    "ReadOperation\032\024.vqro.rpc.ReadResult0\001B\003\370"
-    "\001\001b\006proto3", 690);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "storage.proto", &protobuf_RegisterTypes);
-  WriteOperation::default_instance_ = new WriteOperation();
-  ReadOperation::default_instance_ = new ReadOperation();
-  ReadOperation_default_oneof_instance_ = new ReadOperationOneofInstance();
-  SeriesList::default_instance_ = new SeriesList();
-  ReadResult::default_instance_ = new ReadResult();
-  WriteOperation::default_instance_->InitAsDefaultInstance();
-  ReadOperation::default_instance_->InitAsDefaultInstance();
-  SeriesList::default_instance_->InitAsDefaultInstance();
-  ReadResult::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_storage_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_storage_2eproto {
-  StaticDescriptorInitializer_storage_2eproto() {
-    protobuf_AddDesc_storage_2eproto();
-  }
-} static_descriptor_initializer_storage_2eproto_;
-
-namespace {
-
-static void MergeFromFail(int line) GOOGLE_ATTRIBUTE_COLD;
-static void MergeFromFail(int line) {
-  GOOGLE_CHECK(false) << __FILE__ << ":" << line;
-}
-
-}  // namespace
-
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeriesColumnsDefaultTypeInternal _SeriesColumns_default_instance_;
+PROTOBUF_CONSTEXPR ReadOperation::ReadOperation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.start_time_)*/int64_t{0}
+  , /*decltype(_impl_.end_time_)*/int64_t{0}
+  , /*decltype(_impl_.datapoint_limit_)*/int64_t{0}
+  , /*decltype(_impl_.prefer_latest_)*/false
+  , /*decltype(_impl_.aggregate_)*/0
+  , /*decltype(_impl_.step_)*/int64_t{0}
+  , /*decltype(_impl_.selector_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ReadOperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadOperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadOperationDefaultTypeInternal() {}
+  union {
+    ReadOperation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadOperationDefaultTypeInternal _ReadOperation_default_instance_;
+PROTOBUF_CONSTEXPR SeriesList::SeriesList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.series_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeriesListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeriesListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeriesListDefaultTypeInternal() {}
+  union {
+    SeriesList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeriesListDefaultTypeInternal _SeriesList_default_instance_;
+PROTOBUF_CONSTEXPR ReadResult::ReadResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.datapoints_)*/{}
+  , /*decltype(_impl_.series_)*/nullptr
+  , /*decltype(_impl_.status_)*/nullptr
+  , /*decltype(_impl_.series_handle_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadResultDefaultTypeInternal() {}
+  union {
+    ReadResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadResultDefaultTypeInternal _ReadResult_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+static ::_pb::Metadata file_level_metadata_storage_2eproto[7];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_storage_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_storage_2eproto = nullptr;
+
+const uint32_t TableStruct_storage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesHandles, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesHandles, _impl_.handles_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteOperation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteOperation, _impl_.series_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteOperation, _impl_.datapoints_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteOperation, _impl_.series_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteBatch, _impl_.series_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::WriteBatch, _impl_.columns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _impl_.series_index_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _impl_.timestamps_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _impl_.durations_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesColumns, _impl_.series_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.start_time_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.end_time_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.datapoint_limit_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.prefer_latest_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.aggregate_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadOperation, _impl_.selector_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::SeriesList, _impl_.series_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadResult, _impl_.series_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadResult, _impl_.datapoints_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadResult, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::vqro::rpc::ReadResult, _impl_.series_handle_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::vqro::rpc::SeriesHandles)},
+  { 7, -1, -1, sizeof(::vqro::rpc::WriteOperation)},
+  { 16, -1, -1, sizeof(::vqro::rpc::WriteBatch)},
+  { 24, -1, -1, sizeof(::vqro::rpc::SeriesColumns)},
+  { 35, -1, -1, sizeof(::vqro::rpc::ReadOperation)},
+  { 51, -1, -1, sizeof(::vqro::rpc::SeriesList)},
+  { 58, -1, -1, sizeof(::vqro::rpc::ReadResult)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::vqro::rpc::_SeriesHandles_default_instance_._instance,
+  &::vqro::rpc::_WriteOperation_default_instance_._instance,
+  &::vqro::rpc::_WriteBatch_default_instance_._instance,
+  &::vqro::rpc::_SeriesColumns_default_instance_._instance,
+  &::vqro::rpc::_ReadOperation_default_instance_._instance,
+  &::vqro::rpc::_SeriesList_default_instance_._instance,
+  &::vqro::rpc::_ReadResult_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_storage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rstorage.proto\022\010vqro.rpc\032\ncore.proto\032\014s"
+  "earch.proto\" \n\rSeriesHandles\022\017\n\007handles\030"
+  "\001 \003(\006\"r\n\016WriteOperation\022 \n\006series\030\001 \001(\0132"
+  "\020.vqro.rpc.Series\022\'\n\ndatapoints\030\002 \003(\0132\023."
+  "vqro.rpc.Datapoint\022\025\n\rseries_handle\030\003 \001("
+  "\006\"X\n\nWriteBatch\022 \n\006series\030\001 \003(\0132\020.vqro.r"
+  "pc.Series\022(\n\007columns\030\002 \003(\0132\027.vqro.rpc.Se"
+  "riesColumns\"s\n\rSeriesColumns\022\024\n\014series_i"
+  "ndex\030\001 \001(\r\022\022\n\ntimestamps\030\002 \003(\003\022\016\n\006values"
+  "\030\003 \003(\001\022\021\n\tdurations\030\004 \003(\003\022\025\n\rseries_hand"
+  "le\030\005 \001(\006\"\353\002\n\rReadOperation\022&\n\005query\030\001 \001("
+  "\0132\025.vqro.rpc.SeriesQueryH\000\022$\n\004list\030\002 \001(\013"
+  "2\024.vqro.rpc.SeriesListH\000\022*\n\007handles\030\007 \001("
+  "\0132\027.vqro.rpc.SeriesHandlesH\000\022\022\n\nstart_ti"
+  "me\030\003 \001(\003\022\020\n\010end_time\030\004 \001(\003\022\027\n\017datapoint_"
+  "limit\030\005 \001(\003\022\025\n\rprefer_latest\030\006 \001(\010\022\014\n\004st"
+  "ep\030\010 \001(\003\0224\n\taggregate\030\t \001(\0162!.vqro.rpc.R"
+  "eadOperation.Aggregate\":\n\tAggregate\022\007\n\003A"
+  "VG\020\000\022\007\n\003MIN\020\001\022\007\n\003MAX\020\002\022\007\n\003SUM\020\003\022\t\n\005COUNT"
+  "\020\004B\n\n\010selector\".\n\nSeriesList\022 \n\006series\030\001"
+  " \003(\0132\020.vqro.rpc.Series\"\227\001\n\nReadResult\022 \n"
+  "\006series\030\001 \001(\0132\020.vqro.rpc.Series\022\'\n\ndatap"
+  "oints\030\002 \003(\0132\023.vqro.rpc.Datapoint\022\'\n\006stat"
+  "us\030\003 \001(\0132\027.vqro.rpc.StatusMessage\022\025\n\rser"
+  "ies_handle\030\004 \001(\0062\240\002\n\016VaqueroStorage\022H\n\017W"
+  "riteDatapoints\022\030.vqro.rpc.WriteOperation"
+  "\032\027.vqro.rpc.StatusMessage(\0010\001\022A\n\014WriteBa"
+  "tches\022\024.vqro.rpc.WriteBatch\032\027.vqro.rpc.S"
+  "tatusMessage(\0010\001\022A\n\016ReadDatapoints\022\027.vqr"
+  "o.rpc.ReadOperation\032\024.vqro.rpc.ReadResul"
+  "t0\001\022>\n\rResolveSeries\022\024.vqro.rpc.SeriesLi"
+  "st\032\027.vqro.rpc.SeriesHandlesB\003\370\001\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_storage_2eproto_deps[2] = {
+  &::descriptor_table_core_2eproto,
+  &::descriptor_table_search_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_storage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_storage_2eproto = {
+    false, false, 1280, descriptor_table_protodef_storage_2eproto,
+    "storage.proto",
+    &descriptor_table_storage_2eproto_once, descriptor_table_storage_2eproto_deps, 2, 7,
+    schemas, file_default_instances, TableStruct_storage_2eproto::offsets,
+    file_level_metadata_storage_2eproto, file_level_enum_descriptors_storage_2eproto,
+    file_level_service_descriptors_storage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_storage_2eproto_getter() {
+  return &descriptor_table_storage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_storage_2eproto(&descriptor_table_storage_2eproto);
+namespace vqro {
+namespace rpc {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReadOperation_Aggregate_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_storage_2eproto);
+  return file_level_enum_descriptors_storage_2eproto[0];
+}
+bool ReadOperation_Aggregate_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReadOperation_Aggregate ReadOperation::AVG;
+constexpr ReadOperation_Aggregate ReadOperation::MIN;
+constexpr ReadOperation_Aggregate ReadOperation::MAX;
+constexpr ReadOperation_Aggregate ReadOperation::SUM;
+constexpr ReadOperation_Aggregate ReadOperation::COUNT;
+constexpr ReadOperation_Aggregate ReadOperation::Aggregate_MIN;
+constexpr ReadOperation_Aggregate ReadOperation::Aggregate_MAX;
+constexpr int ReadOperation::Aggregate_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void WriteOperation::_slow_mutable_series() {
-  series_ = ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::Series >(
-        GetArenaNoVirtual());
-}
-::vqro::rpc::Series* WriteOperation::_slow_release_series() {
-  if (series_ == NULL) {
-    return NULL;
-  } else {
-    ::vqro::rpc::Series* temp = new ::vqro::rpc::Series;
-    temp->MergeFrom(*series_);
-    series_ = NULL;
-    return temp;
-  }
-}
-::vqro::rpc::Series* WriteOperation::unsafe_arena_release_series() {
-  
-  ::vqro::rpc::Series* temp = series_;
-  series_ = NULL;
-  return temp;
-}
-void WriteOperation::_slow_set_allocated_series(
-    ::google::protobuf::Arena* message_arena, ::vqro::rpc::Series** series) {
-    if (message_arena != NULL && 
-        ::google::protobuf::Arena::GetArena(*series) == NULL) {
-      message_arena->Own(*series);
-    } else if (message_arena !=
-               ::google::protobuf::Arena::GetArena(*series)) {
-      ::vqro::rpc::Series* new_series = 
-            ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::Series >(
-            message_arena);
-      new_series->CopyFrom(**series);
-      *series = new_series;
+class SeriesHandles::_Internal {
+ public:
+};
+
+SeriesHandles::SeriesHandles(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vqro.rpc.SeriesHandles)
+}
+SeriesHandles::SeriesHandles(const SeriesHandles& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SeriesHandles* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.handles_){from._impl_.handles_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:vqro.rpc.SeriesHandles)
+}
+
+inline void SeriesHandles::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.handles_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SeriesHandles::~SeriesHandles() {
+  // @@protoc_insertion_point(destructor:vqro.rpc.SeriesHandles)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SeriesHandles::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.handles_.~RepeatedField();
+}
+
+void SeriesHandles::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SeriesHandles::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SeriesHandles)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.handles_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SeriesHandles::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated fixed64 handles = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_handles(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 9) {
+          _internal_add_handles(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-void WriteOperation::unsafe_arena_set_allocated_series(
-    ::vqro::rpc::Series* series) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete series_;
+
+uint8_t* SeriesHandles::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SeriesHandles)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed64 handles = 1;
+  if (this->_internal_handles_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_handles(), target);
   }
-  series_ = series;
-  if (series) {
-    
-  } else {
-    
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.WriteOperation.series)
+  // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SeriesHandles)
+  return target;
 }
-#ifndef _MSC_VER
-const int WriteOperation::kSeriesFieldNumber;
-const int WriteOperation::kDatapointsFieldNumber;
-#endif  // !_MSC_VER
 
-WriteOperation::WriteOperation()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.WriteOperation)
-}
+size_t SeriesHandles::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SeriesHandles)
+  size_t total_size = 0;
 
-WriteOperation::WriteOperation(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  datapoints_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:vqro.rpc.WriteOperation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 handles = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_handles_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WriteOperation::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  series_ = const_cast< ::vqro::rpc::Series*>(&::vqro::rpc::Series::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeriesHandles::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SeriesHandles::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeriesHandles::GetClassData() const { return &_class_data_; }
+
+
+void SeriesHandles::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeriesHandles*>(&to_msg);
+  auto& from = static_cast<const SeriesHandles&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SeriesHandles)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.handles_.MergeFrom(from._impl_.handles_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-WriteOperation::WriteOperation(const WriteOperation& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
+void SeriesHandles::CopyFrom(const SeriesHandles& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SeriesHandles)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:vqro.rpc.WriteOperation)
 }
 
-void WriteOperation::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  series_ = NULL;
+bool SeriesHandles::IsInitialized() const {
+  return true;
 }
 
-WriteOperation::~WriteOperation() {
-  // @@protoc_insertion_point(destructor:vqro.rpc.WriteOperation)
-  SharedDtor();
+void SeriesHandles::InternalSwap(SeriesHandles* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.handles_.InternalSwap(&other->_impl_.handles_);
 }
 
-void WriteOperation::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
-    return;
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata SeriesHandles::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[0]);
+}
+
+// ===================================================================
 
-  if (this != default_instance_) {
-    delete series_;
+class WriteOperation::_Internal {
+ public:
+  static const ::vqro::rpc::Series& series(const WriteOperation* msg);
+};
+
+const ::vqro::rpc::Series&
+WriteOperation::_Internal::series(const WriteOperation* msg) {
+  return *msg->_impl_.series_;
+}
+void WriteOperation::clear_series() {
+  if (GetArenaForAllocation() == nullptr && _impl_.series_ != nullptr) {
+    delete _impl_.series_;
   }
+  _impl_.series_ = nullptr;
 }
-
-void WriteOperation::ArenaDtor(void* object) {
-  WriteOperation* _this = reinterpret_cast< WriteOperation* >(object);
-  (void)_this;
+void WriteOperation::clear_datapoints() {
+  _impl_.datapoints_.Clear();
 }
-void WriteOperation::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+WriteOperation::WriteOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vqro.rpc.WriteOperation)
 }
-void WriteOperation::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+WriteOperation::WriteOperation(const WriteOperation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteOperation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datapoints_){from._impl_.datapoints_}
+    , decltype(_impl_.series_){nullptr}
+    , decltype(_impl_.series_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_series()) {
+    _this->_impl_.series_ = new ::vqro::rpc::Series(*from._impl_.series_);
+  }
+  _this->_impl_.series_handle_ = from._impl_.series_handle_;
+  // @@protoc_insertion_point(copy_constructor:vqro.rpc.WriteOperation)
 }
-const ::google::protobuf::Descriptor* WriteOperation::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return WriteOperation_descriptor_;
+
+inline void WriteOperation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datapoints_){arena}
+    , decltype(_impl_.series_){nullptr}
+    , decltype(_impl_.series_handle_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-const WriteOperation& WriteOperation::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_storage_2eproto();
-  return *default_instance_;
+WriteOperation::~WriteOperation() {
+  // @@protoc_insertion_point(destructor:vqro.rpc.WriteOperation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-WriteOperation* WriteOperation::default_instance_ = NULL;
+inline void WriteOperation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.datapoints_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.series_;
+}
 
-WriteOperation* WriteOperation::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<WriteOperation>(arena);
+void WriteOperation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void WriteOperation::Clear() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
-  datapoints_.Clear();
-}
-
-bool WriteOperation::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.WriteOperation)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .vqro.rpc.Series series = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_series()));
-        } else {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.WriteOperation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.datapoints_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.series_ != nullptr) {
+    delete _impl_.series_;
+  }
+  _impl_.series_ = nullptr;
+  _impl_.series_handle_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteOperation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .vqro.rpc.Series series = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_series(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_datapoints;
-        break;
-      }
-
+        continue;
       // repeated .vqro.rpc.Datapoint datapoints = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_datapoints:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_datapoints()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_datapoints(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_datapoints;
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // fixed64 series_handle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.series_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.WriteOperation)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.WriteOperation)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void WriteOperation::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.WriteOperation)
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *this->series_, output);
+uint8_t* WriteOperation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.WriteOperation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .vqro.rpc.Series series = 1;
+  if (this->_internal_has_series()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::series(this),
+        _Internal::series(this).GetCachedSize(), target, stream);
   }
 
   // repeated .vqro.rpc.Datapoint datapoints = 2;
-  for (unsigned int i = 0, n = this->datapoints_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->datapoints(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_datapoints_size()); i < n; i++) {
+    const auto& repfield = this->_internal_datapoints(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.WriteOperation)
-}
-
-::google::protobuf::uint8* WriteOperation::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.WriteOperation)
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, *this->series_, target);
+  // fixed64 series_handle = 3;
+  if (this->_internal_series_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_series_handle(), target);
   }
 
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  for (unsigned int i = 0, n = this->datapoints_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->datapoints(i), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.WriteOperation)
   return target;
 }
 
-int WriteOperation::ByteSize() const {
-  int total_size = 0;
+size_t WriteOperation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.WriteOperation)
+  size_t total_size = 0;
 
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->series_);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .vqro.rpc.Datapoint datapoints = 2;
-  total_size += 1 * this->datapoints_size();
-  for (int i = 0; i < this->datapoints_size(); i++) {
+  total_size += 1UL * this->_internal_datapoints_size();
+  for (const auto& msg : this->_impl_.datapoints_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->datapoints(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void WriteOperation::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const WriteOperation* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const WriteOperation*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // .vqro.rpc.Series series = 1;
+  if (this->_internal_has_series()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.series_);
   }
-}
 
-void WriteOperation::MergeFrom(const WriteOperation& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  datapoints_.MergeFrom(from.datapoints_);
-  if (from.has_series()) {
-    mutable_series()->::vqro::rpc::Series::MergeFrom(from.series());
+  // fixed64 series_handle = 3;
+  if (this->_internal_series_handle() != 0) {
+    total_size += 1 + 8;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WriteOperation::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteOperation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteOperation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteOperation::GetClassData() const { return &_class_data_; }
+
+
+void WriteOperation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteOperation*>(&to_msg);
+  auto& from = static_cast<const WriteOperation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.WriteOperation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.datapoints_.MergeFrom(from._impl_.datapoints_);
+  if (from._internal_has_series()) {
+    _this->_internal_mutable_series()->::vqro::rpc::Series::MergeFrom(
+        from._internal_series());
+  }
+  if (from._internal_series_handle() != 0) {
+    _this->_internal_set_series_handle(from._internal_series_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void WriteOperation::CopyFrom(const WriteOperation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.WriteOperation)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool WriteOperation::IsInitialized() const {
-
   return true;
 }
 
-void WriteOperation::Swap(WriteOperation* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    WriteOperation temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void WriteOperation::UnsafeArenaSwap(WriteOperation* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void WriteOperation::InternalSwap(WriteOperation* other) {
-  std::swap(series_, other->series_);
-  datapoints_.UnsafeArenaSwap(&other->datapoints_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.datapoints_.InternalSwap(&other->_impl_.datapoints_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteOperation, _impl_.series_handle_)
+      + sizeof(WriteOperation::_impl_.series_handle_)
+      - PROTOBUF_FIELD_OFFSET(WriteOperation, _impl_.series_)>(
+          reinterpret_cast<char*>(&_impl_.series_),
+          reinterpret_cast<char*>(&other->_impl_.series_));
 }
 
-::google::protobuf::Metadata WriteOperation::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = WriteOperation_descriptor_;
-  metadata.reflection = WriteOperation_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata WriteOperation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[1]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// WriteOperation
+// ===================================================================
 
-// optional .vqro.rpc.Series series = 1;
- bool WriteOperation::has_series() const {
-  return !_is_default_instance_ && series_ != NULL;
+class WriteBatch::_Internal {
+ public:
+};
+
+void WriteBatch::clear_series() {
+  _impl_.series_.Clear();
+}
+WriteBatch::WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vqro.rpc.WriteBatch)
+}
+WriteBatch::WriteBatch(const WriteBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){from._impl_.series_}
+    , decltype(_impl_.columns_){from._impl_.columns_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:vqro.rpc.WriteBatch)
+}
+
+inline void WriteBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){arena}
+    , decltype(_impl_.columns_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteBatch::~WriteBatch() {
+  // @@protoc_insertion_point(destructor:vqro.rpc.WriteBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- void WriteOperation::clear_series() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
+
+inline void WriteBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.series_.~RepeatedPtrField();
+  _impl_.columns_.~RepeatedPtrField();
 }
- const ::vqro::rpc::Series& WriteOperation::series() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.series)
-  return series_ != NULL ? *series_ : *default_instance_->series_;
+
+void WriteBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
- ::vqro::rpc::Series* WriteOperation::mutable_series() {
-  
-  if (series_ == NULL) {
-    _slow_mutable_series();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.series)
-  return series_;
+
+void WriteBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.series_.Clear();
+  _impl_.columns_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
- ::vqro::rpc::Series* WriteOperation::release_series() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_series();
-  } else {
-    ::vqro::rpc::Series* temp = series_;
-    series_ = NULL;
-    return temp;
-  }
+
+const char* WriteBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .vqro.rpc.Series series = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_series(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .vqro.rpc.SeriesColumns columns = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_columns(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
- void WriteOperation::set_allocated_series(::vqro::rpc::Series* series) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete series_;
+
+uint8_t* WriteBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .vqro.rpc.Series series = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_series_size()); i < n; i++) {
+    const auto& repfield = this->_internal_series(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (series != NULL) {
-    _slow_set_allocated_series(message_arena, &series);
+
+  // repeated .vqro.rpc.SeriesColumns columns = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_columns_size()); i < n; i++) {
+    const auto& repfield = this->_internal_columns(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  series_ = series;
-  if (series) {
-    
-  } else {
-    
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.WriteOperation.series)
+  // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.WriteBatch)
+  return target;
 }
 
-// repeated .vqro.rpc.Datapoint datapoints = 2;
- int WriteOperation::datapoints_size() const {
-  return datapoints_.size();
+size_t WriteBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.WriteBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .vqro.rpc.Series series = 1;
+  total_size += 1UL * this->_internal_series_size();
+  for (const auto& msg : this->_impl_.series_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .vqro.rpc.SeriesColumns columns = 2;
+  total_size += 1UL * this->_internal_columns_size();
+  for (const auto& msg : this->_impl_.columns_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
- void WriteOperation::clear_datapoints() {
-  datapoints_.Clear();
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteBatch::GetClassData() const { return &_class_data_; }
+
+
+void WriteBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteBatch*>(&to_msg);
+  auto& from = static_cast<const WriteBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.WriteBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.series_.MergeFrom(from._impl_.series_);
+  _this->_impl_.columns_.MergeFrom(from._impl_.columns_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
- const ::vqro::rpc::Datapoint& WriteOperation::datapoints(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Get(index);
+
+void WriteBatch::CopyFrom(const WriteBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.WriteBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
- ::vqro::rpc::Datapoint* WriteOperation::mutable_datapoints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Mutable(index);
+
+bool WriteBatch::IsInitialized() const {
+  return true;
 }
- ::vqro::rpc::Datapoint* WriteOperation::add_datapoints() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Add();
+
+void WriteBatch::InternalSwap(WriteBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.series_.InternalSwap(&other->_impl_.series_);
+  _impl_.columns_.InternalSwap(&other->_impl_.columns_);
 }
- const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
-WriteOperation::datapoints() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_;
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[2]);
 }
- ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
-WriteOperation::mutable_datapoints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.WriteOperation.datapoints)
-  return &datapoints_;
+
+// ===================================================================
+
+class SeriesColumns::_Internal {
+ public:
+};
+
+SeriesColumns::SeriesColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vqro.rpc.SeriesColumns)
+}
+SeriesColumns::SeriesColumns(const SeriesColumns& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SeriesColumns* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamps_){from._impl_.timestamps_}
+    , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
+    , decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.durations_){from._impl_.durations_}
+    , /*decltype(_impl_._durations_cached_byte_size_)*/{0}
+    , decltype(_impl_.series_handle_){}
+    , decltype(_impl_.series_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.series_handle_, &from._impl_.series_handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.series_index_) -
+    reinterpret_cast<char*>(&_impl_.series_handle_)) + sizeof(_impl_.series_index_));
+  // @@protoc_insertion_point(copy_constructor:vqro.rpc.SeriesColumns)
+}
+
+inline void SeriesColumns::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamps_){arena}
+    , /*decltype(_impl_._timestamps_cached_byte_size_)*/{0}
+    , decltype(_impl_.values_){arena}
+    , decltype(_impl_.durations_){arena}
+    , /*decltype(_impl_._durations_cached_byte_size_)*/{0}
+    , decltype(_impl_.series_handle_){uint64_t{0u}}
+    , decltype(_impl_.series_index_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+SeriesColumns::~SeriesColumns() {
+  // @@protoc_insertion_point(destructor:vqro.rpc.SeriesColumns)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-// ===================================================================
+inline void SeriesColumns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.timestamps_.~RepeatedField();
+  _impl_.values_.~RepeatedField();
+  _impl_.durations_.~RepeatedField();
+}
+
+void SeriesColumns::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SeriesColumns::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SeriesColumns)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.timestamps_.Clear();
+  _impl_.values_.Clear();
+  _impl_.durations_.Clear();
+  ::memset(&_impl_.series_handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.series_index_) -
+      reinterpret_cast<char*>(&_impl_.series_handle_)) + sizeof(_impl_.series_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SeriesColumns::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 series_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.series_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 timestamps = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_timestamps(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_timestamps(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_values(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 25) {
+          _internal_add_values(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 durations = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_durations(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_durations(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed64 series_handle = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.series_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-#ifndef _MSC_VER
-const int ReadOperation::kQueryFieldNumber;
-const int ReadOperation::kListFieldNumber;
-const int ReadOperation::kStartTimeFieldNumber;
-const int ReadOperation::kEndTimeFieldNumber;
-const int ReadOperation::kDatapointLimitFieldNumber;
-const int ReadOperation::kPreferLatestFieldNumber;
-#endif  // !_MSC_VER
-
-ReadOperation::ReadOperation()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.ReadOperation)
-}
-
-ReadOperation::ReadOperation(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:vqro.rpc.ReadOperation)
+uint8_t* SeriesColumns::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SeriesColumns)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 series_index = 1;
+  if (this->_internal_series_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_series_index(), target);
+  }
+
+  // repeated int64 timestamps = 2;
+  {
+    int byte_size = _impl_._timestamps_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          2, _internal_timestamps(), byte_size, target);
+    }
+  }
+
+  // repeated double values = 3;
+  if (this->_internal_values_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_values(), target);
+  }
+
+  // repeated int64 durations = 4;
+  {
+    int byte_size = _impl_._durations_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          4, _internal_durations(), byte_size, target);
+    }
+  }
+
+  // fixed64 series_handle = 5;
+  if (this->_internal_series_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_series_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SeriesColumns)
+  return target;
+}
+
+size_t SeriesColumns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SeriesColumns)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 timestamps = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.timestamps_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._timestamps_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double values = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_values_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int64 durations = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.durations_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._durations_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // fixed64 series_handle = 5;
+  if (this->_internal_series_handle() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 series_index = 1;
+  if (this->_internal_series_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_series_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ReadOperation::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  ReadOperation_default_oneof_instance_->query_ = const_cast< ::vqro::rpc::SeriesQuery*>(&::vqro::rpc::SeriesQuery::default_instance());
-  ReadOperation_default_oneof_instance_->list_ = const_cast< ::vqro::rpc::SeriesList*>(&::vqro::rpc::SeriesList::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeriesColumns::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SeriesColumns::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeriesColumns::GetClassData() const { return &_class_data_; }
+
+
+void SeriesColumns::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeriesColumns*>(&to_msg);
+  auto& from = static_cast<const SeriesColumns&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SeriesColumns)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.timestamps_.MergeFrom(from._impl_.timestamps_);
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  _this->_impl_.durations_.MergeFrom(from._impl_.durations_);
+  if (from._internal_series_handle() != 0) {
+    _this->_internal_set_series_handle(from._internal_series_handle());
+  }
+  if (from._internal_series_index() != 0) {
+    _this->_internal_set_series_index(from._internal_series_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-ReadOperation::ReadOperation(const ReadOperation& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
+void SeriesColumns::CopyFrom(const SeriesColumns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SeriesColumns)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:vqro.rpc.ReadOperation)
 }
 
-void ReadOperation::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  start_time_ = GOOGLE_LONGLONG(0);
-  end_time_ = GOOGLE_LONGLONG(0);
-  datapoint_limit_ = GOOGLE_LONGLONG(0);
-  prefer_latest_ = false;
-  clear_has_selector();
+bool SeriesColumns::IsInitialized() const {
+  return true;
 }
 
-ReadOperation::~ReadOperation() {
-  // @@protoc_insertion_point(destructor:vqro.rpc.ReadOperation)
-  SharedDtor();
+void SeriesColumns::InternalSwap(SeriesColumns* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.timestamps_.InternalSwap(&other->_impl_.timestamps_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+  _impl_.durations_.InternalSwap(&other->_impl_.durations_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SeriesColumns, _impl_.series_index_)
+      + sizeof(SeriesColumns::_impl_.series_index_)
+      - PROTOBUF_FIELD_OFFSET(SeriesColumns, _impl_.series_handle_)>(
+          reinterpret_cast<char*>(&_impl_.series_handle_),
+          reinterpret_cast<char*>(&other->_impl_.series_handle_));
 }
 
-void ReadOperation::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
-    return;
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata SeriesColumns::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[3]);
+}
 
-  if (has_selector()) {
-    clear_selector();
+// ===================================================================
+
+class ReadOperation::_Internal {
+ public:
+  static const ::vqro::rpc::SeriesQuery& query(const ReadOperation* msg);
+  static const ::vqro::rpc::SeriesList& list(const ReadOperation* msg);
+  static const ::vqro::rpc::SeriesHandles& handles(const ReadOperation* msg);
+};
+
+const ::vqro::rpc::SeriesQuery&
+ReadOperation::_Internal::query(const ReadOperation* msg) {
+  return *msg->_impl_.selector_.query_;
+}
+const ::vqro::rpc::SeriesList&
+ReadOperation::_Internal::list(const ReadOperation* msg) {
+  return *msg->_impl_.selector_.list_;
+}
+const ::vqro::rpc::SeriesHandles&
+ReadOperation::_Internal::handles(const ReadOperation* msg) {
+  return *msg->_impl_.selector_.handles_;
+}
+void ReadOperation::set_allocated_query(::vqro::rpc::SeriesQuery* query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_selector();
+  if (query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(query));
+    if (message_arena != submessage_arena) {
+      query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, query, submessage_arena);
+    }
+    set_has_query();
+    _impl_.selector_.query_ = query;
   }
-  if (this != default_instance_) {
+  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.query)
+}
+void ReadOperation::clear_query() {
+  if (_internal_has_query()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.selector_.query_;
+    }
+    clear_has_selector();
   }
 }
-
-void ReadOperation::ArenaDtor(void* object) {
-  ReadOperation* _this = reinterpret_cast< ReadOperation* >(object);
-  (void)_this;
+void ReadOperation::set_allocated_list(::vqro::rpc::SeriesList* list) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_selector();
+  if (list) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list);
+    if (message_arena != submessage_arena) {
+      list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list, submessage_arena);
+    }
+    set_has_list();
+    _impl_.selector_.list_ = list;
+  }
+  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.list)
+}
+void ReadOperation::set_allocated_handles(::vqro::rpc::SeriesHandles* handles) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_selector();
+  if (handles) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(handles);
+    if (message_arena != submessage_arena) {
+      handles = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, handles, submessage_arena);
+    }
+    set_has_handles();
+    _impl_.selector_.handles_ = handles;
+  }
+  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.handles)
 }
-void ReadOperation::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+ReadOperation::ReadOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:vqro.rpc.ReadOperation)
 }
-void ReadOperation::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+ReadOperation::ReadOperation(const ReadOperation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadOperation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_time_){}
+    , decltype(_impl_.end_time_){}
+    , decltype(_impl_.datapoint_limit_){}
+    , decltype(_impl_.prefer_latest_){}
+    , decltype(_impl_.aggregate_){}
+    , decltype(_impl_.step_){}
+    , decltype(_impl_.selector_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_time_, &from._impl_.start_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_) -
+    reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.step_));
+  clear_has_selector();
+  switch (from.selector_case()) {
+    case kQuery: {
+      _this->_internal_mutable_query()->::vqro::rpc::SeriesQuery::MergeFrom(
+          from._internal_query());
+      break;
+    }
+    case kList: {
+      _this->_internal_mutable_list()->::vqro::rpc::SeriesList::MergeFrom(
+          from._internal_list());
+      break;
+    }
+    case kHandles: {
+      _this->_internal_mutable_handles()->::vqro::rpc::SeriesHandles::MergeFrom(
+          from._internal_handles());
+      break;
+    }
+    case SELECTOR_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:vqro.rpc.ReadOperation)
 }
-const ::google::protobuf::Descriptor* ReadOperation::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ReadOperation_descriptor_;
+
+inline void ReadOperation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_time_){int64_t{0}}
+    , decltype(_impl_.end_time_){int64_t{0}}
+    , decltype(_impl_.datapoint_limit_){int64_t{0}}
+    , decltype(_impl_.prefer_latest_){false}
+    , decltype(_impl_.aggregate_){0}
+    , decltype(_impl_.step_){int64_t{0}}
+    , decltype(_impl_.selector_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_selector();
 }
 
-const ReadOperation& ReadOperation::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_storage_2eproto();
-  return *default_instance_;
+ReadOperation::~ReadOperation() {
+  // @@protoc_insertion_point(destructor:vqro.rpc.ReadOperation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-ReadOperation* ReadOperation::default_instance_ = NULL;
+inline void ReadOperation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_selector()) {
+    clear_selector();
+  }
+}
 
-ReadOperation* ReadOperation::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<ReadOperation>(arena);
+void ReadOperation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void ReadOperation::clear_selector() {
-  switch(selector_case()) {
+// @@protoc_insertion_point(one_of_clear_start:vqro.rpc.ReadOperation)
+  switch (selector_case()) {
     case kQuery: {
-      if (GetArenaNoVirtual() == NULL) {
-        delete selector_.query_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.selector_.query_;
       }
       break;
     }
     case kList: {
-      if (GetArenaNoVirtual() == NULL) {
-        delete selector_.list_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.selector_.list_;
+      }
+      break;
+    }
+    case kHandles: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.selector_.handles_;
       }
       break;
     }
@@ -728,1425 +1498,886 @@ void ReadOperation::clear_selector() {
       break;
     }
   }
-  _oneof_case_[0] = SELECTOR_NOT_SET;
+  _impl_._oneof_case_[0] = SELECTOR_NOT_SET;
 }
 
 
 void ReadOperation::Clear() {
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<ReadOperation*>(16)->f)
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(start_time_, prefer_latest_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.ReadOperation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.start_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.step_) -
+      reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.step_));
   clear_selector();
-}
-
-bool ReadOperation::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.ReadOperation)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .vqro.rpc.SeriesQuery query = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_query()));
-        } else {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadOperation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .vqro.rpc.SeriesQuery query = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_query(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_list;
-        break;
-      }
-
-      // optional .vqro.rpc.SeriesList list = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_list:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list()));
-        } else {
+        continue;
+      // .vqro.rpc.SeriesList list = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_start_time;
-        break;
-      }
-
-      // optional int64 start_time = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_start_time:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &start_time_)));
-
-        } else {
+        continue;
+      // int64 start_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.start_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_end_time;
-        break;
-      }
-
-      // optional int64 end_time = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_end_time:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &end_time_)));
-
-        } else {
+        continue;
+      // int64 end_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.end_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_datapoint_limit;
-        break;
-      }
-
-      // optional int64 datapoint_limit = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_datapoint_limit:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &datapoint_limit_)));
-
-        } else {
+        continue;
+      // int64 datapoint_limit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.datapoint_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_prefer_latest;
-        break;
-      }
-
-      // optional bool prefer_latest = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_prefer_latest:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &prefer_latest_)));
-
-        } else {
+        continue;
+      // bool prefer_latest = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.prefer_latest_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // .vqro.rpc.SeriesHandles handles = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_handles(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 step = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.step_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .vqro.rpc.ReadOperation.Aggregate aggregate = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_aggregate(static_cast<::vqro::rpc::ReadOperation_Aggregate>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.ReadOperation)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.ReadOperation)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ReadOperation::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.ReadOperation)
-  // optional .vqro.rpc.SeriesQuery query = 1;
-  if (has_query()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *selector_.query_, output);
-  }
+uint8_t* ReadOperation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.ReadOperation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional .vqro.rpc.SeriesList list = 2;
-  if (has_list()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *selector_.list_, output);
+  // .vqro.rpc.SeriesQuery query = 1;
+  if (_internal_has_query()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::query(this),
+        _Internal::query(this).GetCachedSize(), target, stream);
   }
 
-  // optional int64 start_time = 3;
-  if (this->start_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->start_time(), output);
+  // .vqro.rpc.SeriesList list = 2;
+  if (_internal_has_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::list(this),
+        _Internal::list(this).GetCachedSize(), target, stream);
   }
 
-  // optional int64 end_time = 4;
-  if (this->end_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->end_time(), output);
+  // int64 start_time = 3;
+  if (this->_internal_start_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_start_time(), target);
   }
 
-  // optional int64 datapoint_limit = 5;
-  if (this->datapoint_limit() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->datapoint_limit(), output);
+  // int64 end_time = 4;
+  if (this->_internal_end_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_end_time(), target);
   }
 
-  // optional bool prefer_latest = 6;
-  if (this->prefer_latest() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->prefer_latest(), output);
+  // int64 datapoint_limit = 5;
+  if (this->_internal_datapoint_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_datapoint_limit(), target);
   }
 
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.ReadOperation)
-}
-
-::google::protobuf::uint8* ReadOperation::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.ReadOperation)
-  // optional .vqro.rpc.SeriesQuery query = 1;
-  if (has_query()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, *selector_.query_, target);
+  // bool prefer_latest = 6;
+  if (this->_internal_prefer_latest() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_prefer_latest(), target);
   }
 
-  // optional .vqro.rpc.SeriesList list = 2;
-  if (has_list()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, *selector_.list_, target);
+  // .vqro.rpc.SeriesHandles handles = 7;
+  if (_internal_has_handles()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::handles(this),
+        _Internal::handles(this).GetCachedSize(), target, stream);
   }
 
-  // optional int64 start_time = 3;
-  if (this->start_time() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->start_time(), target);
+  // int64 step = 8;
+  if (this->_internal_step() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_step(), target);
   }
 
-  // optional int64 end_time = 4;
-  if (this->end_time() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->end_time(), target);
+  // .vqro.rpc.ReadOperation.Aggregate aggregate = 9;
+  if (this->_internal_aggregate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_aggregate(), target);
   }
 
-  // optional int64 datapoint_limit = 5;
-  if (this->datapoint_limit() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->datapoint_limit(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
-  // optional bool prefer_latest = 6;
-  if (this->prefer_latest() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->prefer_latest(), target);
-  }
-
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.ReadOperation)
   return target;
 }
 
-int ReadOperation::ByteSize() const {
-  int total_size = 0;
+size_t ReadOperation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.ReadOperation)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int64 start_time = 3;
-  if (this->start_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->start_time());
+  // int64 start_time = 3;
+  if (this->_internal_start_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_start_time());
   }
 
-  // optional int64 end_time = 4;
-  if (this->end_time() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->end_time());
+  // int64 end_time = 4;
+  if (this->_internal_end_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_end_time());
   }
 
-  // optional int64 datapoint_limit = 5;
-  if (this->datapoint_limit() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->datapoint_limit());
+  // int64 datapoint_limit = 5;
+  if (this->_internal_datapoint_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_datapoint_limit());
   }
 
-  // optional bool prefer_latest = 6;
-  if (this->prefer_latest() != 0) {
+  // bool prefer_latest = 6;
+  if (this->_internal_prefer_latest() != 0) {
     total_size += 1 + 1;
   }
 
+  // .vqro.rpc.ReadOperation.Aggregate aggregate = 9;
+  if (this->_internal_aggregate() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_aggregate());
+  }
+
+  // int64 step = 8;
+  if (this->_internal_step() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_step());
+  }
+
   switch (selector_case()) {
-    // optional .vqro.rpc.SeriesQuery query = 1;
+    // .vqro.rpc.SeriesQuery query = 1;
     case kQuery: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *selector_.query_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.selector_.query_);
       break;
     }
-    // optional .vqro.rpc.SeriesList list = 2;
+    // .vqro.rpc.SeriesList list = 2;
     case kList: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          *selector_.list_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.selector_.list_);
+      break;
+    }
+    // .vqro.rpc.SeriesHandles handles = 7;
+    case kHandles: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.selector_.handles_);
       break;
     }
     case SELECTOR_NOT_SET: {
       break;
     }
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ReadOperation::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const ReadOperation* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadOperation*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadOperation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadOperation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadOperation::GetClassData() const { return &_class_data_; }
+
 
-void ReadOperation::MergeFrom(const ReadOperation& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
+void ReadOperation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadOperation*>(&to_msg);
+  auto& from = static_cast<const ReadOperation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.ReadOperation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_start_time() != 0) {
+    _this->_internal_set_start_time(from._internal_start_time());
+  }
+  if (from._internal_end_time() != 0) {
+    _this->_internal_set_end_time(from._internal_end_time());
+  }
+  if (from._internal_datapoint_limit() != 0) {
+    _this->_internal_set_datapoint_limit(from._internal_datapoint_limit());
+  }
+  if (from._internal_prefer_latest() != 0) {
+    _this->_internal_set_prefer_latest(from._internal_prefer_latest());
+  }
+  if (from._internal_aggregate() != 0) {
+    _this->_internal_set_aggregate(from._internal_aggregate());
+  }
+  if (from._internal_step() != 0) {
+    _this->_internal_set_step(from._internal_step());
+  }
   switch (from.selector_case()) {
     case kQuery: {
-      mutable_query()->::vqro::rpc::SeriesQuery::MergeFrom(from.query());
+      _this->_internal_mutable_query()->::vqro::rpc::SeriesQuery::MergeFrom(
+          from._internal_query());
       break;
     }
     case kList: {
-      mutable_list()->::vqro::rpc::SeriesList::MergeFrom(from.list());
+      _this->_internal_mutable_list()->::vqro::rpc::SeriesList::MergeFrom(
+          from._internal_list());
+      break;
+    }
+    case kHandles: {
+      _this->_internal_mutable_handles()->::vqro::rpc::SeriesHandles::MergeFrom(
+          from._internal_handles());
       break;
     }
     case SELECTOR_NOT_SET: {
       break;
     }
   }
-  if (from.start_time() != 0) {
-    set_start_time(from.start_time());
-  }
-  if (from.end_time() != 0) {
-    set_end_time(from.end_time());
-  }
-  if (from.datapoint_limit() != 0) {
-    set_datapoint_limit(from.datapoint_limit());
-  }
-  if (from.prefer_latest() != 0) {
-    set_prefer_latest(from.prefer_latest());
-  }
-}
-
-void ReadOperation::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ReadOperation::CopyFrom(const ReadOperation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.ReadOperation)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool ReadOperation::IsInitialized() const {
-
   return true;
 }
 
-void ReadOperation::Swap(ReadOperation* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    ReadOperation temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void ReadOperation::UnsafeArenaSwap(ReadOperation* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void ReadOperation::InternalSwap(ReadOperation* other) {
-  std::swap(start_time_, other->start_time_);
-  std::swap(end_time_, other->end_time_);
-  std::swap(datapoint_limit_, other->datapoint_limit_);
-  std::swap(prefer_latest_, other->prefer_latest_);
-  std::swap(selector_, other->selector_);
-  std::swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ReadOperation::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadOperation_descriptor_;
-  metadata.reflection = ReadOperation_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReadOperation
-
-// optional .vqro.rpc.SeriesQuery query = 1;
- bool ReadOperation::has_query() const {
-  return selector_case() == kQuery;
-}
- void ReadOperation::set_has_query() {
-  _oneof_case_[0] = kQuery;
-}
- void ReadOperation::clear_query() {
-  if (has_query()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete selector_.query_;
-    }
-    clear_has_selector();
-  }
-}
- const ::vqro::rpc::SeriesQuery& ReadOperation::query() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.query)
-  return has_query() ? *selector_.query_
-                      : ::vqro::rpc::SeriesQuery::default_instance();
-}
- ::vqro::rpc::SeriesQuery* ReadOperation::mutable_query() {
-  if (!has_query()) {
-    clear_selector();
-    set_has_query();
-    selector_.query_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesQuery >(
-      GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.query)
-  return selector_.query_;
-}
- ::vqro::rpc::SeriesQuery* ReadOperation::release_query() {
-  if (has_query()) {
-    clear_has_selector();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::SeriesQuery* temp = new ::vqro::rpc::SeriesQuery;
-      temp->MergeFrom(*selector_.query_);
-      selector_.query_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::SeriesQuery* temp = selector_.query_;
-      selector_.query_ = NULL;
-      return temp;
-    }
-  } else {
-    return NULL;
-  }
-}
- ::vqro::rpc::SeriesQuery* ReadOperation::unsafe_arena_release_query() {
-  if (has_query()) {
-    clear_has_selector();
-    ::vqro::rpc::SeriesQuery* temp = selector_.query_;
-    selector_.query_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
- void ReadOperation::set_allocated_query(::vqro::rpc::SeriesQuery* query) {
-  clear_selector();
-  if (query) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(query) == NULL) {
-      GetArenaNoVirtual()->Own(query);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(query)) {
-      ::vqro::rpc::SeriesQuery* new_query = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesQuery >(
-          GetArenaNoVirtual());
-      new_query->CopyFrom(*query);
-      query = new_query;
-    }
-    set_has_query();
-    selector_.query_ = query;
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.query)
-}
- void ReadOperation::unsafe_arena_set_allocated_query(::vqro::rpc::SeriesQuery* query) {
-  clear_selector();
-  if (query) {
-    set_has_query();
-    selector_.query_ = query;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.query)
-}
-
-// optional .vqro.rpc.SeriesList list = 2;
- bool ReadOperation::has_list() const {
-  return selector_case() == kList;
-}
- void ReadOperation::set_has_list() {
-  _oneof_case_[0] = kList;
-}
- void ReadOperation::clear_list() {
-  if (has_list()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete selector_.list_;
-    }
-    clear_has_selector();
-  }
-}
- const ::vqro::rpc::SeriesList& ReadOperation::list() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.list)
-  return has_list() ? *selector_.list_
-                      : ::vqro::rpc::SeriesList::default_instance();
-}
- ::vqro::rpc::SeriesList* ReadOperation::mutable_list() {
-  if (!has_list()) {
-    clear_selector();
-    set_has_list();
-    selector_.list_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesList >(
-      GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.list)
-  return selector_.list_;
-}
- ::vqro::rpc::SeriesList* ReadOperation::release_list() {
-  if (has_list()) {
-    clear_has_selector();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::SeriesList* temp = new ::vqro::rpc::SeriesList;
-      temp->MergeFrom(*selector_.list_);
-      selector_.list_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::SeriesList* temp = selector_.list_;
-      selector_.list_ = NULL;
-      return temp;
-    }
-  } else {
-    return NULL;
-  }
-}
- ::vqro::rpc::SeriesList* ReadOperation::unsafe_arena_release_list() {
-  if (has_list()) {
-    clear_has_selector();
-    ::vqro::rpc::SeriesList* temp = selector_.list_;
-    selector_.list_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
-}
- void ReadOperation::set_allocated_list(::vqro::rpc::SeriesList* list) {
-  clear_selector();
-  if (list) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(list) == NULL) {
-      GetArenaNoVirtual()->Own(list);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(list)) {
-      ::vqro::rpc::SeriesList* new_list = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesList >(
-          GetArenaNoVirtual());
-      new_list->CopyFrom(*list);
-      list = new_list;
-    }
-    set_has_list();
-    selector_.list_ = list;
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.list)
-}
- void ReadOperation::unsafe_arena_set_allocated_list(::vqro::rpc::SeriesList* list) {
-  clear_selector();
-  if (list) {
-    set_has_list();
-    selector_.list_ = list;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.list)
-}
-
-// optional int64 start_time = 3;
- void ReadOperation::clear_start_time() {
-  start_time_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 ReadOperation::start_time() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.start_time)
-  return start_time_;
-}
- void ReadOperation::set_start_time(::google::protobuf::int64 value) {
-  
-  start_time_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.start_time)
-}
-
-// optional int64 end_time = 4;
- void ReadOperation::clear_end_time() {
-  end_time_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 ReadOperation::end_time() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.end_time)
-  return end_time_;
-}
- void ReadOperation::set_end_time(::google::protobuf::int64 value) {
-  
-  end_time_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.end_time)
-}
-
-// optional int64 datapoint_limit = 5;
- void ReadOperation::clear_datapoint_limit() {
-  datapoint_limit_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 ReadOperation::datapoint_limit() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.datapoint_limit)
-  return datapoint_limit_;
-}
- void ReadOperation::set_datapoint_limit(::google::protobuf::int64 value) {
-  
-  datapoint_limit_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.datapoint_limit)
-}
-
-// optional bool prefer_latest = 6;
- void ReadOperation::clear_prefer_latest() {
-  prefer_latest_ = false;
-}
- bool ReadOperation::prefer_latest() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.prefer_latest)
-  return prefer_latest_;
-}
- void ReadOperation::set_prefer_latest(bool value) {
-  
-  prefer_latest_ = value;
-  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.prefer_latest)
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadOperation, _impl_.step_)
+      + sizeof(ReadOperation::_impl_.step_)
+      - PROTOBUF_FIELD_OFFSET(ReadOperation, _impl_.start_time_)>(
+          reinterpret_cast<char*>(&_impl_.start_time_),
+          reinterpret_cast<char*>(&other->_impl_.start_time_));
+  swap(_impl_.selector_, other->_impl_.selector_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
- bool ReadOperation::has_selector() const {
-  return selector_case() != SELECTOR_NOT_SET;
-}
- void ReadOperation::clear_has_selector() {
-  _oneof_case_[0] = SELECTOR_NOT_SET;
-}
-ReadOperation::SelectorCase ReadOperation::selector_case() const {
-  return ReadOperation::SelectorCase(_oneof_case_[0]);
+::PROTOBUF_NAMESPACE_ID::Metadata ReadOperation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[4]);
 }
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SeriesList::kSeriesFieldNumber;
-#endif  // !_MSC_VER
+class SeriesList::_Internal {
+ public:
+};
 
-SeriesList::SeriesList()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.SeriesList)
+void SeriesList::clear_series() {
+  _impl_.series_.Clear();
 }
-
-SeriesList::SeriesList(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  series_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SeriesList::SeriesList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.SeriesList)
 }
-
-void SeriesList::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-}
-
 SeriesList::SeriesList(const SeriesList& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SeriesList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){from._impl_.series_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.SeriesList)
 }
 
-void SeriesList::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
+inline void SeriesList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SeriesList::~SeriesList() {
   // @@protoc_insertion_point(destructor:vqro.rpc.SeriesList)
-  SharedDtor();
-}
-
-void SeriesList::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-  }
+  SharedDtor();
 }
 
-void SeriesList::ArenaDtor(void* object) {
-  SeriesList* _this = reinterpret_cast< SeriesList* >(object);
-  (void)_this;
-}
-void SeriesList::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void SeriesList::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SeriesList::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SeriesList_descriptor_;
+inline void SeriesList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.series_.~RepeatedPtrField();
 }
 
-const SeriesList& SeriesList::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_storage_2eproto();
-  return *default_instance_;
+void SeriesList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-SeriesList* SeriesList::default_instance_ = NULL;
+void SeriesList::Clear() {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.SeriesList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-SeriesList* SeriesList::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<SeriesList>(arena);
+  _impl_.series_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SeriesList::Clear() {
-  series_.Clear();
-}
-
-bool SeriesList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.SeriesList)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SeriesList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .vqro.rpc.Series series = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_series:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_series()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_series(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_series;
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.SeriesList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.SeriesList)
-  return false;
-#undef DO_
-}
-
-void SeriesList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.SeriesList)
-  // repeated .vqro.rpc.Series series = 1;
-  for (unsigned int i = 0, n = this->series_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->series(i), output);
-  }
-
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.SeriesList)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SeriesList::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SeriesList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.SeriesList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated .vqro.rpc.Series series = 1;
-  for (unsigned int i = 0, n = this->series_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->series(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_series_size()); i < n; i++) {
+    const auto& repfield = this->_internal_series(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.SeriesList)
   return target;
 }
 
-int SeriesList::ByteSize() const {
-  int total_size = 0;
+size_t SeriesList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.SeriesList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .vqro.rpc.Series series = 1;
-  total_size += 1 * this->series_size();
-  for (int i = 0; i < this->series_size(); i++) {
+  total_size += 1UL * this->_internal_series_size();
+  for (const auto& msg : this->_impl_.series_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->series(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SeriesList::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const SeriesList* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SeriesList*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeriesList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SeriesList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeriesList::GetClassData() const { return &_class_data_; }
 
-void SeriesList::MergeFrom(const SeriesList& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  series_.MergeFrom(from.series_);
-}
 
-void SeriesList::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void SeriesList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeriesList*>(&to_msg);
+  auto& from = static_cast<const SeriesList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.SeriesList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.series_.MergeFrom(from._impl_.series_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SeriesList::CopyFrom(const SeriesList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.SeriesList)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SeriesList::IsInitialized() const {
-
   return true;
 }
 
-void SeriesList::Swap(SeriesList* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    SeriesList temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void SeriesList::UnsafeArenaSwap(SeriesList* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void SeriesList::InternalSwap(SeriesList* other) {
-  series_.UnsafeArenaSwap(&other->series_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.series_.InternalSwap(&other->_impl_.series_);
 }
 
-::google::protobuf::Metadata SeriesList::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SeriesList_descriptor_;
-  metadata.reflection = SeriesList_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SeriesList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[5]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SeriesList
+// ===================================================================
 
-// repeated .vqro.rpc.Series series = 1;
- int SeriesList::series_size() const {
-  return series_.size();
-}
- void SeriesList::clear_series() {
-  series_.Clear();
-}
- const ::vqro::rpc::Series& SeriesList::series(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesList.series)
-  return series_.Get(index);
-}
- ::vqro::rpc::Series* SeriesList::mutable_series(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesList.series)
-  return series_.Mutable(index);
-}
- ::vqro::rpc::Series* SeriesList::add_series() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesList.series)
-  return series_.Add();
+class ReadResult::_Internal {
+ public:
+  static const ::vqro::rpc::Series& series(const ReadResult* msg);
+  static const ::vqro::rpc::StatusMessage& status(const ReadResult* msg);
+};
+
+const ::vqro::rpc::Series&
+ReadResult::_Internal::series(const ReadResult* msg) {
+  return *msg->_impl_.series_;
 }
- const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
-SeriesList::series() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesList.series)
-  return series_;
+const ::vqro::rpc::StatusMessage&
+ReadResult::_Internal::status(const ReadResult* msg) {
+  return *msg->_impl_.status_;
 }
- ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-SeriesList::mutable_series() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesList.series)
-  return &series_;
+void ReadResult::clear_series() {
+  if (GetArenaForAllocation() == nullptr && _impl_.series_ != nullptr) {
+    delete _impl_.series_;
+  }
+  _impl_.series_ = nullptr;
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-void ReadResult::_slow_mutable_series() {
-  series_ = ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::Series >(
-        GetArenaNoVirtual());
-}
-::vqro::rpc::Series* ReadResult::_slow_release_series() {
-  if (series_ == NULL) {
-    return NULL;
-  } else {
-    ::vqro::rpc::Series* temp = new ::vqro::rpc::Series;
-    temp->MergeFrom(*series_);
-    series_ = NULL;
-    return temp;
-  }
-}
-::vqro::rpc::Series* ReadResult::unsafe_arena_release_series() {
-  
-  ::vqro::rpc::Series* temp = series_;
-  series_ = NULL;
-  return temp;
-}
-void ReadResult::_slow_set_allocated_series(
-    ::google::protobuf::Arena* message_arena, ::vqro::rpc::Series** series) {
-    if (message_arena != NULL && 
-        ::google::protobuf::Arena::GetArena(*series) == NULL) {
-      message_arena->Own(*series);
-    } else if (message_arena !=
-               ::google::protobuf::Arena::GetArena(*series)) {
-      ::vqro::rpc::Series* new_series = 
-            ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::Series >(
-            message_arena);
-      new_series->CopyFrom(**series);
-      *series = new_series;
-    }
+void ReadResult::clear_datapoints() {
+  _impl_.datapoints_.Clear();
 }
-void ReadResult::unsafe_arena_set_allocated_series(
-    ::vqro::rpc::Series* series) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete series_;
-  }
-  series_ = series;
-  if (series) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadResult.series)
-}
-void ReadResult::_slow_mutable_status() {
-  status_ = ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-        GetArenaNoVirtual());
-}
-::vqro::rpc::StatusMessage* ReadResult::_slow_release_status() {
-  if (status_ == NULL) {
-    return NULL;
-  } else {
-    ::vqro::rpc::StatusMessage* temp = new ::vqro::rpc::StatusMessage;
-    temp->MergeFrom(*status_);
-    status_ = NULL;
-    return temp;
-  }
-}
-::vqro::rpc::StatusMessage* ReadResult::unsafe_arena_release_status() {
-  
-  ::vqro::rpc::StatusMessage* temp = status_;
-  status_ = NULL;
-  return temp;
-}
-void ReadResult::_slow_set_allocated_status(
-    ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status) {
-    if (message_arena != NULL && 
-        ::google::protobuf::Arena::GetArena(*status) == NULL) {
-      message_arena->Own(*status);
-    } else if (message_arena !=
-               ::google::protobuf::Arena::GetArena(*status)) {
-      ::vqro::rpc::StatusMessage* new_status = 
-            ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::StatusMessage >(
-            message_arena);
-      new_status->CopyFrom(**status);
-      *status = new_status;
-    }
+void ReadResult::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
 }
-void ReadResult::unsafe_arena_set_allocated_status(
-    ::vqro::rpc::StatusMessage* status) {
-  if (GetArenaNoVirtual() == NULL) {
-    delete status_;
-  }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadResult.status)
-}
-#ifndef _MSC_VER
-const int ReadResult::kSeriesFieldNumber;
-const int ReadResult::kDatapointsFieldNumber;
-const int ReadResult::kStatusFieldNumber;
-#endif  // !_MSC_VER
-
-ReadResult::ReadResult()
-  : ::google::protobuf::Message() , _internal_metadata_(NULL)  {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:vqro.rpc.ReadResult)
-}
-
-ReadResult::ReadResult(::google::protobuf::Arena* arena)
-  : ::google::protobuf::Message(),
-  _internal_metadata_(arena),
-  datapoints_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ReadResult::ReadResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:vqro.rpc.ReadResult)
 }
-
-void ReadResult::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
-  series_ = const_cast< ::vqro::rpc::Series*>(&::vqro::rpc::Series::default_instance());
-  status_ = const_cast< ::vqro::rpc::StatusMessage*>(&::vqro::rpc::StatusMessage::default_instance());
-}
-
 ReadResult::ReadResult(const ReadResult& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datapoints_){from._impl_.datapoints_}
+    , decltype(_impl_.series_){nullptr}
+    , decltype(_impl_.status_){nullptr}
+    , decltype(_impl_.series_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_series()) {
+    _this->_impl_.series_ = new ::vqro::rpc::Series(*from._impl_.series_);
+  }
+  if (from._internal_has_status()) {
+    _this->_impl_.status_ = new ::vqro::rpc::StatusMessage(*from._impl_.status_);
+  }
+  _this->_impl_.series_handle_ = from._impl_.series_handle_;
   // @@protoc_insertion_point(copy_constructor:vqro.rpc.ReadResult)
 }
 
-void ReadResult::SharedCtor() {
-    _is_default_instance_ = false;
-  _cached_size_ = 0;
-  series_ = NULL;
-  status_ = NULL;
+inline void ReadResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.datapoints_){arena}
+    , decltype(_impl_.series_){nullptr}
+    , decltype(_impl_.status_){nullptr}
+    , decltype(_impl_.series_handle_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ReadResult::~ReadResult() {
   // @@protoc_insertion_point(destructor:vqro.rpc.ReadResult)
-  SharedDtor();
-}
-
-void ReadResult::SharedDtor() {
-  if (GetArenaNoVirtual() != NULL) {
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
     return;
   }
-
-  if (this != default_instance_) {
-    delete series_;
-    delete status_;
-  }
-}
-
-void ReadResult::ArenaDtor(void* object) {
-  ReadResult* _this = reinterpret_cast< ReadResult* >(object);
-  (void)_this;
-}
-void ReadResult::RegisterArenaDtor(::google::protobuf::Arena* arena) {
-}
-void ReadResult::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ReadResult::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ReadResult_descriptor_;
+  SharedDtor();
 }
 
-const ReadResult& ReadResult::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_storage_2eproto();
-  return *default_instance_;
+inline void ReadResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.datapoints_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.series_;
+  if (this != internal_default_instance()) delete _impl_.status_;
 }
 
-ReadResult* ReadResult::default_instance_ = NULL;
-
-ReadResult* ReadResult::New(::google::protobuf::Arena* arena) const {
-  return ::google::protobuf::Arena::CreateMessage<ReadResult>(arena);
+void ReadResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void ReadResult::Clear() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
-  datapoints_.Clear();
-}
-
-bool ReadResult::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:vqro.rpc.ReadResult)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .vqro.rpc.Series series = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_series()));
-        } else {
+// @@protoc_insertion_point(message_clear_start:vqro.rpc.ReadResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.datapoints_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.series_ != nullptr) {
+    delete _impl_.series_;
+  }
+  _impl_.series_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
+  _impl_.series_handle_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .vqro.rpc.Series series = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_series(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_datapoints;
-        break;
-      }
-
+        continue;
       // repeated .vqro.rpc.Datapoint datapoints = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_datapoints:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_datapoints()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_datapoints(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_datapoints;
-        if (input->ExpectTag(26)) goto parse_status;
-        break;
-      }
-
-      // optional .vqro.rpc.StatusMessage status = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_status:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_status()));
-        } else {
+        continue;
+      // .vqro.rpc.StatusMessage status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_status(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
-        break;
-      }
+        continue;
+      // fixed64 series_handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.series_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:vqro.rpc.ReadResult)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:vqro.rpc.ReadResult)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ReadResult::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:vqro.rpc.ReadResult)
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, *this->series_, output);
-  }
+uint8_t* ReadResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.ReadResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  for (unsigned int i = 0, n = this->datapoints_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->datapoints(i), output);
+  // .vqro.rpc.Series series = 1;
+  if (this->_internal_has_series()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::series(this),
+        _Internal::series(this).GetCachedSize(), target, stream);
   }
 
-  // optional .vqro.rpc.StatusMessage status = 3;
-  if (this->has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->status_, output);
+  // repeated .vqro.rpc.Datapoint datapoints = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_datapoints_size()); i < n; i++) {
+    const auto& repfield = this->_internal_datapoints(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // @@protoc_insertion_point(serialize_end:vqro.rpc.ReadResult)
-}
-
-::google::protobuf::uint8* ReadResult::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:vqro.rpc.ReadResult)
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, *this->series_, target);
+  // .vqro.rpc.StatusMessage status = 3;
+  if (this->_internal_has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::status(this),
+        _Internal::status(this).GetCachedSize(), target, stream);
   }
 
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  for (unsigned int i = 0, n = this->datapoints_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->datapoints(i), target);
+  // fixed64 series_handle = 4;
+  if (this->_internal_series_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_series_handle(), target);
   }
 
-  // optional .vqro.rpc.StatusMessage status = 3;
-  if (this->has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, *this->status_, target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-
   // @@protoc_insertion_point(serialize_to_array_end:vqro.rpc.ReadResult)
   return target;
 }
 
-int ReadResult::ByteSize() const {
-  int total_size = 0;
+size_t ReadResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:vqro.rpc.ReadResult)
+  size_t total_size = 0;
 
-  // optional .vqro.rpc.Series series = 1;
-  if (this->has_series()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .vqro.rpc.Datapoint datapoints = 2;
+  total_size += 1UL * this->_internal_datapoints_size();
+  for (const auto& msg : this->_impl_.datapoints_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .vqro.rpc.Series series = 1;
+  if (this->_internal_has_series()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->series_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.series_);
   }
 
-  // optional .vqro.rpc.StatusMessage status = 3;
-  if (this->has_status()) {
+  // .vqro.rpc.StatusMessage status = 3;
+  if (this->_internal_has_status()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->status_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.status_);
   }
 
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  total_size += 1 * this->datapoints_size();
-  for (int i = 0; i < this->datapoints_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->datapoints(i));
+  // fixed64 series_handle = 4;
+  if (this->_internal_series_handle() != 0) {
+    total_size += 1 + 8;
   }
 
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ReadResult::MergeFrom(const ::google::protobuf::Message& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  const ReadResult* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ReadResult*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadResult::GetClassData() const { return &_class_data_; }
+
 
-void ReadResult::MergeFrom(const ReadResult& from) {
-  if (GOOGLE_PREDICT_FALSE(&from == this)) MergeFromFail(__LINE__);
-  datapoints_.MergeFrom(from.datapoints_);
-  if (from.has_series()) {
-    mutable_series()->::vqro::rpc::Series::MergeFrom(from.series());
+void ReadResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadResult*>(&to_msg);
+  auto& from = static_cast<const ReadResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:vqro.rpc.ReadResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.datapoints_.MergeFrom(from._impl_.datapoints_);
+  if (from._internal_has_series()) {
+    _this->_internal_mutable_series()->::vqro::rpc::Series::MergeFrom(
+        from._internal_series());
   }
-  if (from.has_status()) {
-    mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(from.status());
+  if (from._internal_has_status()) {
+    _this->_internal_mutable_status()->::vqro::rpc::StatusMessage::MergeFrom(
+        from._internal_status());
   }
-}
-
-void ReadResult::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_series_handle() != 0) {
+    _this->_internal_set_series_handle(from._internal_series_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ReadResult::CopyFrom(const ReadResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:vqro.rpc.ReadResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool ReadResult::IsInitialized() const {
-
   return true;
 }
 
-void ReadResult::Swap(ReadResult* other) {
-  if (other == this) return;
-  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
-    InternalSwap(other);
-  } else {
-    ReadResult temp;
-    temp.MergeFrom(*this);
-    CopyFrom(*other);
-    other->CopyFrom(temp);
-  }
-}
-void ReadResult::UnsafeArenaSwap(ReadResult* other) {
-  if (other == this) return;
-  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
-  InternalSwap(other);
-}
 void ReadResult::InternalSwap(ReadResult* other) {
-  std::swap(series_, other->series_);
-  datapoints_.UnsafeArenaSwap(&other->datapoints_);
-  std::swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ReadResult::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ReadResult_descriptor_;
-  metadata.reflection = ReadResult_reflection_;
-  return metadata;
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.datapoints_.InternalSwap(&other->_impl_.datapoints_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadResult, _impl_.series_handle_)
+      + sizeof(ReadResult::_impl_.series_handle_)
+      - PROTOBUF_FIELD_OFFSET(ReadResult, _impl_.series_)>(
+          reinterpret_cast<char*>(&_impl_.series_),
+          reinterpret_cast<char*>(&other->_impl_.series_));
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ReadResult
-
-// optional .vqro.rpc.Series series = 1;
- bool ReadResult::has_series() const {
-  return !_is_default_instance_ && series_ != NULL;
-}
- void ReadResult::clear_series() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
-}
- const ::vqro::rpc::Series& ReadResult::series() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.series)
-  return series_ != NULL ? *series_ : *default_instance_->series_;
-}
- ::vqro::rpc::Series* ReadResult::mutable_series() {
-  
-  if (series_ == NULL) {
-    _slow_mutable_series();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.series)
-  return series_;
-}
- ::vqro::rpc::Series* ReadResult::release_series() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_series();
-  } else {
-    ::vqro::rpc::Series* temp = series_;
-    series_ = NULL;
-    return temp;
-  }
-}
- void ReadResult::set_allocated_series(::vqro::rpc::Series* series) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete series_;
-  }
-  if (series != NULL) {
-    _slow_set_allocated_series(message_arena, &series);
-  }
-  series_ = series;
-  if (series) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadResult.series)
+::PROTOBUF_NAMESPACE_ID::Metadata ReadResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_storage_2eproto_getter, &descriptor_table_storage_2eproto_once,
+      file_level_metadata_storage_2eproto[6]);
 }
 
-// repeated .vqro.rpc.Datapoint datapoints = 2;
- int ReadResult::datapoints_size() const {
-  return datapoints_.size();
-}
- void ReadResult::clear_datapoints() {
-  datapoints_.Clear();
-}
- const ::vqro::rpc::Datapoint& ReadResult::datapoints(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Get(index);
-}
- ::vqro::rpc::Datapoint* ReadResult::mutable_datapoints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Mutable(index);
-}
- ::vqro::rpc::Datapoint* ReadResult::add_datapoints() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Add();
-}
- const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
-ReadResult::datapoints() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.ReadResult.datapoints)
-  return datapoints_;
-}
- ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
-ReadResult::mutable_datapoints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.ReadResult.datapoints)
-  return &datapoints_;
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SeriesHandles*
+Arena::CreateMaybeMessage< ::vqro::rpc::SeriesHandles >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SeriesHandles >(arena);
 }
-
-// optional .vqro.rpc.StatusMessage status = 3;
- bool ReadResult::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::WriteOperation*
+Arena::CreateMaybeMessage< ::vqro::rpc::WriteOperation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::WriteOperation >(arena);
 }
- void ReadResult::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::WriteBatch*
+Arena::CreateMaybeMessage< ::vqro::rpc::WriteBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::WriteBatch >(arena);
 }
- const ::vqro::rpc::StatusMessage& ReadResult::status() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SeriesColumns*
+Arena::CreateMaybeMessage< ::vqro::rpc::SeriesColumns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SeriesColumns >(arena);
 }
- ::vqro::rpc::StatusMessage* ReadResult::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.status)
-  return status_;
+template<> PROTOBUF_NOINLINE ::vqro::rpc::ReadOperation*
+Arena::CreateMaybeMessage< ::vqro::rpc::ReadOperation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::ReadOperation >(arena);
 }
- ::vqro::rpc::StatusMessage* ReadResult::release_status() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
-  }
+template<> PROTOBUF_NOINLINE ::vqro::rpc::SeriesList*
+Arena::CreateMaybeMessage< ::vqro::rpc::SeriesList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::SeriesList >(arena);
 }
- void ReadResult::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
-  }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
-  }
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadResult.status)
+template<> PROTOBUF_NOINLINE ::vqro::rpc::ReadResult*
+Arena::CreateMaybeMessage< ::vqro::rpc::ReadResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::vqro::rpc::ReadResult >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace rpc
-}  // namespace vqro
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
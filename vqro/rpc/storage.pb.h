@@ -1,1057 +1,2682 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: storage.proto
 
-#ifndef PROTOBUF_storage_2eproto__INCLUDED
-#define PROTOBUF_storage_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_storage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_storage_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "core.pb.h"
 #include "search.pb.h"
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_storage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_storage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_storage_2eproto;
 namespace vqro {
 namespace rpc {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_storage_2eproto();
-void protobuf_AssignDesc_storage_2eproto();
-void protobuf_ShutdownFile_storage_2eproto();
-
-class WriteOperation;
 class ReadOperation;
-class SeriesList;
+struct ReadOperationDefaultTypeInternal;
+extern ReadOperationDefaultTypeInternal _ReadOperation_default_instance_;
 class ReadResult;
+struct ReadResultDefaultTypeInternal;
+extern ReadResultDefaultTypeInternal _ReadResult_default_instance_;
+class SeriesColumns;
+struct SeriesColumnsDefaultTypeInternal;
+extern SeriesColumnsDefaultTypeInternal _SeriesColumns_default_instance_;
+class SeriesHandles;
+struct SeriesHandlesDefaultTypeInternal;
+extern SeriesHandlesDefaultTypeInternal _SeriesHandles_default_instance_;
+class SeriesList;
+struct SeriesListDefaultTypeInternal;
+extern SeriesListDefaultTypeInternal _SeriesList_default_instance_;
+class WriteBatch;
+struct WriteBatchDefaultTypeInternal;
+extern WriteBatchDefaultTypeInternal _WriteBatch_default_instance_;
+class WriteOperation;
+struct WriteOperationDefaultTypeInternal;
+extern WriteOperationDefaultTypeInternal _WriteOperation_default_instance_;
+}  // namespace rpc
+}  // namespace vqro
+PROTOBUF_NAMESPACE_OPEN
+template<> ::vqro::rpc::ReadOperation* Arena::CreateMaybeMessage<::vqro::rpc::ReadOperation>(Arena*);
+template<> ::vqro::rpc::ReadResult* Arena::CreateMaybeMessage<::vqro::rpc::ReadResult>(Arena*);
+template<> ::vqro::rpc::SeriesColumns* Arena::CreateMaybeMessage<::vqro::rpc::SeriesColumns>(Arena*);
+template<> ::vqro::rpc::SeriesHandles* Arena::CreateMaybeMessage<::vqro::rpc::SeriesHandles>(Arena*);
+template<> ::vqro::rpc::SeriesList* Arena::CreateMaybeMessage<::vqro::rpc::SeriesList>(Arena*);
+template<> ::vqro::rpc::WriteBatch* Arena::CreateMaybeMessage<::vqro::rpc::WriteBatch>(Arena*);
+template<> ::vqro::rpc::WriteOperation* Arena::CreateMaybeMessage<::vqro::rpc::WriteOperation>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace vqro {
+namespace rpc {
 
+enum ReadOperation_Aggregate : int {
+  ReadOperation_Aggregate_AVG = 0,
+  ReadOperation_Aggregate_MIN = 1,
+  ReadOperation_Aggregate_MAX = 2,
+  ReadOperation_Aggregate_SUM = 3,
+  ReadOperation_Aggregate_COUNT = 4,
+  ReadOperation_Aggregate_ReadOperation_Aggregate_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ReadOperation_Aggregate_ReadOperation_Aggregate_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ReadOperation_Aggregate_IsValid(int value);
+constexpr ReadOperation_Aggregate ReadOperation_Aggregate_Aggregate_MIN = ReadOperation_Aggregate_AVG;
+constexpr ReadOperation_Aggregate ReadOperation_Aggregate_Aggregate_MAX = ReadOperation_Aggregate_COUNT;
+constexpr int ReadOperation_Aggregate_Aggregate_ARRAYSIZE = ReadOperation_Aggregate_Aggregate_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReadOperation_Aggregate_descriptor();
+template<typename T>
+inline const std::string& ReadOperation_Aggregate_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReadOperation_Aggregate>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReadOperation_Aggregate_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReadOperation_Aggregate_descriptor(), enum_t_value);
+}
+inline bool ReadOperation_Aggregate_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReadOperation_Aggregate* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReadOperation_Aggregate>(
+    ReadOperation_Aggregate_descriptor(), name, value);
+}
 // ===================================================================
 
-class WriteOperation : public ::google::protobuf::Message {
+class SeriesHandles final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SeriesHandles) */ {
  public:
-  WriteOperation();
-  virtual ~WriteOperation();
-
-  WriteOperation(const WriteOperation& from);
+  inline SeriesHandles() : SeriesHandles(nullptr) {}
+  ~SeriesHandles() override;
+  explicit PROTOBUF_CONSTEXPR SeriesHandles(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SeriesHandles(const SeriesHandles& from);
+  SeriesHandles(SeriesHandles&& from) noexcept
+    : SeriesHandles() {
+    *this = ::std::move(from);
+  }
 
-  inline WriteOperation& operator=(const WriteOperation& from) {
+  inline SeriesHandles& operator=(const SeriesHandles& from) {
     CopyFrom(from);
     return *this;
   }
+  inline SeriesHandles& operator=(SeriesHandles&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const WriteOperation& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeriesHandles& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SeriesHandles* internal_default_instance() {
+    return reinterpret_cast<const SeriesHandles*>(
+               &_SeriesHandles_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void UnsafeArenaSwap(WriteOperation* other);
-  void Swap(WriteOperation* other);
+  friend void swap(SeriesHandles& a, SeriesHandles& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeriesHandles* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeriesHandles* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline WriteOperation* New() const { return New(NULL); }
+  SeriesHandles* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeriesHandles>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SeriesHandles& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeriesHandles& from) {
+    SeriesHandles::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  WriteOperation* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const WriteOperation& from);
-  void MergeFrom(const WriteOperation& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(WriteOperation* other);
-  protected:
-  explicit WriteOperation(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SeriesHandles* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SeriesHandles";
   }
+  protected:
+  explicit SeriesHandles(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.Series series = 1;
-  bool has_series() const;
-  void clear_series();
-  static const int kSeriesFieldNumber = 1;
+  enum : int {
+    kHandlesFieldNumber = 1,
+  };
+  // repeated fixed64 handles = 1;
+  int handles_size() const;
   private:
-  void _slow_mutable_series();
-  void _slow_set_allocated_series(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::Series** series);
-  ::vqro::rpc::Series* _slow_release_series();
+  int _internal_handles_size() const;
   public:
-  const ::vqro::rpc::Series& series() const;
-  ::vqro::rpc::Series* mutable_series();
-  ::vqro::rpc::Series* release_series();
-  void set_allocated_series(::vqro::rpc::Series* series);
-  ::vqro::rpc::Series* unsafe_arena_release_series();
-  void unsafe_arena_set_allocated_series(
-      ::vqro::rpc::Series* series);
-
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  int datapoints_size() const;
-  void clear_datapoints();
-  static const int kDatapointsFieldNumber = 2;
-  const ::vqro::rpc::Datapoint& datapoints(int index) const;
-  ::vqro::rpc::Datapoint* mutable_datapoints(int index);
-  ::vqro::rpc::Datapoint* add_datapoints();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
-      datapoints() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
-      mutable_datapoints();
-
-  // @@protoc_insertion_point(class_scope:vqro.rpc.WriteOperation)
+  void clear_handles();
+  private:
+  uint64_t _internal_handles(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_handles() const;
+  void _internal_add_handles(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_handles();
+  public:
+  uint64_t handles(int index) const;
+  void set_handles(int index, uint64_t value);
+  void add_handles(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      handles() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_handles();
+
+  // @@protoc_insertion_point(class_scope:vqro.rpc.SeriesHandles)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::vqro::rpc::Series* series_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint > datapoints_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_storage_2eproto();
-  friend void protobuf_AssignDesc_storage_2eproto();
-  friend void protobuf_ShutdownFile_storage_2eproto();
-
-  void InitAsDefaultInstance();
-  static WriteOperation* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > handles_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadOperation : public ::google::protobuf::Message {
+class WriteOperation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.WriteOperation) */ {
  public:
-  ReadOperation();
-  virtual ~ReadOperation();
+  inline WriteOperation() : WriteOperation(nullptr) {}
+  ~WriteOperation() override;
+  explicit PROTOBUF_CONSTEXPR WriteOperation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReadOperation(const ReadOperation& from);
+  WriteOperation(const WriteOperation& from);
+  WriteOperation(WriteOperation&& from) noexcept
+    : WriteOperation() {
+    *this = ::std::move(from);
+  }
 
-  inline ReadOperation& operator=(const ReadOperation& from) {
+  inline WriteOperation& operator=(const WriteOperation& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  inline WriteOperation& operator=(WriteOperation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReadOperation& default_instance();
 
-  enum SelectorCase {
-    kQuery = 1,
-    kList = 2,
-    SELECTOR_NOT_SET = 0,
-  };
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteOperation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteOperation* internal_default_instance() {
+    return reinterpret_cast<const WriteOperation*>(
+               &_WriteOperation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void UnsafeArenaSwap(ReadOperation* other);
-  void Swap(ReadOperation* other);
+  friend void swap(WriteOperation& a, WriteOperation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteOperation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteOperation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ReadOperation* New() const { return New(NULL); }
+  WriteOperation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteOperation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteOperation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteOperation& from) {
+    WriteOperation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ReadOperation* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReadOperation& from);
-  void MergeFrom(const ReadOperation& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ReadOperation* other);
-  protected:
-  explicit ReadOperation(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteOperation* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.WriteOperation";
   }
+  protected:
+  explicit WriteOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.SeriesQuery query = 1;
-  bool has_query() const;
-  void clear_query();
-  static const int kQueryFieldNumber = 1;
+  enum : int {
+    kDatapointsFieldNumber = 2,
+    kSeriesFieldNumber = 1,
+    kSeriesHandleFieldNumber = 3,
+  };
+  // repeated .vqro.rpc.Datapoint datapoints = 2;
+  int datapoints_size() const;
   private:
-  void _slow_mutable_query();
-  void _slow_set_allocated_query(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::SeriesQuery** query);
-  ::vqro::rpc::SeriesQuery* _slow_release_query();
+  int _internal_datapoints_size() const;
   public:
-  const ::vqro::rpc::SeriesQuery& query() const;
-  ::vqro::rpc::SeriesQuery* mutable_query();
-  ::vqro::rpc::SeriesQuery* release_query();
-  void set_allocated_query(::vqro::rpc::SeriesQuery* query);
-  ::vqro::rpc::SeriesQuery* unsafe_arena_release_query();
-  void unsafe_arena_set_allocated_query(
-      ::vqro::rpc::SeriesQuery* query);
-
-  // optional .vqro.rpc.SeriesList list = 2;
-  bool has_list() const;
-  void clear_list();
-  static const int kListFieldNumber = 2;
+  void clear_datapoints();
+  ::vqro::rpc::Datapoint* mutable_datapoints(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >*
+      mutable_datapoints();
   private:
-  void _slow_mutable_list();
-  void _slow_set_allocated_list(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::SeriesList** list);
-  ::vqro::rpc::SeriesList* _slow_release_list();
+  const ::vqro::rpc::Datapoint& _internal_datapoints(int index) const;
+  ::vqro::rpc::Datapoint* _internal_add_datapoints();
   public:
-  const ::vqro::rpc::SeriesList& list() const;
-  ::vqro::rpc::SeriesList* mutable_list();
-  ::vqro::rpc::SeriesList* release_list();
-  void set_allocated_list(::vqro::rpc::SeriesList* list);
-  ::vqro::rpc::SeriesList* unsafe_arena_release_list();
-  void unsafe_arena_set_allocated_list(
-      ::vqro::rpc::SeriesList* list);
-
-  // optional int64 start_time = 3;
-  void clear_start_time();
-  static const int kStartTimeFieldNumber = 3;
-  ::google::protobuf::int64 start_time() const;
-  void set_start_time(::google::protobuf::int64 value);
-
-  // optional int64 end_time = 4;
-  void clear_end_time();
-  static const int kEndTimeFieldNumber = 4;
-  ::google::protobuf::int64 end_time() const;
-  void set_end_time(::google::protobuf::int64 value);
+  const ::vqro::rpc::Datapoint& datapoints(int index) const;
+  ::vqro::rpc::Datapoint* add_datapoints();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >&
+      datapoints() const;
 
-  // optional int64 datapoint_limit = 5;
-  void clear_datapoint_limit();
-  static const int kDatapointLimitFieldNumber = 5;
-  ::google::protobuf::int64 datapoint_limit() const;
-  void set_datapoint_limit(::google::protobuf::int64 value);
+  // .vqro.rpc.Series series = 1;
+  bool has_series() const;
+  private:
+  bool _internal_has_series() const;
+  public:
+  void clear_series();
+  const ::vqro::rpc::Series& series() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::Series* release_series();
+  ::vqro::rpc::Series* mutable_series();
+  void set_allocated_series(::vqro::rpc::Series* series);
+  private:
+  const ::vqro::rpc::Series& _internal_series() const;
+  ::vqro::rpc::Series* _internal_mutable_series();
+  public:
+  void unsafe_arena_set_allocated_series(
+      ::vqro::rpc::Series* series);
+  ::vqro::rpc::Series* unsafe_arena_release_series();
 
-  // optional bool prefer_latest = 6;
-  void clear_prefer_latest();
-  static const int kPreferLatestFieldNumber = 6;
-  bool prefer_latest() const;
-  void set_prefer_latest(bool value);
+  // fixed64 series_handle = 3;
+  void clear_series_handle();
+  uint64_t series_handle() const;
+  void set_series_handle(uint64_t value);
+  private:
+  uint64_t _internal_series_handle() const;
+  void _internal_set_series_handle(uint64_t value);
+  public:
 
-  SelectorCase selector_case() const;
-  // @@protoc_insertion_point(class_scope:vqro.rpc.ReadOperation)
+  // @@protoc_insertion_point(class_scope:vqro.rpc.WriteOperation)
  private:
-  inline void set_has_query();
-  inline void set_has_list();
-
-  inline bool has_selector() const;
-  void clear_selector();
-  inline void clear_has_selector();
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 start_time_;
-  ::google::protobuf::int64 end_time_;
-  ::google::protobuf::int64 datapoint_limit_;
-  bool prefer_latest_;
-  union SelectorUnion {
-    SelectorUnion() {}
-    ::vqro::rpc::SeriesQuery* query_;
-    ::vqro::rpc::SeriesList* list_;
-  } selector_;
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend void  protobuf_AddDesc_storage_2eproto();
-  friend void protobuf_AssignDesc_storage_2eproto();
-  friend void protobuf_ShutdownFile_storage_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReadOperation* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint > datapoints_;
+    ::vqro::rpc::Series* series_;
+    uint64_t series_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SeriesList : public ::google::protobuf::Message {
+class WriteBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.WriteBatch) */ {
  public:
-  SeriesList();
-  virtual ~SeriesList();
-
-  SeriesList(const SeriesList& from);
+  inline WriteBatch() : WriteBatch(nullptr) {}
+  ~WriteBatch() override;
+  explicit PROTOBUF_CONSTEXPR WriteBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteBatch(const WriteBatch& from);
+  WriteBatch(WriteBatch&& from) noexcept
+    : WriteBatch() {
+    *this = ::std::move(from);
+  }
 
-  inline SeriesList& operator=(const SeriesList& from) {
+  inline WriteBatch& operator=(const WriteBatch& from) {
     CopyFrom(from);
     return *this;
   }
+  inline WriteBatch& operator=(WriteBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SeriesList& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteBatch* internal_default_instance() {
+    return reinterpret_cast<const WriteBatch*>(
+               &_WriteBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void UnsafeArenaSwap(SeriesList* other);
-  void Swap(SeriesList* other);
+  friend void swap(WriteBatch& a, WriteBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SeriesList* New() const { return New(NULL); }
+  WriteBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteBatch& from) {
+    WriteBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  SeriesList* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SeriesList& from);
-  void MergeFrom(const SeriesList& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(SeriesList* other);
-  protected:
-  explicit SeriesList(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteBatch* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.WriteBatch";
   }
+  protected:
+  explicit WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSeriesFieldNumber = 1,
+    kColumnsFieldNumber = 2,
+  };
   // repeated .vqro.rpc.Series series = 1;
   int series_size() const;
+  private:
+  int _internal_series_size() const;
+  public:
   void clear_series();
-  static const int kSeriesFieldNumber = 1;
-  const ::vqro::rpc::Series& series(int index) const;
   ::vqro::rpc::Series* mutable_series(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+      mutable_series();
+  private:
+  const ::vqro::rpc::Series& _internal_series(int index) const;
+  ::vqro::rpc::Series* _internal_add_series();
+  public:
+  const ::vqro::rpc::Series& series(int index) const;
   ::vqro::rpc::Series* add_series();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
       series() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-      mutable_series();
 
-  // @@protoc_insertion_point(class_scope:vqro.rpc.SeriesList)
+  // repeated .vqro.rpc.SeriesColumns columns = 2;
+  int columns_size() const;
+  private:
+  int _internal_columns_size() const;
+  public:
+  void clear_columns();
+  ::vqro::rpc::SeriesColumns* mutable_columns(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::SeriesColumns >*
+      mutable_columns();
+  private:
+  const ::vqro::rpc::SeriesColumns& _internal_columns(int index) const;
+  ::vqro::rpc::SeriesColumns* _internal_add_columns();
+  public:
+  const ::vqro::rpc::SeriesColumns& columns(int index) const;
+  ::vqro::rpc::SeriesColumns* add_columns();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::SeriesColumns >&
+      columns() const;
+
+  // @@protoc_insertion_point(class_scope:vqro.rpc.WriteBatch)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series > series_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_storage_2eproto();
-  friend void protobuf_AssignDesc_storage_2eproto();
-  friend void protobuf_ShutdownFile_storage_2eproto();
-
-  void InitAsDefaultInstance();
-  static SeriesList* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series > series_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::SeriesColumns > columns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReadResult : public ::google::protobuf::Message {
+class SeriesColumns final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SeriesColumns) */ {
  public:
-  ReadResult();
-  virtual ~ReadResult();
-
-  ReadResult(const ReadResult& from);
+  inline SeriesColumns() : SeriesColumns(nullptr) {}
+  ~SeriesColumns() override;
+  explicit PROTOBUF_CONSTEXPR SeriesColumns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SeriesColumns(const SeriesColumns& from);
+  SeriesColumns(SeriesColumns&& from) noexcept
+    : SeriesColumns() {
+    *this = ::std::move(from);
+  }
 
-  inline ReadResult& operator=(const ReadResult& from) {
+  inline SeriesColumns& operator=(const SeriesColumns& from) {
     CopyFrom(from);
     return *this;
   }
+  inline SeriesColumns& operator=(SeriesColumns&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ::google::protobuf::Arena* GetArena() const { return GetArenaNoVirtual(); }
-  inline void* GetMaybeArenaPointer() const {
-    return MaybeArenaPtr();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeriesColumns& default_instance() {
+    return *internal_default_instance();
   }
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReadResult& default_instance();
+  static inline const SeriesColumns* internal_default_instance() {
+    return reinterpret_cast<const SeriesColumns*>(
+               &_SeriesColumns_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void UnsafeArenaSwap(ReadResult* other);
-  void Swap(ReadResult* other);
+  friend void swap(SeriesColumns& a, SeriesColumns& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeriesColumns* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeriesColumns* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ReadResult* New() const { return New(NULL); }
+  SeriesColumns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeriesColumns>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SeriesColumns& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeriesColumns& from) {
+    SeriesColumns::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ReadResult* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReadResult& from);
-  void MergeFrom(const ReadResult& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ReadResult* other);
-  protected:
-  explicit ReadResult(::google::protobuf::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SeriesColumns* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SeriesColumns";
   }
+  protected:
+  explicit SeriesColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .vqro.rpc.Series series = 1;
-  bool has_series() const;
-  void clear_series();
-  static const int kSeriesFieldNumber = 1;
+  enum : int {
+    kTimestampsFieldNumber = 2,
+    kValuesFieldNumber = 3,
+    kDurationsFieldNumber = 4,
+    kSeriesHandleFieldNumber = 5,
+    kSeriesIndexFieldNumber = 1,
+  };
+  // repeated int64 timestamps = 2;
+  int timestamps_size() const;
   private:
-  void _slow_mutable_series();
-  void _slow_set_allocated_series(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::Series** series);
-  ::vqro::rpc::Series* _slow_release_series();
+  int _internal_timestamps_size() const;
   public:
-  const ::vqro::rpc::Series& series() const;
-  ::vqro::rpc::Series* mutable_series();
-  ::vqro::rpc::Series* release_series();
-  void set_allocated_series(::vqro::rpc::Series* series);
-  ::vqro::rpc::Series* unsafe_arena_release_series();
-  void unsafe_arena_set_allocated_series(
-      ::vqro::rpc::Series* series);
-
-  // repeated .vqro.rpc.Datapoint datapoints = 2;
-  int datapoints_size() const;
-  void clear_datapoints();
-  static const int kDatapointsFieldNumber = 2;
-  const ::vqro::rpc::Datapoint& datapoints(int index) const;
-  ::vqro::rpc::Datapoint* mutable_datapoints(int index);
-  ::vqro::rpc::Datapoint* add_datapoints();
-  const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
-      datapoints() const;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
+  void clear_timestamps();
+  private:
+  int64_t _internal_timestamps(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_timestamps() const;
+  void _internal_add_timestamps(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_timestamps();
+  public:
+  int64_t timestamps(int index) const;
+  void set_timestamps(int index, int64_t value);
+  void add_timestamps(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      timestamps() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_timestamps();
+
+  // repeated double values = 3;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  private:
+  double _internal_values(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_values() const;
+  void _internal_add_values(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_values();
+  public:
+  double values(int index) const;
+  void set_values(int index, double value);
+  void add_values(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_values();
+
+  // repeated int64 durations = 4;
+  int durations_size() const;
+  private:
+  int _internal_durations_size() const;
+  public:
+  void clear_durations();
+  private:
+  int64_t _internal_durations(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_durations() const;
+  void _internal_add_durations(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_durations();
+  public:
+  int64_t durations(int index) const;
+  void set_durations(int index, int64_t value);
+  void add_durations(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      durations() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_durations();
+
+  // fixed64 series_handle = 5;
+  void clear_series_handle();
+  uint64_t series_handle() const;
+  void set_series_handle(uint64_t value);
+  private:
+  uint64_t _internal_series_handle() const;
+  void _internal_set_series_handle(uint64_t value);
+  public:
+
+  // uint32 series_index = 1;
+  void clear_series_index();
+  uint32_t series_index() const;
+  void set_series_index(uint32_t value);
+  private:
+  uint32_t _internal_series_index() const;
+  void _internal_set_series_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:vqro.rpc.SeriesColumns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > timestamps_;
+    mutable std::atomic<int> _timestamps_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > values_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > durations_;
+    mutable std::atomic<int> _durations_cached_byte_size_;
+    uint64_t series_handle_;
+    uint32_t series_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadOperation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.ReadOperation) */ {
+ public:
+  inline ReadOperation() : ReadOperation(nullptr) {}
+  ~ReadOperation() override;
+  explicit PROTOBUF_CONSTEXPR ReadOperation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadOperation(const ReadOperation& from);
+  ReadOperation(ReadOperation&& from) noexcept
+    : ReadOperation() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadOperation& operator=(const ReadOperation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadOperation& operator=(ReadOperation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadOperation& default_instance() {
+    return *internal_default_instance();
+  }
+  enum SelectorCase {
+    kQuery = 1,
+    kList = 2,
+    kHandles = 7,
+    SELECTOR_NOT_SET = 0,
+  };
+
+  static inline const ReadOperation* internal_default_instance() {
+    return reinterpret_cast<const ReadOperation*>(
+               &_ReadOperation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ReadOperation& a, ReadOperation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadOperation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadOperation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadOperation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadOperation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadOperation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadOperation& from) {
+    ReadOperation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadOperation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.ReadOperation";
+  }
+  protected:
+  explicit ReadOperation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ReadOperation_Aggregate Aggregate;
+  static constexpr Aggregate AVG =
+    ReadOperation_Aggregate_AVG;
+  static constexpr Aggregate MIN =
+    ReadOperation_Aggregate_MIN;
+  static constexpr Aggregate MAX =
+    ReadOperation_Aggregate_MAX;
+  static constexpr Aggregate SUM =
+    ReadOperation_Aggregate_SUM;
+  static constexpr Aggregate COUNT =
+    ReadOperation_Aggregate_COUNT;
+  static inline bool Aggregate_IsValid(int value) {
+    return ReadOperation_Aggregate_IsValid(value);
+  }
+  static constexpr Aggregate Aggregate_MIN =
+    ReadOperation_Aggregate_Aggregate_MIN;
+  static constexpr Aggregate Aggregate_MAX =
+    ReadOperation_Aggregate_Aggregate_MAX;
+  static constexpr int Aggregate_ARRAYSIZE =
+    ReadOperation_Aggregate_Aggregate_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Aggregate_descriptor() {
+    return ReadOperation_Aggregate_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Aggregate_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Aggregate>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Aggregate_Name.");
+    return ReadOperation_Aggregate_Name(enum_t_value);
+  }
+  static inline bool Aggregate_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Aggregate* value) {
+    return ReadOperation_Aggregate_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartTimeFieldNumber = 3,
+    kEndTimeFieldNumber = 4,
+    kDatapointLimitFieldNumber = 5,
+    kPreferLatestFieldNumber = 6,
+    kAggregateFieldNumber = 9,
+    kStepFieldNumber = 8,
+    kQueryFieldNumber = 1,
+    kListFieldNumber = 2,
+    kHandlesFieldNumber = 7,
+  };
+  // int64 start_time = 3;
+  void clear_start_time();
+  int64_t start_time() const;
+  void set_start_time(int64_t value);
+  private:
+  int64_t _internal_start_time() const;
+  void _internal_set_start_time(int64_t value);
+  public:
+
+  // int64 end_time = 4;
+  void clear_end_time();
+  int64_t end_time() const;
+  void set_end_time(int64_t value);
+  private:
+  int64_t _internal_end_time() const;
+  void _internal_set_end_time(int64_t value);
+  public:
+
+  // int64 datapoint_limit = 5;
+  void clear_datapoint_limit();
+  int64_t datapoint_limit() const;
+  void set_datapoint_limit(int64_t value);
+  private:
+  int64_t _internal_datapoint_limit() const;
+  void _internal_set_datapoint_limit(int64_t value);
+  public:
+
+  // bool prefer_latest = 6;
+  void clear_prefer_latest();
+  bool prefer_latest() const;
+  void set_prefer_latest(bool value);
+  private:
+  bool _internal_prefer_latest() const;
+  void _internal_set_prefer_latest(bool value);
+  public:
+
+  // .vqro.rpc.ReadOperation.Aggregate aggregate = 9;
+  void clear_aggregate();
+  ::vqro::rpc::ReadOperation_Aggregate aggregate() const;
+  void set_aggregate(::vqro::rpc::ReadOperation_Aggregate value);
+  private:
+  ::vqro::rpc::ReadOperation_Aggregate _internal_aggregate() const;
+  void _internal_set_aggregate(::vqro::rpc::ReadOperation_Aggregate value);
+  public:
+
+  // int64 step = 8;
+  void clear_step();
+  int64_t step() const;
+  void set_step(int64_t value);
+  private:
+  int64_t _internal_step() const;
+  void _internal_set_step(int64_t value);
+  public:
+
+  // .vqro.rpc.SeriesQuery query = 1;
+  bool has_query() const;
+  private:
+  bool _internal_has_query() const;
+  public:
+  void clear_query();
+  const ::vqro::rpc::SeriesQuery& query() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::SeriesQuery* release_query();
+  ::vqro::rpc::SeriesQuery* mutable_query();
+  void set_allocated_query(::vqro::rpc::SeriesQuery* query);
+  private:
+  const ::vqro::rpc::SeriesQuery& _internal_query() const;
+  ::vqro::rpc::SeriesQuery* _internal_mutable_query();
+  public:
+  void unsafe_arena_set_allocated_query(
+      ::vqro::rpc::SeriesQuery* query);
+  ::vqro::rpc::SeriesQuery* unsafe_arena_release_query();
+
+  // .vqro.rpc.SeriesList list = 2;
+  bool has_list() const;
+  private:
+  bool _internal_has_list() const;
+  public:
+  void clear_list();
+  const ::vqro::rpc::SeriesList& list() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::SeriesList* release_list();
+  ::vqro::rpc::SeriesList* mutable_list();
+  void set_allocated_list(::vqro::rpc::SeriesList* list);
+  private:
+  const ::vqro::rpc::SeriesList& _internal_list() const;
+  ::vqro::rpc::SeriesList* _internal_mutable_list();
+  public:
+  void unsafe_arena_set_allocated_list(
+      ::vqro::rpc::SeriesList* list);
+  ::vqro::rpc::SeriesList* unsafe_arena_release_list();
+
+  // .vqro.rpc.SeriesHandles handles = 7;
+  bool has_handles() const;
+  private:
+  bool _internal_has_handles() const;
+  public:
+  void clear_handles();
+  const ::vqro::rpc::SeriesHandles& handles() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::SeriesHandles* release_handles();
+  ::vqro::rpc::SeriesHandles* mutable_handles();
+  void set_allocated_handles(::vqro::rpc::SeriesHandles* handles);
+  private:
+  const ::vqro::rpc::SeriesHandles& _internal_handles() const;
+  ::vqro::rpc::SeriesHandles* _internal_mutable_handles();
+  public:
+  void unsafe_arena_set_allocated_handles(
+      ::vqro::rpc::SeriesHandles* handles);
+  ::vqro::rpc::SeriesHandles* unsafe_arena_release_handles();
+
+  void clear_selector();
+  SelectorCase selector_case() const;
+  // @@protoc_insertion_point(class_scope:vqro.rpc.ReadOperation)
+ private:
+  class _Internal;
+  void set_has_query();
+  void set_has_list();
+  void set_has_handles();
+
+  inline bool has_selector() const;
+  inline void clear_has_selector();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t start_time_;
+    int64_t end_time_;
+    int64_t datapoint_limit_;
+    bool prefer_latest_;
+    int aggregate_;
+    int64_t step_;
+    union SelectorUnion {
+      constexpr SelectorUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::vqro::rpc::SeriesQuery* query_;
+      ::vqro::rpc::SeriesList* list_;
+      ::vqro::rpc::SeriesHandles* handles_;
+    } selector_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SeriesList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.SeriesList) */ {
+ public:
+  inline SeriesList() : SeriesList(nullptr) {}
+  ~SeriesList() override;
+  explicit PROTOBUF_CONSTEXPR SeriesList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SeriesList(const SeriesList& from);
+  SeriesList(SeriesList&& from) noexcept
+    : SeriesList() {
+    *this = ::std::move(from);
+  }
+
+  inline SeriesList& operator=(const SeriesList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SeriesList& operator=(SeriesList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeriesList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SeriesList* internal_default_instance() {
+    return reinterpret_cast<const SeriesList*>(
+               &_SeriesList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SeriesList& a, SeriesList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeriesList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeriesList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SeriesList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeriesList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SeriesList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeriesList& from) {
+    SeriesList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SeriesList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.SeriesList";
+  }
+  protected:
+  explicit SeriesList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeriesFieldNumber = 1,
+  };
+  // repeated .vqro.rpc.Series series = 1;
+  int series_size() const;
+  private:
+  int _internal_series_size() const;
+  public:
+  void clear_series();
+  ::vqro::rpc::Series* mutable_series(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+      mutable_series();
+  private:
+  const ::vqro::rpc::Series& _internal_series(int index) const;
+  ::vqro::rpc::Series* _internal_add_series();
+  public:
+  const ::vqro::rpc::Series& series(int index) const;
+  ::vqro::rpc::Series* add_series();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
+      series() const;
+
+  // @@protoc_insertion_point(class_scope:vqro.rpc.SeriesList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series > series_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:vqro.rpc.ReadResult) */ {
+ public:
+  inline ReadResult() : ReadResult(nullptr) {}
+  ~ReadResult() override;
+  explicit PROTOBUF_CONSTEXPR ReadResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadResult(const ReadResult& from);
+  ReadResult(ReadResult&& from) noexcept
+    : ReadResult() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadResult& operator=(const ReadResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadResult& operator=(ReadResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadResult* internal_default_instance() {
+    return reinterpret_cast<const ReadResult*>(
+               &_ReadResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ReadResult& a, ReadResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadResult& from) {
+    ReadResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "vqro.rpc.ReadResult";
+  }
+  protected:
+  explicit ReadResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDatapointsFieldNumber = 2,
+    kSeriesFieldNumber = 1,
+    kStatusFieldNumber = 3,
+    kSeriesHandleFieldNumber = 4,
+  };
+  // repeated .vqro.rpc.Datapoint datapoints = 2;
+  int datapoints_size() const;
+  private:
+  int _internal_datapoints_size() const;
+  public:
+  void clear_datapoints();
+  ::vqro::rpc::Datapoint* mutable_datapoints(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >*
       mutable_datapoints();
+  private:
+  const ::vqro::rpc::Datapoint& _internal_datapoints(int index) const;
+  ::vqro::rpc::Datapoint* _internal_add_datapoints();
+  public:
+  const ::vqro::rpc::Datapoint& datapoints(int index) const;
+  ::vqro::rpc::Datapoint* add_datapoints();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >&
+      datapoints() const;
+
+  // .vqro.rpc.Series series = 1;
+  bool has_series() const;
+  private:
+  bool _internal_has_series() const;
+  public:
+  void clear_series();
+  const ::vqro::rpc::Series& series() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::Series* release_series();
+  ::vqro::rpc::Series* mutable_series();
+  void set_allocated_series(::vqro::rpc::Series* series);
+  private:
+  const ::vqro::rpc::Series& _internal_series() const;
+  ::vqro::rpc::Series* _internal_mutable_series();
+  public:
+  void unsafe_arena_set_allocated_series(
+      ::vqro::rpc::Series* series);
+  ::vqro::rpc::Series* unsafe_arena_release_series();
 
-  // optional .vqro.rpc.StatusMessage status = 3;
+  // .vqro.rpc.StatusMessage status = 3;
   bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 3;
   private:
-  void _slow_mutable_status();
-  void _slow_set_allocated_status(
-      ::google::protobuf::Arena* message_arena, ::vqro::rpc::StatusMessage** status);
-  ::vqro::rpc::StatusMessage* _slow_release_status();
+  bool _internal_has_status() const;
   public:
+  void clear_status();
   const ::vqro::rpc::StatusMessage& status() const;
+  PROTOBUF_NODISCARD ::vqro::rpc::StatusMessage* release_status();
   ::vqro::rpc::StatusMessage* mutable_status();
-  ::vqro::rpc::StatusMessage* release_status();
   void set_allocated_status(::vqro::rpc::StatusMessage* status);
-  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
+  private:
+  const ::vqro::rpc::StatusMessage& _internal_status() const;
+  ::vqro::rpc::StatusMessage* _internal_mutable_status();
+  public:
   void unsafe_arena_set_allocated_status(
       ::vqro::rpc::StatusMessage* status);
+  ::vqro::rpc::StatusMessage* unsafe_arena_release_status();
+
+  // fixed64 series_handle = 4;
+  void clear_series_handle();
+  uint64_t series_handle() const;
+  void set_series_handle(uint64_t value);
+  private:
+  uint64_t _internal_series_handle() const;
+  void _internal_set_series_handle(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:vqro.rpc.ReadResult)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  friend class ::google::protobuf::Arena;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  bool _is_default_instance_;
-  ::vqro::rpc::Series* series_;
-  ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint > datapoints_;
-  ::vqro::rpc::StatusMessage* status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_storage_2eproto();
-  friend void protobuf_AssignDesc_storage_2eproto();
-  friend void protobuf_ShutdownFile_storage_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReadResult* default_instance_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint > datapoints_;
+    ::vqro::rpc::Series* series_;
+    ::vqro::rpc::StatusMessage* status_;
+    uint64_t series_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_storage_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SeriesHandles
+
+// repeated fixed64 handles = 1;
+inline int SeriesHandles::_internal_handles_size() const {
+  return _impl_.handles_.size();
+}
+inline int SeriesHandles::handles_size() const {
+  return _internal_handles_size();
+}
+inline void SeriesHandles::clear_handles() {
+  _impl_.handles_.Clear();
+}
+inline uint64_t SeriesHandles::_internal_handles(int index) const {
+  return _impl_.handles_.Get(index);
+}
+inline uint64_t SeriesHandles::handles(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesHandles.handles)
+  return _internal_handles(index);
+}
+inline void SeriesHandles::set_handles(int index, uint64_t value) {
+  _impl_.handles_.Set(index, value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesHandles.handles)
+}
+inline void SeriesHandles::_internal_add_handles(uint64_t value) {
+  _impl_.handles_.Add(value);
+}
+inline void SeriesHandles::add_handles(uint64_t value) {
+  _internal_add_handles(value);
+  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesHandles.handles)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SeriesHandles::_internal_handles() const {
+  return _impl_.handles_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SeriesHandles::handles() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesHandles.handles)
+  return _internal_handles();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SeriesHandles::_internal_mutable_handles() {
+  return &_impl_.handles_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SeriesHandles::mutable_handles() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesHandles.handles)
+  return _internal_mutable_handles();
+}
+
+// -------------------------------------------------------------------
+
 // WriteOperation
 
-// optional .vqro.rpc.Series series = 1;
-inline bool WriteOperation::has_series() const {
-  return !_is_default_instance_ && series_ != NULL;
+// .vqro.rpc.Series series = 1;
+inline bool WriteOperation::_internal_has_series() const {
+  return this != internal_default_instance() && _impl_.series_ != nullptr;
+}
+inline bool WriteOperation::has_series() const {
+  return _internal_has_series();
+}
+inline const ::vqro::rpc::Series& WriteOperation::_internal_series() const {
+  const ::vqro::rpc::Series* p = _impl_.series_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::Series&>(
+      ::vqro::rpc::_Series_default_instance_);
+}
+inline const ::vqro::rpc::Series& WriteOperation::series() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.series)
+  return _internal_series();
+}
+inline void WriteOperation::unsafe_arena_set_allocated_series(
+    ::vqro::rpc::Series* series) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.series_);
+  }
+  _impl_.series_ = series;
+  if (series) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.WriteOperation.series)
+}
+inline ::vqro::rpc::Series* WriteOperation::release_series() {
+  
+  ::vqro::rpc::Series* temp = _impl_.series_;
+  _impl_.series_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::vqro::rpc::Series* WriteOperation::unsafe_arena_release_series() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.WriteOperation.series)
+  
+  ::vqro::rpc::Series* temp = _impl_.series_;
+  _impl_.series_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::Series* WriteOperation::_internal_mutable_series() {
+  
+  if (_impl_.series_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::Series>(GetArenaForAllocation());
+    _impl_.series_ = p;
+  }
+  return _impl_.series_;
+}
+inline ::vqro::rpc::Series* WriteOperation::mutable_series() {
+  ::vqro::rpc::Series* _msg = _internal_mutable_series();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.series)
+  return _msg;
+}
+inline void WriteOperation::set_allocated_series(::vqro::rpc::Series* series) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.series_);
+  }
+  if (series) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(series));
+    if (message_arena != submessage_arena) {
+      series = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, series, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.series_ = series;
+  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.WriteOperation.series)
+}
+
+// repeated .vqro.rpc.Datapoint datapoints = 2;
+inline int WriteOperation::_internal_datapoints_size() const {
+  return _impl_.datapoints_.size();
+}
+inline int WriteOperation::datapoints_size() const {
+  return _internal_datapoints_size();
+}
+inline ::vqro::rpc::Datapoint* WriteOperation::mutable_datapoints(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.datapoints)
+  return _impl_.datapoints_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >*
+WriteOperation::mutable_datapoints() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.WriteOperation.datapoints)
+  return &_impl_.datapoints_;
+}
+inline const ::vqro::rpc::Datapoint& WriteOperation::_internal_datapoints(int index) const {
+  return _impl_.datapoints_.Get(index);
+}
+inline const ::vqro::rpc::Datapoint& WriteOperation::datapoints(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.datapoints)
+  return _internal_datapoints(index);
+}
+inline ::vqro::rpc::Datapoint* WriteOperation::_internal_add_datapoints() {
+  return _impl_.datapoints_.Add();
+}
+inline ::vqro::rpc::Datapoint* WriteOperation::add_datapoints() {
+  ::vqro::rpc::Datapoint* _add = _internal_add_datapoints();
+  // @@protoc_insertion_point(field_add:vqro.rpc.WriteOperation.datapoints)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >&
+WriteOperation::datapoints() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.WriteOperation.datapoints)
+  return _impl_.datapoints_;
+}
+
+// fixed64 series_handle = 3;
+inline void WriteOperation::clear_series_handle() {
+  _impl_.series_handle_ = uint64_t{0u};
+}
+inline uint64_t WriteOperation::_internal_series_handle() const {
+  return _impl_.series_handle_;
+}
+inline uint64_t WriteOperation::series_handle() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.series_handle)
+  return _internal_series_handle();
+}
+inline void WriteOperation::_internal_set_series_handle(uint64_t value) {
+  
+  _impl_.series_handle_ = value;
+}
+inline void WriteOperation::set_series_handle(uint64_t value) {
+  _internal_set_series_handle(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.WriteOperation.series_handle)
+}
+
+// -------------------------------------------------------------------
+
+// WriteBatch
+
+// repeated .vqro.rpc.Series series = 1;
+inline int WriteBatch::_internal_series_size() const {
+  return _impl_.series_.size();
+}
+inline int WriteBatch::series_size() const {
+  return _internal_series_size();
+}
+inline ::vqro::rpc::Series* WriteBatch::mutable_series(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteBatch.series)
+  return _impl_.series_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+WriteBatch::mutable_series() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.WriteBatch.series)
+  return &_impl_.series_;
+}
+inline const ::vqro::rpc::Series& WriteBatch::_internal_series(int index) const {
+  return _impl_.series_.Get(index);
+}
+inline const ::vqro::rpc::Series& WriteBatch::series(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.WriteBatch.series)
+  return _internal_series(index);
+}
+inline ::vqro::rpc::Series* WriteBatch::_internal_add_series() {
+  return _impl_.series_.Add();
+}
+inline ::vqro::rpc::Series* WriteBatch::add_series() {
+  ::vqro::rpc::Series* _add = _internal_add_series();
+  // @@protoc_insertion_point(field_add:vqro.rpc.WriteBatch.series)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
+WriteBatch::series() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.WriteBatch.series)
+  return _impl_.series_;
+}
+
+// repeated .vqro.rpc.SeriesColumns columns = 2;
+inline int WriteBatch::_internal_columns_size() const {
+  return _impl_.columns_.size();
+}
+inline int WriteBatch::columns_size() const {
+  return _internal_columns_size();
+}
+inline void WriteBatch::clear_columns() {
+  _impl_.columns_.Clear();
+}
+inline ::vqro::rpc::SeriesColumns* WriteBatch::mutable_columns(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteBatch.columns)
+  return _impl_.columns_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::SeriesColumns >*
+WriteBatch::mutable_columns() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.WriteBatch.columns)
+  return &_impl_.columns_;
+}
+inline const ::vqro::rpc::SeriesColumns& WriteBatch::_internal_columns(int index) const {
+  return _impl_.columns_.Get(index);
+}
+inline const ::vqro::rpc::SeriesColumns& WriteBatch::columns(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.WriteBatch.columns)
+  return _internal_columns(index);
+}
+inline ::vqro::rpc::SeriesColumns* WriteBatch::_internal_add_columns() {
+  return _impl_.columns_.Add();
+}
+inline ::vqro::rpc::SeriesColumns* WriteBatch::add_columns() {
+  ::vqro::rpc::SeriesColumns* _add = _internal_add_columns();
+  // @@protoc_insertion_point(field_add:vqro.rpc.WriteBatch.columns)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::SeriesColumns >&
+WriteBatch::columns() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.WriteBatch.columns)
+  return _impl_.columns_;
+}
+
+// -------------------------------------------------------------------
+
+// SeriesColumns
+
+// uint32 series_index = 1;
+inline void SeriesColumns::clear_series_index() {
+  _impl_.series_index_ = 0u;
+}
+inline uint32_t SeriesColumns::_internal_series_index() const {
+  return _impl_.series_index_;
+}
+inline uint32_t SeriesColumns::series_index() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesColumns.series_index)
+  return _internal_series_index();
+}
+inline void SeriesColumns::_internal_set_series_index(uint32_t value) {
+  
+  _impl_.series_index_ = value;
+}
+inline void SeriesColumns::set_series_index(uint32_t value) {
+  _internal_set_series_index(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesColumns.series_index)
+}
+
+// repeated int64 timestamps = 2;
+inline int SeriesColumns::_internal_timestamps_size() const {
+  return _impl_.timestamps_.size();
+}
+inline int SeriesColumns::timestamps_size() const {
+  return _internal_timestamps_size();
+}
+inline void SeriesColumns::clear_timestamps() {
+  _impl_.timestamps_.Clear();
+}
+inline int64_t SeriesColumns::_internal_timestamps(int index) const {
+  return _impl_.timestamps_.Get(index);
+}
+inline int64_t SeriesColumns::timestamps(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesColumns.timestamps)
+  return _internal_timestamps(index);
+}
+inline void SeriesColumns::set_timestamps(int index, int64_t value) {
+  _impl_.timestamps_.Set(index, value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesColumns.timestamps)
+}
+inline void SeriesColumns::_internal_add_timestamps(int64_t value) {
+  _impl_.timestamps_.Add(value);
+}
+inline void SeriesColumns::add_timestamps(int64_t value) {
+  _internal_add_timestamps(value);
+  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesColumns.timestamps)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+SeriesColumns::_internal_timestamps() const {
+  return _impl_.timestamps_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+SeriesColumns::timestamps() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesColumns.timestamps)
+  return _internal_timestamps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+SeriesColumns::_internal_mutable_timestamps() {
+  return &_impl_.timestamps_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+SeriesColumns::mutable_timestamps() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesColumns.timestamps)
+  return _internal_mutable_timestamps();
+}
+
+// repeated double values = 3;
+inline int SeriesColumns::_internal_values_size() const {
+  return _impl_.values_.size();
 }
-inline void WriteOperation::clear_series() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
+inline int SeriesColumns::values_size() const {
+  return _internal_values_size();
 }
-inline const ::vqro::rpc::Series& WriteOperation::series() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.series)
-  return series_ != NULL ? *series_ : *default_instance_->series_;
+inline void SeriesColumns::clear_values() {
+  _impl_.values_.Clear();
 }
-inline ::vqro::rpc::Series* WriteOperation::mutable_series() {
-  
-  if (series_ == NULL) {
-    _slow_mutable_series();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.series)
-  return series_;
+inline double SeriesColumns::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
 }
-inline ::vqro::rpc::Series* WriteOperation::release_series() {
-  
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_series();
-  } else {
-    ::vqro::rpc::Series* temp = series_;
-    series_ = NULL;
-    return temp;
-  }
+inline double SeriesColumns::values(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesColumns.values)
+  return _internal_values(index);
 }
-inline void WriteOperation::set_allocated_series(::vqro::rpc::Series* series) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete series_;
-  }
-  if (series != NULL) {
-    _slow_set_allocated_series(message_arena, &series);
-  }
-  series_ = series;
-  if (series) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.WriteOperation.series)
+inline void SeriesColumns::set_values(int index, double value) {
+  _impl_.values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesColumns.values)
+}
+inline void SeriesColumns::_internal_add_values(double value) {
+  _impl_.values_.Add(value);
+}
+inline void SeriesColumns::add_values(double value) {
+  _internal_add_values(value);
+  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesColumns.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+SeriesColumns::_internal_values() const {
+  return _impl_.values_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+SeriesColumns::values() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesColumns.values)
+  return _internal_values();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+SeriesColumns::_internal_mutable_values() {
+  return &_impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+SeriesColumns::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesColumns.values)
+  return _internal_mutable_values();
 }
 
-// repeated .vqro.rpc.Datapoint datapoints = 2;
-inline int WriteOperation::datapoints_size() const {
-  return datapoints_.size();
+// repeated int64 durations = 4;
+inline int SeriesColumns::_internal_durations_size() const {
+  return _impl_.durations_.size();
 }
-inline void WriteOperation::clear_datapoints() {
-  datapoints_.Clear();
+inline int SeriesColumns::durations_size() const {
+  return _internal_durations_size();
 }
-inline const ::vqro::rpc::Datapoint& WriteOperation::datapoints(int index) const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Get(index);
+inline void SeriesColumns::clear_durations() {
+  _impl_.durations_.Clear();
 }
-inline ::vqro::rpc::Datapoint* WriteOperation::mutable_datapoints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Mutable(index);
+inline int64_t SeriesColumns::_internal_durations(int index) const {
+  return _impl_.durations_.Get(index);
 }
-inline ::vqro::rpc::Datapoint* WriteOperation::add_datapoints() {
-  // @@protoc_insertion_point(field_add:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_.Add();
+inline int64_t SeriesColumns::durations(int index) const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesColumns.durations)
+  return _internal_durations(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
-WriteOperation::datapoints() const {
-  // @@protoc_insertion_point(field_list:vqro.rpc.WriteOperation.datapoints)
-  return datapoints_;
+inline void SeriesColumns::set_durations(int index, int64_t value) {
+  _impl_.durations_.Set(index, value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesColumns.durations)
 }
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
-WriteOperation::mutable_datapoints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.WriteOperation.datapoints)
-  return &datapoints_;
+inline void SeriesColumns::_internal_add_durations(int64_t value) {
+  _impl_.durations_.Add(value);
+}
+inline void SeriesColumns::add_durations(int64_t value) {
+  _internal_add_durations(value);
+  // @@protoc_insertion_point(field_add:vqro.rpc.SeriesColumns.durations)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+SeriesColumns::_internal_durations() const {
+  return _impl_.durations_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+SeriesColumns::durations() const {
+  // @@protoc_insertion_point(field_list:vqro.rpc.SeriesColumns.durations)
+  return _internal_durations();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+SeriesColumns::_internal_mutable_durations() {
+  return &_impl_.durations_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+SeriesColumns::mutable_durations() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesColumns.durations)
+  return _internal_mutable_durations();
+}
+
+// fixed64 series_handle = 5;
+inline void SeriesColumns::clear_series_handle() {
+  _impl_.series_handle_ = uint64_t{0u};
+}
+inline uint64_t SeriesColumns::_internal_series_handle() const {
+  return _impl_.series_handle_;
+}
+inline uint64_t SeriesColumns::series_handle() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.SeriesColumns.series_handle)
+  return _internal_series_handle();
+}
+inline void SeriesColumns::_internal_set_series_handle(uint64_t value) {
+  
+  _impl_.series_handle_ = value;
+}
+inline void SeriesColumns::set_series_handle(uint64_t value) {
+  _internal_set_series_handle(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.SeriesColumns.series_handle)
 }
 
 // -------------------------------------------------------------------
 
 // ReadOperation
 
-// optional .vqro.rpc.SeriesQuery query = 1;
-inline bool ReadOperation::has_query() const {
+// .vqro.rpc.SeriesQuery query = 1;
+inline bool ReadOperation::_internal_has_query() const {
   return selector_case() == kQuery;
 }
-inline void ReadOperation::set_has_query() {
-  _oneof_case_[0] = kQuery;
-}
-inline void ReadOperation::clear_query() {
-  if (has_query()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete selector_.query_;
-    }
-    clear_has_selector();
-  }
-}
-inline const ::vqro::rpc::SeriesQuery& ReadOperation::query() const {
-  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.query)
-  return has_query() ? *selector_.query_
-                      : ::vqro::rpc::SeriesQuery::default_instance();
+inline bool ReadOperation::has_query() const {
+  return _internal_has_query();
 }
-inline ::vqro::rpc::SeriesQuery* ReadOperation::mutable_query() {
-  if (!has_query()) {
-    clear_selector();
-    set_has_query();
-    selector_.query_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesQuery >(
-      GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.query)
-  return selector_.query_;
+inline void ReadOperation::set_has_query() {
+  _impl_._oneof_case_[0] = kQuery;
 }
 inline ::vqro::rpc::SeriesQuery* ReadOperation::release_query() {
-  if (has_query()) {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ReadOperation.query)
+  if (_internal_has_query()) {
     clear_has_selector();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::SeriesQuery* temp = new ::vqro::rpc::SeriesQuery;
-      temp->MergeFrom(*selector_.query_);
-      selector_.query_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::SeriesQuery* temp = selector_.query_;
-      selector_.query_ = NULL;
-      return temp;
+    ::vqro::rpc::SeriesQuery* temp = _impl_.selector_.query_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
+    _impl_.selector_.query_ = nullptr;
+    return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::vqro::rpc::SeriesQuery& ReadOperation::_internal_query() const {
+  return _internal_has_query()
+      ? *_impl_.selector_.query_
+      : reinterpret_cast< ::vqro::rpc::SeriesQuery&>(::vqro::rpc::_SeriesQuery_default_instance_);
+}
+inline const ::vqro::rpc::SeriesQuery& ReadOperation::query() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.query)
+  return _internal_query();
+}
 inline ::vqro::rpc::SeriesQuery* ReadOperation::unsafe_arena_release_query() {
-  if (has_query()) {
+  // @@protoc_insertion_point(field_unsafe_arena_release:vqro.rpc.ReadOperation.query)
+  if (_internal_has_query()) {
     clear_has_selector();
-    ::vqro::rpc::SeriesQuery* temp = selector_.query_;
-    selector_.query_ = NULL;
+    ::vqro::rpc::SeriesQuery* temp = _impl_.selector_.query_;
+    _impl_.selector_.query_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void ReadOperation::set_allocated_query(::vqro::rpc::SeriesQuery* query) {
+inline void ReadOperation::unsafe_arena_set_allocated_query(::vqro::rpc::SeriesQuery* query) {
   clear_selector();
   if (query) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(query) == NULL) {
-      GetArenaNoVirtual()->Own(query);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(query)) {
-      ::vqro::rpc::SeriesQuery* new_query = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesQuery >(
-          GetArenaNoVirtual());
-      new_query->CopyFrom(*query);
-      query = new_query;
-    }
     set_has_query();
-    selector_.query_ = query;
+    _impl_.selector_.query_ = query;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.query)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.query)
 }
-inline void ReadOperation::unsafe_arena_set_allocated_query(::vqro::rpc::SeriesQuery* query) {
-  clear_selector();
-  if (query) {
+inline ::vqro::rpc::SeriesQuery* ReadOperation::_internal_mutable_query() {
+  if (!_internal_has_query()) {
+    clear_selector();
     set_has_query();
-    selector_.query_ = query;
+    _impl_.selector_.query_ = CreateMaybeMessage< ::vqro::rpc::SeriesQuery >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.query)
+  return _impl_.selector_.query_;
+}
+inline ::vqro::rpc::SeriesQuery* ReadOperation::mutable_query() {
+  ::vqro::rpc::SeriesQuery* _msg = _internal_mutable_query();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.query)
+  return _msg;
 }
 
-// optional .vqro.rpc.SeriesList list = 2;
-inline bool ReadOperation::has_list() const {
+// .vqro.rpc.SeriesList list = 2;
+inline bool ReadOperation::_internal_has_list() const {
   return selector_case() == kList;
 }
+inline bool ReadOperation::has_list() const {
+  return _internal_has_list();
+}
 inline void ReadOperation::set_has_list() {
-  _oneof_case_[0] = kList;
+  _impl_._oneof_case_[0] = kList;
 }
 inline void ReadOperation::clear_list() {
-  if (has_list()) {
-    if (GetArenaNoVirtual() == NULL) {
-      delete selector_.list_;
+  if (_internal_has_list()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.selector_.list_;
     }
     clear_has_selector();
   }
 }
+inline ::vqro::rpc::SeriesList* ReadOperation::release_list() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ReadOperation.list)
+  if (_internal_has_list()) {
+    clear_has_selector();
+    ::vqro::rpc::SeriesList* temp = _impl_.selector_.list_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.selector_.list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::vqro::rpc::SeriesList& ReadOperation::_internal_list() const {
+  return _internal_has_list()
+      ? *_impl_.selector_.list_
+      : reinterpret_cast< ::vqro::rpc::SeriesList&>(::vqro::rpc::_SeriesList_default_instance_);
+}
 inline const ::vqro::rpc::SeriesList& ReadOperation::list() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.list)
-  return has_list() ? *selector_.list_
-                      : ::vqro::rpc::SeriesList::default_instance();
+  return _internal_list();
 }
-inline ::vqro::rpc::SeriesList* ReadOperation::mutable_list() {
-  if (!has_list()) {
+inline ::vqro::rpc::SeriesList* ReadOperation::unsafe_arena_release_list() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:vqro.rpc.ReadOperation.list)
+  if (_internal_has_list()) {
+    clear_has_selector();
+    ::vqro::rpc::SeriesList* temp = _impl_.selector_.list_;
+    _impl_.selector_.list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ReadOperation::unsafe_arena_set_allocated_list(::vqro::rpc::SeriesList* list) {
+  clear_selector();
+  if (list) {
+    set_has_list();
+    _impl_.selector_.list_ = list;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.list)
+}
+inline ::vqro::rpc::SeriesList* ReadOperation::_internal_mutable_list() {
+  if (!_internal_has_list()) {
     clear_selector();
     set_has_list();
-    selector_.list_ = 
-      ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesList >(
-      GetArenaNoVirtual());
+    _impl_.selector_.list_ = CreateMaybeMessage< ::vqro::rpc::SeriesList >(GetArenaForAllocation());
   }
+  return _impl_.selector_.list_;
+}
+inline ::vqro::rpc::SeriesList* ReadOperation::mutable_list() {
+  ::vqro::rpc::SeriesList* _msg = _internal_mutable_list();
   // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.list)
-  return selector_.list_;
+  return _msg;
 }
-inline ::vqro::rpc::SeriesList* ReadOperation::release_list() {
-  if (has_list()) {
+
+// .vqro.rpc.SeriesHandles handles = 7;
+inline bool ReadOperation::_internal_has_handles() const {
+  return selector_case() == kHandles;
+}
+inline bool ReadOperation::has_handles() const {
+  return _internal_has_handles();
+}
+inline void ReadOperation::set_has_handles() {
+  _impl_._oneof_case_[0] = kHandles;
+}
+inline void ReadOperation::clear_handles() {
+  if (_internal_has_handles()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.selector_.handles_;
+    }
     clear_has_selector();
-    if (GetArenaNoVirtual() != NULL) {
-      ::vqro::rpc::SeriesList* temp = new ::vqro::rpc::SeriesList;
-      temp->MergeFrom(*selector_.list_);
-      selector_.list_ = NULL;
-      return temp;
-    } else {
-      ::vqro::rpc::SeriesList* temp = selector_.list_;
-      selector_.list_ = NULL;
-      return temp;
+  }
+}
+inline ::vqro::rpc::SeriesHandles* ReadOperation::release_handles() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ReadOperation.handles)
+  if (_internal_has_handles()) {
+    clear_has_selector();
+    ::vqro::rpc::SeriesHandles* temp = _impl_.selector_.handles_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
+    _impl_.selector_.handles_ = nullptr;
+    return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline ::vqro::rpc::SeriesList* ReadOperation::unsafe_arena_release_list() {
-  if (has_list()) {
+inline const ::vqro::rpc::SeriesHandles& ReadOperation::_internal_handles() const {
+  return _internal_has_handles()
+      ? *_impl_.selector_.handles_
+      : reinterpret_cast< ::vqro::rpc::SeriesHandles&>(::vqro::rpc::_SeriesHandles_default_instance_);
+}
+inline const ::vqro::rpc::SeriesHandles& ReadOperation::handles() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.handles)
+  return _internal_handles();
+}
+inline ::vqro::rpc::SeriesHandles* ReadOperation::unsafe_arena_release_handles() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:vqro.rpc.ReadOperation.handles)
+  if (_internal_has_handles()) {
     clear_has_selector();
-    ::vqro::rpc::SeriesList* temp = selector_.list_;
-    selector_.list_ = NULL;
+    ::vqro::rpc::SeriesHandles* temp = _impl_.selector_.handles_;
+    _impl_.selector_.handles_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline void ReadOperation::set_allocated_list(::vqro::rpc::SeriesList* list) {
+inline void ReadOperation::unsafe_arena_set_allocated_handles(::vqro::rpc::SeriesHandles* handles) {
   clear_selector();
-  if (list) {
-    if (GetArenaNoVirtual() != NULL &&
-        ::google::protobuf::Arena::GetArena(list) == NULL) {
-      GetArenaNoVirtual()->Own(list);
-    } else if (GetArenaNoVirtual() !=
-               ::google::protobuf::Arena::GetArena(list)) {
-      ::vqro::rpc::SeriesList* new_list = 
-          ::google::protobuf::Arena::CreateMessage< ::vqro::rpc::SeriesList >(
-          GetArenaNoVirtual());
-      new_list->CopyFrom(*list);
-      list = new_list;
-    }
-    set_has_list();
-    selector_.list_ = list;
+  if (handles) {
+    set_has_handles();
+    _impl_.selector_.handles_ = handles;
   }
-  // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadOperation.list)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.handles)
 }
-inline void ReadOperation::unsafe_arena_set_allocated_list(::vqro::rpc::SeriesList* list) {
-  clear_selector();
-  if (list) {
-    set_has_list();
-    selector_.list_ = list;
+inline ::vqro::rpc::SeriesHandles* ReadOperation::_internal_mutable_handles() {
+  if (!_internal_has_handles()) {
+    clear_selector();
+    set_has_handles();
+    _impl_.selector_.handles_ = CreateMaybeMessage< ::vqro::rpc::SeriesHandles >(GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadOperation.list)
+  return _impl_.selector_.handles_;
+}
+inline ::vqro::rpc::SeriesHandles* ReadOperation::mutable_handles() {
+  ::vqro::rpc::SeriesHandles* _msg = _internal_mutable_handles();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadOperation.handles)
+  return _msg;
 }
 
-// optional int64 start_time = 3;
+// int64 start_time = 3;
 inline void ReadOperation::clear_start_time() {
-  start_time_ = GOOGLE_LONGLONG(0);
+  _impl_.start_time_ = int64_t{0};
+}
+inline int64_t ReadOperation::_internal_start_time() const {
+  return _impl_.start_time_;
 }
-inline ::google::protobuf::int64 ReadOperation::start_time() const {
+inline int64_t ReadOperation::start_time() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.start_time)
-  return start_time_;
+  return _internal_start_time();
 }
-inline void ReadOperation::set_start_time(::google::protobuf::int64 value) {
+inline void ReadOperation::_internal_set_start_time(int64_t value) {
   
-  start_time_ = value;
+  _impl_.start_time_ = value;
+}
+inline void ReadOperation::set_start_time(int64_t value) {
+  _internal_set_start_time(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.start_time)
 }
 
-// optional int64 end_time = 4;
+// int64 end_time = 4;
 inline void ReadOperation::clear_end_time() {
-  end_time_ = GOOGLE_LONGLONG(0);
+  _impl_.end_time_ = int64_t{0};
+}
+inline int64_t ReadOperation::_internal_end_time() const {
+  return _impl_.end_time_;
 }
-inline ::google::protobuf::int64 ReadOperation::end_time() const {
+inline int64_t ReadOperation::end_time() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.end_time)
-  return end_time_;
+  return _internal_end_time();
 }
-inline void ReadOperation::set_end_time(::google::protobuf::int64 value) {
+inline void ReadOperation::_internal_set_end_time(int64_t value) {
   
-  end_time_ = value;
+  _impl_.end_time_ = value;
+}
+inline void ReadOperation::set_end_time(int64_t value) {
+  _internal_set_end_time(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.end_time)
 }
 
-// optional int64 datapoint_limit = 5;
+// int64 datapoint_limit = 5;
 inline void ReadOperation::clear_datapoint_limit() {
-  datapoint_limit_ = GOOGLE_LONGLONG(0);
+  _impl_.datapoint_limit_ = int64_t{0};
+}
+inline int64_t ReadOperation::_internal_datapoint_limit() const {
+  return _impl_.datapoint_limit_;
 }
-inline ::google::protobuf::int64 ReadOperation::datapoint_limit() const {
+inline int64_t ReadOperation::datapoint_limit() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.datapoint_limit)
-  return datapoint_limit_;
+  return _internal_datapoint_limit();
 }
-inline void ReadOperation::set_datapoint_limit(::google::protobuf::int64 value) {
+inline void ReadOperation::_internal_set_datapoint_limit(int64_t value) {
   
-  datapoint_limit_ = value;
+  _impl_.datapoint_limit_ = value;
+}
+inline void ReadOperation::set_datapoint_limit(int64_t value) {
+  _internal_set_datapoint_limit(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.datapoint_limit)
 }
 
-// optional bool prefer_latest = 6;
+// bool prefer_latest = 6;
 inline void ReadOperation::clear_prefer_latest() {
-  prefer_latest_ = false;
+  _impl_.prefer_latest_ = false;
+}
+inline bool ReadOperation::_internal_prefer_latest() const {
+  return _impl_.prefer_latest_;
 }
 inline bool ReadOperation::prefer_latest() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.prefer_latest)
-  return prefer_latest_;
+  return _internal_prefer_latest();
 }
-inline void ReadOperation::set_prefer_latest(bool value) {
+inline void ReadOperation::_internal_set_prefer_latest(bool value) {
   
-  prefer_latest_ = value;
+  _impl_.prefer_latest_ = value;
+}
+inline void ReadOperation::set_prefer_latest(bool value) {
+  _internal_set_prefer_latest(value);
   // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.prefer_latest)
 }
 
+// int64 step = 8;
+inline void ReadOperation::clear_step() {
+  _impl_.step_ = int64_t{0};
+}
+inline int64_t ReadOperation::_internal_step() const {
+  return _impl_.step_;
+}
+inline int64_t ReadOperation::step() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.step)
+  return _internal_step();
+}
+inline void ReadOperation::_internal_set_step(int64_t value) {
+  
+  _impl_.step_ = value;
+}
+inline void ReadOperation::set_step(int64_t value) {
+  _internal_set_step(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.step)
+}
+
+// .vqro.rpc.ReadOperation.Aggregate aggregate = 9;
+inline void ReadOperation::clear_aggregate() {
+  _impl_.aggregate_ = 0;
+}
+inline ::vqro::rpc::ReadOperation_Aggregate ReadOperation::_internal_aggregate() const {
+  return static_cast< ::vqro::rpc::ReadOperation_Aggregate >(_impl_.aggregate_);
+}
+inline ::vqro::rpc::ReadOperation_Aggregate ReadOperation::aggregate() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ReadOperation.aggregate)
+  return _internal_aggregate();
+}
+inline void ReadOperation::_internal_set_aggregate(::vqro::rpc::ReadOperation_Aggregate value) {
+  
+  _impl_.aggregate_ = value;
+}
+inline void ReadOperation::set_aggregate(::vqro::rpc::ReadOperation_Aggregate value) {
+  _internal_set_aggregate(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.ReadOperation.aggregate)
+}
+
 inline bool ReadOperation::has_selector() const {
   return selector_case() != SELECTOR_NOT_SET;
 }
 inline void ReadOperation::clear_has_selector() {
-  _oneof_case_[0] = SELECTOR_NOT_SET;
+  _impl_._oneof_case_[0] = SELECTOR_NOT_SET;
 }
 inline ReadOperation::SelectorCase ReadOperation::selector_case() const {
-  return ReadOperation::SelectorCase(_oneof_case_[0]);
+  return ReadOperation::SelectorCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // SeriesList
 
 // repeated .vqro.rpc.Series series = 1;
+inline int SeriesList::_internal_series_size() const {
+  return _impl_.series_.size();
+}
 inline int SeriesList::series_size() const {
-  return series_.size();
+  return _internal_series_size();
+}
+inline ::vqro::rpc::Series* SeriesList::mutable_series(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesList.series)
+  return _impl_.series_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >*
+SeriesList::mutable_series() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesList.series)
+  return &_impl_.series_;
 }
-inline void SeriesList::clear_series() {
-  series_.Clear();
+inline const ::vqro::rpc::Series& SeriesList::_internal_series(int index) const {
+  return _impl_.series_.Get(index);
 }
 inline const ::vqro::rpc::Series& SeriesList::series(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.SeriesList.series)
-  return series_.Get(index);
+  return _internal_series(index);
 }
-inline ::vqro::rpc::Series* SeriesList::mutable_series(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.SeriesList.series)
-  return series_.Mutable(index);
+inline ::vqro::rpc::Series* SeriesList::_internal_add_series() {
+  return _impl_.series_.Add();
 }
 inline ::vqro::rpc::Series* SeriesList::add_series() {
+  ::vqro::rpc::Series* _add = _internal_add_series();
   // @@protoc_insertion_point(field_add:vqro.rpc.SeriesList.series)
-  return series_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Series >&
 SeriesList::series() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.SeriesList.series)
-  return series_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Series >*
-SeriesList::mutable_series() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.SeriesList.series)
-  return &series_;
+  return _impl_.series_;
 }
 
 // -------------------------------------------------------------------
 
 // ReadResult
 
-// optional .vqro.rpc.Series series = 1;
+// .vqro.rpc.Series series = 1;
+inline bool ReadResult::_internal_has_series() const {
+  return this != internal_default_instance() && _impl_.series_ != nullptr;
+}
 inline bool ReadResult::has_series() const {
-  return !_is_default_instance_ && series_ != NULL;
+  return _internal_has_series();
 }
-inline void ReadResult::clear_series() {
-  if (series_ != NULL) delete series_;
-  series_ = NULL;
+inline const ::vqro::rpc::Series& ReadResult::_internal_series() const {
+  const ::vqro::rpc::Series* p = _impl_.series_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::Series&>(
+      ::vqro::rpc::_Series_default_instance_);
 }
 inline const ::vqro::rpc::Series& ReadResult::series() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.series)
-  return series_ != NULL ? *series_ : *default_instance_->series_;
+  return _internal_series();
 }
-inline ::vqro::rpc::Series* ReadResult::mutable_series() {
-  
-  if (series_ == NULL) {
-    _slow_mutable_series();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.series)
-  return series_;
+inline void ReadResult::unsafe_arena_set_allocated_series(
+    ::vqro::rpc::Series* series) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.series_);
+  }
+  _impl_.series_ = series;
+  if (series) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadResult.series)
 }
 inline ::vqro::rpc::Series* ReadResult::release_series() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_series();
-  } else {
-    ::vqro::rpc::Series* temp = series_;
-    series_ = NULL;
-    return temp;
+  ::vqro::rpc::Series* temp = _impl_.series_;
+  _impl_.series_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void ReadResult::set_allocated_series(::vqro::rpc::Series* series) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete series_;
+inline ::vqro::rpc::Series* ReadResult::unsafe_arena_release_series() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ReadResult.series)
+  
+  ::vqro::rpc::Series* temp = _impl_.series_;
+  _impl_.series_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::Series* ReadResult::_internal_mutable_series() {
+  
+  if (_impl_.series_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::Series>(GetArenaForAllocation());
+    _impl_.series_ = p;
   }
-  if (series != NULL) {
-    _slow_set_allocated_series(message_arena, &series);
+  return _impl_.series_;
+}
+inline ::vqro::rpc::Series* ReadResult::mutable_series() {
+  ::vqro::rpc::Series* _msg = _internal_mutable_series();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.series)
+  return _msg;
+}
+inline void ReadResult::set_allocated_series(::vqro::rpc::Series* series) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.series_);
   }
-  series_ = series;
   if (series) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(series));
+    if (message_arena != submessage_arena) {
+      series = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, series, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.series_ = series;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadResult.series)
 }
 
 // repeated .vqro.rpc.Datapoint datapoints = 2;
+inline int ReadResult::_internal_datapoints_size() const {
+  return _impl_.datapoints_.size();
+}
 inline int ReadResult::datapoints_size() const {
-  return datapoints_.size();
+  return _internal_datapoints_size();
 }
-inline void ReadResult::clear_datapoints() {
-  datapoints_.Clear();
+inline ::vqro::rpc::Datapoint* ReadResult::mutable_datapoints(int index) {
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.datapoints)
+  return _impl_.datapoints_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >*
+ReadResult::mutable_datapoints() {
+  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.ReadResult.datapoints)
+  return &_impl_.datapoints_;
+}
+inline const ::vqro::rpc::Datapoint& ReadResult::_internal_datapoints(int index) const {
+  return _impl_.datapoints_.Get(index);
 }
 inline const ::vqro::rpc::Datapoint& ReadResult::datapoints(int index) const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Get(index);
+  return _internal_datapoints(index);
 }
-inline ::vqro::rpc::Datapoint* ReadResult::mutable_datapoints(int index) {
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Mutable(index);
+inline ::vqro::rpc::Datapoint* ReadResult::_internal_add_datapoints() {
+  return _impl_.datapoints_.Add();
 }
 inline ::vqro::rpc::Datapoint* ReadResult::add_datapoints() {
+  ::vqro::rpc::Datapoint* _add = _internal_add_datapoints();
   // @@protoc_insertion_point(field_add:vqro.rpc.ReadResult.datapoints)
-  return datapoints_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::vqro::rpc::Datapoint >&
 ReadResult::datapoints() const {
   // @@protoc_insertion_point(field_list:vqro.rpc.ReadResult.datapoints)
-  return datapoints_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::vqro::rpc::Datapoint >*
-ReadResult::mutable_datapoints() {
-  // @@protoc_insertion_point(field_mutable_list:vqro.rpc.ReadResult.datapoints)
-  return &datapoints_;
+  return _impl_.datapoints_;
 }
 
-// optional .vqro.rpc.StatusMessage status = 3;
+// .vqro.rpc.StatusMessage status = 3;
+inline bool ReadResult::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
+}
 inline bool ReadResult::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+  return _internal_has_status();
 }
-inline void ReadResult::clear_status() {
-  if (status_ != NULL) delete status_;
-  status_ = NULL;
+inline const ::vqro::rpc::StatusMessage& ReadResult::_internal_status() const {
+  const ::vqro::rpc::StatusMessage* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::vqro::rpc::StatusMessage&>(
+      ::vqro::rpc::_StatusMessage_default_instance_);
 }
 inline const ::vqro::rpc::StatusMessage& ReadResult::status() const {
   // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+  return _internal_status();
 }
-inline ::vqro::rpc::StatusMessage* ReadResult::mutable_status() {
-  
-  if (status_ == NULL) {
-    _slow_mutable_status();  }
-  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.status)
-  return status_;
+inline void ReadResult::unsafe_arena_set_allocated_status(
+    ::vqro::rpc::StatusMessage* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:vqro.rpc.ReadResult.status)
 }
 inline ::vqro::rpc::StatusMessage* ReadResult::release_status() {
   
-  if (GetArenaNoVirtual() != NULL) {
-    return _slow_release_status();
-  } else {
-    ::vqro::rpc::StatusMessage* temp = status_;
-    status_ = NULL;
-    return temp;
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void ReadResult::set_allocated_status(::vqro::rpc::StatusMessage* status) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete status_;
+inline ::vqro::rpc::StatusMessage* ReadResult::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:vqro.rpc.ReadResult.status)
+  
+  ::vqro::rpc::StatusMessage* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
+}
+inline ::vqro::rpc::StatusMessage* ReadResult::_internal_mutable_status() {
+  
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::vqro::rpc::StatusMessage>(GetArenaForAllocation());
+    _impl_.status_ = p;
   }
-  if (status != NULL) {
-    _slow_set_allocated_status(message_arena, &status);
+  return _impl_.status_;
+}
+inline ::vqro::rpc::StatusMessage* ReadResult::mutable_status() {
+  ::vqro::rpc::StatusMessage* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:vqro.rpc.ReadResult.status)
+  return _msg;
+}
+inline void ReadResult::set_allocated_status(::vqro::rpc::StatusMessage* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
   }
-  status_ = status;
   if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(status));
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
+  _impl_.status_ = status;
   // @@protoc_insertion_point(field_set_allocated:vqro.rpc.ReadResult.status)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// fixed64 series_handle = 4;
+inline void ReadResult::clear_series_handle() {
+  _impl_.series_handle_ = uint64_t{0u};
+}
+inline uint64_t ReadResult::_internal_series_handle() const {
+  return _impl_.series_handle_;
+}
+inline uint64_t ReadResult::series_handle() const {
+  // @@protoc_insertion_point(field_get:vqro.rpc.ReadResult.series_handle)
+  return _internal_series_handle();
+}
+inline void ReadResult::_internal_set_series_handle(uint64_t value) {
+  
+  _impl_.series_handle_ = value;
+}
+inline void ReadResult::set_series_handle(uint64_t value) {
+  _internal_set_series_handle(value);
+  // @@protoc_insertion_point(field_set:vqro.rpc.ReadResult.series_handle)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace rpc
 }  // namespace vqro
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::vqro::rpc::ReadOperation_Aggregate> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::vqro::rpc::ReadOperation_Aggregate>() {
+  return ::vqro::rpc::ReadOperation_Aggregate_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_storage_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_storage_2eproto
@@ -7,6 +7,7 @@
 #include "vqro/rpc/core.pb.h"
 #include "vqro/rpc/storage.grpc.pb.h"
 #include "vqro/db/db.h"
+#include "vqro/db/write_stream.h"
 
 using grpc::ServerContext;
 using grpc::ServerReader;
@@ -18,8 +19,11 @@ using grpc::StatusCode;
 using vqro::rpc::VaqueroStorage;
 using vqro::rpc::StatusMessage;
 using vqro::rpc::WriteOperation;
+using vqro::rpc::WriteBatch;
 using vqro::rpc::ReadOperation;
 using vqro::rpc::ReadResult;
+using vqro::rpc::SeriesList;
+using vqro::rpc::SeriesHandles;
 using vqro::rpc::SearchSeriesResults;
 using vqro::db::Database;
 
@@ -38,27 +42,145 @@ class VaqueroStorageServiceImpl final : public VaqueroStorage::Service {
 
   Status WriteDatapoints(ServerContext* context,
                          ServerReaderWriter<StatusMessage,WriteOperation>* stream) override {
-    WriteOperation op;
     int written = 0;
 
     LOG(INFO) << "WriteDatapoints() called";
-    while (stream->Read(&op)) {
-      LOG(INFO) << "Writing " << to_string(op.datapoints_size()) << " datapoints";
+    if (FLAGS_async_writes) {
+      vqro::db::WriteStream write_stream(db, FLAGS_write_stream_window);
+      WriteOperation* op = write_stream.NextOperation();
+      std::unique_ptr<vqro::db::WriteBackpressure> refused;
+      std::unique_ptr<vqro::db::StaleSeriesHandle> stale;
+
+      // An op that failed on its worker fails the whole stream, so we stop
+      // reading as soon as one has rather than apply the rest of it.
+      while (!refused && !stale && !write_stream.Failed() &&
+             stream->Read(op)) {
+        VLOG(1) << "Writing " << to_string(op->datapoints_size()) << " datapoints";
+        int num_datapoints = op->datapoints_size();
+        try {
+          write_stream.Write(op);  // Takes op back, even if it throws
+          written += num_datapoints;
+        } catch (vqro::db::StaleSeriesHandle& err) {
+          stale.reset(new vqro::db::StaleSeriesHandle(err));
+        } catch (vqro::db::WriteBackpressure& err) {
+          refused.reset(new vqro::db::WriteBackpressure(err));
+        } catch (vqro::db::DatabaseError& err) {  // ie. InvalidSeriesProto
+          WriteFailed(err);
+        }
+        op = write_stream.NextOperation();
+      }
+
+      // Returns the error of an op that failed on a worker, or a failed log.
       try {
-        db->Write(op);
-        written += op.datapoints_size();
-      } catch (vqro::db::InvalidSeriesProto& err) {
-        LOG(WARNING) << "Write failure: " << err.message;
-        StatusMessage sm;
-        sm.set_text(err.message);
-        sm.set_error(true);
-        //stream->Write(sm); //TODO fix this with newer grpc
+        write_stream.WaitDurable();
+      } catch (std::exception& err) {
+        LOG(ERROR) << "WriteDatapoints failed: " << err.what();
+        return Status(StatusCode::INTERNAL, err.what());
+      }
+
+      if (refused)
+        return GoAway(stream, *refused);
+      if (stale)
+        return StaleHandle(*stale);
+    } else {
+      WriteOperation op;
+      while (stream->Read(&op)) {
+        VLOG(1) << "Writing " << to_string(op.datapoints_size()) << " datapoints";
+        try {
+          db->Write(op);
+          written += op.datapoints_size();
+        } catch (vqro::db::StaleSeriesHandle& err) {
+          return StaleHandle(err);
+        } catch (vqro::db::WriteBackpressure& err) {
+          return GoAway(stream, err);
+        } catch (vqro::db::DatabaseError& err) {  // ie. InvalidSeriesProto
+          WriteFailed(err);
+        } catch (IOError& err) {
+          LOG(ERROR) << "WriteDatapoints failed: " << err.message;
+          return Status(StatusCode::INTERNAL, err.message);
+        }
       }
     }
     LOG(INFO) << "Wrote " << written << " datapoints.";
     return Status::OK;
   }
 
+  Status WriteBatches(ServerContext* context,
+                      ServerReaderWriter<StatusMessage,WriteBatch>* stream) override {
+    WriteBatch batch;
+    int batches = 0;
+    int written = 0;
+
+    LOG(INFO) << "WriteBatches() called";
+    while (stream->Read(&batch)) {
+      VLOG(1) << "Writing batch of " << batch.columns_size() << " series";
+      try {
+        db->Write(batch);
+        batches++;
+        for (const auto& columns : batch.columns())
+          written += columns.timestamps_size();
+      } catch (vqro::db::StaleSeriesHandle& err) {
+        return StaleHandle(err);
+      } catch (vqro::db::WriteBackpressure& err) {
+        return GoAway(stream, err);
+      } catch (vqro::db::DatabaseError& err) {  // ie. InvalidSeriesProto
+        WriteFailed(err);
+      } catch (IOError& err) {
+        LOG(ERROR) << "WriteBatches failed: " << err.message;
+        return Status(StatusCode::INTERNAL, err.message);
+      }
+    }
+    LOG(INFO) << "Wrote " << written << " datapoints in " << batches
+              << " batches.";
+    return Status::OK;
+  }
+
+  void WriteFailed(const vqro::db::DatabaseError& err) {
+    LOG(WARNING) << "Write failure: " << err.message;
+    StatusMessage sm;
+    sm.set_text(err.message);
+    sm.set_error(true);
+    //stream->Write(sm); //TODO fix this with newer grpc
+  }
+
+  // Tells the client to stop writing and come back after a while. Every
+  // message read before the refused one has been applied and is durable.
+  template <typename Stream>
+  Status GoAway(Stream* stream, const vqro::db::WriteBackpressure& err) {
+    LOG(WARNING) << "WriteDatapoints refused: " << err.message;
+    StatusMessage sm;
+    sm.set_text(err.message);
+    sm.set_error(true);
+    sm.set_go_away(true);
+    sm.set_retry_after_ms(err.retry_after_ms);
+    stream->Write(sm);
+    return Status(StatusCode::RESOURCE_EXHAUSTED, err.message);
+  }
+
+  // Ends a stream that used a stale series handle. The client must resolve
+  // its series again before retrying.
+  Status StaleHandle(const vqro::db::StaleSeriesHandle& err) {
+    LOG(WARNING) << "Refusing stale series handle: " << err.message;
+    return Status(StatusCode::FAILED_PRECONDITION, err.message);
+  }
+
+  Status ResolveSeries(ServerContext* context,
+                       const SeriesList* list,
+                       SeriesHandles* handles) override {
+    for (const auto& series : list->series()) {
+      try {
+        handles->add_handles(db->ResolveSeries(series));
+      } catch (vqro::db::InvalidSeriesProto& err) {
+        return Status(StatusCode::INVALID_ARGUMENT, err.message);
+      } catch (vqro::db::DatabaseError& err) {
+        LOG(ERROR) << "ResolveSeries failed: " << err.message;
+        return Status(StatusCode::INTERNAL, err.message);
+      }
+    }
+    VLOG(1) << "Resolved " << handles->handles_size() << " series handles";
+    return Status::OK;
+  }
+
   Status ReadDatapoints(ServerContext* context,
                         const ReadOperation* read_op,
                         ServerWriter<ReadResult>* writer) override {
@@ -69,21 +191,27 @@ class VaqueroStorageServiceImpl final : public VaqueroStorage::Service {
 
     LOG(INFO) << "ReadDatapoints() called";
 
-    // First we search for matching series, which are handled by this outer lambda.
+    // The proto's aggregates are declared in the same order as the db's.
+    vqro::db::Aggregate aggregate = vqro::db::Aggregate::AVG;
+    if (ReadOperation::Aggregate_IsValid(read_op->aggregate()))
+      aggregate = static_cast<vqro::db::Aggregate>(read_op->aggregate());
+
+    // We Read() each series, streaming back results with this lambda.
+    auto respond = [&] (vqro::db::Datapoint* db_points, size_t num_points) {
+      read_result.clear_datapoints();
+      for (unsigned int i = 0; i < num_points; i++) {
+        proto_point = read_result.add_datapoints();
+        proto_point->set_timestamp(db_points[i].timestamp);
+        proto_point->set_duration(db_points[i].duration);
+        proto_point->set_value(db_points[i].value);
+      }
+      datapoints_read += num_points;
+      // Lastly, write a ReadResult back to the client
+      writer->Write(read_result);
+    };
+
+    // Series found by search or listed by labels are handled by this lambda.
     auto read_series = [&] (SearchSeriesResults& search_results) {
-      // Then we Read() each series, streaming back results with this inner lambda.
-      auto respond = [&] (vqro::db::Datapoint* db_points, size_t num_points) {
-        read_result.clear_datapoints();
-        for (unsigned int i = 0; i < num_points; i++) {
-          proto_point = read_result.add_datapoints();
-          proto_point->set_timestamp(db_points[i].timestamp);
-          proto_point->set_duration(db_points[i].duration);
-          proto_point->set_value(db_points[i].value);
-        }
-        datapoints_read += num_points;
-        // Lastly, write a ReadResult back to the client
-        writer->Write(read_result);
-      };
       // Read() each series that matched the query
       for (auto series : search_results.matches()) {
         matched_series++;
@@ -95,7 +223,9 @@ class VaqueroStorageServiceImpl final : public VaqueroStorage::Service {
                  read_op->end_time(),
                  read_op->datapoint_limit(),
                  read_op->prefer_latest(),
-                 respond);
+                 respond,
+                 read_op->step(),
+                 aggregate);
       }
     }; // read_series
 
@@ -119,6 +249,29 @@ class VaqueroStorageServiceImpl final : public VaqueroStorage::Service {
         }
         break;
 
+      case ReadOperation::kHandles:
+        for (auto handle : read_op->handles().handles()) {
+          matched_series++;
+          read_result.Clear();
+          read_result.set_series_handle(handle);
+          try {
+            db->Read(handle,
+                     read_op->start_time(),
+                     read_op->end_time(),
+                     read_op->datapoint_limit(),
+                     read_op->prefer_latest(),
+                     respond,
+                     read_op->step(),
+                     aggregate);
+          } catch (vqro::db::StaleSeriesHandle& err) {
+            return StaleHandle(err);
+          } catch (vqro::db::DatabaseError& err) {
+            LOG(ERROR) << "ReadDatapoints failed: " << err.message;
+            return Status(StatusCode::INTERNAL, err.message);
+          }
+        }
+        break;
+
       case ReadOperation::SELECTOR_NOT_SET:
         LOG(ERROR) << "Invalid ReadOperation, selector not set.";
         return Status(StatusCode::INVALID_ARGUMENT, "Selector not specified");
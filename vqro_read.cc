@@ -440,7 +440,7 @@ int DoSearchLabels(int argc, char** argv) {
   // RPC time
   grpc_init();
   auto channel = grpc::CreateChannel(GetServerAddress(),
-                                     grpc::InsecureCredentials());
+                                     grpc::InsecureChannelCredentials());
   VaqueroClient client(channel);
 
   if (FLAGS_debug)
@@ -473,7 +473,7 @@ int DoSearchSeries(int argc, char** argv) {
   // RPC time
   grpc_init();
   auto channel = grpc::CreateChannel(GetServerAddress(),
-                                     grpc::InsecureCredentials());
+                                     grpc::InsecureChannelCredentials());
   VaqueroClient client(channel);
 
   if (FLAGS_debug)
@@ -547,7 +547,7 @@ int DoReadDatapoints(ReadOperation read_op) {
   // RPC time
   grpc_init();
   auto channel = grpc::CreateChannel(GetServerAddress(),
-                                     grpc::InsecureCredentials());
+                                     grpc::InsecureChannelCredentials());
   VaqueroClient client(channel);
 
   if (FLAGS_debug)
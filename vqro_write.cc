@@ -119,7 +119,7 @@ int main(int argc, char** argv) {
   grpc_init();
   signal(SIGINT, handle_sigint);
   auto channel = grpc::CreateChannel(server_address,
-                                     grpc::InsecureCredentials());
+                                     grpc::InsecureChannelCredentials());
   VaqueroClient client(channel);
 
   WriteOperation write_op;